@@ -0,0 +1,269 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+/**
+ * @file MLI Graph Runtime API
+ *
+ * @brief This header includes declarations for loading and sequential execution of serialized graphs of kernels
+ */
+
+#ifndef _MLI_GRAPH_API_H_
+#define _MLI_GRAPH_API_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mli_job_api.h"
+#include "mli_types.h"
+
+/**
+ * @brief Get size of serialized graph
+ *
+ * @detail This function returns the size in bytes of the memory required by mli_graph_pack
+ * to serialize a graph with the given number of tensors and operations.
+ *
+ * @param num_tensors  [I] Number of tensors.
+ * @param num_ops      [I] Number of operations.
+ *
+ * @return Size of serialized graph in bytes
+ */
+uint32_t mli_graph_get_size(uint32_t num_tensors, uint32_t num_ops);
+
+/**
+ * @brief Serialize graph
+ *
+ * @detail This function writes the header, tensor descriptors and operation descriptors of the graph
+ * into memory (for instance, by a host tool producing a model file next to the weights blob).
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param tensors      [I] Array of tensor descriptors (for more info see @ref mli_graph_tensor_desc).
+ * @param num_tensors  [I] Number of tensors.
+ * @param ops          [I] Array of operation descriptors in order of execution.
+ * @param num_ops      [I] Number of operations.
+ * @param data         [O] Memory for serialized graph (aligned to 4 bytes at least).
+ * @param data_size    [I] Size of memory for serialized graph in bytes (see mli_graph_get_size).
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_pack(const mli_graph_tensor_desc *tensors, uint32_t num_tensors,
+        const mli_graph_op_desc *ops, uint32_t num_ops, void *data, uint32_t data_size);
+
+/**
+ * @brief Open serialized graph
+ *
+ * @detail This function validates the header and all descriptors of the serialized graph and returns
+ * the size of state memory required to load it. The graph is treated as untrusted data: these checks
+ * are done regardless of the library debug mode.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param data        [I] Pointer to serialized graph (aligned to 4 bytes at least).
+ * @param data_size   [I] Size of memory holding serialized graph in bytes.
+ * @param state_size  [O] Size of state memory for mli_graph_load in bytes.
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_open(const void *data, uint32_t data_size, uint32_t *state_size);
+
+/**
+ * @brief Load graph
+ *
+ * @detail This function fills the graph structure from the serialized graph opened by mli_graph_open.
+ * Constant tensors point into the weights blob opened by mli_hlp_blob_open; nothing is copied.
+ * Connectivity of operations is validated and element types and shapes of operation outputs are derived
+ * regardless of the library debug mode. Serialized graph and blob must be kept until the graph is used.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param graph       [O] Graph structure.
+ * @param data        [I] Serialized graph opened by mli_graph_open.
+ * @param blob        [I] Weights blob with constant tensors. Can be NULL if the graph has no constant tensors.
+ * @param state       [I] State memory (aligned to 8 bytes). Arrays of the graph are located here.
+ * @param state_size  [I] Size of state memory in bytes (see mli_graph_open).
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_load(mli_graph *graph, const void *data, const void *blob, void *state, uint32_t state_size);
+
+/**
+ * @brief Apply pass to graph
+ *
+ * @detail This function calls the pass for a loaded graph and validates the graph again after it.
+ * Passes can be applied only before mli_graph_plan.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param graph  [I/O] Graph loaded by mli_graph_load.
+ * @param pass   [I] Pass function.
+ * @param ctx    [I] Context passed to the pass function.
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_apply_pass(mli_graph *graph, mli_graph_pass_fn pass, void *ctx);
+
+/**
+ * @brief Fuse ReLU into preceding operations
+ *
+ * @detail This pass folds each ReLU operation into the preceding convolution, depthwise convolution or
+ * fully connected operation if the latter has no activation and its output is consumed only by the ReLU.
+ * The ReLU operation is replaced by MLI_GRAPH_OP_NOP. To be used with mli_graph_apply_pass.
+ *
+ * @param graph  [I/O] Graph loaded by mli_graph_load.
+ * @param ctx    [I] Unused.
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_fuse_relu(mli_graph *graph, void *ctx);
+
+/**
+ * @brief Plan memory of graph
+ *
+ * @detail This function places all non-constant tensors of the graph in a single arena using the static
+ * memory planner (see mli_hlp_mem_plan). Lifetimes of tensors are derived from the operations using them.
+ * Inputs of the graph are alive from the first operation and outputs until the last one.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param graph       [I/O] Graph loaded by mli_graph_load.
+ * @param arena_size  [O] Size of arena required by the graph in bytes.
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_plan(mli_graph *graph, uint32_t *arena_size);
+
+/**
+ * @brief Bind graph to arena
+ *
+ * @detail This function sets data of non-constant tensors of the planned graph to the arena, selects
+ * the kernel of each operation by element types of its tensors and validates each operation once.
+ * Convolutions are prepared (see mli_krn_conv2d_hwcn_fx16_prepare), so their parameters are not derived again
+ * by mli_graph_run.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param graph       [I/O] Graph planned by mli_graph_plan.
+ * @param arena       [I] Arena memory (aligned to MLI_GRAPH_ALIGNMENT bytes).
+ * @param arena_size  [I] Size of arena memory in bytes.
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_bind(mli_graph *graph, int8_t *arena, uint32_t arena_size);
+
+/**
+ * @brief Run graph
+ *
+ * @detail This function executes operations of the bound graph in order and calls execution hooks
+ * around each of them. Inputs of the graph must be filled before the call. Execution stops at the first
+ * operation which returns an error.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param graph  [I] Graph bound by mli_graph_bind.
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_run(const mli_graph *graph);
+
+/**
+ * @brief Prepare asynchronous run of graph
+ *
+ * @detail This function sets up the job handle to execute mli_graph_run for the bound graph.
+ * The job is started by mli_job_start, and its status is the status of mli_graph_run. Execution hooks
+ * are called from the thread executing the job. Inputs must not be changed, and outputs must not
+ * be read, until the job is done.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param graph  [I] Graph bound by mli_graph_bind.
+ * @param h      [O] Pointer to a job handle.
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_prepare_job(const mli_graph *graph, mli_job_handle_t *h);
+
+/**
+ * @brief Find tensor of graph by name
+ *
+ * @detail This function looks up the first tensor of the loaded graph with the given name
+ * (for instance, to fill inputs or read outputs of the graph).
+ *
+ * @param graph   [I] Graph loaded by mli_graph_load.
+ * @param name    [I] Name of the tensor.
+ * @param tensor  [O] Pointer to the tensor of the graph.
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_find_tensor(const mli_graph *graph, const char *name, mli_tensor **tensor);
+
+/**
+ * @brief Tune graph
+ *
+ * @detail This function times implementation variants of each operation of the bound graph on the current
+ * machine and keeps the fastest one. Operations are tuned in order of execution, and each variant is run
+ * once before being timed. Variants are planned and direct kernel calls and, for convolutions and pooling,
+ * number of threads from 1 to max_threads of the config. Variants not supported by an operation are skipped.
+ * Execution hooks are not called. Inputs of the graph must be filled before the call; contents of all
+ * non-constant tensors are undefined after it. The selected variants can be stored by mli_graph_tuning_pack.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param graph  [I/O] Graph bound by mli_graph_bind.
+ * @param cfg    [I] Tuning config.
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_tune(mli_graph *graph, const mli_graph_tune_cfg *cfg);
+
+/**
+ * @brief Get size of tuning records
+ *
+ * @detail This function returns size in bytes of tuning records of a graph with the given number of operations.
+ *
+ * @param num_ops  [I] Number of operations of the graph.
+ *
+ * @return Size of tuning records in bytes
+ */
+uint32_t mli_graph_tuning_get_size(uint32_t num_ops);
+
+/**
+ * @brief Pack tuning records
+ *
+ * @detail This function serializes implementation variants of operations of the loaded graph
+ * (for instance, selected by mli_graph_tune) into a versioned binary form (MLI_GRAPH_TUNING_VERSION).
+ *
+ * @param graph      [I] Graph loaded by mli_graph_load.
+ * @param data       [O] Memory for tuning records (aligned to 4 bytes).
+ * @param data_size  [I] Size of memory in bytes (see mli_graph_tuning_get_size).
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_tuning_pack(const mli_graph *graph, void *data, uint32_t data_size);
+
+/**
+ * @brief Set tuning records
+ *
+ * @detail This function validates tuning records produced by mli_graph_tuning_pack for the same graph
+ * and applies them to operations of the loaded graph. Records are validated regardless of debug mode.
+ * Variants take effect at the next mli_graph_bind.
+ *
+ * @param graph      [I/O] Graph loaded by mli_graph_load.
+ * @param data       [I] Tuning records (aligned to 4 bytes).
+ * @param data_size  [I] Size of tuning records in bytes.
+ *
+ * @return MLI status code
+ */
+mli_status mli_graph_set_tuning(mli_graph *graph, const void *data, uint32_t data_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //_MLI_GRAPH_API_H_
@@ -172,6 +172,27 @@ mli_status mli_hlp_point_to_subtensor(const mli_tensor *in, const mli_point_to_s
  */
 mli_status mli_hlp_create_subtensor(const mli_tensor *in, const mli_sub_tensor_cfg *cfg, mli_tensor *out);
 
+/**
+ * @brief Create views for concatenation or split of a tensor
+ *
+ * @detail This function splits the full tensor along the axis into tensors_num views of the given sizes.
+ * Views point into the data of the full tensor and keep its memory strides, so they are generally not contiguous.
+ * A kernel writing its output to a view puts results directly to the concatenated tensor (no concatenation copy),
+ * and views of an input tensor can be consumed by kernels as split parts without copying. Per-axis quantization
+ * parameters are sliced together with the data if the tensor is quantized along the axis.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param full    [I] Full (concatenated) tensor
+ * @param cfg     [I] Configuration structure (for more info see @ref mli_concat_cfg)
+ * @param sizes   [I] Sizes of views along the axis (tensors_num values). The sum must be equal to the full tensor size.
+ * @param views   [O] Array of tensors_num output tensors. Results will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_hlp_concat_views(const mli_tensor *full, const mli_concat_cfg *cfg, const uint32_t *sizes,
+        mli_tensor *views);
+
 int32_t mli_hlp_tensor_scale_shift(const mli_tensor *in, const uint32_t scale_idx);
 
 int32_t mli_hlp_tensor_scale(const mli_tensor *in, const uint32_t scale_idx);
@@ -219,6 +240,151 @@ uint8_t mli_hlp_accu_guard_bits_fx16_fx8();
  */
 void mli_hlp_set_tensor_mem_strides(mli_tensor* in);
 
+/**
+ * @brief Static memory planner
+ *
+ * @detail This function places buffers with known lifetimes into memory banks so that buffers which are alive
+ * at the same time don't overlap. Buffers are placed in order of decreasing size, each one at the lowest offset
+ * of its bank which is free during its lifetime and satisfies its alignment. The function fills offset (and size,
+ * if not provided) of each buffer and returns the peak size of each bank, which is the memory required for the bank.
+ * Planning can be done once (for instance, at build time) and reused for any number of inferences.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param bufs       [I/O] Array of buffer descriptors (for more info see @ref mli_mem_plan_buf).
+ * @param num_bufs   [I] Number of buffers.
+ * @param peak_size  [O] Array of num_banks peak sizes of banks in bytes.
+ * @param num_banks  [I] Number of memory banks.
+ *
+ * @return MLI status code
+ */
+mli_status mli_hlp_mem_plan(mli_mem_plan_buf *bufs, uint32_t num_bufs, uint32_t *peak_size, uint32_t num_banks);
+
+/**
+ * @brief Bind tensors to planned memory
+ *
+ * @detail This function sets data pointer and capacity of tensor of each buffer according to the plan
+ * derived by mli_hlp_mem_plan. Buffers without tensor are skipped. Memory of each bank must be at least
+ * of the peak size and aligned to the largest alignment of buffers placed in it.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param bufs       [I] Array of buffer descriptors processed by mli_hlp_mem_plan.
+ * @param num_bufs   [I] Number of buffers.
+ * @param bank_mem   [I] Array of pointers to memory of each bank.
+ * @param num_banks  [I] Number of memory banks.
+ *
+ * @return MLI status code
+ */
+mli_status mli_hlp_mem_plan_bind(const mli_mem_plan_buf *bufs, uint32_t num_bufs, int8_t *const *bank_mem,
+        uint32_t num_banks);
+
+/**
+ * @brief Get size of weights blob
+ *
+ * @detail This function returns the size in bytes of the blob required to pack the tensors
+ * by mli_hlp_blob_pack including header, tensor descriptors, data, quantization parameters and alignment padding.
+ *
+ * @param tensors      [I] Array of pointers to tensors to pack.
+ * @param num_tensors  [I] Number of tensors.
+ *
+ * @return Size of blob in bytes
+ */
+uint32_t mli_hlp_blob_get_size(const mli_tensor *const *tensors, uint32_t num_tensors);
+
+/**
+ * @brief Pack tensors into weights blob
+ *
+ * @detail This function serializes tensors together with their names, shapes, memory strides and element
+ * parameters (including per-axis quantization parameters) into the blob. Data of each tensor is copied
+ * as it is laid out in memory (taking memory strides into account) and is placed at an offset aligned
+ * to MLI_BLOB_ALIGNMENT. The function is intended for host tools which prepare model files.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param tensors      [I] Array of pointers to tensors to pack.
+ * @param names        [I] Array of null terminated names of tensors (shorter than MLI_BLOB_NAME_LEN).
+ * @param num_tensors  [I] Number of tensors.
+ * @param blob         [O] Memory for the blob (aligned to 4 bytes at least).
+ * @param blob_size    [I] Size of memory for the blob in bytes (see mli_hlp_blob_get_size).
+ *
+ * @return MLI status code
+ */
+mli_status mli_hlp_blob_pack(const mli_tensor *const *tensors, const char *const *names, uint32_t num_tensors,
+        void *blob, uint32_t blob_size);
+
+/**
+ * @brief Open weights blob
+ *
+ * @detail This function validates the header and all tensor descriptors of the blob (for instance, a file mapped
+ * into memory by the application) and returns the number of tensors in it. The blob is treated as untrusted data:
+ * these checks are done regardless of the library debug mode. Only blobs successfully opened by this function
+ * can be passed to mli_hlp_blob_get_tensor and mli_hlp_blob_find_tensor.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param blob         [I] Pointer to the blob (aligned to 4 bytes at least).
+ * @param blob_size    [I] Size of memory holding the blob in bytes.
+ * @param num_tensors  [O] Number of tensors in the blob.
+ *
+ * @return MLI status code
+ */
+mli_status mli_hlp_blob_open(const void *blob, uint32_t blob_size, uint32_t *num_tensors);
+
+/**
+ * @brief Get tensor from weights blob
+ *
+ * @detail This function fills the tensor structure according to the descriptor of tensor idx of the blob.
+ * Data and quantization parameters of the tensor point into the blob memory; nothing is copied.
+ * Tensors retrieved from a read-only mapping must not be used as outputs.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param blob  [I] Pointer to the blob opened by mli_hlp_blob_open.
+ * @param idx   [I] Index of the tensor in the blob.
+ * @param out   [O] Tensor structure to fill.
+ *
+ * @return MLI status code
+ */
+mli_status mli_hlp_blob_get_tensor(const void *blob, uint32_t idx, mli_tensor *out);
+
+/**
+ * @brief Find tensor in weights blob by name
+ *
+ * @detail This function looks up the first tensor with the given name in the blob and fills
+ * the tensor structure like mli_hlp_blob_get_tensor.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param blob  [I] Pointer to the blob opened by mli_hlp_blob_open.
+ * @param name  [I] Null terminated name of the tensor.
+ * @param out   [O] Tensor structure to fill.
+ *
+ * @return MLI status code. MLI_STATUS_ARGUMENT_ERROR if there is no tensor with such name.
+ */
+mli_status mli_hlp_blob_find_tensor(const void *blob, const char *name, mli_tensor *out);
+
+/**
+ * @brief Set number of threads used by kernels
+ *
+ * @detail This function sets the number of threads which execute convolution, depthwise convolution and pooling
+ * kernels. The output area of a kernel is split into rectangles of rows which are processed by the calling thread
+ * and workers of a persistent thread pool. Results are identical to single-threaded execution. Threaded execution
+ * is available only for host builds with MLI_HOST_THREADS option. The default is 1 (no threads are created).
+ *
+ * @param num_threads  [I] Number of threads including the calling one. Must be in range [1, MLI_MAX_NUM_THREADS].
+ *
+ * @return MLI status code. MLI_STATUS_NOT_SUPPORTED if num_threads > 1 and the library is built without threads.
+ */
+mli_status mli_hlp_set_num_threads(uint32_t num_threads);
+
+/**
+ * @brief Get number of threads used by kernels
+ *
+ * @return Number of threads set by mli_hlp_set_num_threads
+ */
+uint32_t mli_hlp_get_num_threads(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,135 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+/**
+ * @file MLI Job API
+ *
+ * @brief This header includes declarations for asynchronous execution of kernels and graphs
+ */
+
+#ifndef _MLI_JOB_API_H_
+#define _MLI_JOB_API_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include "mli_types.h"
+
+typedef enum _mli_job_state {
+    MLI_JOB_STATE_INVALID = 0,
+    MLI_JOB_STATE_PREPARED,
+    MLI_JOB_STATE_RUNNING,
+    MLI_JOB_STATE_DONE
+} mli_job_state;
+
+/**
+ * @brief Job function
+ *
+ * Function executed by a job (for instance, a wrapper of a kernel call with arguments kept in ctx).
+ * Returns MLI status code.
+ */
+typedef mli_status (*mli_job_fn)(void *ctx);
+
+/**
+ * @brief Job handle
+ *
+ * Fields are for internal use. A handle is set up by mli_job_prepare() and must stay valid
+ * until the job is done.
+ */
+typedef struct _mli_job_handle_t {
+    mli_job_fn fn;
+    void *ctx;
+    void (*cb)(int32_t);
+    int32_t cookie;
+    mli_job_state state;
+    mli_status status;                  /**< Status returned by the job function once the job is done.*/
+    struct _mli_job_handle_t *next;     /**< Next job in the queue of workers.*/
+} mli_job_handle_t;
+
+/**
+ * @brief Prepare a job
+ *
+ * @detail This function sets up the handle to execute fn(ctx). Arguments referenced by ctx
+ * must stay valid until the job is done. The function must not be called for a job which
+ * is started but not done yet.
+ *
+ * @param h    [O] pointer to a job handle.
+ * @param fn   [I] job function.
+ * @param ctx  [I] this parameter will be passed to the job function.
+ *
+ * @return MLI status code
+ */
+mli_status
+mli_job_prepare(mli_job_handle_t* h, mli_job_fn fn, void* ctx);
+
+/**
+ * @brief Register a callback for a job
+ *
+ * @detail This function will register a callback function that will be called after the job
+ * function has returned, in the same way as mli_mov_registercallback() does it for data transfers.
+ * The callback needs to be registered before the job is started.
+ *
+ * @param h       [I] pointer to a handle prepared by mli_job_prepare().
+ * @param cb      [I] function pointer to a callback.
+ * @param cookie  [I] this parameter will be passed to the callback function.
+ *
+ * @return MLI status code
+ */
+mli_status
+mli_job_registercallback(mli_job_handle_t* h, void (*cb)(int32_t), int32_t cookie);
+
+/**
+ * @brief Start a job
+ *
+ * @detail This function queues the prepared job to the worker threads and returns immediately.
+ * Jobs are executed in order of start by up to MLI_MAX_NUM_JOB_WORKERS workers. If the library
+ * is built without threads, the job is executed in the calling thread before the function returns.
+ * A done job can be started again.
+ *
+ * @param h    [I] pointer to a handle prepared by mli_job_prepare().
+ *
+ * @return MLI status code
+ */
+mli_status
+mli_job_start(mli_job_handle_t* h);
+
+/**
+ * @brief Polling function to detect if job has completed
+ *
+ * @detail This function will return true when the job (including its callback) is completed,
+ * and false in all other cases
+ *
+ * @param h    [I] pointer to a job handle.
+ *
+ * @return bool job is done.
+ */
+bool
+mli_job_isdone(mli_job_handle_t* h);
+
+/**
+ * @brief Synchronize to job complete
+ *
+ * @detail This function will block and return after the job has completed. Jobs must not wait
+ * for other jobs, as all workers might be busy.
+ *
+ * @param h    [I] pointer to a started job handle.
+ *
+ * @return MLI status code returned by the job function
+ */
+mli_status
+mli_job_wait(mli_job_handle_t* h);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //_MLI_JOB_API_H_
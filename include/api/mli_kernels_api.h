@@ -236,6 +236,160 @@ mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k5x5(
         const mli_conv2d_cfg* cfg,
         mli_tensor* out);
 
+/**
+ * @brief 2D Convolution Prepare
+ *
+ * @detail These functions check parameters of a general or depthwise 2D convolution and derive everything that
+ * depends only on parameters, shapes and element parameters of tensors (adjusted padding, ReLU limits and
+ * quantization parameters) once. The result is stored in the plan and reused by mli_krn_conv2d_run.
+ * It is useful for small layers where per-call preparation is comparable to the computation itself.
+ * Weights and bias are referenced by the plan and must be kept unchanged while the plan is used.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param in      [I] Input feature map tensor (3-dimensional tensor). Data is used only for checks
+ * @param weights [I] Convolution filters weights tensor (4-dimensional tensor)
+ * @param bias    [I] Convolution filters biases tensor (1-dimensional tensor)
+ * @param cfg     [I] Convolution parameters structure (for more info see @ref mli_conv2d_cfg)
+ * @param out     [I/O] Output feature map tensor. Data is used only for checks; el_type is filled like by kernel
+ * @param plan    [O] Plan structure. Derived state of the kernel will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_conv2d_hwcn_fx16_prepare(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_conv2d_cfg * cfg, mli_tensor * out, mli_conv2d_plan * plan);
+mli_status mli_krn_conv2d_hwcn_fx16_fx8_fx8_prepare(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_conv2d_cfg * cfg, mli_tensor * out, mli_conv2d_plan * plan);
+mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepare(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_conv2d_cfg * cfg, mli_tensor * out, mli_conv2d_plan * plan);
+mli_status mli_krn_depthwise_conv2d_hwcn_fx16_prepare(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_conv2d_cfg * cfg, mli_tensor * out, mli_conv2d_plan * plan);
+mli_status mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_prepare(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_conv2d_cfg * cfg, mli_tensor * out, mli_conv2d_plan * plan);
+mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepare(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_conv2d_cfg * cfg, mli_tensor * out, mli_conv2d_plan * plan);
+
+/**
+ * @brief 2D Convolution Planned Run
+ *
+ * @detail This kernel performs the convolution described by the plan (see mli_krn_conv2d_hwcn_fx16_prepare)
+ * for new input and output data. Data must be laid out as described by the input and output tensors passed
+ * to the prepare function (same shape and memory strides) and satisfy the same memory placement requirements.
+ * Results are bit-exact with the results of the corresponding non-planned function.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param plan     [I] Plan structure filled by one of prepare functions
+ * @param in_data  [I] Pointer to input feature map data
+ * @param out_data [O] Pointer to output feature map data. Result will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_conv2d_run(const mli_conv2d_plan * plan, const void * in_data, void * out_data);
+
+/**
+ * @brief 2D Convolution with Epilogue
+ *
+ * @detail These kernels perform a general or depthwise 2D convolution and apply the element-wise operation
+ * described by the epilogue configuration to each output value before it is stored (activation by LUT,
+ * parametric RELU or addition of a tensor). The result is bit-exact with the convolution followed by the
+ * related kernel, but the output is written only once. The epilogue operation works with element parameters
+ * of the output tensor. Sigmoid and tanh epilogues update element parameters of the output as the related kernels do.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param in       [I] Input feature map tensor (3-dimensional tensor)
+ * @param weights  [I] Convolution filters weights tensor (4-dimensional tensor)
+ * @param bias     [I] Convolution filters biases tensor (1-dimensional tensor)
+ * @param cfg      [I] Convolution parameters structure (for more info see @ref mli_conv2d_cfg)
+ * @param epilogue [I] Epilogue configuration structure (for more info see @ref mli_epilogue_cfg)
+ * @param out      [O] Output feature map tensor. Result is stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_conv2d_hwcn_fx16_epilogue(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_conv2d_cfg * cfg, const mli_epilogue_cfg * epilogue, mli_tensor * out);
+mli_status mli_krn_conv2d_hwcn_fx16_fx8_fx8_epilogue(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_conv2d_cfg * cfg, const mli_epilogue_cfg * epilogue, mli_tensor * out);
+mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_epilogue(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_conv2d_cfg * cfg, const mli_epilogue_cfg * epilogue, mli_tensor * out);
+mli_status mli_krn_depthwise_conv2d_hwcn_fx16_epilogue(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_conv2d_cfg * cfg, const mli_epilogue_cfg * epilogue, mli_tensor * out);
+mli_status mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_epilogue(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_conv2d_cfg * cfg, const mli_epilogue_cfg * epilogue, mli_tensor * out);
+mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_epilogue(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_conv2d_cfg * cfg, const mli_epilogue_cfg * epilogue, mli_tensor * out);
+
+/**
+ * @brief Epilogue Prepare
+ *
+ * @detail This function converts slope coefficients of sa8 parametric relu epilogue into the table of per-channel
+ * requantization parameters. It must be called before sa8 kernels with epilogue if the slope holds a value per channel,
+ * and again if element parameters of the output or slope values are changed. User must provide memory for the table
+ * in slope_params and slope_params_capacity fields of the epilogue structure before the call.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param out      [I] Output tensor of kernels with the epilogue. Only element parameters are used by prepare function
+ * @param epilogue [I/O] Epilogue configuration structure of MLI_EPILOGUE_PRELU type. Table of parameters is filled here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_epilogue_sa8_prepare(const mli_tensor * out, mli_epilogue_cfg * epilogue);
+
+/**
+ * @brief Depthwise Separable 2D Convolution
+ *
+ * @detail This kernel implements a depthwise separable convolution block: depthwise 2D convolution followed by
+ * pointwise (1x1) 2D convolution. Output rows of the depthwise part are computed into a rolling buffer
+ * (cfg->scratch_data) and immediately consumed by the pointwise part, so the intermediate feature map is never
+ * stored in full. The result is bit-exact with mli_krn_depthwise_conv2d_hwcn_<type> followed by
+ * mli_krn_conv2d_hwcn_<type> where the intermediate tensor has element parameters cfg->mid_el_params.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param in         [I] Input feature map tensor (3-dimensional tensor)
+ * @param dw_weights [I] Depthwise convolution filters weights tensor (4-dimensional tensor)
+ * @param dw_bias    [I] Depthwise convolution filters biases tensor (1-dimensional tensor)
+ * @param pw_weights [I] Pointwise convolution filters weights tensor (4-dimensional tensor of 1x1 filters)
+ * @param pw_bias    [I] Pointwise convolution filters biases tensor (1-dimensional tensor)
+ * @param cfg        [I] Configuration structure (for more info see @ref mli_dw_separable_conv2d_cfg)
+ * @param out        [O] Output feature map tensor. Result is stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_depthwise_separable_conv2d_hwcn_fx16(const mli_tensor * in,
+        const mli_tensor * dw_weights, const mli_tensor * dw_bias,
+        const mli_tensor * pw_weights, const mli_tensor * pw_bias,
+        const mli_dw_separable_conv2d_cfg * cfg, mli_tensor * out);
+mli_status mli_krn_depthwise_separable_conv2d_hwcn_fx16_fx8_fx8(const mli_tensor * in,
+        const mli_tensor * dw_weights, const mli_tensor * dw_bias,
+        const mli_tensor * pw_weights, const mli_tensor * pw_bias,
+        const mli_dw_separable_conv2d_cfg * cfg, mli_tensor * out);
+mli_status mli_krn_depthwise_separable_conv2d_hwcn_sa8_sa8_sa32(const mli_tensor * in,
+        const mli_tensor * dw_weights, const mli_tensor * dw_bias,
+        const mli_tensor * pw_weights, const mli_tensor * pw_bias,
+        const mli_dw_separable_conv2d_cfg * cfg, mli_tensor * out);
+
+/**
+ * @brief Get size of scratch data required by Depthwise Separable 2D Convolution
+ *
+ * @detail This function returns the minimal capacity (in bytes) of cfg->scratch_data required by
+ * mli_krn_depthwise_separable_conv2d_hwcn_<type> kernels: a single row of the intermediate feature map.
+ * If a larger scratch is provided, the kernel processes as many rows per step as fit into it.
+ * The function doesn't access tensor data.
+ *
+ * @param in         [I] Input feature map tensor (3-dimensional tensor)
+ * @param dw_weights [I] Depthwise convolution filters weights tensor (4-dimensional tensor)
+ * @param out        [I] Output feature map tensor (3-dimensional tensor)
+ *
+ * @return Size of scratch data in bytes
+ */
+int32_t mli_krn_depthwise_separable_conv2d_get_scratch_size(
+        const mli_tensor * in,
+        const mli_tensor * dw_weights,
+        const mli_tensor * out);
+
 /**
  * @brief 2D Group convolution
  *
@@ -597,6 +751,33 @@ mli_status mli_krn_fully_connected_sa8_sa8_sa32_ext_bias(
         const mli_fully_connected_cfg * cfg,
         mli_tensor * out);
 
+/**
+ * @brief Fully Connected with Epilogue
+ *
+ * @detail These kernels implement fully connected layer and apply the element-wise operation described
+ * by the epilogue configuration to each output value before it is stored (see mli_krn_conv2d_hwcn_fx16_epilogue).
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param in       [I] Input feature tensor (of any shape)
+ * @param weights  [I] Weights tensor (2-dimensional tensor)
+ * @param bias     [I] Biases tensor (1-dimensional tensor)
+ * @param cfg      [I] Fully connected parameters structure (for more info see @ref mli_fully_connected_cfg)
+ * @param epilogue [I] Epilogue configuration structure (for more info see @ref mli_epilogue_cfg)
+ * @param out      [O] Output feature tensor. Result will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_fully_connected_fx16_epilogue(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_fully_connected_cfg * cfg, const mli_epilogue_cfg * epilogue,
+        mli_tensor * out);
+mli_status mli_krn_fully_connected_fx16_fx8_fx8_epilogue(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_fully_connected_cfg * cfg, const mli_epilogue_cfg * epilogue,
+        mli_tensor * out);
+mli_status mli_krn_fully_connected_sa8_sa8_sa32_epilogue(const mli_tensor * in, const mli_tensor * weights,
+        const mli_tensor * bias, const mli_fully_connected_cfg * cfg, const mli_epilogue_cfg * epilogue,
+        mli_tensor * out);
+
 /**
  * @brief Long Short Term Memory (LSTM) Cell
  *
@@ -659,6 +840,24 @@ mli_status mli_krn_lstm_cell_sa8_sa8_sa32(
         mli_tensor * cell,
         mli_tensor * out);
 
+/**
+ * @brief Get size of scratch data required by LSTM Cell
+ *
+ * @detail This function returns the capacity (in bytes) of cfg->scratch_data required by mli_krn_lstm_cell_<type>
+ * kernels for the given input and weights. Scratch keeps results of the dense part for all gates of a single step.
+ * The function doesn't access tensor data.
+ *
+ * @param in          [I] Input feature tensor. Must be a tensor of shape (sequence_length, input_elements).
+ * @param weights_in  [I] Input Weights tensor (set of 4 matrixes in the [i,g,f,o] order: 3-dimensional tensor)
+ * @param cfg         [I] RNN Configuration structure (for more info see @ref mli_rnn_cell_cfg)
+ *
+ * @return Size of scratch data in bytes
+ */
+int32_t mli_krn_lstm_cell_get_scratch_size(
+        const mli_tensor * in,
+        const mli_tensor * weights_in,
+        const mli_rnn_cell_cfg * cfg);
+
 /**
  * @brief Gated Recurrent Unit (GRU) Cell
  *
@@ -717,6 +916,24 @@ mli_status mli_krn_gru_cell_sa8_sa8_sa32(
         const mli_rnn_cell_cfg * cfg,
         mli_tensor * out);
 
+/**
+ * @brief Get size of scratch data required by GRU Cell
+ *
+ * @detail This function returns the capacity (in bytes) of cfg->scratch_data required by mli_krn_gru_cell_<type>
+ * kernels for the given input and weights. Scratch keeps results of the dense part for all gates of a single step.
+ * The function doesn't access tensor data.
+ *
+ * @param in          [I] Input feature tensor. Must be a tensor of shape (sequence_length, input_elements).
+ * @param weights_in  [I] Input Weights tensor (set of 3 matrixes in the [z,r,n] order: 3-dimensional tensor)
+ * @param cfg         [I] RNN Configuration structure (for more info see @ref mli_rnn_cell_cfg)
+ *
+ * @return Size of scratch data in bytes
+ */
+int32_t mli_krn_gru_cell_get_scratch_size(
+        const mli_tensor * in,
+        const mli_tensor * weights_in,
+        const mli_rnn_cell_cfg * cfg);
+
 /**
  * @brief Basic Recurrent Neural Network Cell
  *
@@ -860,6 +1077,51 @@ mli_status mli_krn_prelu_sa8(
         const mli_prelu_cfg *cfg,
         mli_tensor * out);
 
+/**
+ * @brief Parametric Relu Plan
+ *
+ * @detail This function converts slope coefficients tensor of sa8 parametric relu into the table of per-channel
+ * requantization parameters and stores it into the plan structure together with other parameters derived from
+ * element parameters of tensors. mli_krn_prelu_sa8_run then applies parametric relu to tensors with the same
+ * element parameters without deriving them again. User must provide memory for the table
+ * in slope_params and slope_params_capacity fields of the plan structure before the call.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param in          [I] Input feature tensor (of any shape)
+ * @param slope_coeff [I] Slope coefficients tensor
+ * @param cfg         [I] Prelu Configuration structure (for more info see @ref mli_prelu_cfg)
+ * @param out         [I] Output feature tensor. Only element parameters are used by prepare function
+ * @param plan        [I/O] Plan structure. Requantization parameters will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_prelu_sa8_prepare(
+        const mli_tensor *in,
+        const mli_tensor *slope_coeff,
+        const mli_prelu_cfg *cfg,
+        const mli_tensor *out,
+        mli_prelu_plan *plan);
+
+/**
+ * @brief Parametric Relu Planned Run
+ *
+ * @detail This kernel applies parametric relu described by the plan (see mli_krn_prelu_sa8_prepare).
+ * Element parameters of tensors must be the same as of tensors passed to the prepare function.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param plan    [I] Plan structure filled by prepare function
+ * @param in      [I] Input feature tensor (of any shape)
+ * @param out     [O] Output feature tensor. Result will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_prelu_sa8_run(
+        const mli_prelu_plan *plan,
+        const mli_tensor *in,
+        mli_tensor *out);
+
 /**
  * @brief Sigmoid Activation function
  *
@@ -939,6 +1201,55 @@ mli_status mli_krn_l2_normalize_sa8(const mli_tensor *in, const mli_tensor *epsi
 mli_status mli_krn_l2_normalize_create_lut(mli_lut *lut);
 int32_t mli_krn_l2_normalize_get_lut_size();
 
+/**
+ * @brief Layer Normalization
+ *
+ * @detail This kernel normalizes each row of the input tensor along its innermost dimension to zero mean and
+ * unit variance, scales the result with gamma and shifts it with beta coefficients per element of the row:
+ * out = (in - mean(in)) / sqrt(var(in) + epsilon) * gamma + beta, where epsilon = 1e-5
+ * Statistics and output are computed in two passes over the row. Inverse square root is calculated using
+ * the lookup table created by mli_krn_layer_norm_create_lut. Kernel outputs a tensor of the same shape as
+ * input tensor. Element parameters of output tensor are provided by user.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param in      [I] Input feature tensor (of any shape)
+ * @param gamma   [I] Scale coefficients tensor (1D tensor with size of the innermost dimension of input)
+ * @param beta    [I] Shift coefficients tensor (1D tensor with size of the innermost dimension of input)
+ * @param lut     [I] Lookup table of inverse square root function
+ * @param out     [O] Output feature tensor. Result will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_layer_norm_fx16(const mli_tensor *in, const mli_tensor *gamma, const mli_tensor *beta,
+                                   const mli_lut *lut, mli_tensor *out);
+mli_status mli_krn_layer_norm_sa8(const mli_tensor *in, const mli_tensor *gamma, const mli_tensor *beta,
+                                  const mli_lut *lut, mli_tensor *out);
+
+/**
+ * @brief Root Mean Square Normalization
+ *
+ * @detail This kernel normalizes each row of the input tensor along its innermost dimension by root mean square
+ * value of the row and scales the result with gamma coefficients per element of the row:
+ * out = in / sqrt(mean(in^2) + epsilon) * gamma, where epsilon = 1e-5
+ * Uses the same lookup table as mli_krn_layer_norm_* kernels.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param in      [I] Input feature tensor (of any shape)
+ * @param gamma   [I] Scale coefficients tensor (1D tensor with size of the innermost dimension of input)
+ * @param lut     [I] Lookup table of inverse square root function
+ * @param out     [O] Output feature tensor. Result will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_rms_norm_fx16(const mli_tensor *in, const mli_tensor *gamma,
+                                 const mli_lut *lut, mli_tensor *out);
+mli_status mli_krn_rms_norm_sa8(const mli_tensor *in, const mli_tensor *gamma,
+                                const mli_lut *lut, mli_tensor *out);
+mli_status mli_krn_layer_norm_create_lut(mli_lut *lut);
+int32_t mli_krn_layer_norm_get_lut_size();
+
 
 
 //================================================
@@ -950,7 +1261,9 @@ int32_t mli_krn_l2_normalize_get_lut_size();
  * @brief Elementwise Addition
  *
  * @detail This kernel adds two tensors of the same shape element-wise  and stores results to the output tensor 
- * saving the shape of inputs. It supports simple broadcasting of single value (scalar tensor) on general tensor.
+ * saving the shape of inputs. It supports broadcasting of single value (scalar tensor) on general tensor and NumPy-style
+ * broadcasting of tensors with compatible shapes (each pair of dimensions aligned on the innermost one
+ * is equal or one of them is 1).
  * One of the operands can be a scalar (Note, special tensor-scalar form can be used. see mli_tensor description in 
  * MLI Documentation)
  *
@@ -970,7 +1283,9 @@ mli_status mli_krn_eltwise_add_sa8(const mli_tensor * in1, const mli_tensor * in
  * @brief Elementwise Subtraction
  *
  * @detail This kernel subtracts element-wise, the second input tensor (subtrahend) from the first input tensor (minuend) 
- * and stores results to the output tensor It supports simple broadcasting of single value (scalar tensor) on general tensor.
+ * and stores results to the output tensor It supports broadcasting of single value (scalar tensor) on general tensor and NumPy-style
+ * broadcasting of tensors with compatible shapes (each pair of dimensions aligned on the innermost one
+ * is equal or one of them is 1).
  * One of the operands can be a scalar (Note, special tensor-scalar form can be used. see mli_tensor description in MLI Documentation)
  *
  * For more info on primitive see MLI Documentation
@@ -988,7 +1303,9 @@ mli_status mli_krn_eltwise_sub_sa8(const mli_tensor * in1, const mli_tensor * in
 /* @brief Elementwise Multiplication
  *
  * @detail This kernel multiplies two tensors of the same shape element-wise and store results to the output tensor 
- * saving the shape of inputs. It supports simple broadcasting of single value (scalar tensor) on general tensor.
+ * saving the shape of inputs. It supports broadcasting of single value (scalar tensor) on general tensor and NumPy-style
+ * broadcasting of tensors with compatible shapes (each pair of dimensions aligned on the innermost one
+ * is equal or one of them is 1).
  * One of the operands can be a scalar (Note, special tensor-scalar form can be used. see mli_tensor description in MLI Documentation)
  *
  * For more info on primitive see MLI Documentation
@@ -1006,7 +1323,9 @@ mli_status mli_krn_eltwise_mul_sa8(const mli_tensor * in1, const mli_tensor * in
 /* @brief Elementwise MAX/MIN
  *
  * @detail This kernel finds element-wise maximum / minimum of inputs operands and store results to the output tensor
- * saving the shape of inputs. It supports simple broadcasting of single value (scalar tensor) on general tensor.
+ * saving the shape of inputs. It supports broadcasting of single value (scalar tensor) on general tensor and NumPy-style
+ * broadcasting of tensors with compatible shapes (each pair of dimensions aligned on the innermost one
+ * is equal or one of them is 1).
  * One of the operands can be a scalar (Note, special tensor-scalar form can be used. see mli_tensor description in MLI Documentation)
  *
  * For more info on primitive see MLI Documentation
@@ -1024,6 +1343,70 @@ mli_status mli_krn_eltwise_max_fx8(const mli_tensor * in1, const mli_tensor * in
 mli_status mli_krn_eltwise_max_fx16(const mli_tensor * in1, const mli_tensor * in2, mli_tensor * out);
 mli_status mli_krn_eltwise_max_sa8(const mli_tensor * in1, const mli_tensor * in2, mli_tensor * out);
 
+/* @brief Elementwise Addition/Subtraction Plan
+ *
+ * @detail These functions derive requantization parameters of elementwise addition or subtraction for
+ * sa8 tensors once and store them into the plan structure. mli_krn_eltwise_sa8_run then performs the operation
+ * on tensors with the same element parameters (scale, scale_frac_bits and zero_point) without deriving them again.
+ * It is useful when the same operation is applied many times to tensors with static quantization parameters.
+ * Data and shape of tensors are not used by prepare functions and may differ between calls of run function.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param in1     [I] First input feature tensor (or scalar tensor)
+ * @param in2     [I] Second input feature tensor (or scalar tensor)
+ * @param out     [I] Output feature tensor. Only element parameters are used by prepare function
+ * @param plan    [O] Plan structure. Requantization parameters will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_eltwise_add_sa8_prepare(const mli_tensor * in1, const mli_tensor * in2, const mli_tensor * out,
+        mli_eltwise_plan * plan);
+mli_status mli_krn_eltwise_sub_sa8_prepare(const mli_tensor * in1, const mli_tensor * in2, const mli_tensor * out,
+        mli_eltwise_plan * plan);
+
+/* @brief Elementwise Planned Run
+ *
+ * @detail This kernel performs elementwise operation described by the plan (see mli_krn_eltwise_add_sa8_prepare).
+ * Element parameters of tensors must be the same as of tensors passed to the prepare function.
+ * It supports the same broadcasting modes as the original elementwise functions.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param plan    [I] Plan structure filled by one of prepare functions
+ * @param in1     [I] First input feature tensor (or scalar tensor)
+ * @param in2     [I] Second input feature tensor (or scalar tensor)
+ * @param out     [O] Output feature tensor. Result will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_eltwise_sa8_run(const mli_eltwise_plan * plan, const mli_tensor * in1, const mli_tensor * in2,
+        mli_tensor * out);
+
+/* @brief Elementwise Fused Multiply-Add
+ *
+ * @detail This kernel multiplies two tensors element-wise, adds the third tensor to the product and store results
+ * to the output tensor (out = in1 * in2 + in3). Intermediate result is kept in the wide accumulator and requantized
+ * only once, when it is stored to the output tensor after optional ReLU clipping. It supports broadcasting
+ * of single value (scalar tensor) and NumPy-style broadcasting of all three operands to the common shape.
+ * First or second operand can be a scalar (Note, special tensor-scalar form can be used. see mli_tensor description
+ * in MLI Documentation). Third operand can be a scalar independently of the first two.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param in1     [I] First input feature tensor (or scalar tensor)
+ * @param in2     [I] Second input feature tensor (or scalar tensor)
+ * @param in3     [I] Addend input feature tensor (or scalar tensor)
+ * @param cfg     [I] Configuration structure (for more info see @ref mli_eltwise_fma_cfg)
+ * @param out     [O] Output feature tensor. Result will be stored here
+ *
+ * @return MLI status code
+ */
+mli_status mli_krn_eltwise_fma_fx16(const mli_tensor * in1, const mli_tensor * in2, const mli_tensor * in3,
+        const mli_eltwise_fma_cfg * cfg, mli_tensor * out);
+mli_status mli_krn_eltwise_fma_sa8(const mli_tensor * in1, const mli_tensor * in2, const mli_tensor * in3,
+        const mli_eltwise_fma_cfg * cfg, mli_tensor * out);
+
 
 
 //================================================
@@ -0,0 +1,241 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+/**
+ * @file MLI Library Compile-Time Specialized Kernels API
+ *
+ * @brief This header declares C++ templates over the convolution kernels of MLI Library. Kernel size
+ * of a layer is a template constant: the kernel specialized for it is selected at compile time,
+ * the constant is checked by static assertions and checks of tensors against it are compiled out
+ * in the release debug mode (MLI_DEBUG_MODE == DBG_MODE_RELEASE).
+ *
+ * The header is C++ only and requires C++11.
+ */
+
+#ifndef _MLI_KERNELS_TPL_API_H_
+#define _MLI_KERNELS_TPL_API_H_
+
+#ifndef __cplusplus
+#error "mli_kernels_tpl_api.h requires a C++ compiler"
+#endif
+
+#include "mli_config.h"
+#include "mli_types.h"
+#include "api/mli_helpers_api.h"
+#include "api/mli_kernels_api.h"
+
+namespace mli {
+
+/**
+ * Data format tags. They select the element types of input, weights and bias like the suffix of C functions.
+ */
+namespace fmt {
+struct fx16 {};
+struct fx16_fx8_fx8 {};
+struct sa8_sa8_sa32 {};
+} // namespace fmt
+
+namespace tpl {
+
+/**
+ * Checks of tensors against template constants are done only if the library returns valid status codes.
+ */
+static const bool kCheckParams = (MLI_DEBUG_MODE != DBG_MODE_RELEASE);
+
+// Selection of C function for data format and kernel size.
+// Primary templates call the generic function, specializations call the function specialized for a kernel size.
+//========================================================
+template <typename data_format, unsigned kernel_height, unsigned kernel_width>
+struct conv2d_hwcn_func;
+
+template <typename data_format, unsigned kernel_height, unsigned kernel_width>
+struct depthwise_conv2d_hwcn_func;
+
+#define MLI_TPL_CONV_FUNC(traits, format, kh, kw, func) \
+    template <> struct traits<fmt::format, kh, kw> { \
+        static mli_status run(const mli_tensor *in, const mli_tensor *weights, const mli_tensor *bias, \
+                const mli_conv2d_cfg *cfg, mli_tensor *out) { \
+            return func(in, weights, bias, cfg, out); \
+        } \
+    };
+
+#define MLI_TPL_CONV_GENERIC_FUNC(traits, format, func) \
+    template <unsigned kernel_height, unsigned kernel_width> struct traits<fmt::format, kernel_height, kernel_width> { \
+        static mli_status run(const mli_tensor *in, const mli_tensor *weights, const mli_tensor *bias, \
+                const mli_conv2d_cfg *cfg, mli_tensor *out) { \
+            return func(in, weights, bias, cfg, out); \
+        } \
+    };
+
+// 1x1 functions are specialized for zero padding, so padded layers are passed to the generic function
+#define MLI_TPL_CONV_K1X1_FUNC(traits, format, func, generic_func) \
+    template <> struct traits<fmt::format, 1, 1> { \
+        static mli_status run(const mli_tensor *in, const mli_tensor *weights, const mli_tensor *bias, \
+                const mli_conv2d_cfg *cfg, mli_tensor *out) { \
+            if (cfg->padding_left != 0 || cfg->padding_right != 0 || \
+                    cfg->padding_top != 0 || cfg->padding_bottom != 0) \
+                return generic_func(in, weights, bias, cfg, out); \
+            return func(in, weights, bias, cfg, out); \
+        } \
+    };
+
+MLI_TPL_CONV_GENERIC_FUNC(conv2d_hwcn_func, fx16, mli_krn_conv2d_hwcn_fx16)
+MLI_TPL_CONV_GENERIC_FUNC(conv2d_hwcn_func, fx16_fx8_fx8, mli_krn_conv2d_hwcn_fx16_fx8_fx8)
+MLI_TPL_CONV_GENERIC_FUNC(conv2d_hwcn_func, sa8_sa8_sa32, mli_krn_conv2d_hwcn_sa8_sa8_sa32)
+MLI_TPL_CONV_K1X1_FUNC(conv2d_hwcn_func, fx16, mli_krn_conv2d_hwcn_fx16_k1x1, mli_krn_conv2d_hwcn_fx16)
+MLI_TPL_CONV_K1X1_FUNC(conv2d_hwcn_func, fx16_fx8_fx8, mli_krn_conv2d_hwcn_fx16_fx8_fx8_k1x1,
+        mli_krn_conv2d_hwcn_fx16_fx8_fx8)
+MLI_TPL_CONV_K1X1_FUNC(conv2d_hwcn_func, sa8_sa8_sa32, mli_krn_conv2d_hwcn_sa8_sa8_sa32_k1x1,
+        mli_krn_conv2d_hwcn_sa8_sa8_sa32)
+MLI_TPL_CONV_FUNC(conv2d_hwcn_func, fx16, 3, 3, mli_krn_conv2d_hwcn_fx16_k3x3)
+MLI_TPL_CONV_FUNC(conv2d_hwcn_func, fx16_fx8_fx8, 3, 3, mli_krn_conv2d_hwcn_fx16_fx8_fx8_k3x3)
+MLI_TPL_CONV_FUNC(conv2d_hwcn_func, sa8_sa8_sa32, 3, 3, mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3)
+MLI_TPL_CONV_FUNC(conv2d_hwcn_func, fx16, 5, 5, mli_krn_conv2d_hwcn_fx16_k5x5)
+MLI_TPL_CONV_FUNC(conv2d_hwcn_func, fx16_fx8_fx8, 5, 5, mli_krn_conv2d_hwcn_fx16_fx8_fx8_k5x5)
+MLI_TPL_CONV_FUNC(conv2d_hwcn_func, sa8_sa8_sa32, 5, 5, mli_krn_conv2d_hwcn_sa8_sa8_sa32_k5x5)
+
+MLI_TPL_CONV_GENERIC_FUNC(depthwise_conv2d_hwcn_func, fx16, mli_krn_depthwise_conv2d_hwcn_fx16)
+MLI_TPL_CONV_GENERIC_FUNC(depthwise_conv2d_hwcn_func, fx16_fx8_fx8, mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8)
+MLI_TPL_CONV_GENERIC_FUNC(depthwise_conv2d_hwcn_func, sa8_sa8_sa32, mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32)
+MLI_TPL_CONV_FUNC(depthwise_conv2d_hwcn_func, fx16, 3, 3, mli_krn_depthwise_conv2d_hwcn_fx16_k3x3)
+MLI_TPL_CONV_FUNC(depthwise_conv2d_hwcn_func, fx16_fx8_fx8, 3, 3, mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_k3x3)
+MLI_TPL_CONV_FUNC(depthwise_conv2d_hwcn_func, sa8_sa8_sa32, 3, 3, mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k3x3)
+MLI_TPL_CONV_FUNC(depthwise_conv2d_hwcn_func, fx16, 5, 5, mli_krn_depthwise_conv2d_hwcn_fx16_k5x5)
+MLI_TPL_CONV_FUNC(depthwise_conv2d_hwcn_func, fx16_fx8_fx8, 5, 5, mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_k5x5)
+MLI_TPL_CONV_FUNC(depthwise_conv2d_hwcn_func, sa8_sa8_sa32, 5, 5, mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k5x5)
+
+#undef MLI_TPL_CONV_FUNC
+#undef MLI_TPL_CONV_K1X1_FUNC
+#undef MLI_TPL_CONV_GENERIC_FUNC
+
+// Selection of prepare function for data format (prepare functions select the code for the kernel size)
+//========================================================
+template <typename data_format> struct conv2d_hwcn_prepare_func;
+template <typename data_format> struct depthwise_conv2d_hwcn_prepare_func;
+
+#define MLI_TPL_CONV_PREPARE_FUNC(traits, format, func) \
+    template <> struct traits<fmt::format> { \
+        static mli_status prepare(const mli_tensor *in, const mli_tensor *weights, const mli_tensor *bias, \
+                const mli_conv2d_cfg *cfg, mli_tensor *out, mli_conv2d_plan *plan) { \
+            return func(in, weights, bias, cfg, out, plan); \
+        } \
+    };
+
+MLI_TPL_CONV_PREPARE_FUNC(conv2d_hwcn_prepare_func, fx16, mli_krn_conv2d_hwcn_fx16_prepare)
+MLI_TPL_CONV_PREPARE_FUNC(conv2d_hwcn_prepare_func, fx16_fx8_fx8, mli_krn_conv2d_hwcn_fx16_fx8_fx8_prepare)
+MLI_TPL_CONV_PREPARE_FUNC(conv2d_hwcn_prepare_func, sa8_sa8_sa32, mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepare)
+MLI_TPL_CONV_PREPARE_FUNC(depthwise_conv2d_hwcn_prepare_func, fx16, mli_krn_depthwise_conv2d_hwcn_fx16_prepare)
+MLI_TPL_CONV_PREPARE_FUNC(depthwise_conv2d_hwcn_prepare_func, fx16_fx8_fx8,
+        mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_prepare)
+MLI_TPL_CONV_PREPARE_FUNC(depthwise_conv2d_hwcn_prepare_func, sa8_sa8_sa32,
+        mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepare)
+
+#undef MLI_TPL_CONV_PREPARE_FUNC
+
+// Check of run-time parameters against template constants
+//========================================================
+template <unsigned kernel_height, unsigned kernel_width>
+static inline mli_status check_conv2d(const mli_tensor *weights, const mli_conv2d_cfg *cfg) {
+    if (weights == nullptr) return MLI_STATUS_BAD_TENSOR;
+    if (cfg == nullptr) return MLI_STATUS_BAD_FUNC_CFG;
+    // Kernel height and width dimensions are the same for HWCN and HW1N layouts
+    if (weights->shape[KRNL_H_DIM_HWCN] != kernel_height || weights->shape[KRNL_W_DIM_HWCN] != kernel_width)
+        return MLI_STATUS_SHAPE_MISMATCH;
+    return MLI_STATUS_OK;
+}
+
+} // namespace tpl
+
+/**
+ * @brief 2D Convolution with Compile-Time Parameters
+ *
+ * @detail Performs 2D convolution of HWC input by HWCN weights like mli_krn_conv2d_hwcn_<data_format>.
+ * Kernel size is a template constant; the function specialized for the kernel size
+ * (mli_krn_conv2d_hwcn_<data_format>_k<kernel_height>x<kernel_width>) is used if it exists. The 1x1 function
+ * is used only without padding; padded 1x1 layers are passed to the generic function.
+ * Strides, padding, dilation and ReLU are taken from cfg.
+ *
+ * For more info on primitive see MLI Documentation
+ */
+template <typename data_format, unsigned kernel_height, unsigned kernel_width>
+struct conv2d_hwcn {
+    static_assert(kernel_height > 0 && kernel_width > 0, "Kernel size must be positive");
+
+    static mli_conv2d_cfg cfg(mli_relu_type relu = MLI_RELU_NONE,
+            uint8_t stride_width = 1, uint8_t stride_height = 1,
+            uint8_t padding_left = 0, uint8_t padding_right = 0,
+            uint8_t padding_top = 0, uint8_t padding_bottom = 0) {
+        mli_conv2d_cfg conv_cfg = {{relu, 0, 0}, stride_width, stride_height, padding_left, padding_right,
+                                   padding_top, padding_bottom, 1, 1};
+        return conv_cfg;
+    }
+
+    static mli_status run(const mli_tensor *in, const mli_tensor *weights, const mli_tensor *bias,
+            const mli_conv2d_cfg *cfg, mli_tensor *out) {
+        if (tpl::kCheckParams) {
+            mli_status ret = tpl::check_conv2d<kernel_height, kernel_width>(weights, cfg);
+            if (ret != MLI_STATUS_OK) return ret;
+        }
+        return tpl::conv2d_hwcn_func<data_format, kernel_height, kernel_width>::run(in, weights, bias, cfg, out);
+    }
+
+    static mli_status prepare(const mli_tensor *in, const mli_tensor *weights, const mli_tensor *bias,
+            const mli_conv2d_cfg *cfg, mli_tensor *out, mli_conv2d_plan *plan) {
+        if (tpl::kCheckParams) {
+            mli_status ret = tpl::check_conv2d<kernel_height, kernel_width>(weights, cfg);
+            if (ret != MLI_STATUS_OK) return ret;
+        }
+        return tpl::conv2d_hwcn_prepare_func<data_format>::prepare(in, weights, bias, cfg, out, plan);
+    }
+};
+
+/**
+ * @brief 2D Depthwise Convolution with Compile-Time Parameters
+ *
+ * @detail Performs depthwise 2D convolution of HWC input by HW1N weights like
+ * mli_krn_depthwise_conv2d_hwcn_<data_format>. Kernel size is a template constant;
+ * the function specialized for the kernel size is used if it exists.
+ *
+ * For more info on primitive see MLI Documentation
+ */
+template <typename data_format, unsigned kernel_height, unsigned kernel_width>
+struct depthwise_conv2d_hwcn {
+    static_assert(kernel_height > 0 && kernel_width > 0, "Kernel size must be positive");
+
+    static mli_conv2d_cfg cfg(mli_relu_type relu = MLI_RELU_NONE,
+            uint8_t stride_width = 1, uint8_t stride_height = 1,
+            uint8_t padding_left = 0, uint8_t padding_right = 0,
+            uint8_t padding_top = 0, uint8_t padding_bottom = 0) {
+        return conv2d_hwcn<data_format, kernel_height, kernel_width>::cfg(
+                relu, stride_width, stride_height, padding_left, padding_right, padding_top, padding_bottom);
+    }
+
+    static mli_status run(const mli_tensor *in, const mli_tensor *weights, const mli_tensor *bias,
+            const mli_conv2d_cfg *cfg, mli_tensor *out) {
+        if (tpl::kCheckParams) {
+            mli_status ret = tpl::check_conv2d<kernel_height, kernel_width>(weights, cfg);
+            if (ret != MLI_STATUS_OK) return ret;
+        }
+        return tpl::depthwise_conv2d_hwcn_func<data_format, kernel_height, kernel_width>::run(
+                in, weights, bias, cfg, out);
+    }
+
+    static mli_status prepare(const mli_tensor *in, const mli_tensor *weights, const mli_tensor *bias,
+            const mli_conv2d_cfg *cfg, mli_tensor *out, mli_conv2d_plan *plan) {
+        if (tpl::kCheckParams) {
+            mli_status ret = tpl::check_conv2d<kernel_height, kernel_width>(weights, cfg);
+            if (ret != MLI_STATUS_OK) return ret;
+        }
+        return tpl::depthwise_conv2d_hwcn_prepare_func<data_format>::prepare(in, weights, bias, cfg, out, plan);
+    }
+};
+
+} // namespace mli
+
+#endif //#ifndef _MLI_KERNELS_TPL_API_H_
@@ -33,10 +33,47 @@ typedef enum _mli_mov_state {
     MLI_MOV_STATE_DONE
 } mli_mov_state;
 
+/**
+ * Maximum number of dma channels which can be managed by the mli_mov functions
+ */
+#define MLI_MOV_MAX_DMA_CHAN (16)
+
+typedef enum {
+    MLI_MOV_DMA_CH_NOT_USED = 0,
+    MLI_MOV_DMA_CH_AVAILABLE,
+    MLI_MOV_DMA_CH_IN_USE
+} mli_mov_dma_ch_status_t;
+
+typedef struct {
+    int base_channel;
+    int pool_size;
+    mli_mov_dma_ch_status_t channel_status[MLI_MOV_MAX_DMA_CHAN];
+} mli_mov_dma_pool_t;
+#define MLI_MOV_DMA_POOL_INIT {0, 0}
+
+typedef struct {
+    void (*cb)(int32_t);
+    int32_t cookie;
+} mli_mov_cb_t;
+
+/**
+ * @brief Library context
+ *
+ * Resources used by one inference stream: the pool of dma channels and the callbacks registered
+ * on them. Independent streams (for instance, threads running different models) use separate contexts
+ * with disjoint sets of dma channels. Fields are for internal use, a context is set up by mli_context_init().
+ */
+typedef struct _mli_context {
+    mli_mov_dma_pool_t dma_pool;                     /**< Dma channels available to the context.*/
+    mli_mov_cb_t callbacks[MLI_MOV_MAX_DMA_CHAN];    /**< Callbacks registered per dma channel.*/
+    int32_t lock;                                    /**< Guards the pool against concurrent acquire and release.*/
+} mli_context;
+
 typedef struct _mli_mov_handle_t {
     int dma_ch;
     int num_ch;
     mli_mov_state state;
+    mli_context *ctx;   /**< Context the channels are acquired from. NULL stands for the default context.*/
 } mli_mov_handle_t;
 
 //---------------------------------------------------------------------
@@ -63,6 +100,22 @@ typedef struct _mli_mov_handle_t {
 mli_status
 mli_mov_tensor_sync(const mli_tensor* src, const mli_mov_cfg_t* cfg, mli_tensor* dst);
 
+/** 
+ * @brief Synchronous copy from src tensor to dst tensor using resources of a context
+ *
+ * @detail This function is the same as mli_mov_tensor_sync() but the dma channel is acquired
+ * from the ctx context instead of the default one.
+ *
+ * @param ctx  [I] pointer to a context initialized by mli_context_init().
+ * @param src  [I] pointer to source tensor.
+ * @param dst  [I] pointer to destination tensor.
+ * @param cfg  [I] pointer to config struct
+ *
+ * @return MLI status code
+ */
+mli_status
+mli_mov_tensor_sync_ctx(mli_context* ctx, const mli_tensor* src, const mli_mov_cfg_t* cfg, mli_tensor* dst);
+
 
 //---------------------------------------------------------------------
 // Asynchronous data movement functions
@@ -158,9 +211,79 @@ mli_status
 mli_mov_wait(mli_mov_handle_t* h);
 
 
+//---------------------------------------------------------------------
+// Data movement chains (lists of transfers)
+//---------------------------------------------------------------------
+
+/** 
+ * @brief Get size of memory required for a data movement chain
+ *
+ * @detail This function returns the number of bytes that need to be provided in the transfers field
+ * of mli_mov_chain_t to hold num_transfers pre-computed transfers.
+ *
+ * @param num_transfers [I] number of transfers in the chain.
+ *
+ * @return size of memory in bytes.
+ */
+uint32_t
+mli_mov_chain_get_mem_size(uint32_t num_transfers);
+
+/** 
+ * @brief Prepare a chain of copies
+ *
+ * @detail This function validates all descriptors, fills the destination tensors the same way
+ * mli_mov_prepare() does and stores the pre-computed transfers in the chain memory.
+ * No tensor data is copied. Quantization parameters of per-axis quantized tensors are copied
+ * at this step if the destination provides its own memory for them.
+ * A prepared chain can be started any number of times as long as the addresses and shapes of
+ * the tensors are unchanged. Descriptors are not referenced after this function returns.
+ *
+ * @param chain    [I/O] pointer to chain with memory and capacity initialized.
+ * @param desc     [I] array of transfer descriptors.
+ * @param num_desc [I] number of descriptors in the array.
+ *
+ * @return MLI status code
+ */
+mli_status
+mli_mov_chain_prepare(mli_mov_chain_t* chain, const mli_mov_chain_desc_t* desc, uint32_t num_desc);
+
+/** 
+ * @brief Start a chain of copies
+ *
+ * @detail This function starts all transfers of a prepared chain on one handle. Transfers are executed
+ * back-to-back in the order of descriptors. Completion of the whole chain is reported once through
+ * mli_mov_isdone(), mli_mov_wait() and the callback registered on the handle.
+ * The chain memory must stay valid until the transfer is completed.
+ * The handle needs to be obtained using the mli_mov_acquire_handle() function.
+ *
+ * @param h     [I] pointer to a handle for an available dma channel.
+ * @param chain [I] pointer to a chain prepared by mli_mov_chain_prepare().
+ *
+ * @return MLI status code
+ */
+mli_status
+mli_mov_chain_start(mli_mov_handle_t* h, const mli_mov_chain_t* chain);
+
+
 //---------------------------------------------------------------------
 // functions to set available resources (e.g. dma channels)
 //---------------------------------------------------------------------
+/** 
+ * @brief Initialize a context
+ *
+ * @detail This function initializes the ctx context with an empty pool of dma channels.
+ * Channels assigned to a context which was previously placed at the same address are freed.
+ * Channels are assigned to the context by mli_mov_set_num_dma_ch_ctx(). Functions without a context
+ * parameter use the default context of the library, which doesn't need initialization.
+ * Acquire and release of channels are thread safe for each context, including the default one.
+ *
+ * @param ctx  [O] pointer to a context.
+ *
+ * @return MLI status code
+ */
+mli_status
+mli_context_init(mli_context* ctx);
+
 /** 
  * @brief set dma channels that can be used by mli_mov functions
  *
@@ -168,6 +291,8 @@ mli_mov_wait(mli_mov_handle_t* h);
  * that can be used by the mli_mov functions.
  * These channels should not be used by other functions.
  * the acquire and release functions can be used to obtain channels from this pool
+ * Channels of the previous pool are freed. The call fails if one of the channels is assigned to
+ * another context, or if a channel of the previous pool is still acquired by a handle.
  *
  * @param ch_offset  [I] first dma channel that can by used
  * @param num_ch     [I] number of dma channels that can be used
@@ -177,6 +302,23 @@ mli_mov_wait(mli_mov_handle_t* h);
 mli_status
 mli_mov_set_num_dma_ch(int ch_offset, int num_ch);
 
+/** 
+ * @brief set dma channels that can be used by mli_mov functions of a context
+ *
+ * @detail This function is the same as mli_mov_set_num_dma_ch() but sets the pool of the ctx context.
+ * A dma channel is assigned to one context at most (the default one included), so the channels of
+ * the ctx context must not be in the pool of another context. Set an empty pool (num_ch = 0) or
+ * initialize the context again to free its channels.
+ *
+ * @param ctx        [I/O] pointer to a context initialized by mli_context_init().
+ * @param ch_offset  [I] first dma channel that can by used
+ * @param num_ch     [I] number of dma channels that can be used
+ *
+ * @return MLI status code
+ */
+mli_status
+mli_mov_set_num_dma_ch_ctx(mli_context* ctx, int ch_offset, int num_ch);
+
 /** 
  * @brief Acquire dma channel(s)
  *
@@ -190,6 +332,22 @@ mli_mov_set_num_dma_ch(int ch_offset, int num_ch);
 mli_status
 mli_mov_acquire_handle(int num_ch, mli_mov_handle_t* h);
 
+/** 
+ * @brief Acquire dma channel(s) of a context
+ *
+ * @detail This function is the same as mli_mov_acquire_handle() but obtains channels from the pool
+ * of the ctx context. The handle keeps the context, so all other functions taking the handle
+ * (including the release) use resources of this context.
+ *
+ * @param ctx    [I/O] pointer to a context initialized by mli_context_init().
+ * @param num_ch [I] number of requested dma channels
+ * @param h      [O] pointer a handle that will be filled with the dma channel offset that can be used.
+ *
+ * @return MLI status code
+ */
+mli_status
+mli_mov_acquire_handle_ctx(mli_context* ctx, int num_ch, mli_mov_handle_t* h);
+
 /** 
  * @brief Release dma channle(s)
  *
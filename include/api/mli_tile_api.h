@@ -0,0 +1,110 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+/**
+ * @file MLI Tiled Layer Executor API
+ *
+ * @brief This header includes declarations for tiled and weight streaming execution of layers using fast memory
+ */
+
+#ifndef _MLI_TILE_API_H_
+#define _MLI_TILE_API_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mli_types.h"
+
+/**
+ * @brief Prepare tiled execution of a layer
+ *
+ * @detail This function splits the output of the layer into tiles of whole rows so that two input tiles
+ * (including halo rows required by the kernel) and one output tile fit into the fast memory provided in plan.
+ * Output tiles are made as high as possible to minimize the number of tiles and halo overhead.
+ * The function doesn't access tensor data.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param layer  [I] Layer description (kernel, its configuration and parameters).
+ * @param in     [I] Input feature map tensor (3-dimensional tensor, HWC). Can be located in slow memory.
+ * @param out    [I] Output feature map tensor. For convolution layers the shape must be filled like for the kernel itself.
+ * @param plan   [I/O] Plan structure. fast_mem and fast_mem_size fields must be filled by user.
+ *
+ * @return MLI status code
+ */
+mli_status mli_tile_prepare(const mli_tile_layer *layer, const mli_tensor *in, const mli_tensor *out,
+        mli_tile_plan *plan);
+
+/**
+ * @brief Run a layer tile by tile
+ *
+ * @detail This function executes the layer for each tile of the plan. Input tiles are copied from in to
+ * the fast memory using the data movement API, and the input of the next tile is copied while the kernel
+ * processes the current one (double buffering). Results of each tile are copied to out. The layer,
+ * input and output must be the same as used for mli_tile_prepare.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param layer  [I] Layer description (kernel, its configuration and parameters).
+ * @param plan   [I] Plan structure prepared by mli_tile_prepare.
+ * @param in     [I] Input feature map tensor (3-dimensional tensor, HWC).
+ * @param out    [I/O] Output feature map tensor. Result is stored here.
+ *
+ * @return MLI status code
+ */
+mli_status mli_tile_run(const mli_tile_layer *layer, const mli_tile_plan *plan, const mli_tensor *in,
+        mli_tensor *out);
+
+/**
+ * @brief Prepare weight streaming execution of a layer
+ *
+ * @detail This function splits the weights of a convolution or fully connected layer along the output channel
+ * dimension into chunks so that two chunks fit into the fast memory provided in plan. Chunks are made as large
+ * as possible to minimize the number of kernel invocations. Depthwise and group convolutions are not supported.
+ * The function doesn't access tensor data.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param layer  [I] Layer description (conv2d or fully_connected kernel, its configuration and parameters).
+ * @param in     [I] Input tensor of the layer.
+ * @param out    [I] Output tensor. For convolution layers the shape must be filled like for the kernel itself.
+ * @param plan   [I/O] Plan structure. fast_mem and fast_mem_size fields must be filled by user.
+ *
+ * @return MLI status code
+ */
+mli_status mli_tile_weights_prepare(const mli_tile_layer *layer, const mli_tensor *in, const mli_tensor *out,
+        mli_tile_weights_plan *plan);
+
+/**
+ * @brief Run a layer chunk by chunk of weights
+ *
+ * @detail This function executes the layer for each weights chunk of the plan. Chunks are copied from the layer
+ * weights to the fast memory using the data movement API, and the next chunk is copied while the kernel
+ * processes the current one (double buffering). Bias and per-channel quantization parameters of weights and bias
+ * are sliced consistently with the chunk. Each invocation writes its slice of output channels directly to out
+ * through memory strides. The layer, input and output must be the same as used for mli_tile_weights_prepare.
+ *
+ * For more info on primitive see MLI Documentation
+ *
+ * @param layer  [I] Layer description (conv2d or fully_connected kernel, its configuration and parameters).
+ * @param plan   [I] Plan structure prepared by mli_tile_weights_prepare.
+ * @param in     [I] Input tensor of the layer.
+ * @param out    [I/O] Output tensor. Result is stored here.
+ *
+ * @return MLI status code
+ */
+mli_status mli_tile_weights_run(const mli_tile_layer *layer, const mli_tile_weights_plan *plan,
+        const mli_tensor *in, mli_tensor *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //_MLI_TILE_API_H_
@@ -21,5 +21,8 @@
 #include "api/mli_helpers_api.h"
 #include "api/mli_kernels_api.h"
 #include "api/mli_mov_api.h"
+#include "api/mli_job_api.h"
+#include "api/mli_tile_api.h"
+#include "api/mli_graph_api.h"
 
 #endif //#ifndef _MLI_API_H_
@@ -29,6 +29,25 @@
 */
 #define MLI_RNN_MAX_INPUT (4)
 
+/**
+* Host threaded execution: Maximum number of threads which can be set by mli_hlp_set_num_threads.
+*/
+#define MLI_MAX_NUM_THREADS (64)
+
+/**
+* Host threaded execution: Maximum number of worker threads executing jobs started by mli_job_start.
+*/
+#define MLI_MAX_NUM_JOB_WORKERS (4)
+
+/**
+* Specialization dispatch: generic kernels forward to the specialization which matches kernel size (and stride
+* or padding where it is required), like mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3. Set to 0 to keep generic kernels
+* independent of specializations: the linker then can drop specializations which are not called directly.
+*/
+#ifndef MLI_SPEC_DISPATCH
+#define MLI_SPEC_DISPATCH (1)
+#endif
+
 /**
 * Library Debug mode
 */
@@ -229,6 +229,35 @@ typedef struct {
                        If axis < 0 the function will be applied to the whole tensor */
 } mli_prelu_cfg;
 
+/**
+ * @brief Parametric RELU requantization parameters
+ *
+ * Requantization parameters of one branch of parametric RELU:
+ * out = ((in - in_zero_point) * scale) * 2^(-shift) + out_zero_point
+ */
+typedef struct {
+    int16_t scale; /**< 16-bit fixed-point multiplier.*/
+    int16_t shift; /**< Right shift applied after multiplication.*/
+} mli_prelu_requant_params;
+
+/**
+ * @brief Parametric RELU Plan definition
+ *
+ * Data structure to keep requantization parameters of sa8 parametric RELU which are derived once
+ * by mli_krn_prelu_sa8_prepare and reused by mli_krn_prelu_sa8_run. Slope tensor is converted to the
+ * table of per-channel requantization parameters for negative input values. Memory for the table
+ * is provided by user. Other fields are filled by the library and must not be modified by user.
+ */
+typedef struct {
+    mli_prelu_requant_params *slope_params; /**< [user] Memory for per-channel parameters of negative branch.*/
+    uint32_t slope_params_capacity;         /**< [user] Number of elements which slope_params can hold.*/
+    uint32_t slope_params_num;              /**< Number of channels (filled elements of slope_params).*/
+    int32_t axis;                           /**< Axis along which slope is applied (-1 for the whole tensor).*/
+    int16_t in_offset;                      /**< Zero point of the input.*/
+    int16_t out_offset;                     /**< Zero point of the output.*/
+    mli_prelu_requant_params identity;      /**< Parameters of positive branch.*/
+} mli_prelu_plan;
+
 /**
  * @brief Softmax Layer config
  *
@@ -252,6 +281,68 @@ typedef struct {
     mli_relu_cfg relu; /**< Type of ReLU activation applied to output values.*/
 } mli_fully_connected_cfg;
 
+/**
+ * @brief Epilogue type definition
+ *
+ * enum used for selection of the element-wise operation fused into convolution or fully connected kernel
+ */
+typedef enum {
+    MLI_EPILOGUE_NONE = 0,  /**< No operation. Output is the same as of the kernel without epilogue */
+    MLI_EPILOGUE_SIGM,      /**< Sigmoid by LUT created with mli_krn_sigm_create_lut */
+    MLI_EPILOGUE_TANH,      /**< Hyperbolic tangent by LUT created with mli_krn_tanh_create_lut */
+    MLI_EPILOGUE_PRELU,     /**< Parametric RELU with one slope or one slope per output channel */
+    MLI_EPILOGUE_ADD,       /**< Addition of a tensor with the shape of output (residual connection) */
+    MLI_EPILOGUE_LARGE_ENUM = 0x02000000  /**< Utility field. Prevent size optimization of public enums */
+} mli_epilogue_type;
+
+/**
+ * @brief Epilogue config definition
+ *
+ * Data structure to describe an element-wise operation applied by convolution or fully connected kernel
+ * to each output value after the built-in ReLU and before it is stored. Result is the same as of the related
+ * kernel (sigmoid, tanh, parametric RELU or elementwise add) called for the output of the kernel without epilogue,
+ * with the output tensor as both input and output.
+ * For sa8 parametric RELU with a slope per channel, requantization parameters of each channel are derived once
+ * into the table provided by user by mli_krn_epilogue_sa8_prepare, as mli_krn_prelu_sa8_prepare does it for a plan.
+ * Kernels only read the configuration, so it may be shared by concurrent calls.
+ */
+typedef struct {
+    mli_epilogue_type type;     /**< Type of operation.*/
+    const mli_lut *lut;         /**< LUT of activation function (MLI_EPILOGUE_SIGM and MLI_EPILOGUE_TANH).*/
+    const mli_tensor *operand;  /**< Slope coefficients (MLI_EPILOGUE_PRELU) or second input (MLI_EPILOGUE_ADD).*/
+    mli_prelu_requant_params *slope_params; /**< [user] Memory for per-channel parameters of sa8 MLI_EPILOGUE_PRELU.*/
+    uint32_t slope_params_capacity;         /**< [user] Number of elements which slope_params can hold.*/
+    uint32_t slope_params_num;              /**< Number of channels filled by mli_krn_epilogue_sa8_prepare.*/
+} mli_epilogue_cfg;
+
+/**
+ * @brief Elementwise Plan definition
+ *
+ * Data structure to keep requantization parameters of sa8 elementwise function which are derived once
+ * by mli_krn_eltwise_<operation>_sa8_prepare and reused by mli_krn_eltwise_sa8_run for tensors
+ * with the same element parameters. All fields are filled by the library and must not be modified by user.
+ */
+typedef struct {
+    int32_t type;        /**< Type of elementwise operation (for internal use).*/
+    int16_t in_offset1;  /**< Zero point of the first input.*/
+    int16_t in_offset2;  /**< Zero point of the second input.*/
+    int16_t out_offset;  /**< Zero point of the output.*/
+    int16_t scale1;      /**< 16-bit fixed-point multiplier of the first input.*/
+    int16_t scale2;      /**< 16-bit fixed-point multiplier of the second input.*/
+    int8_t shift1;       /**< Right shift applied to the first input after multiplication.*/
+    int8_t shift2;       /**< Right shift applied to the second input after multiplication.*/
+    int8_t post_shift;   /**< Right shift applied to the result.*/
+} mli_eltwise_plan;
+
+/**
+ * @brief Fused Multiply-Add Elementwise config definition
+ *
+ * Data structure to provide the configuration for a fused multiply-add elementwise function (out = in1 * in2 + in3).
+ */
+typedef struct {
+    mli_relu_cfg relu; /**< Type of ReLU activation applied to output values.*/
+} mli_eltwise_fma_cfg;
+
 
 
 /**
@@ -274,6 +365,35 @@ typedef struct {
                                   filter point across height dimension. If set to 0 or 1, no dilation logic is used*/
 } mli_conv2d_cfg;
 
+/**
+ * @brief Convolution Plan definition
+ *
+ * Data structure to keep the state of a 2D convolution (general or depthwise) which is derived once by
+ * mli_krn_<convolution>_prepare from parameters, shapes and element parameters of tensors: adjusted padding,
+ * ReLU limits, private tensor descriptors and quantization parameters. It is reused by mli_krn_conv2d_run
+ * for new input and output data. All fields are filled by the library and must not be modified by user.
+ */
+#define MLI_CONV2D_PLAN_STATE_SIZE (256)
+typedef struct _mli_conv2d_plan {
+    void (*run)(const struct _mli_conv2d_plan *plan, const void *in_data, void *out_data);
+                        /**< Function performing the convolution (for internal use).*/
+    uint64_t state[MLI_CONV2D_PLAN_STATE_SIZE / sizeof(uint64_t)]; /**< Derived state of the kernel (for internal use).*/
+} mli_conv2d_plan;
+
+/**
+ * @brief Depthwise Separable Convolution config definition
+ *
+ * Data structure to provide the configuration for a fused depthwise + pointwise (1x1) convolution block.
+ * Rows of the intermediate feature map (output of depthwise part) are kept in a rolling buffer
+ * provided by scratch_data and never exist as a full-size tensor.
+ */
+typedef struct {
+    mli_conv2d_cfg dw_cfg;              /**< Configuration of depthwise convolution.*/
+    mli_relu_cfg pw_relu;               /**< Type of ReLU activation applied to output of pointwise convolution.*/
+    mli_element_params mid_el_params;   /**< Element parameters of intermediate values (output of depthwise part).*/
+    mli_data_container scratch_data;    /**< Rolling buffer to keep rows of intermediate feature map.*/
+} mli_dw_separable_conv2d_cfg;
+
 
 
 /**
@@ -459,6 +579,297 @@ typedef struct _mli_mov_cfg {
     uint8_t  padding_post[MLI_MAX_RANK];
 } mli_mov_cfg_t;
 
+/**
+ * @brief Data movement chain descriptor
+ *
+ * One entry of the transfer list passed to mli_mov_chain_prepare(): copy of src tensor into dst tensor
+ * according to cfg. Semantic of each field is the same as for mli_mov_prepare().
+ */
+typedef struct _mli_mov_chain_desc {
+    const mli_tensor *src;      /**< Source tensor */
+    const mli_mov_cfg_t *cfg;   /**< Configuration of the transfer */
+    mli_tensor *dst;            /**< Destination tensor. Filled by mli_mov_chain_prepare() except data pointer */
+} mli_mov_chain_desc_t;
+
+/**
+ * @brief Data movement chain
+ *
+ * List of validated and pre-computed transfers which are executed back-to-back by mli_mov_chain_start().
+ * Memory for the list is provided by user. Required size can be obtained with mli_mov_chain_get_mem_size().
+ */
+typedef struct _mli_mov_chain {
+    void *transfers;         /**< Memory for pre-computed transfers. Must be aligned to the size of a pointer */
+    uint32_t capacity;       /**< Size of transfers memory in bytes */
+    uint32_t num_transfers;  /**< Number of transfers in the chain. Filled by mli_mov_chain_prepare() */
+} mli_mov_chain_t;
+
+/**
+ * @brief Convolution-like kernel which can be executed by the tiled layer executor
+ *
+ * Any of conv2d, depthwise conv2d or group conv2d kernels in HWC data layout.
+ */
+typedef mli_status (*mli_tile_conv2d_fn)(const mli_tensor *in, const mli_tensor *weights, const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg, mli_tensor *out);
+
+/**
+ * @brief Pooling kernel which can be executed by the tiled layer executor
+ *
+ * Any of maxpool or avepool kernels in HWC data layout.
+ */
+typedef mli_status (*mli_tile_pool_fn)(const mli_tensor *in, const mli_pool_cfg *cfg, mli_tensor *out);
+
+/**
+ * @brief Fully connected kernel which can be executed by the weight streaming executor
+ *
+ * Any of mli_krn_fully_connected_<type> kernels.
+ */
+typedef mli_status (*mli_tile_fc_fn)(const mli_tensor *in, const mli_tensor *weights, const mli_tensor *bias,
+        const mli_fully_connected_cfg *cfg, mli_tensor *out);
+
+/**
+ * @brief Tiled layer definition
+ *
+ * Data structure to describe a layer for the tiled layer executor. Exactly one of conv2d and pool
+ * kernels must be provided together with the related configuration. Weights and bias are used in place.
+ * The weight streaming executor accepts exactly one of conv2d and fully_connected kernels instead.
+ */
+typedef struct {
+    mli_tile_conv2d_fn conv2d;       /**< Convolution kernel. NULL for pooling layer.*/
+    mli_tile_pool_fn pool;           /**< Pooling kernel. NULL for convolution layer.*/
+    const mli_tensor *weights;       /**< Weights tensor of convolution or fully connected layer.*/
+    const mli_tensor *bias;          /**< Bias tensor of convolution or fully connected layer.*/
+    const mli_conv2d_cfg *conv_cfg;  /**< Configuration of convolution layer.*/
+    const mli_pool_cfg *pool_cfg;    /**< Configuration of pooling layer.*/
+    mli_tile_fc_fn fully_connected;  /**< Fully connected kernel. Used by the weight streaming executor only.*/
+    const mli_fully_connected_cfg *fc_cfg; /**< Configuration of fully connected layer.*/
+} mli_tile_layer;
+
+/**
+ * @brief Tiled layer execution plan
+ *
+ * Data structure to keep the tiling of a layer along the height dimension derived by mli_tile_prepare
+ * and used by mli_tile_run. Fast memory for two input tiles and one output tile is provided by user.
+ * Other fields are filled by the library and must not be modified by user.
+ */
+typedef struct {
+    int8_t *fast_mem;                 /**< [user] Fast memory (for instance, CCM) for tile buffers.*/
+    uint32_t fast_mem_size;           /**< [user] Size of fast memory in bytes.*/
+    uint32_t out_shape[3];            /**< Shape of the whole output (HWC).*/
+    uint32_t tile_out_rows;           /**< Number of output rows per tile (the last tile may be smaller).*/
+    uint32_t tile_in_rows;            /**< Maximum number of input rows per tile including halo.*/
+    uint32_t num_tiles;               /**< Number of tiles.*/
+    uint32_t in_buf_size;             /**< Size of one input tile buffer in bytes.*/
+    uint32_t out_buf_size;            /**< Size of output tile buffer in bytes.*/
+} mli_tile_plan;
+
+/**
+ * @brief Weight streaming execution plan
+ *
+ * Data structure to keep the split of layer weights along the output channel dimension derived by
+ * mli_tile_weights_prepare and used by mli_tile_weights_run. Fast memory for two weights chunks is provided by user.
+ * Other fields are filled by the library and must not be modified by user.
+ */
+typedef struct {
+    int8_t *fast_mem;                 /**< [user] Fast memory (for instance, CCM) for weights chunks.*/
+    uint32_t fast_mem_size;           /**< [user] Size of fast memory in bytes.*/
+    uint32_t chunk_channels;          /**< Number of output channels per chunk (the last chunk may be smaller).*/
+    uint32_t num_chunks;              /**< Number of chunks.*/
+    uint32_t buf_size;                /**< Size of one weights chunk buffer in bytes.*/
+} mli_tile_weights_plan;
+
+/**
+ * @brief Memory planner buffer descriptor
+ *
+ * Data structure to declare an intermediate tensor (or any other buffer) for the static memory planner.
+ * Lifetime of the buffer is the range of operations [first_op, last_op] in the sequence of operations
+ * of the application. Buffers with overlapping lifetimes placed in the same bank never share memory.
+ */
+typedef struct {
+    mli_tensor *tensor;     /**< [user] Tensor to place. Can be NULL if size is provided. Data pointer and capacity
+                                 of the tensor are set by mli_hlp_mem_plan_bind.*/
+    uint32_t size;          /**< [user] Size of the buffer in bytes. If 0, it is derived from shape, memory strides
+                                 and element type of tensor by mli_hlp_mem_plan.*/
+    uint32_t alignment;     /**< [user] Alignment of the buffer offset in bytes (power of two). 0 is the same as 1.*/
+    uint32_t bank;          /**< [user] Index of the memory bank to place the buffer in (for instance, 0 for XY or
+                                 VCCM and 1 for system memory).*/
+    uint32_t first_op;      /**< [user] Index of the first operation which uses the buffer (usually the producer).*/
+    uint32_t last_op;       /**< [user] Index of the last operation which uses the buffer.*/
+    uint32_t offset;        /**< Offset of the buffer from the beginning of its bank. Filled by mli_hlp_mem_plan.*/
+} mli_mem_plan_buf;
+
+/**
+ * @brief Weights blob format constants
+ *
+ * Weights blob is a versioned binary container of tensors (for instance, model coefficients) which can be
+ * mapped into memory and used by kernels without copying. Data of each tensor in the blob is aligned to
+ * MLI_BLOB_ALIGNMENT bytes relative to the beginning of the blob.
+ */
+#define MLI_BLOB_VERSION (1)            /**< Version of the blob format produced and accepted by the library.*/
+#define MLI_BLOB_ALIGNMENT (64)         /**< Alignment of tensor data in the blob in bytes.*/
+#define MLI_BLOB_NAME_LEN (32)          /**< Size of tensor name field including terminating null character.*/
+#define MLI_BLOB_LAYOUT_NATIVE (0)      /**< Tensor data is stored as described by its shape and memory strides.
+                                             Other layout tags are reserved for data prepacked for a specific target.*/
+
+/**
+ * @brief Graph format constants
+ *
+ * Serialized graph is a versioned binary description of a sequence of operations and tensors connecting them.
+ * Constant tensors (weights, biases) are not stored in it and are looked up by name in a weights blob.
+ */
+#define MLI_GRAPH_VERSION (1)           /**< Version of the graph format produced and accepted by the library.*/
+#define MLI_GRAPH_MAX_OP_INPUTS (3)     /**< Maximum number of input tensors of one operation.*/
+#define MLI_GRAPH_ALIGNMENT (16)        /**< Alignment of tensor buffers in the arena relative to its beginning.*/
+#define MLI_GRAPH_TUNING_VERSION (1)    /**< Version of the tuning records produced and accepted by the library.*/
+
+/**
+ * @brief Graph operation type
+ *
+ * Inputs of operations are ordered as arguments of the corresponding kernels:
+ * {in, weights, bias} for convolutions and fully connected, {in} for pooling and ReLU, {in1, in2} for addition.
+ */
+typedef enum {
+    MLI_GRAPH_OP_NOP = 0,               /**< No operation (for instance, an operation removed by a fusion pass).*/
+    MLI_GRAPH_OP_CONV2D,                /**< mli_krn_conv2d_hwcn_* kernels.*/
+    MLI_GRAPH_OP_DEPTHWISE_CONV2D,      /**< mli_krn_depthwise_conv2d_hwcn_* kernels.*/
+    MLI_GRAPH_OP_FULLY_CONNECTED,       /**< mli_krn_fully_connected_* kernels.*/
+    MLI_GRAPH_OP_MAXPOOL,               /**< mli_krn_maxpool_hwc_* kernels.*/
+    MLI_GRAPH_OP_AVEPOOL,               /**< mli_krn_avepool_hwc_* kernels.*/
+    MLI_GRAPH_OP_RELU,                  /**< mli_krn_relu_* kernels.*/
+    MLI_GRAPH_OP_ELTWISE_ADD,           /**< mli_krn_eltwise_add_* kernels.*/
+    MLI_GRAPH_OP_NUM,                   /**< Utility field. Number of operation types.*/
+    MLI_GRAPH_OP_LARGE_ENUM = 0x02000000 /**< Utility field. Prevent size optimization of public enums */
+} mli_graph_op_type;
+
+/**
+ * @brief Graph tensor kind
+ */
+typedef enum {
+    MLI_GRAPH_TENSOR_CONST = 0,         /**< Constant tensor looked up by name in the weights blob.*/
+    MLI_GRAPH_TENSOR_INPUT,             /**< Input of the graph. Filled by the application before each run.*/
+    MLI_GRAPH_TENSOR_OUTPUT,            /**< Output of the graph. Alive until the end of each run.*/
+    MLI_GRAPH_TENSOR_INTERNAL,          /**< Intermediate tensor. Shares memory with other tensors.*/
+    MLI_GRAPH_TENSOR_LARGE_ENUM = 0x02000000 /**< Utility field. Prevent size optimization of public enums */
+} mli_graph_tensor_kind;
+
+/**
+ * @brief Graph tensor descriptor
+ *
+ * Data structure to describe a tensor of the graph for mli_graph_pack. Element type and shape are used only
+ * for inputs of the graph: they are derived from the weights blob for constant tensors and from the producing
+ * operation for other tensors. Quantization parameters are used for inputs and outputs of operations
+ * (per-tensor only).
+ */
+typedef struct {
+    char name[MLI_BLOB_NAME_LEN];       /**< Name of the tensor (name of tensor in the blob for constant tensors).*/
+    mli_graph_tensor_kind kind;         /**< Kind of the tensor.*/
+    mli_element_type el_type;           /**< Element type of the tensor (inputs of the graph only).*/
+    uint32_t rank;                      /**< Rank of the tensor (inputs of the graph only).*/
+    uint32_t shape[MLI_MAX_RANK];       /**< Shape of the tensor (inputs of the graph only).*/
+    int32_t frac_bits;                  /**< Number of fractional bits (FX tensors only).*/
+    int32_t zero_point;                 /**< Zero point (SA tensors only).*/
+    int32_t scale;                      /**< Scale (SA tensors only).*/
+    int32_t scale_frac_bits;            /**< Number of fractional bits of scale (SA tensors only).*/
+} mli_graph_tensor_desc;
+
+/**
+ * @brief Graph operation descriptor
+ *
+ * Data structure to describe an operation of the graph. Operations are executed in the order of declaration,
+ * so each input of an operation must be a constant tensor, an input of the graph or an output of an earlier operation.
+ */
+typedef struct {
+    mli_graph_op_type type;             /**< Type of the operation.*/
+    uint32_t num_inputs;                /**< Number of input tensors.*/
+    uint32_t inputs[MLI_GRAPH_MAX_OP_INPUTS]; /**< Indexes of input tensors.*/
+    uint32_t output;                    /**< Index of output tensor.*/
+    union {
+        mli_conv2d_cfg conv2d;          /**< Configuration of convolutions.*/
+        mli_pool_cfg pool;              /**< Configuration of pooling.*/
+        mli_fully_connected_cfg fc;     /**< Configuration of fully connected.*/
+        mli_relu_cfg relu;              /**< Configuration of ReLU.*/
+    } cfg;                              /**< Configuration of the operation (depends on type).*/
+} mli_graph_op_desc;
+
+/**
+ * @brief Graph execution hooks
+ *
+ * Callbacks invoked by mli_graph_run around each executed operation (for instance, for per-op profiling).
+ * NULL callbacks are skipped.
+ */
+typedef struct {
+    void (*before_op)(void *ctx, uint32_t op_idx, const mli_graph_op_desc *op);   /**< Called before the operation.*/
+    void (*after_op)(void *ctx, uint32_t op_idx, const mli_graph_op_desc *op, mli_status status);
+                                                                                  /**< Called after the operation.*/
+    void *ctx;                          /**< Context passed to callbacks.*/
+} mli_graph_hooks;
+
+/**
+ * @brief Graph operation implementation
+ *
+ * Implementation variant used to execute an operation of a bound graph (see mli_graph_tune).
+ */
+typedef enum {
+    MLI_GRAPH_IMPL_DEFAULT = 0,         /**< Planned kernel if the operation supports it, direct call otherwise.*/
+    MLI_GRAPH_IMPL_PLANNED,             /**< Kernel plan derived once by mli_graph_bind (convolutions, sa8 addition).*/
+    MLI_GRAPH_IMPL_DIRECT,              /**< Kernel function called with all parameters on each run.*/
+    MLI_GRAPH_IMPL_NUM,                 /**< Utility field. Number of implementation variants.*/
+    MLI_GRAPH_IMPL_LARGE_ENUM = 0x02000000
+} mli_graph_impl;
+
+/**
+ * @brief Graph operation variant
+ *
+ * Implementation and number of threads selected for one operation.
+ */
+typedef struct {
+    mli_graph_impl impl;                /**< Implementation of the operation.*/
+    uint32_t num_threads;               /**< Number of threads (see mli_hlp_set_num_threads). 0 keeps the current one.*/
+} mli_graph_op_variant;
+
+/**
+ * @brief Graph tuning config
+ *
+ * Data structure to provide a timer and limits of the search to mli_graph_tune.
+ */
+typedef struct {
+    uint64_t (*get_time)(void *ctx);    /**< Returns current time in any monotonic units (for instance, cycles).*/
+    void *ctx;                          /**< Context passed to get_time.*/
+    uint32_t repeats;                   /**< Number of timed runs of each variant. The shortest one is taken.*/
+    uint32_t max_threads;               /**< Maximum number of threads tried for threaded kernels. 0 or 1 to keep
+                                             the current number of threads.*/
+} mli_graph_tune_cfg;
+
+/**
+ * @brief Graph runtime definition
+ *
+ * Data structure to keep a graph loaded by mli_graph_load. Arrays of tensors, kinds, operations and variants are located
+ * in the state memory provided by user. Operations and their configurations can be modified by passes
+ * (see mli_graph_apply_pass) before planning. Other fields are filled by the library and must not be modified by user.
+ */
+typedef struct {
+    mli_tensor *tensors;                /**< Tensors of the graph. Data of non-constant tensors is set by mli_graph_bind.*/
+    mli_graph_tensor_kind *tensor_kinds;/**< Kinds of the tensors.*/
+    mli_graph_op_desc *ops;             /**< Operations of the graph.*/
+    mli_graph_op_variant *variants;     /**< Implementation variants of operations (see mli_graph_set_tuning).*/
+    uint32_t num_tensors;               /**< Number of tensors.*/
+    uint32_t num_ops;                   /**< Number of operations.*/
+    mli_graph_hooks hooks;              /**< [user] Execution hooks. Zeroed by mli_graph_load.*/
+    const void *data;                   /**< Serialized graph (for internal use).*/
+    void *exec;                         /**< Dispatch records of operations (for internal use).*/
+    mli_mem_plan_buf *bufs;             /**< Memory plan buffers (for internal use).*/
+    uint32_t num_exec;                  /**< Number of dispatch records (for internal use).*/
+    uint32_t num_bufs;                  /**< Number of memory plan buffers (for internal use).*/
+    uint32_t arena_size;                /**< Size of the arena derived by mli_graph_plan.*/
+    uint32_t stage;                     /**< Stage of the graph preparation (for internal use).*/
+} mli_graph;
+
+/**
+ * @brief Graph pass
+ *
+ * Function which transforms operations of a loaded graph (for instance, fuses them). Returns MLI status code.
+ */
+typedef mli_status (*mli_graph_pass_fn)(mli_graph *graph, void *ctx);
+
 /**
  * @brief Argmax helper config
  *
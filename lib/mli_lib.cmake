@@ -28,6 +28,9 @@ file(GLOB temp
     ${MLI_LIB_CMAKE_DIR}/src/bricks/*.cc
     ${MLI_LIB_CMAKE_DIR}/src/private/src/*.cc
     ${MLI_LIB_CMAKE_DIR}/src/move/*.cc
+    ${MLI_LIB_CMAKE_DIR}/src/tiling/*.cc
+    ${MLI_LIB_CMAKE_DIR}/src/graph/*.cc
+    ${MLI_LIB_CMAKE_DIR}/src/job/*.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/diverse/*.cc
 )
 set(MLI_LIB_SOURCE_FILES
@@ -39,9 +42,11 @@ set(MLI_LIB_SOURCE_FILES
     ${MLI_LIB_CMAKE_DIR}/src/kernels/transform/mli_krn_tanh_fx.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/transform/mli_krn_softmax_fx.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/transform/mli_krn_l2_normalize.cc
+    ${MLI_LIB_CMAKE_DIR}/src/kernels/transform/mli_krn_layer_norm.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/convolution/mli_krn_conv2d_hwcn.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/convolution/mli_krn_transpose_conv2d_hwcn.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/convolution/mli_krn_depthwise_conv2d_hwcn.cc
+    ${MLI_LIB_CMAKE_DIR}/src/kernels/convolution/mli_krn_depthwise_separable_conv2d_hwcn.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/convolution/mli_krn_group_conv2d_hwcn.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/common/mli_krn_fully_connected.cc
     ${MLI_LIB_CMAKE_DIR}/src/kernels/common/mli_krn_rnn_dense.cc
@@ -190,6 +195,68 @@ else()
     message(FATAL_ERROR "Please specify full accumulator length: ON or OFF")
 endif()
 
+# Host copy engine for the asynchronous mli_mov API: worker threads per DMA channel.
+# It is the default for host builds only; ARC builds keep the direct copy in mli_mov_prepare.
+if (NOT DEFINED MLI_MOV_HOST_ASYNC)
+    if (${MLI_PLATFORM} STREQUAL NATIVE)
+        set(MLI_MOV_HOST_ASYNC ON)
+    else()
+        set(MLI_MOV_HOST_ASYNC OFF)
+    endif()
+endif()
+
+if(MLI_MOV_HOST_ASYNC STREQUAL ON)
+    if (NOT ${MLI_PLATFORM} STREQUAL NATIVE)
+        message(FATAL_ERROR "MLI_MOV_HOST_ASYNC is supported only for host builds")
+    endif()
+    list(APPEND MLI_LIB_PRIVATE_COMPILE_DEFINITIONS
+        MLI_MOV_HOST_ASYNC
+    )
+elseif(MLI_MOV_HOST_ASYNC STREQUAL OFF)
+    # we don't do anything in this case
+else()
+    message(FATAL_ERROR "Please specify MLI_MOV_HOST_ASYNC : ON or OFF")
+endif()
+
+# Host thread pool for kernels which split their output area between threads (see mli_hlp_set_num_threads).
+# It is the default for host builds only; ARC builds always run kernels in the calling thread.
+if (NOT DEFINED MLI_HOST_THREADS)
+    if (${MLI_PLATFORM} STREQUAL NATIVE)
+        set(MLI_HOST_THREADS ON)
+    else()
+        set(MLI_HOST_THREADS OFF)
+    endif()
+endif()
+
+if(MLI_HOST_THREADS STREQUAL ON)
+    if (NOT ${MLI_PLATFORM} STREQUAL NATIVE)
+        message(FATAL_ERROR "MLI_HOST_THREADS is supported only for host builds")
+    endif()
+    list(APPEND MLI_LIB_PRIVATE_COMPILE_DEFINITIONS
+        MLI_HOST_THREADS
+    )
+elseif(MLI_HOST_THREADS STREQUAL OFF)
+    # we don't do anything in this case
+else()
+    message(FATAL_ERROR "Please specify MLI_HOST_THREADS : ON or OFF")
+endif()
+
+# Forwarding of generic kernels to specializations by kernel size (see MLI_SPEC_DISPATCH in mli_config.h).
+# Size-constrained builds can switch it OFF to link only specializations which are called directly.
+if (NOT DEFINED MLI_SPEC_DISPATCH)
+    set(MLI_SPEC_DISPATCH ON)
+endif()
+
+if(MLI_SPEC_DISPATCH STREQUAL ON)
+    # we don't do anything in this case
+elseif(MLI_SPEC_DISPATCH STREQUAL OFF)
+    list(APPEND MLI_LIB_PRIVATE_COMPILE_DEFINITIONS
+        MLI_SPEC_DISPATCH=0
+    )
+else()
+    message(FATAL_ERROR "Please specify MLI_SPEC_DISPATCH : ON or OFF")
+endif()
+
 if(AVEPOOL_16BIT_MUL STREQUAL ON)
     list(APPEND MLI_LIB_PRIVATE_COMPILE_DEFINITIONS
         AVEPOOL_16BIT_MUL
@@ -0,0 +1,259 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_KRN_EPILOGUE_H_
+#define _MLI_KRN_EPILOGUE_H_
+
+#include <type_traits>
+
+#include "mli_config.h"
+#include "mli_krn_epilogue_decl.h"
+#include "mli_krn_eltwise.h"
+#include "mli_krn_leaky_relu.h"
+#include "mli_math.h"
+#include "mli_prv_activation_lut.h"
+#include "mli_prv_lut.h"
+#include "mli_prv_quant.h"
+#include "mli_prv_tensor.h"
+#include "mli_types.h"
+
+namespace mli {
+namespace krn {
+
+#pragma MLI_CODE_SECTION_START(".mli_lib")
+
+template <typename io_T>
+struct epilogue {
+    static constexpr bool asym = std::is_same<io_T, int8_t>::value;
+
+    mli_epilogue_type type;
+
+    // MLI_EPILOGUE_SIGM and MLI_EPILOGUE_TANH
+    const mli_lut *lut;
+    int8_t lut_in_frac_bits;
+    bool lut_interpolate;
+    s8asym_quant_params lut_in_params;
+    s8asym_quant_params lut_out_params;
+
+    // MLI_EPILOGUE_PRELU
+    const MLI_PTR(io_T) slope;
+    int slope_mem_stride;           // 0 if one slope is used for all channels
+    io_T slope_val;                 // Slope for all channels (scalar tensor as leaky relu has)
+    int slope_shift;                // FX only
+    int16_t in_zp;                  // SA8 only
+    s8asym_quant_params identity_params;
+    s8asym_quant_params alpha_params; // SA8 with one slope only
+    const mli_prelu_requant_params *slope_params; // SA8 with a slope per channel
+
+    // MLI_EPILOGUE_ADD
+    const MLI_PTR(io_T) addend;
+    int addend_row_mem_stride;
+    int addend_clmn_mem_stride;
+    int addend_ch_mem_stride;
+    int addend_batch_mem_stride;
+    eltwise_params add_params;
+
+    MLI_FORCE_INLINE io_T apply(const io_T val, const int row, const int clmn, const int ch) const {
+        switch (type) {
+        case MLI_EPILOGUE_SIGM:
+        case MLI_EPILOGUE_TANH: {
+            s8asym_quant_params out_params = lut_out_params;
+            if (lut_interpolate)
+                return mli::krn::ref::activation_lut_one_elem_interpolate<io_T, io_T, asym, asym>(
+                        val, lut, lut_in_frac_bits, &lut_in_params, &out_params);
+            return mli::krn::ref::activation_lut_one_elem_no_interpolate<io_T, io_T, asym, asym>(
+                    val, lut, lut_in_frac_bits, &lut_in_params, &out_params);
+        }
+        case MLI_EPILOGUE_PRELU:
+            return apply_prelu(val, ch);
+        case MLI_EPILOGUE_ADD: {
+            const io_T addend_val = addend[row * addend_row_mem_stride + clmn * addend_clmn_mem_stride +
+                                           ch * addend_ch_mem_stride];
+            return mli::krn::ref::eltwise_perform_operation<io_T, io_T, ELTWISE_ADD, asym>(
+                    val, addend_val, add_params.in_offset1, add_params.in_offset2, add_params.out_offset,
+                    add_params.scale16_1, add_params.scale16_2,
+                    add_params.pre_op_shift1, add_params.pre_op_shift2, add_params.post_op_shift);
+        }
+        default:
+            return val;
+        }
+    }
+
+    // Same as compute_leaky_relu of the reference implementation
+    MLI_FORCE_INLINE io_T apply_prelu(const io_T val, const int ch) const {
+        if (asym) {
+            const int16_t input_sub = mli_math_sub_fx((int16_t)val, in_zp);
+            s8asym_quant_params params = identity_params;
+            if (val < in_zp) {
+                if (slope_mem_stride == 0) {
+                    params = alpha_params;
+                } else {
+                    params.scale = slope_params[ch].scale;
+                    params.shift = slope_params[ch].shift;
+                }
+            }
+            int32_t output = mli_math_asr_rnd_fx(mli_math_mul_fx<int16_t, int32_t>(params.scale, input_sub),
+                                                 params.shift);
+            output = mli_math_add_fx(output, (int32_t)params.offset);
+            return (io_T)mli_math_cast_fx<int32_t, int8_t>(output, 0);
+        } else {
+            const io_T zero = 0;
+            const io_T scale = (slope_mem_stride == 0) ? slope_val : slope[ch * slope_mem_stride];
+            const io_T pos = mli_math_max_fx(zero, val);
+            const io_T neg = mli_math_acc_cast_fx<io_T, mli_acc32_t>(
+                    mli_math_mul_fx<io_T, mli_acc32_t>(mli_math_min_fx(zero, val), scale), slope_shift);
+            return mli_math_add_fx(pos, neg);
+        }
+    }
+
+    MLI_FORCE_INLINE epilogue batch_item(const uint32_t item) const {
+        epilogue item_epilogue = *this;
+        if (type == MLI_EPILOGUE_ADD)
+            item_epilogue.addend += item * addend_batch_mem_stride;
+        return item_epilogue;
+    }
+};
+
+//====================================================================================
+// Derive parameters of epilogue once per kernel call.
+// out must hold the shape and element parameters of the kernel result.
+//====================================================================================
+template <typename io_T>
+static MLI_FORCE_INLINE void define_epilogue(
+        const mli_epilogue_cfg *cfg,
+        const mli_tensor *out,
+        epilogue<io_T> *ep) {
+    constexpr bool asym = epilogue<io_T>::asym;
+    ep->type = cfg->type;
+
+    if (cfg->type == MLI_EPILOGUE_SIGM || cfg->type == MLI_EPILOGUE_TANH) {
+        const mli_lut *lut = cfg->lut;
+        int in_frac_bits = 0;
+        if (asym) {
+            ep->lut_in_params.offset = out->el_params.sa.zero_point.mem.i16;
+            ep->lut_in_params.scale = out->el_params.sa.scale.mem.i16;
+            ep->lut_in_params.shift = out->el_params.sa.scale_frac_bits.mem.i8;
+            ep->lut_out_params.scale = 1;
+            if (cfg->type == MLI_EPILOGUE_SIGM) {
+                ep->lut_out_params.offset = K_SIGM_ASYM_ZERO_POINT;
+                ep->lut_out_params.shift = K_SIGM_OUTPUT_SHIFT;
+            } else {
+                ep->lut_out_params.offset = K_TANH_ASYM_ZERO_POINT;
+                ep->lut_out_params.shift = K_TANH_OUTPUT_SHIFT;
+            }
+            // Same as in compute_activation_lut: SA8 input is converted to FX16 with LUT integer bits
+            in_frac_bits = kMaxFracBitsFx16 - (kMaxFracBitsFx8 - lut->in_frac_bits);
+        } else {
+            in_frac_bits = out->el_params.fx.frac_bits;
+        }
+        ep->lut = lut;
+        ep->lut_in_frac_bits = (int8_t)(asym ? 0 : in_frac_bits);
+        ep->lut_interpolate = mli_math_min_fx(in_frac_bits - lut->in_frac_bits, (int)kMaxFracBitsFx16) > 0;
+    } else if (cfg->type == MLI_EPILOGUE_PRELU) {
+        const mli_tensor *slope = cfg->operand;
+        if (mli_prv_count_elem_num(slope) == 1) {
+            ep->slope = nullptr;
+            ep->slope_mem_stride = 0;
+            ep->slope_val = mli_prv_tensor_data_val<io_T>(slope);
+        } else {
+            ep->slope = mli_prv_tensor_data_ptr<MLI_PTR(io_T)>(slope);
+            ep->slope_mem_stride = slope->mem_stride[slope->rank - 1];
+            ep->slope_val = 0;
+        }
+        if (asym) {
+            ep->in_zp = out->el_params.sa.zero_point.mem.i16;
+            mli::krn::ref::leaky_relu_define_identity_params(out, out, &ep->identity_params);
+            if (ep->slope_mem_stride == 0) {
+                ep->alpha_params = mli::krn::ref::leaky_relu_define_alpha_params(
+                        out, slope, out, (int8_t)ep->slope_val, &ep->identity_params);
+            } else {
+                // Negative branch parameters of each channel are taken from the table filled by
+                // epilogue_sa8_define_slope_params (offset is the output zero point for both branches)
+                ep->slope_params = cfg->slope_params;
+            }
+        } else {
+            ep->slope_shift = mli_prv_calc_shift(out, slope, out);
+        }
+    } else if (cfg->type == MLI_EPILOGUE_ADD) {
+        const mli_tensor *addend = cfg->operand;
+        const int rank = (int)addend->rank;
+        ep->addend = mli_prv_tensor_data_ptr<MLI_PTR(io_T)>(addend);
+        ep->addend_ch_mem_stride = addend->mem_stride[rank - 1];
+        ep->addend_clmn_mem_stride = (rank >= 2) ? addend->mem_stride[rank - 2] : 0;
+        ep->addend_row_mem_stride = (rank >= 3) ? addend->mem_stride[rank - 3] : 0;
+        ep->addend_batch_mem_stride = (rank >= 4) ? addend->mem_stride[rank - 4] : 0;
+        mli::krn::ref::eltwise_define_params<io_T, ELTWISE_ADD, asym>(out, addend, out, &ep->add_params);
+    }
+}
+
+static MLI_FORCE_INLINE void define_epilogue(
+        const mli_epilogue_cfg * /*cfg*/,
+        const mli_tensor * /*out*/,
+        no_epilogue * /*ep*/) {
+}
+
+//====================================================================================
+// Derive requantization parameters of the negative branch of sa8 parametric RELU epilogue
+// for each channel into the table of user. Parameters depend only on element parameters
+// of output and on slope values, so it is done once by mli_krn_epilogue_sa8_prepare.
+//====================================================================================
+static MLI_FORCE_INLINE void epilogue_sa8_define_slope_params(
+        const mli_tensor *out,
+        mli_epilogue_cfg *cfg) {
+    const mli_tensor *slope = cfg->operand;
+    const uint32_t channels = mli_prv_count_elem_num(slope);
+    cfg->slope_params_num = 0;
+    // One slope for all channels: parameters are derived by kernels
+    if (channels == 1)
+        return;
+
+    s8asym_quant_params identity_params;
+    mli::krn::ref::leaky_relu_define_identity_params(out, out, &identity_params);
+    const MLI_PTR(int8_t) slope_ptr = mli_prv_tensor_data_ptr<MLI_PTR(int8_t)>(slope);
+    const int slope_mem_stride = slope->mem_stride[slope->rank - 1];
+    for (uint32_t ch = 0; ch < channels; ch++) {
+        const s8asym_quant_params alpha_params = mli::krn::ref::leaky_relu_define_alpha_params(
+                out, slope, out, slope_ptr[ch * slope_mem_stride], &identity_params);
+        cfg->slope_params[ch].scale = alpha_params.scale;
+        cfg->slope_params[ch].shift = alpha_params.shift;
+    }
+    cfg->slope_params_num = channels;
+}
+
+//====================================================================================
+// Update element parameters of output after activation by LUT (as sigmoid and tanh kernels do)
+//====================================================================================
+template <typename io_T>
+static MLI_FORCE_INLINE void epilogue_update_out_params(
+        const mli_epilogue_cfg *cfg,
+        const epilogue<io_T> &ep,
+        mli_tensor *out) {
+    if (cfg->type != MLI_EPILOGUE_SIGM && cfg->type != MLI_EPILOGUE_TANH)
+        return;
+
+    if (epilogue<io_T>::asym) {
+        out->el_params.sa.zero_point.mem.i16 = ep.lut_out_params.offset;
+        out->el_params.sa.scale.mem.i16 = ep.lut_out_params.scale;
+        out->el_params.sa.scale_frac_bits.mem.i8 = (int8_t)ep.lut_out_params.shift;
+    } else {
+        out->el_params.fx.frac_bits = sizeof(io_T) * 8 - 1;
+    }
+}
+
+static MLI_FORCE_INLINE void epilogue_update_out_params(
+        const mli_epilogue_cfg * /*cfg*/,
+        const no_epilogue & /*ep*/,
+        mli_tensor * /*out*/) {
+}
+
+#pragma MLI_CODE_SECTION_END()
+} // namespace krn
+} // namespace mli
+
+#endif // _MLI_KRN_EPILOGUE_H_
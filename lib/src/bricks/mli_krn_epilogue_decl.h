@@ -0,0 +1,43 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_KRN_EPILOGUE_DECL_H_
+#define _MLI_KRN_EPILOGUE_DECL_H_
+
+#include "mli_config.h"
+#include "mli_types.h"
+
+namespace mli {
+namespace krn {
+
+//========================================================
+// Epilogue of convolution and fully connected kernels
+//========================================================
+// An epilogue is applied by the kernel template to each output value after result_cast and the built-in ReLU,
+// right before the value is stored. Position of the value is passed as (row, clmn, ch) of the output item.
+// Kernels without epilogue are instantiated with no_epilogue which keeps the value as is.
+struct no_epilogue {
+    template <typename io_T>
+    MLI_FORCE_INLINE io_T apply(const io_T val, const int /*row*/, const int /*clmn*/, const int /*ch*/) const {
+        return val;
+    }
+
+    MLI_FORCE_INLINE no_epilogue batch_item(const uint32_t /*item*/) const {
+        return *this;
+    }
+};
+
+// Epilogue described by mli_epilogue_cfg (see mli_krn_epilogue.h)
+template <typename io_T>
+struct epilogue;
+
+} // namespace krn
+} // namespace mli
+
+#endif // _MLI_KRN_EPILOGUE_DECL_H_
@@ -0,0 +1,1184 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "mli_api.h"
+#include "mli_check.h"
+#include "mli_config.h"
+#include "mli_debug.h"
+#include "mli_graph_api.h"
+#include "mli_job_api.h"
+#include "mli_math_macros.h"
+#include "mli_prv_parallel.h"
+#include "mli_prv_tensor.h"
+#include "mli_types.h"
+
+#pragma MLI_CODE_SECTION_START(".mli_lib")
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//=====================================================================
+// Graph format
+//=====================================================================
+// Serialized graph is a header followed by an array of tensor descriptors and an array of operation
+// descriptors. All fields are 32-bit words in the byte order of the target. Configuration of an operation
+// is stored as a list of words in order of fields of the corresponding configuration structure.
+
+#define MLI_GRAPH_MAGIC (0x47494C4D) // "MLIG"
+#define MLI_GRAPH_OP_PARAMS (12)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size;       // Size of header. Offset of the first tensor descriptor.
+    uint32_t tensor_desc_size;  // Size of one tensor descriptor.
+    uint32_t op_desc_size;      // Size of one operation descriptor.
+    uint32_t num_tensors;
+    uint32_t num_ops;
+    uint32_t graph_size;        // Size of the whole serialized graph.
+    uint32_t reserved[8];
+} mli_graph_header;
+
+typedef struct {
+    char name[MLI_BLOB_NAME_LEN];
+    uint32_t kind;
+    uint32_t el_type;
+    uint32_t rank;
+    uint32_t shape[MLI_MAX_RANK];
+    int32_t frac_bits;
+    int32_t zero_point;
+    int32_t scale;
+    int32_t scale_frac_bits;
+    uint32_t reserved[5];
+} mli_graph_tensor_rec;
+
+typedef struct {
+    uint32_t type;
+    uint32_t num_inputs;
+    uint32_t inputs[MLI_GRAPH_MAX_OP_INPUTS];
+    uint32_t output;
+    int32_t params[MLI_GRAPH_OP_PARAMS];
+    uint32_t reserved[2];
+} mli_graph_op_rec;
+
+static_assert(sizeof(mli_graph_header) == 64, "Graph header layout is a part of the format");
+static_assert(sizeof(mli_graph_tensor_rec) == 96, "Graph tensor descriptor layout is a part of the format");
+static_assert(sizeof(mli_graph_op_rec) == 80, "Graph operation descriptor layout is a part of the format");
+
+// Tuning records are a header followed by one record per operation of the graph (including NOPs).
+
+#define MLI_GRAPH_TUNING_MAGIC (0x544C494D) // "MLIT"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size;       // Size of header. Offset of the first record.
+    uint32_t record_size;       // Size of one record.
+    uint32_t num_ops;
+    uint32_t reserved[3];
+} mli_graph_tuning_header;
+
+typedef struct {
+    uint32_t op_type;           // Type of the operation the record was made for.
+    uint32_t impl;
+    uint32_t num_threads;
+    uint32_t reserved;
+} mli_graph_tuning_rec;
+
+static_assert(sizeof(mli_graph_tuning_header) == 32, "Tuning header layout is a part of the format");
+static_assert(sizeof(mli_graph_tuning_rec) == 16, "Tuning record layout is a part of the format");
+
+//=====================================================================
+// Runtime state
+//=====================================================================
+
+enum {
+    MLI_GRAPH_STAGE_NONE = 0,
+    MLI_GRAPH_STAGE_LOADED,
+    MLI_GRAPH_STAGE_PLANNED,
+    MLI_GRAPH_STAGE_BOUND
+};
+
+typedef mli_status (*mli_graph_fc_fn)(const mli_tensor *in, const mli_tensor *weights, const mli_tensor *bias,
+        const mli_fully_connected_cfg *cfg, mli_tensor *out);
+typedef mli_status (*mli_graph_pool_fn)(const mli_tensor *in, const mli_pool_cfg *cfg, mli_tensor *out);
+typedef mli_status (*mli_graph_relu_fn)(const mli_tensor *in, const mli_relu_cfg *cfg, mli_tensor *out);
+typedef mli_status (*mli_graph_eltwise_fn)(const mli_tensor *in1, const mli_tensor *in2, mli_tensor *out);
+typedef mli_status (*mli_graph_conv2d_fn)(const mli_tensor *in, const mli_tensor *weights, const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg, mli_tensor *out);
+
+// Dispatch record of an operation. Everything except the kernel call itself is resolved by mli_graph_bind.
+typedef struct mli_graph_exec_s {
+    mli_status (*run)(const struct mli_graph_exec_s *exec);
+    const mli_graph_op_desc *op;
+    const mli_tensor *in[MLI_GRAPH_MAX_OP_INPUTS];
+    mli_tensor *out;
+    uint32_t op_idx;
+    uint32_t num_threads;       // Number of threads of the operation. 0 keeps the one of the caller.
+    union {
+        mli_graph_conv2d_fn conv2d;
+        mli_graph_fc_fn fc;
+        mli_graph_pool_fn pool;
+        mli_graph_relu_fn relu;
+        mli_graph_eltwise_fn eltwise;
+    } krn;
+    union {
+        mli_conv2d_plan conv2d;
+        mli_eltwise_plan eltwise;
+    } plan;
+} mli_graph_exec;
+
+// Number of inputs of each operation type
+static const uint32_t mli_graph_op_arity[MLI_GRAPH_OP_NUM] = {0, 3, 3, 3, 1, 1, 1, 2};
+
+//=====================================================================
+// Private functions
+//=====================================================================
+
+static const mli_graph_tensor_rec *mli_graph_tensor_recs(const void *data) {
+    const mli_graph_header *header = (const mli_graph_header *)data;
+    return (const mli_graph_tensor_rec *)((const int8_t *)data + header->header_size);
+}
+
+static const mli_graph_op_rec *mli_graph_op_recs(const void *data) {
+    const mli_graph_header *header = (const mli_graph_header *)data;
+    return (const mli_graph_op_rec *)((const int8_t *)data + header->header_size +
+            header->num_tensors * header->tensor_desc_size);
+}
+
+static uint64_t mli_graph_state_size(uint32_t num_tensors, uint32_t num_ops) {
+    return (uint64_t)num_ops * (sizeof(mli_graph_exec) + sizeof(mli_graph_op_desc) + sizeof(mli_graph_op_variant)) +
+           (uint64_t)num_tensors * (sizeof(mli_tensor) + sizeof(mli_mem_plan_buf) + sizeof(mli_graph_tensor_kind));
+}
+
+static bool mli_graph_in_range(int32_t val, int32_t min_val, int32_t max_val) {
+    return val >= min_val && val <= max_val;
+}
+
+static void mli_graph_relu_to_params(const mli_relu_cfg *relu, int32_t *params) {
+    params[0] = relu->type;
+    params[1] = relu->min;
+    params[2] = relu->max;
+}
+
+static void mli_graph_relu_from_params(const int32_t *params, mli_relu_cfg *relu) {
+    relu->type = (mli_relu_type)params[0];
+    relu->min = (int16_t)params[1];
+    relu->max = (int16_t)params[2];
+}
+
+static void mli_graph_cfg_to_params(const mli_graph_op_desc *op, int32_t *params) {
+    switch (op->type) {
+        case MLI_GRAPH_OP_CONV2D:
+        case MLI_GRAPH_OP_DEPTHWISE_CONV2D: {
+            const mli_conv2d_cfg *cfg = &op->cfg.conv2d;
+            mli_graph_relu_to_params(&cfg->relu, params);
+            params[3] = cfg->stride_width;
+            params[4] = cfg->stride_height;
+            params[5] = cfg->padding_left;
+            params[6] = cfg->padding_right;
+            params[7] = cfg->padding_top;
+            params[8] = cfg->padding_bottom;
+            params[9] = cfg->dilation_width;
+            params[10] = cfg->dilation_height;
+            break;
+        }
+        case MLI_GRAPH_OP_MAXPOOL:
+        case MLI_GRAPH_OP_AVEPOOL: {
+            const mli_pool_cfg *cfg = &op->cfg.pool;
+            params[0] = cfg->kernel_width;
+            params[1] = cfg->kernel_height;
+            params[2] = cfg->stride_width;
+            params[3] = cfg->stride_height;
+            params[4] = cfg->padding_left;
+            params[5] = cfg->padding_right;
+            params[6] = cfg->padding_top;
+            params[7] = cfg->padding_bottom;
+            break;
+        }
+        case MLI_GRAPH_OP_FULLY_CONNECTED:
+            mli_graph_relu_to_params(&op->cfg.fc.relu, params);
+            break;
+        case MLI_GRAPH_OP_RELU:
+            mli_graph_relu_to_params(&op->cfg.relu, params);
+            break;
+        default:
+            break;
+    }
+}
+
+static void mli_graph_cfg_from_params(const int32_t *params, mli_graph_op_desc *op) {
+    memset(&op->cfg, 0, sizeof(op->cfg));
+    switch (op->type) {
+        case MLI_GRAPH_OP_CONV2D:
+        case MLI_GRAPH_OP_DEPTHWISE_CONV2D: {
+            mli_conv2d_cfg *cfg = &op->cfg.conv2d;
+            mli_graph_relu_from_params(params, &cfg->relu);
+            cfg->stride_width = (uint8_t)params[3];
+            cfg->stride_height = (uint8_t)params[4];
+            cfg->padding_left = (uint8_t)params[5];
+            cfg->padding_right = (uint8_t)params[6];
+            cfg->padding_top = (uint8_t)params[7];
+            cfg->padding_bottom = (uint8_t)params[8];
+            cfg->dilation_width = (uint8_t)params[9];
+            cfg->dilation_height = (uint8_t)params[10];
+            break;
+        }
+        case MLI_GRAPH_OP_MAXPOOL:
+        case MLI_GRAPH_OP_AVEPOOL: {
+            mli_pool_cfg *cfg = &op->cfg.pool;
+            cfg->kernel_width = (uint8_t)params[0];
+            cfg->kernel_height = (uint8_t)params[1];
+            cfg->stride_width = (uint8_t)params[2];
+            cfg->stride_height = (uint8_t)params[3];
+            cfg->padding_left = (uint8_t)params[4];
+            cfg->padding_right = (uint8_t)params[5];
+            cfg->padding_top = (uint8_t)params[6];
+            cfg->padding_bottom = (uint8_t)params[7];
+            break;
+        }
+        case MLI_GRAPH_OP_FULLY_CONNECTED:
+            mli_graph_relu_from_params(params, &op->cfg.fc.relu);
+            break;
+        case MLI_GRAPH_OP_RELU:
+            mli_graph_relu_from_params(params, &op->cfg.relu);
+            break;
+        default:
+            break;
+    }
+}
+
+// Descriptors come from untrusted memory, so they are validated regardless of debug mode.
+static mli_status mli_graph_check_tensor_rec(const mli_graph_tensor_rec *rec) {
+    if (rec->name[MLI_BLOB_NAME_LEN - 1] != '\0' || rec->kind > MLI_GRAPH_TENSOR_INTERNAL)
+        return MLI_STATUS_BAD_TENSOR;
+    if (!mli_graph_in_range(rec->frac_bits, INT8_MIN, INT8_MAX) ||
+            !mli_graph_in_range(rec->zero_point, INT16_MIN, INT16_MAX) ||
+            !mli_graph_in_range(rec->scale, INT16_MIN, INT16_MAX) ||
+            !mli_graph_in_range(rec->scale_frac_bits, INT8_MIN, INT8_MAX))
+        return MLI_STATUS_BAD_TENSOR;
+    if (rec->kind != MLI_GRAPH_TENSOR_INPUT)
+        return MLI_STATUS_OK;
+
+    if (rec->el_type != MLI_EL_FX_8 && rec->el_type != MLI_EL_FX_16 && rec->el_type != MLI_EL_SA_8)
+        return MLI_STATUS_NOT_SUPPORTED;
+    if (rec->rank == 0 || rec->rank > MLI_MAX_RANK)
+        return MLI_STATUS_BAD_TENSOR;
+    uint64_t num_elems = 1;
+    for (uint32_t i = 0; i < rec->rank; i++) {
+        num_elems *= rec->shape[i];
+        if (rec->shape[i] == 0 || num_elems > INT32_MAX)
+            return MLI_STATUS_BAD_TENSOR;
+    }
+    return MLI_STATUS_OK;
+}
+
+static void mli_graph_fill_params(const mli_graph_tensor_rec *rec, mli_tensor *t) {
+    if (t->el_type == MLI_EL_FX_8 || t->el_type == MLI_EL_FX_16) {
+        t->el_params.fx.frac_bits = (int8_t)rec->frac_bits;
+    } else {
+        t->el_params.sa.type = MLI_EL_PARAM_SC16_ZP16;
+        t->el_params.sa.dim = -1;
+        t->el_params.sa.zero_point.mem.i16 = (int16_t)rec->zero_point;
+        t->el_params.sa.scale.mem.i16 = (int16_t)rec->scale;
+        t->el_params.sa.scale_frac_bits.mem.i8 = (int8_t)rec->scale_frac_bits;
+    }
+}
+
+static bool mli_graph_check_relu_params(const int32_t *params) {
+    return mli_graph_in_range(params[0], MLI_RELU_NONE, MLI_RELU_6) &&
+           mli_graph_in_range(params[1], INT16_MIN, INT16_MAX) &&
+           mli_graph_in_range(params[2], INT16_MIN, INT16_MAX);
+}
+
+static mli_status mli_graph_check_op_rec(const mli_graph_op_rec *rec, uint32_t num_tensors) {
+    if (rec->type >= MLI_GRAPH_OP_NUM)
+        return MLI_STATUS_NOT_SUPPORTED;
+    if (rec->num_inputs != mli_graph_op_arity[rec->type])
+        return MLI_STATUS_BAD_FUNC_CFG;
+    if (rec->type == MLI_GRAPH_OP_NOP)
+        return MLI_STATUS_OK;
+    for (uint32_t i = 0; i < rec->num_inputs; i++) {
+        if (rec->inputs[i] >= num_tensors)
+            return MLI_STATUS_BAD_TENSOR;
+    }
+    if (rec->output >= num_tensors)
+        return MLI_STATUS_BAD_TENSOR;
+
+    bool valid = true;
+    switch (rec->type) {
+        case MLI_GRAPH_OP_CONV2D:
+        case MLI_GRAPH_OP_DEPTHWISE_CONV2D:
+            valid = mli_graph_check_relu_params(rec->params);
+            for (uint32_t i = 3; i <= 10; i++)
+                valid &= mli_graph_in_range(rec->params[i], 0, UINT8_MAX);
+            break;
+        case MLI_GRAPH_OP_FULLY_CONNECTED:
+        case MLI_GRAPH_OP_RELU:
+            valid = mli_graph_check_relu_params(rec->params);
+            break;
+        case MLI_GRAPH_OP_MAXPOOL:
+        case MLI_GRAPH_OP_AVEPOOL:
+            for (uint32_t i = 0; i <= 7; i++)
+                valid &= mli_graph_in_range(rec->params[i], 0, UINT8_MAX);
+            break;
+        default:
+            break;
+    }
+    return valid ? MLI_STATUS_OK : MLI_STATUS_BAD_FUNC_CFG;
+}
+
+// Index of the operation before op_end producing the tensor, or num_ops if there is no such operation.
+static uint32_t mli_graph_producer(const mli_graph *graph, uint32_t tensor, uint32_t op_end) {
+    for (uint32_t i = 0; i < op_end; i++) {
+        if (graph->ops[i].type != MLI_GRAPH_OP_NOP && graph->ops[i].output == tensor)
+            return i;
+    }
+    return graph->num_ops;
+}
+
+static uint32_t mli_graph_out_size(uint32_t in_size, uint32_t pad_beg, uint32_t pad_end, uint32_t kernel,
+        uint32_t stride) {
+    const uint32_t padded = in_size + pad_beg + pad_end;
+    return (stride == 0 || kernel == 0 || padded < kernel) ? 0 : (padded - kernel) / stride + 1;
+}
+
+// Derives element type and shape of the output of operation. Quantization parameters of the output
+// are kept as described by the graph; kernels which propagate them from the input do it on their own.
+static mli_status mli_graph_infer_output(const mli_graph *graph, const mli_graph_op_desc *op) {
+    const mli_tensor *in = &graph->tensors[op->inputs[0]];
+    mli_tensor *out = &graph->tensors[op->output];
+    uint32_t shape[MLI_MAX_RANK] = {0};
+    uint32_t rank = in->rank;
+    for (uint32_t i = 0; i < in->rank; i++)
+        shape[i] = in->shape[i];
+
+    switch (op->type) {
+        case MLI_GRAPH_OP_CONV2D:
+        case MLI_GRAPH_OP_DEPTHWISE_CONV2D: {
+            const mli_tensor *weights = &graph->tensors[op->inputs[1]];
+            const mli_tensor *bias = &graph->tensors[op->inputs[2]];
+            const mli_conv2d_cfg *cfg = &op->cfg.conv2d;
+            if (in->rank != 3 || weights->rank != 4 || bias->rank != 1)
+                return MLI_STATUS_RANK_MISMATCH;
+            const bool is_depthwise = op->type == MLI_GRAPH_OP_DEPTHWISE_CONV2D;
+            if ((is_depthwise && (weights->shape[KRNL_D_DIM_HWCN] != 1 ||
+                                  weights->shape[KRNL_C_DIM_HWCN] != in->shape[FMAP_C_DIM_HWC])) ||
+                    (!is_depthwise && weights->shape[KRNL_D_DIM_HWCN] != in->shape[FMAP_C_DIM_HWC]) ||
+                    bias->shape[0] != weights->shape[KRNL_C_DIM_HWCN])
+                return MLI_STATUS_SHAPE_MISMATCH;
+            const uint32_t dil_w = MAX(cfg->dilation_width, 1);
+            const uint32_t dil_h = MAX(cfg->dilation_height, 1);
+            shape[FMAP_H_DIM_HWC] = mli_graph_out_size(in->shape[FMAP_H_DIM_HWC], cfg->padding_top,
+                    cfg->padding_bottom, (weights->shape[KRNL_H_DIM_HWCN] - 1) * dil_h + 1, cfg->stride_height);
+            shape[FMAP_W_DIM_HWC] = mli_graph_out_size(in->shape[FMAP_W_DIM_HWC], cfg->padding_left,
+                    cfg->padding_right, (weights->shape[KRNL_W_DIM_HWCN] - 1) * dil_w + 1, cfg->stride_width);
+            shape[FMAP_C_DIM_HWC] = weights->shape[KRNL_C_DIM_HWCN];
+            break;
+        }
+        case MLI_GRAPH_OP_FULLY_CONNECTED: {
+            const mli_tensor *weights = &graph->tensors[op->inputs[1]];
+            const mli_tensor *bias = &graph->tensors[op->inputs[2]];
+            if (weights->rank != 2 || bias->rank != 1)
+                return MLI_STATUS_RANK_MISMATCH;
+            if (mli_prv_count_elem_num(in) != weights->shape[0] || bias->shape[0] != weights->shape[1])
+                return MLI_STATUS_SHAPE_MISMATCH;
+            rank = 1;
+            shape[0] = weights->shape[1];
+            break;
+        }
+        case MLI_GRAPH_OP_MAXPOOL:
+        case MLI_GRAPH_OP_AVEPOOL: {
+            const mli_pool_cfg *cfg = &op->cfg.pool;
+            if (in->rank != 3)
+                return MLI_STATUS_RANK_MISMATCH;
+            shape[FMAP_H_DIM_HWC] = mli_graph_out_size(in->shape[FMAP_H_DIM_HWC], cfg->padding_top,
+                    cfg->padding_bottom, cfg->kernel_height, cfg->stride_height);
+            shape[FMAP_W_DIM_HWC] = mli_graph_out_size(in->shape[FMAP_W_DIM_HWC], cfg->padding_left,
+                    cfg->padding_right, cfg->kernel_width, cfg->stride_width);
+            break;
+        }
+        case MLI_GRAPH_OP_ELTWISE_ADD: {
+            const mli_tensor *in2 = &graph->tensors[op->inputs[1]];
+            if (in2->rank != in->rank || in2->el_type != in->el_type)
+                return MLI_STATUS_INCOMPATEBLE_TENSORS;
+            for (uint32_t i = 0; i < in->rank; i++) {
+                if (in2->shape[i] != in->shape[i])
+                    return MLI_STATUS_SHAPE_MISMATCH;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    for (uint32_t i = 0; i < rank; i++) {
+        if (shape[i] == 0)
+            return MLI_STATUS_BAD_FUNC_CFG;
+    }
+    out->el_type = in->el_type;
+    out->rank = rank;
+    for (uint32_t i = 0; i < MLI_MAX_RANK; i++)
+        out->shape[i] = (i < rank) ? shape[i] : 0;
+    mli_hlp_set_tensor_mem_strides(out);
+    return MLI_STATUS_OK;
+}
+
+// Operations are validated regardless of debug mode: graph structure comes from untrusted data or from passes.
+// Each input of an operation must be available before it and each non-constant tensor has one producer.
+static mli_status mli_graph_validate(const mli_graph *graph) {
+    for (uint32_t i = 0; i < graph->num_ops; i++) {
+        const mli_graph_op_desc *op = &graph->ops[i];
+        if ((uint32_t)op->type >= MLI_GRAPH_OP_NUM)
+            return MLI_STATUS_NOT_SUPPORTED;
+        if (op->type == MLI_GRAPH_OP_NOP)
+            continue;
+        if (op->num_inputs != mli_graph_op_arity[op->type])
+            return MLI_STATUS_BAD_FUNC_CFG;
+        if (op->output >= graph->num_tensors)
+            return MLI_STATUS_BAD_TENSOR;
+
+        for (uint32_t j = 0; j < op->num_inputs; j++) {
+            const uint32_t t = op->inputs[j];
+            if (t >= graph->num_tensors)
+                return MLI_STATUS_BAD_TENSOR;
+            const mli_graph_tensor_kind kind = graph->tensor_kinds[t];
+            if (kind != MLI_GRAPH_TENSOR_CONST && kind != MLI_GRAPH_TENSOR_INPUT &&
+                    mli_graph_producer(graph, t, i) == graph->num_ops)
+                return MLI_STATUS_BAD_TENSOR;
+        }
+        const mli_graph_tensor_kind out_kind = graph->tensor_kinds[op->output];
+        if ((out_kind != MLI_GRAPH_TENSOR_OUTPUT && out_kind != MLI_GRAPH_TENSOR_INTERNAL) ||
+                mli_graph_producer(graph, op->output, i) != graph->num_ops)
+            return MLI_STATUS_BAD_TENSOR;
+
+        mli_status ret = mli_graph_infer_output(graph, op);
+        if (ret != MLI_STATUS_OK)
+            return ret;
+    }
+
+    for (uint32_t t = 0; t < graph->num_tensors; t++) {
+        if (graph->tensor_kinds[t] == MLI_GRAPH_TENSOR_OUTPUT &&
+                mli_graph_producer(graph, t, graph->num_ops) == graph->num_ops)
+            return MLI_STATUS_BAD_TENSOR;
+    }
+    return MLI_STATUS_OK;
+}
+
+//=====================================================================
+// Dispatch
+//=====================================================================
+
+static mli_status mli_graph_run_conv2d(const mli_graph_exec *exec) {
+    return mli_krn_conv2d_run(&exec->plan.conv2d, exec->in[0]->data.mem.pi8, exec->out->data.mem.pi8);
+}
+
+static mli_status mli_graph_run_conv2d_direct(const mli_graph_exec *exec) {
+    return exec->krn.conv2d(exec->in[0], exec->in[1], exec->in[2], &exec->op->cfg.conv2d, exec->out);
+}
+
+static mli_status mli_graph_run_fc(const mli_graph_exec *exec) {
+    return exec->krn.fc(exec->in[0], exec->in[1], exec->in[2], &exec->op->cfg.fc, exec->out);
+}
+
+static mli_status mli_graph_run_pool(const mli_graph_exec *exec) {
+    return exec->krn.pool(exec->in[0], &exec->op->cfg.pool, exec->out);
+}
+
+static mli_status mli_graph_run_relu(const mli_graph_exec *exec) {
+    return exec->krn.relu(exec->in[0], &exec->op->cfg.relu, exec->out);
+}
+
+static mli_status mli_graph_run_eltwise(const mli_graph_exec *exec) {
+    return exec->krn.eltwise(exec->in[0], exec->in[1], exec->out);
+}
+
+static mli_status mli_graph_run_eltwise_sa8(const mli_graph_exec *exec) {
+    return mli_krn_eltwise_sa8_run(&exec->plan.eltwise, exec->in[0], exec->in[1], exec->out);
+}
+
+// Number of threads of the variant applies only to kernels called by this thread, and the setting
+// of the application is left untouched, so graphs may run concurrently with other kernels.
+static mli_status mli_graph_exec_run(const mli_graph_exec *exec) {
+    if (exec->num_threads == 0)
+        return exec->run(exec);
+    const uint32_t caller_override = mli_prv_parallel_get_thread_override();
+    mli_status ret = mli_prv_parallel_set_thread_override(exec->num_threads);
+    if (ret == MLI_STATUS_OK)
+        ret = exec->run(exec);
+    mli_prv_parallel_set_thread_override(caller_override);
+    return ret;
+}
+
+static bool mli_graph_is_threaded(mli_graph_op_type type) {
+    return type == MLI_GRAPH_OP_CONV2D || type == MLI_GRAPH_OP_DEPTHWISE_CONV2D ||
+           type == MLI_GRAPH_OP_MAXPOOL || type == MLI_GRAPH_OP_AVEPOOL;
+}
+
+static bool mli_graph_has_plan(mli_graph_op_type type) {
+    return type == MLI_GRAPH_OP_CONV2D || type == MLI_GRAPH_OP_DEPTHWISE_CONV2D ||
+           type == MLI_GRAPH_OP_ELTWISE_ADD;
+}
+
+// Selects kernel of the operation by element types of its tensors and by its variant,
+// and validates the operation once.
+static mli_status mli_graph_prepare_exec(mli_graph_exec *exec, const mli_graph_op_variant *variant) {
+    const mli_graph_op_desc *op = exec->op;
+    const bool is_direct = variant->impl == MLI_GRAPH_IMPL_DIRECT;
+    if (variant->impl == MLI_GRAPH_IMPL_PLANNED && !mli_graph_has_plan(op->type))
+        return MLI_STATUS_NOT_SUPPORTED;
+    exec->num_threads = variant->num_threads;
+
+    const mli_element_type in_type = exec->in[0]->el_type;
+    const mli_element_type w_type = (op->num_inputs > 1) ? exec->in[1]->el_type : in_type;
+    const bool is_sa8 = in_type == MLI_EL_SA_8 && w_type == MLI_EL_SA_8;
+    const bool is_fx16 = in_type == MLI_EL_FX_16 && w_type == MLI_EL_FX_16;
+    const bool is_fx16_fx8 = in_type == MLI_EL_FX_16 && w_type == MLI_EL_FX_8;
+    const bool is_fx8 = in_type == MLI_EL_FX_8 && w_type == MLI_EL_FX_8;
+
+    switch (op->type) {
+        case MLI_GRAPH_OP_CONV2D:
+        case MLI_GRAPH_OP_DEPTHWISE_CONV2D: {
+            const bool is_dw = op->type == MLI_GRAPH_OP_DEPTHWISE_CONV2D;
+            if (is_direct) {
+                mli_status (*chk)(const mli_tensor *, const mli_tensor *, const mli_tensor *,
+                        const mli_conv2d_cfg *, const mli_tensor *) = NULL;
+                exec->run = mli_graph_run_conv2d_direct;
+                if (is_sa8) {
+                    exec->krn.conv2d = is_dw ? mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32
+                                             : mli_krn_conv2d_hwcn_sa8_sa8_sa32;
+                    chk = is_dw ? mli_chk_depthwise_conv2d_hwcn_sa8_sa8_sa32 : mli_chk_conv2d_hwcn_sa8_sa8_sa32;
+                } else if (is_fx16) {
+                    exec->krn.conv2d = is_dw ? mli_krn_depthwise_conv2d_hwcn_fx16 : mli_krn_conv2d_hwcn_fx16;
+                    chk = is_dw ? mli_chk_depthwise_conv2d_hwcn_fx16 : mli_chk_conv2d_hwcn_fx16;
+                } else if (is_fx16_fx8) {
+                    exec->krn.conv2d = is_dw ? mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8
+                                             : mli_krn_conv2d_hwcn_fx16_fx8_fx8;
+                    chk = is_dw ? mli_chk_depthwise_conv2d_hwcn_fx16_fx8_fx8 : mli_chk_conv2d_hwcn_fx16_fx8_fx8;
+                } else {
+                    return MLI_STATUS_NOT_SUPPORTED;
+                }
+                return MLI_CHECK_STATUS(chk(exec->in[0], exec->in[1], exec->in[2], &op->cfg.conv2d, exec->out),
+                        __func__);
+            }
+            exec->run = mli_graph_run_conv2d;
+            if (is_sa8)
+                return (is_dw ? mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepare
+                              : mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepare)(exec->in[0], exec->in[1], exec->in[2],
+                                &op->cfg.conv2d, exec->out, &exec->plan.conv2d);
+            if (is_fx16)
+                return (is_dw ? mli_krn_depthwise_conv2d_hwcn_fx16_prepare
+                              : mli_krn_conv2d_hwcn_fx16_prepare)(exec->in[0], exec->in[1], exec->in[2],
+                                &op->cfg.conv2d, exec->out, &exec->plan.conv2d);
+            if (is_fx16_fx8)
+                return (is_dw ? mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_prepare
+                              : mli_krn_conv2d_hwcn_fx16_fx8_fx8_prepare)(exec->in[0], exec->in[1], exec->in[2],
+                                &op->cfg.conv2d, exec->out, &exec->plan.conv2d);
+            return MLI_STATUS_NOT_SUPPORTED;
+        }
+        case MLI_GRAPH_OP_FULLY_CONNECTED:
+            exec->run = mli_graph_run_fc;
+            if (is_sa8) {
+                exec->krn.fc = mli_krn_fully_connected_sa8_sa8_sa32;
+                return MLI_CHECK_STATUS(mli_chk_fully_connected_sa8_sa8_sa32(exec->in[0], exec->in[1], exec->in[2],
+                        &op->cfg.fc, exec->out), __func__);
+            }
+            if (is_fx16) {
+                exec->krn.fc = mli_krn_fully_connected_fx16;
+                return MLI_CHECK_STATUS(mli_chk_fully_connected_fx16(exec->in[0], exec->in[1], exec->in[2],
+                        &op->cfg.fc, exec->out), __func__);
+            }
+            if (is_fx16_fx8) {
+                exec->krn.fc = mli_krn_fully_connected_fx16_fx8_fx8;
+                return MLI_CHECK_STATUS(mli_chk_fully_connected_fx8w16d(exec->in[0], exec->in[1], exec->in[2],
+                        &op->cfg.fc, exec->out), __func__);
+            }
+            return MLI_STATUS_NOT_SUPPORTED;
+        case MLI_GRAPH_OP_MAXPOOL:
+        case MLI_GRAPH_OP_AVEPOOL: {
+            const bool is_max = op->type == MLI_GRAPH_OP_MAXPOOL;
+            mli_status (*chk)(const mli_tensor *, const mli_pool_cfg *, const mli_tensor *) = NULL;
+            exec->run = mli_graph_run_pool;
+            if (is_sa8) {
+                exec->krn.pool = is_max ? mli_krn_maxpool_hwc_sa8 : mli_krn_avepool_hwc_sa8;
+                chk = is_max ? mli_chk_maxpool_hwc_sa8 : mli_chk_avepool_hwc_sa8;
+            } else if (is_fx16) {
+                exec->krn.pool = is_max ? mli_krn_maxpool_hwc_fx16 : mli_krn_avepool_hwc_fx16;
+                chk = is_max ? mli_chk_maxpool_hwc_fx16 : mli_chk_avepool_hwc_fx16;
+            } else if (is_fx8) {
+                exec->krn.pool = is_max ? mli_krn_maxpool_hwc_fx8 : mli_krn_avepool_hwc_fx8;
+                chk = is_max ? mli_chk_maxpool_hwc_fx8 : mli_chk_avepool_hwc_fx8;
+            } else {
+                return MLI_STATUS_NOT_SUPPORTED;
+            }
+            return MLI_CHECK_STATUS(chk(exec->in[0], &op->cfg.pool, exec->out), __func__);
+        }
+        case MLI_GRAPH_OP_RELU: {
+            mli_status (*chk)(const mli_tensor *, const mli_relu_cfg *, mli_tensor *) = NULL;
+            exec->run = mli_graph_run_relu;
+            if (is_sa8) {
+                exec->krn.relu = mli_krn_relu_sa8;
+                chk = mli_chk_relu_sa8;
+            } else if (is_fx16) {
+                exec->krn.relu = mli_krn_relu_fx16;
+                chk = mli_chk_relu_fx16;
+            } else if (is_fx8) {
+                exec->krn.relu = mli_krn_relu_fx8;
+                chk = mli_chk_relu_fx8;
+            } else {
+                return MLI_STATUS_NOT_SUPPORTED;
+            }
+            return MLI_CHECK_STATUS(chk(exec->in[0], &op->cfg.relu, exec->out), __func__);
+        }
+        case MLI_GRAPH_OP_ELTWISE_ADD:
+            if (is_sa8 && !is_direct) {
+                // Requantization parameters are derived once
+                exec->run = mli_graph_run_eltwise_sa8;
+                return mli_krn_eltwise_add_sa8_prepare(exec->in[0], exec->in[1], exec->out, &exec->plan.eltwise);
+            }
+            exec->run = mli_graph_run_eltwise;
+            if (is_sa8) {
+                exec->krn.eltwise = mli_krn_eltwise_add_sa8;
+                return MLI_CHECK_STATUS(mli_chk_eltwise_sa8(exec->in[0], exec->in[1], exec->out), __func__);
+            }
+            if (is_fx16) {
+                exec->krn.eltwise = mli_krn_eltwise_add_fx16;
+                return MLI_CHECK_STATUS(mli_chk_eltwise_fx16(exec->in[0], exec->in[1], exec->out), __func__);
+            }
+            if (is_fx8) {
+                exec->krn.eltwise = mli_krn_eltwise_add_fx8;
+                return MLI_CHECK_STATUS(mli_chk_eltwise_fx8(exec->in[0], exec->in[1], exec->out), __func__);
+            }
+            return MLI_STATUS_NOT_SUPPORTED;
+        default:
+            return MLI_STATUS_NOT_SUPPORTED;
+    }
+}
+
+//=====================================================================
+// Public functions
+//=====================================================================
+
+uint32_t mli_graph_get_size(uint32_t num_tensors, uint32_t num_ops) {
+    return sizeof(mli_graph_header) + num_tensors * sizeof(mli_graph_tensor_rec) +
+           num_ops * sizeof(mli_graph_op_rec);
+}
+
+mli_status mli_graph_pack(const mli_graph_tensor_desc *tensors, uint32_t num_tensors,
+        const mli_graph_op_desc *ops, uint32_t num_ops, void *data, uint32_t data_size) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_graph_pack(tensors, num_tensors, ops, num_ops, data, data_size),
+            __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    const uint32_t graph_size = mli_graph_get_size(num_tensors, num_ops);
+    memset(data, 0, graph_size);
+
+    mli_graph_header *header = (mli_graph_header *)data;
+    header->magic = MLI_GRAPH_MAGIC;
+    header->version = MLI_GRAPH_VERSION;
+    header->header_size = sizeof(mli_graph_header);
+    header->tensor_desc_size = sizeof(mli_graph_tensor_rec);
+    header->op_desc_size = sizeof(mli_graph_op_rec);
+    header->num_tensors = num_tensors;
+    header->num_ops = num_ops;
+    header->graph_size = graph_size;
+
+    mli_graph_tensor_rec *tensor_recs = (mli_graph_tensor_rec *)mli_graph_tensor_recs(data);
+    for (uint32_t i = 0; i < num_tensors; i++) {
+        const mli_graph_tensor_desc *desc = &tensors[i];
+        mli_graph_tensor_rec *rec = &tensor_recs[i];
+        strncpy(rec->name, desc->name, MLI_BLOB_NAME_LEN - 1);
+        rec->kind = desc->kind;
+        rec->el_type = desc->el_type;
+        rec->rank = desc->rank;
+        for (uint32_t dim = 0; dim < desc->rank; dim++)
+            rec->shape[dim] = desc->shape[dim];
+        rec->frac_bits = desc->frac_bits;
+        rec->zero_point = desc->zero_point;
+        rec->scale = desc->scale;
+        rec->scale_frac_bits = desc->scale_frac_bits;
+    }
+
+    mli_graph_op_rec *op_recs = (mli_graph_op_rec *)mli_graph_op_recs(data);
+    for (uint32_t i = 0; i < num_ops; i++) {
+        const mli_graph_op_desc *op = &ops[i];
+        mli_graph_op_rec *rec = &op_recs[i];
+        rec->type = op->type;
+        rec->num_inputs = op->num_inputs;
+        for (uint32_t j = 0; j < op->num_inputs; j++)
+            rec->inputs[j] = op->inputs[j];
+        rec->output = op->output;
+        mli_graph_cfg_to_params(op, rec->params);
+    }
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_graph_open(const void *data, uint32_t data_size, uint32_t *state_size) {
+    if (data == NULL || state_size == NULL)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    if (((uintptr_t)data & (sizeof(uint32_t) - 1)) != 0)
+        return MLI_STATUS_MISALIGNMENT_ERROR;
+    if (data_size < sizeof(mli_graph_header))
+        return MLI_STATUS_LENGTH_ERROR;
+
+    const mli_graph_header *header = (const mli_graph_header *)data;
+    if (header->magic != MLI_GRAPH_MAGIC)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    if (header->version != MLI_GRAPH_VERSION)
+        return MLI_STATUS_NOT_SUPPORTED;
+    if (header->header_size != sizeof(mli_graph_header) ||
+            header->tensor_desc_size != sizeof(mli_graph_tensor_rec) ||
+            header->op_desc_size != sizeof(mli_graph_op_rec))
+        return MLI_STATUS_BAD_FUNC_CFG;
+    if (header->graph_size > data_size ||
+            (uint64_t)header->header_size + (uint64_t)header->num_tensors * header->tensor_desc_size +
+            (uint64_t)header->num_ops * header->op_desc_size > header->graph_size)
+        return MLI_STATUS_LENGTH_ERROR;
+    const uint64_t size = mli_graph_state_size(header->num_tensors, header->num_ops);
+    if (size > UINT32_MAX)
+        return MLI_STATUS_LENGTH_ERROR;
+
+    const mli_graph_tensor_rec *tensor_recs = mli_graph_tensor_recs(data);
+    for (uint32_t i = 0; i < header->num_tensors; i++) {
+        mli_status ret = mli_graph_check_tensor_rec(&tensor_recs[i]);
+        if (ret != MLI_STATUS_OK)
+            return ret;
+    }
+    const mli_graph_op_rec *op_recs = mli_graph_op_recs(data);
+    for (uint32_t i = 0; i < header->num_ops; i++) {
+        mli_status ret = mli_graph_check_op_rec(&op_recs[i], header->num_tensors);
+        if (ret != MLI_STATUS_OK)
+            return ret;
+    }
+    *state_size = (uint32_t)size;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_graph_load(mli_graph *graph, const void *data, const void *blob, void *state, uint32_t state_size) {
+    if (graph == NULL || data == NULL || state == NULL)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    if (((uintptr_t)state & (sizeof(uint64_t) - 1)) != 0)
+        return MLI_STATUS_MISALIGNMENT_ERROR;
+
+    const mli_graph_header *header = (const mli_graph_header *)data;
+    const uint32_t num_tensors = header->num_tensors;
+    const uint32_t num_ops = header->num_ops;
+    if (mli_graph_state_size(num_tensors, num_ops) > state_size)
+        return MLI_STATUS_NOT_ENGH_MEM;
+
+    // Arrays with stricter alignment go first
+    int8_t *mem = (int8_t *)state;
+    memset(graph, 0, sizeof(*graph));
+    graph->exec = mem;
+    mem += num_ops * sizeof(mli_graph_exec);
+    graph->tensors = (mli_tensor *)mem;
+    mem += num_tensors * sizeof(mli_tensor);
+    graph->bufs = (mli_mem_plan_buf *)mem;
+    mem += num_tensors * sizeof(mli_mem_plan_buf);
+    graph->ops = (mli_graph_op_desc *)mem;
+    mem += num_ops * sizeof(mli_graph_op_desc);
+    graph->variants = (mli_graph_op_variant *)mem;
+    mem += num_ops * sizeof(mli_graph_op_variant);
+    memset(graph->variants, 0, num_ops * sizeof(mli_graph_op_variant));
+    graph->tensor_kinds = (mli_graph_tensor_kind *)mem;
+    graph->num_tensors = num_tensors;
+    graph->num_ops = num_ops;
+    graph->data = data;
+
+    const mli_graph_tensor_rec *tensor_recs = mli_graph_tensor_recs(data);
+    for (uint32_t i = 0; i < num_tensors; i++) {
+        const mli_graph_tensor_rec *rec = &tensor_recs[i];
+        mli_tensor *t = &graph->tensors[i];
+        memset(t, 0, sizeof(*t));
+        graph->tensor_kinds[i] = (mli_graph_tensor_kind)rec->kind;
+        if (rec->kind == MLI_GRAPH_TENSOR_CONST) {
+            if (blob == NULL)
+                return MLI_STATUS_ARGUMENT_ERROR;
+            mli_status ret = mli_hlp_blob_find_tensor(blob, rec->name, t);
+            if (ret != MLI_STATUS_OK)
+                return ret;
+            continue;
+        }
+
+        // Element type and shape of other tensors are derived from operations producing them
+        if (rec->kind == MLI_GRAPH_TENSOR_INPUT) {
+            t->el_type = (mli_element_type)rec->el_type;
+            t->rank = rec->rank;
+            for (uint32_t dim = 0; dim < rec->rank; dim++)
+                t->shape[dim] = rec->shape[dim];
+            mli_hlp_set_tensor_mem_strides(t);
+            mli_graph_fill_params(rec, t);
+        }
+    }
+
+    const mli_graph_op_rec *op_recs = mli_graph_op_recs(data);
+    for (uint32_t i = 0; i < num_ops; i++) {
+        const mli_graph_op_rec *rec = &op_recs[i];
+        mli_graph_op_desc *op = &graph->ops[i];
+        memset(op, 0, sizeof(*op));
+        op->type = (mli_graph_op_type)rec->type;
+        op->num_inputs = rec->num_inputs;
+        for (uint32_t j = 0; j < rec->num_inputs; j++)
+            op->inputs[j] = rec->inputs[j];
+        op->output = rec->output;
+        mli_graph_cfg_from_params(rec->params, op);
+    }
+
+    mli_status ret = mli_graph_validate(graph);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    // Quantization parameters are set once element types are known. ReLU and max pooling outputs
+    // keep parameters of their inputs like the kernels do.
+    for (uint32_t i = 0; i < num_ops; i++) {
+        const mli_graph_op_desc *op = &graph->ops[i];
+        if (op->type == MLI_GRAPH_OP_NOP)
+            continue;
+        mli_tensor *out = &graph->tensors[op->output];
+        if (op->type == MLI_GRAPH_OP_RELU || op->type == MLI_GRAPH_OP_MAXPOOL)
+            out->el_params = graph->tensors[op->inputs[0]].el_params;
+        else
+            mli_graph_fill_params(&tensor_recs[op->output], out);
+    }
+    graph->stage = MLI_GRAPH_STAGE_LOADED;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_graph_apply_pass(mli_graph *graph, mli_graph_pass_fn pass, void *ctx) {
+    if (graph == NULL || pass == NULL)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    if (graph->stage != MLI_GRAPH_STAGE_LOADED)
+        return MLI_STATUS_ARGUMENT_ERROR;
+
+    mli_status ret = pass(graph, ctx);
+    if (ret == MLI_STATUS_OK)
+        ret = mli_graph_validate(graph);
+    if (ret != MLI_STATUS_OK)
+        graph->stage = MLI_GRAPH_STAGE_NONE;
+    return ret;
+}
+
+mli_status mli_graph_fuse_relu(mli_graph *graph, void *ctx) {
+    (void)ctx;
+    if (graph == NULL)
+        return MLI_STATUS_ARGUMENT_ERROR;
+
+    for (uint32_t i = 0; i < graph->num_ops; i++) {
+        mli_graph_op_desc *relu = &graph->ops[i];
+        if (relu->type != MLI_GRAPH_OP_RELU)
+            continue;
+        const uint32_t t = relu->inputs[0];
+        if (t >= graph->num_tensors || graph->tensor_kinds[t] != MLI_GRAPH_TENSOR_INTERNAL)
+            continue;
+        const uint32_t p = mli_graph_producer(graph, t, i);
+        if (p == graph->num_ops)
+            continue;
+
+        mli_graph_op_desc *prod = &graph->ops[p];
+        mli_relu_cfg *prod_relu = NULL;
+        if (prod->type == MLI_GRAPH_OP_CONV2D || prod->type == MLI_GRAPH_OP_DEPTHWISE_CONV2D)
+            prod_relu = &prod->cfg.conv2d.relu;
+        else if (prod->type == MLI_GRAPH_OP_FULLY_CONNECTED)
+            prod_relu = &prod->cfg.fc.relu;
+        if (prod_relu == NULL || prod_relu->type != MLI_RELU_NONE)
+            continue;
+
+        uint32_t num_consumers = 0;
+        for (uint32_t j = 0; j < graph->num_ops; j++) {
+            const mli_graph_op_desc *op = &graph->ops[j];
+            for (uint32_t k = 0; k < op->num_inputs && op->type != MLI_GRAPH_OP_NOP; k++)
+                num_consumers += (op->inputs[k] == t) ? 1 : 0;
+        }
+        if (num_consumers != 1)
+            continue;
+
+        // ReLU keeps quantization of its input, so the fused output is quantized like the producer output
+        *prod_relu = relu->cfg.relu;
+        prod->output = relu->output;
+        graph->tensors[relu->output].el_params = graph->tensors[t].el_params;
+        relu->type = MLI_GRAPH_OP_NOP;
+        relu->num_inputs = 0;
+    }
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_graph_plan(mli_graph *graph, uint32_t *arena_size) {
+    if (graph == NULL || arena_size == NULL || graph->stage < MLI_GRAPH_STAGE_LOADED)
+        return MLI_STATUS_ARGUMENT_ERROR;
+
+    // Lifetime of a tensor is the range of operations using it
+    uint32_t num_bufs = 0;
+    for (uint32_t t = 0; t < graph->num_tensors; t++) {
+        const mli_graph_tensor_kind kind = graph->tensor_kinds[t];
+        if (kind == MLI_GRAPH_TENSOR_CONST)
+            continue;
+        uint32_t first_op = (kind == MLI_GRAPH_TENSOR_INPUT) ? 0 : UINT32_MAX;
+        uint32_t last_op = 0;
+        for (uint32_t i = 0; i < graph->num_ops; i++) {
+            const mli_graph_op_desc *op = &graph->ops[i];
+            if (op->type == MLI_GRAPH_OP_NOP)
+                continue;
+            bool is_used = op->output == t;
+            for (uint32_t j = 0; j < op->num_inputs; j++)
+                is_used |= op->inputs[j] == t;
+            if (is_used) {
+                first_op = MIN(first_op, i);
+                last_op = MAX(last_op, i);
+            }
+        }
+        if (first_op == UINT32_MAX)
+            continue;
+        if (kind == MLI_GRAPH_TENSOR_OUTPUT)
+            last_op = graph->num_ops - 1;
+
+        mli_mem_plan_buf *buf = &graph->bufs[num_bufs++];
+        buf->tensor = &graph->tensors[t];
+        buf->size = 0;
+        buf->alignment = MLI_GRAPH_ALIGNMENT;
+        buf->bank = 0;
+        buf->first_op = first_op;
+        buf->last_op = last_op;
+        buf->offset = 0;
+    }
+
+    uint32_t peak_size = 0;
+    mli_status ret = mli_hlp_mem_plan(graph->bufs, num_bufs, &peak_size, 1);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+    graph->num_bufs = num_bufs;
+    graph->arena_size = peak_size;
+    graph->stage = MLI_GRAPH_STAGE_PLANNED;
+    *arena_size = peak_size;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_graph_bind(mli_graph *graph, int8_t *arena, uint32_t arena_size) {
+    if (graph == NULL || graph->stage < MLI_GRAPH_STAGE_PLANNED)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    if (arena == NULL || arena_size < graph->arena_size)
+        return MLI_STATUS_NOT_ENGH_MEM;
+    if (((uintptr_t)arena & (MLI_GRAPH_ALIGNMENT - 1)) != 0)
+        return MLI_STATUS_MISALIGNMENT_ERROR;
+
+    mli_status ret = mli_hlp_mem_plan_bind(graph->bufs, graph->num_bufs, &arena, 1);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    // Dispatch records are built for executed operations only
+    mli_graph_exec *exec = (mli_graph_exec *)graph->exec;
+    uint32_t num_exec = 0;
+    graph->stage = MLI_GRAPH_STAGE_PLANNED;
+    for (uint32_t i = 0; i < graph->num_ops; i++) {
+        const mli_graph_op_desc *op = &graph->ops[i];
+        if (op->type == MLI_GRAPH_OP_NOP)
+            continue;
+        mli_graph_exec *e = &exec[num_exec++];
+        memset(e, 0, sizeof(*e));
+        e->op = op;
+        e->op_idx = i;
+        for (uint32_t j = 0; j < op->num_inputs; j++)
+            e->in[j] = &graph->tensors[op->inputs[j]];
+        e->out = &graph->tensors[op->output];
+        ret = mli_graph_prepare_exec(e, &graph->variants[i]);
+        if (ret != MLI_STATUS_OK)
+            return ret;
+    }
+    graph->num_exec = num_exec;
+    graph->stage = MLI_GRAPH_STAGE_BOUND;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_graph_run(const mli_graph *graph) {
+    if (graph == NULL || graph->stage != MLI_GRAPH_STAGE_BOUND)
+        return MLI_STATUS_ARGUMENT_ERROR;
+
+    const mli_graph_exec *exec = (const mli_graph_exec *)graph->exec;
+    const mli_graph_hooks *hooks = &graph->hooks;
+    if (hooks->before_op == NULL && hooks->after_op == NULL) {
+        for (uint32_t i = 0; i < graph->num_exec; i++) {
+            mli_status ret = mli_graph_exec_run(&exec[i]);
+            if (ret != MLI_STATUS_OK)
+                return ret;
+        }
+        return MLI_STATUS_OK;
+    }
+
+    for (uint32_t i = 0; i < graph->num_exec; i++) {
+        const mli_graph_exec *e = &exec[i];
+        if (hooks->before_op != NULL)
+            hooks->before_op(hooks->ctx, e->op_idx, e->op);
+        mli_status ret = mli_graph_exec_run(e);
+        if (hooks->after_op != NULL)
+            hooks->after_op(hooks->ctx, e->op_idx, e->op, ret);
+        if (ret != MLI_STATUS_OK)
+            return ret;
+    }
+    return MLI_STATUS_OK;
+}
+
+static mli_status mli_graph_run_job(void *ctx) {
+    return mli_graph_run((const mli_graph *)ctx);
+}
+
+mli_status mli_graph_prepare_job(const mli_graph *graph, mli_job_handle_t *h) {
+    if (graph == NULL || graph->stage != MLI_GRAPH_STAGE_BOUND)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    return mli_job_prepare(h, mli_graph_run_job, (void *)graph);
+}
+
+mli_status mli_graph_find_tensor(const mli_graph *graph, const char *name, mli_tensor **tensor) {
+    if (graph == NULL || name == NULL || tensor == NULL || graph->stage == MLI_GRAPH_STAGE_NONE)
+        return MLI_STATUS_ARGUMENT_ERROR;
+
+    const mli_graph_tensor_rec *tensor_recs = mli_graph_tensor_recs(graph->data);
+    for (uint32_t i = 0; i < graph->num_tensors; i++) {
+        if (strncmp(tensor_recs[i].name, name, MLI_BLOB_NAME_LEN) == 0) {
+            *tensor = &graph->tensors[i];
+            return MLI_STATUS_OK;
+        }
+    }
+    return MLI_STATUS_ARGUMENT_ERROR;
+}
+
+mli_status mli_graph_tune(mli_graph *graph, const mli_graph_tune_cfg *cfg) {
+    if (graph == NULL || cfg == NULL || cfg->get_time == NULL || graph->stage != MLI_GRAPH_STAGE_BOUND)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    if (cfg->max_threads > MLI_MAX_NUM_THREADS)
+        return MLI_STATUS_BAD_FUNC_CFG;
+
+    // Threads are tried only if the library is able to use them
+    uint32_t max_threads = MAX(cfg->max_threads, 1);
+    if (max_threads > mli_prv_parallel_max_threads())
+        max_threads = 1;
+    const uint32_t repeats = MAX(cfg->repeats, 1);
+
+    // Each operation is timed on outputs of already tuned operations preceding it
+    mli_graph_exec *exec = (mli_graph_exec *)graph->exec;
+    mli_status ret = MLI_STATUS_OK;
+    for (uint32_t i = 0; i < graph->num_exec && ret == MLI_STATUS_OK; i++) {
+        mli_graph_exec *e = &exec[i];
+        mli_graph_op_variant *variant = &graph->variants[e->op_idx];
+        const uint32_t num_threads = mli_graph_is_threaded(e->op->type) ? max_threads : 0;
+        mli_graph_op_variant best = *variant;
+        uint64_t best_time = UINT64_MAX;
+        for (uint32_t impl = MLI_GRAPH_IMPL_PLANNED; impl < MLI_GRAPH_IMPL_NUM && ret == MLI_STATUS_OK; impl++) {
+            for (uint32_t threads = MIN(num_threads, 1); threads <= num_threads; threads++) {
+                const mli_graph_op_variant candidate = {(mli_graph_impl)impl, threads};
+                if (mli_graph_prepare_exec(e, &candidate) != MLI_STATUS_OK)
+                    continue;
+
+                ret = mli_graph_exec_run(e);
+                uint64_t time = UINT64_MAX;
+                for (uint32_t r = 0; r < repeats && ret == MLI_STATUS_OK; r++) {
+                    const uint64_t start = cfg->get_time(cfg->ctx);
+                    ret = mli_graph_exec_run(e);
+                    time = MIN(time, cfg->get_time(cfg->ctx) - start);
+                }
+                if (ret != MLI_STATUS_OK)
+                    break;
+                if (time < best_time) {
+                    best = candidate;
+                    best_time = time;
+                }
+            }
+        }
+        *variant = best;
+        mli_status prepare_ret = mli_graph_prepare_exec(e, variant);
+        if (ret == MLI_STATUS_OK)
+            ret = prepare_ret;
+    }
+    return ret;
+}
+
+uint32_t mli_graph_tuning_get_size(uint32_t num_ops) {
+    return sizeof(mli_graph_tuning_header) + num_ops * sizeof(mli_graph_tuning_rec);
+}
+
+mli_status mli_graph_tuning_pack(const mli_graph *graph, void *data, uint32_t data_size) {
+    if (graph == NULL || data == NULL || graph->stage == MLI_GRAPH_STAGE_NONE)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    if (((uintptr_t)data & (sizeof(uint32_t) - 1)) != 0)
+        return MLI_STATUS_MISALIGNMENT_ERROR;
+    if (data_size < mli_graph_tuning_get_size(graph->num_ops))
+        return MLI_STATUS_NOT_ENGH_MEM;
+
+    mli_graph_tuning_header *header = (mli_graph_tuning_header *)data;
+    memset(header, 0, sizeof(*header));
+    header->magic = MLI_GRAPH_TUNING_MAGIC;
+    header->version = MLI_GRAPH_TUNING_VERSION;
+    header->header_size = sizeof(mli_graph_tuning_header);
+    header->record_size = sizeof(mli_graph_tuning_rec);
+    header->num_ops = graph->num_ops;
+
+    mli_graph_tuning_rec *recs = (mli_graph_tuning_rec *)(header + 1);
+    for (uint32_t i = 0; i < graph->num_ops; i++) {
+        memset(&recs[i], 0, sizeof(recs[i]));
+        recs[i].op_type = graph->ops[i].type;
+        recs[i].impl = graph->variants[i].impl;
+        recs[i].num_threads = graph->variants[i].num_threads;
+    }
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_graph_set_tuning(mli_graph *graph, const void *data, uint32_t data_size) {
+    if (graph == NULL || data == NULL || graph->stage == MLI_GRAPH_STAGE_NONE)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    if (((uintptr_t)data & (sizeof(uint32_t) - 1)) != 0)
+        return MLI_STATUS_MISALIGNMENT_ERROR;
+    if (data_size < sizeof(mli_graph_tuning_header))
+        return MLI_STATUS_LENGTH_ERROR;
+
+    // Records come from untrusted memory, so they are validated regardless of debug mode
+    // and applied only if all of them are valid.
+    const mli_graph_tuning_header *header = (const mli_graph_tuning_header *)data;
+    if (header->magic != MLI_GRAPH_TUNING_MAGIC)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    if (header->version != MLI_GRAPH_TUNING_VERSION)
+        return MLI_STATUS_NOT_SUPPORTED;
+    if (header->header_size != sizeof(mli_graph_tuning_header) ||
+            header->record_size != sizeof(mli_graph_tuning_rec) || header->num_ops != graph->num_ops)
+        return MLI_STATUS_BAD_FUNC_CFG;
+    if (data_size < mli_graph_tuning_get_size(header->num_ops))
+        return MLI_STATUS_LENGTH_ERROR;
+
+    const mli_graph_tuning_rec *recs = (const mli_graph_tuning_rec *)(header + 1);
+    uint32_t max_threads = 1;
+    for (uint32_t i = 0; i < header->num_ops; i++) {
+        const mli_graph_tuning_rec *rec = &recs[i];
+        const mli_graph_op_type type = graph->ops[i].type;
+        if (rec->op_type != (uint32_t)type || rec->impl >= MLI_GRAPH_IMPL_NUM ||
+                rec->num_threads > MLI_MAX_NUM_THREADS)
+            return MLI_STATUS_BAD_FUNC_CFG;
+        if (rec->impl == MLI_GRAPH_IMPL_PLANNED && !mli_graph_has_plan(type))
+            return MLI_STATUS_BAD_FUNC_CFG;
+        max_threads = MAX(max_threads, rec->num_threads);
+    }
+
+    // Records made on another machine may require threads which are not available here
+    if (max_threads > mli_prv_parallel_max_threads())
+        return MLI_STATUS_NOT_SUPPORTED;
+
+    for (uint32_t i = 0; i < header->num_ops; i++) {
+        graph->variants[i].impl = (mli_graph_impl)recs[i].impl;
+        graph->variants[i].num_threads = recs[i].num_threads;
+    }
+    return MLI_STATUS_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma MLI_CODE_SECTION_END()
@@ -247,6 +247,29 @@ mli_status mli_hlp_create_subtensor(const mli_tensor *in, const mli_sub_tensor_c
     return MLI_STATUS_OK;
 }
 
+mli_status mli_hlp_concat_views(const mli_tensor *full, const mli_concat_cfg *cfg, const uint32_t *sizes,
+        mli_tensor *views) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_concat_views(full, cfg, sizes, views), __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    // Each view is a sub-tensor of the full tensor of the same rank which differs only in
+    // the concatenation axis. Memory strides are those of the full tensor, so a kernel writing
+    // its output to a view puts results directly to their place in the concatenated tensor.
+    mli_sub_tensor_cfg sub_cfg = {{0}, {0}, full->rank};
+    for (int i = 0; i < (int)full->rank; i++)
+        sub_cfg.size[i] = full->shape[i];
+
+    for (int idx = 0; idx < cfg->tensors_num; idx++) {
+        sub_cfg.size[cfg->axis] = sizes[idx];
+        ret = mli_hlp_create_subtensor(full, &sub_cfg, &views[idx]);
+        if (ret != MLI_STATUS_OK)
+            return ret;
+        sub_cfg.offset[cfg->axis] += sizes[idx];
+    }
+    return MLI_STATUS_OK;
+}
+
 mli_status mli_hlp_convert_tensor_safx(const mli_tensor * src, mli_tensor * dst) {
     mli_status ret = MLI_CHECK_STATUS(mli_chk_convert_tensor(src, dst), __func__);
     if (ret != MLI_STATUS_OK)
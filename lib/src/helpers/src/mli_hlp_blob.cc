@@ -0,0 +1,321 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "mli_check.h"
+#include "mli_config.h"
+#include "mli_debug.h"
+#include "mli_helpers_api.h"
+#include "mli_math_macros.h"
+#include "mli_prv_tensor.h"
+#include "mli_types.h"
+
+#pragma MLI_CODE_SECTION_START(".mli_lib")
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//=====================================================================
+// Blob format
+//=====================================================================
+// Blob is a header followed by an array of tensor descriptors and then by data sections. All fields are
+// 32-bit words in the byte order of the target. Offsets are counted from the beginning of the blob.
+// Data of each tensor starts at an offset aligned to MLI_BLOB_ALIGNMENT. Per-axis quantization parameters
+// of the tensor follow its data: zero points (int16), scales (int16) and scale fractional bits (int8).
+
+#define MLI_BLOB_MAGIC (0x574C494D) // "MLIW"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size;       // Size of header. Offset of the first tensor descriptor.
+    uint32_t desc_size;         // Size of one tensor descriptor.
+    uint32_t num_tensors;
+    uint32_t blob_size;         // Size of the whole blob including data sections.
+    uint32_t reserved[10];
+} mli_blob_header;
+
+typedef struct {
+    char name[MLI_BLOB_NAME_LEN];
+    uint32_t el_type;
+    uint32_t rank;
+    uint32_t shape[MLI_MAX_RANK];
+    int32_t mem_stride[MLI_MAX_RANK];
+    uint32_t layout;
+    uint32_t data_offset;
+    uint32_t data_size;
+    int32_t frac_bits;          // FX tensors only.
+    int32_t dim;                // SA tensors only. Axis of quantization parameters or -1.
+    int32_t zero_point;         // SA tensors only. Value if dim < 0, offset of array otherwise.
+    int32_t scale;              // SA tensors only. Value if dim < 0, offset of array otherwise.
+    int32_t scale_frac_bits;    // SA tensors only. Value if dim < 0, offset of array otherwise.
+    uint32_t reserved[6];
+} mli_blob_tensor_desc;
+
+static_assert(sizeof(mli_blob_header) == 64, "Blob header layout is a part of the format");
+static_assert(sizeof(mli_blob_tensor_desc) == 128, "Blob tensor descriptor layout is a part of the format");
+
+//=====================================================================
+// Private functions
+//=====================================================================
+
+static bool mli_hlp_blob_is_sa(uint32_t el_type) {
+    return el_type == MLI_EL_SA_8 || el_type == MLI_EL_SA_32;
+}
+
+static uint32_t mli_hlp_blob_num_params(const mli_tensor *t) {
+    if (mli_hlp_blob_is_sa(t->el_type) && t->el_params.sa.dim >= 0)
+        return t->shape[t->el_params.sa.dim];
+    return 0;
+}
+
+// Places data and per-axis quantization parameters of the tensor starting from offset.
+// Returns offset of the end of the tensor sections.
+static uint32_t mli_hlp_blob_place(const mli_tensor *t, uint32_t offset, uint32_t *data_offset,
+        uint32_t *params_offset) {
+    const uint32_t num_params = mli_hlp_blob_num_params(t);
+    *data_offset = CEIL_DIV(offset, MLI_BLOB_ALIGNMENT) * MLI_BLOB_ALIGNMENT;
+    *params_offset = CEIL_DIV(*data_offset + mli_prv_tensor_span_size(t), sizeof(int32_t)) * sizeof(int32_t);
+    return *params_offset + num_params * (2 * sizeof(int16_t) + sizeof(int8_t));
+}
+
+static bool mli_hlp_blob_in_range(uint64_t offset, uint64_t size, uint32_t align, uint32_t blob_size) {
+    return offset % align == 0 && offset + size <= blob_size;
+}
+
+// Descriptors come from untrusted memory, so they are validated regardless of debug mode.
+static mli_status mli_hlp_blob_check_desc(const mli_blob_tensor_desc *desc, uint32_t blob_size) {
+    uint32_t elem_size = 0;
+    switch (desc->el_type) {
+        case MLI_EL_FX_8:  elem_size = sizeof(int8_t); break;
+        case MLI_EL_FX_16: elem_size = sizeof(int16_t); break;
+        case MLI_EL_SA_8:  elem_size = sizeof(int8_t); break;
+        case MLI_EL_SA_32: elem_size = sizeof(int32_t); break;
+        case MLI_EL_FP_32: elem_size = sizeof(float); break;
+        default:
+            return MLI_STATUS_BAD_TENSOR;
+    }
+    if (desc->layout != MLI_BLOB_LAYOUT_NATIVE)
+        return MLI_STATUS_NOT_SUPPORTED;
+    if (desc->rank > MLI_MAX_RANK || desc->name[MLI_BLOB_NAME_LEN - 1] != '\0')
+        return MLI_STATUS_BAD_TENSOR;
+
+    uint64_t span = 1;
+    uint64_t stride = 1;
+    for (int i = (int)desc->rank - 1; i >= 0; i--) {
+        if (desc->shape[i] == 0 || desc->mem_stride[i] < 0)
+            return MLI_STATUS_BAD_TENSOR;
+        if (desc->mem_stride[i] != 0)
+            stride = (uint64_t)desc->mem_stride[i];
+        span += (desc->shape[i] - 1) * stride;
+        stride *= desc->shape[i];
+        if (span > UINT32_MAX || stride > UINT32_MAX)
+            return MLI_STATUS_BAD_TENSOR;
+    }
+    if (span * elem_size > desc->data_size ||
+            !mli_hlp_blob_in_range(desc->data_offset, desc->data_size, MLI_BLOB_ALIGNMENT, blob_size))
+        return MLI_STATUS_LENGTH_ERROR;
+
+    if (mli_hlp_blob_is_sa(desc->el_type) && desc->dim >= 0) {
+        if (desc->dim >= (int32_t)desc->rank)
+            return MLI_STATUS_BAD_TENSOR;
+        const uint64_t num_params = desc->shape[desc->dim];
+        if (!mli_hlp_blob_in_range((uint32_t)desc->zero_point, num_params * sizeof(int16_t), sizeof(int16_t),
+                        blob_size) ||
+                !mli_hlp_blob_in_range((uint32_t)desc->scale, num_params * sizeof(int16_t), sizeof(int16_t),
+                        blob_size) ||
+                !mli_hlp_blob_in_range((uint32_t)desc->scale_frac_bits, num_params * sizeof(int8_t),
+                        sizeof(int8_t), blob_size))
+            return MLI_STATUS_LENGTH_ERROR;
+    }
+    return MLI_STATUS_OK;
+}
+
+static const mli_blob_tensor_desc *mli_hlp_blob_desc(const void *blob, uint32_t idx) {
+    const mli_blob_header *header = (const mli_blob_header *)blob;
+    return (const mli_blob_tensor_desc *)((const int8_t *)blob + header->header_size + idx * header->desc_size);
+}
+
+static void mli_hlp_blob_fill_tensor(const void *blob, const mli_blob_tensor_desc *desc, mli_tensor *out) {
+    // Tensor structure has no const data pointer. Data of the blob is still not modified by the library.
+    int8_t *base = (int8_t *)blob;
+    out->data.mem.pi8 = base + desc->data_offset;
+    out->data.capacity = desc->data_size;
+    out->rank = desc->rank;
+    for (uint32_t i = 0; i < MLI_MAX_RANK; i++) {
+        out->shape[i] = (i < desc->rank) ? desc->shape[i] : 0;
+        out->mem_stride[i] = (i < desc->rank) ? desc->mem_stride[i] : 0;
+    }
+    out->el_type = (mli_element_type)desc->el_type;
+
+    if (desc->el_type == MLI_EL_FX_8 || desc->el_type == MLI_EL_FX_16) {
+        out->el_params.fx.frac_bits = (int8_t)desc->frac_bits;
+    } else if (mli_hlp_blob_is_sa(desc->el_type)) {
+        out->el_params.sa.type = MLI_EL_PARAM_SC16_ZP16;
+        out->el_params.sa.dim = desc->dim;
+        if (desc->dim < 0) {
+            out->el_params.sa.zero_point.mem.i16 = (int16_t)desc->zero_point;
+            out->el_params.sa.scale.mem.i16 = (int16_t)desc->scale;
+            out->el_params.sa.scale_frac_bits.mem.i8 = (int8_t)desc->scale_frac_bits;
+            out->el_params.sa.zero_point.capacity = 0;
+            out->el_params.sa.scale.capacity = 0;
+            out->el_params.sa.scale_frac_bits.capacity = 0;
+        } else {
+            const uint32_t num_params = desc->shape[desc->dim];
+            out->el_params.sa.zero_point.mem.pi16 = (int16_t *)(base + desc->zero_point);
+            out->el_params.sa.scale.mem.pi16 = (int16_t *)(base + desc->scale);
+            out->el_params.sa.scale_frac_bits.mem.pi8 = base + desc->scale_frac_bits;
+            out->el_params.sa.zero_point.capacity = num_params * sizeof(int16_t);
+            out->el_params.sa.scale.capacity = num_params * sizeof(int16_t);
+            out->el_params.sa.scale_frac_bits.capacity = num_params * sizeof(int8_t);
+        }
+    }
+}
+
+//=====================================================================
+// Public functions
+//=====================================================================
+
+uint32_t mli_hlp_blob_get_size(const mli_tensor *const *tensors, uint32_t num_tensors) {
+    uint32_t offset = sizeof(mli_blob_header) + num_tensors * sizeof(mli_blob_tensor_desc);
+    for (uint32_t i = 0; i < num_tensors; i++) {
+        uint32_t data_offset, params_offset;
+        offset = mli_hlp_blob_place(tensors[i], offset, &data_offset, &params_offset);
+    }
+    return offset;
+}
+
+mli_status mli_hlp_blob_pack(const mli_tensor *const *tensors, const char *const *names, uint32_t num_tensors,
+        void *blob, uint32_t blob_size) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_blob_pack(tensors, names, num_tensors, blob, blob_size), __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    int8_t *base = (int8_t *)blob;
+    mli_blob_header *header = (mli_blob_header *)blob;
+    mli_blob_tensor_desc *descs = (mli_blob_tensor_desc *)(base + sizeof(mli_blob_header));
+    uint32_t offset = sizeof(mli_blob_header) + num_tensors * sizeof(mli_blob_tensor_desc);
+    memset(blob, 0, offset);
+
+    for (uint32_t i = 0; i < num_tensors; i++) {
+        const mli_tensor *t = tensors[i];
+        mli_blob_tensor_desc *desc = &descs[i];
+        uint32_t data_offset, params_offset;
+        const uint32_t end = mli_hlp_blob_place(t, offset, &data_offset, &params_offset);
+        const uint32_t data_size = mli_prv_tensor_span_size(t);
+
+        strncpy(desc->name, names[i], MLI_BLOB_NAME_LEN - 1);
+        desc->el_type = t->el_type;
+        desc->rank = t->rank;
+        for (uint32_t dim = 0; dim < t->rank; dim++) {
+            desc->shape[dim] = t->shape[dim];
+            desc->mem_stride[dim] = t->mem_stride[dim];
+        }
+        desc->layout = MLI_BLOB_LAYOUT_NATIVE;
+        desc->data_offset = data_offset;
+        desc->data_size = data_size;
+        desc->dim = -1;
+
+        // Padding is zeroed to keep blobs reproducible
+        memset(base + offset, 0, end - offset);
+        memcpy(base + data_offset, t->data.mem.pi8, data_size);
+
+        if (t->el_type == MLI_EL_FX_8 || t->el_type == MLI_EL_FX_16) {
+            desc->frac_bits = t->el_params.fx.frac_bits;
+        } else if (mli_hlp_blob_is_sa(t->el_type)) {
+            if (t->el_params.sa.dim < 0) {
+                desc->zero_point = t->el_params.sa.zero_point.mem.i16;
+                desc->scale = t->el_params.sa.scale.mem.i16;
+                desc->scale_frac_bits = t->el_params.sa.scale_frac_bits.mem.i8;
+            } else {
+                const uint32_t num_params = mli_hlp_blob_num_params(t);
+                desc->dim = t->el_params.sa.dim;
+                desc->zero_point = params_offset;
+                desc->scale = params_offset + num_params * sizeof(int16_t);
+                desc->scale_frac_bits = params_offset + 2 * num_params * sizeof(int16_t);
+                memcpy(base + desc->zero_point, t->el_params.sa.zero_point.mem.pi16, num_params * sizeof(int16_t));
+                memcpy(base + desc->scale, t->el_params.sa.scale.mem.pi16, num_params * sizeof(int16_t));
+                memcpy(base + desc->scale_frac_bits, t->el_params.sa.scale_frac_bits.mem.pi8,
+                        num_params * sizeof(int8_t));
+            }
+        }
+        offset = end;
+    }
+
+    header->magic = MLI_BLOB_MAGIC;
+    header->version = MLI_BLOB_VERSION;
+    header->header_size = sizeof(mli_blob_header);
+    header->desc_size = sizeof(mli_blob_tensor_desc);
+    header->num_tensors = num_tensors;
+    header->blob_size = offset;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_hlp_blob_open(const void *blob, uint32_t blob_size, uint32_t *num_tensors) {
+    if (blob == NULL || num_tensors == NULL)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    if (((uintptr_t)blob & (sizeof(uint32_t) - 1)) != 0)
+        return MLI_STATUS_MISALIGNMENT_ERROR;
+    if (blob_size < sizeof(mli_blob_header))
+        return MLI_STATUS_LENGTH_ERROR;
+
+    const mli_blob_header *header = (const mli_blob_header *)blob;
+    if (header->magic != MLI_BLOB_MAGIC)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    if (header->version != MLI_BLOB_VERSION)
+        return MLI_STATUS_NOT_SUPPORTED;
+    if (header->header_size != sizeof(mli_blob_header) || header->desc_size != sizeof(mli_blob_tensor_desc))
+        return MLI_STATUS_BAD_FUNC_CFG;
+    if (header->blob_size > blob_size ||
+            (uint64_t)header->header_size + (uint64_t)header->num_tensors * header->desc_size > header->blob_size)
+        return MLI_STATUS_LENGTH_ERROR;
+
+    for (uint32_t i = 0; i < header->num_tensors; i++) {
+        mli_status ret = mli_hlp_blob_check_desc(mli_hlp_blob_desc(blob, i), header->blob_size);
+        if (ret != MLI_STATUS_OK)
+            return ret;
+    }
+    *num_tensors = header->num_tensors;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_hlp_blob_get_tensor(const void *blob, uint32_t idx, mli_tensor *out) {
+    if (blob == NULL || out == NULL)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    if (idx >= ((const mli_blob_header *)blob)->num_tensors)
+        return MLI_STATUS_ARGUMENT_ERROR;
+
+    mli_hlp_blob_fill_tensor(blob, mli_hlp_blob_desc(blob, idx), out);
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_hlp_blob_find_tensor(const void *blob, const char *name, mli_tensor *out) {
+    if (blob == NULL || name == NULL || out == NULL)
+        return MLI_STATUS_ARGUMENT_ERROR;
+
+    const uint32_t num_tensors = ((const mli_blob_header *)blob)->num_tensors;
+    for (uint32_t i = 0; i < num_tensors; i++) {
+        const mli_blob_tensor_desc *desc = mli_hlp_blob_desc(blob, i);
+        if (strncmp(desc->name, name, MLI_BLOB_NAME_LEN) == 0) {
+            mli_hlp_blob_fill_tensor(blob, desc, out);
+            return MLI_STATUS_OK;
+        }
+    }
+    return MLI_STATUS_ARGUMENT_ERROR;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma MLI_CODE_SECTION_END()
@@ -0,0 +1,127 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mli_check.h"
+#include "mli_config.h"
+#include "mli_debug.h"
+#include "mli_helpers_api.h"
+#include "mli_math_macros.h"
+#include "mli_prv_tensor.h"
+#include "mli_types.h"
+
+#pragma MLI_CODE_SECTION_START(".mli_lib")
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//=====================================================================
+// Private functions
+//=====================================================================
+
+// Placement order: larger buffers first, buffers of equal size in order of declaration.
+static bool mli_hlp_mem_plan_precedes(const mli_mem_plan_buf *bufs, uint32_t a, uint32_t b) {
+    if (bufs[a].size != bufs[b].size)
+        return bufs[a].size > bufs[b].size;
+    return a < b;
+}
+
+static bool mli_hlp_mem_plan_conflict(const mli_mem_plan_buf *a, const mli_mem_plan_buf *b) {
+    return a->bank == b->bank && a->first_op <= b->last_op && b->first_op <= a->last_op;
+}
+
+// Lowest aligned offset of buffer cur which doesn't overlap already placed buffers alive at the same time.
+// Candidate offsets are the beginning of the bank and the ends of conflicting buffers.
+static uint32_t mli_hlp_mem_plan_place(const mli_mem_plan_buf *bufs, uint32_t num_bufs, uint32_t cur) {
+    const mli_mem_plan_buf *buf = &bufs[cur];
+    const uint32_t align = (buf->alignment != 0) ? buf->alignment : 1;
+    uint32_t best = UINT32_MAX;
+    for (int64_t cand_idx = -1; cand_idx < (int64_t)num_bufs; cand_idx++) {
+        uint32_t cand = 0;
+        if (cand_idx >= 0) {
+            const mli_mem_plan_buf *other = &bufs[cand_idx];
+            if (!mli_hlp_mem_plan_precedes(bufs, cand_idx, cur) || !mli_hlp_mem_plan_conflict(buf, other))
+                continue;
+            cand = CEIL_DIV(other->offset + other->size, align) * align;
+        }
+        if (cand >= best)
+            continue;
+
+        bool is_free = true;
+        for (uint32_t j = 0; j < num_bufs && is_free; j++) {
+            const mli_mem_plan_buf *other = &bufs[j];
+            if (!mli_hlp_mem_plan_precedes(bufs, j, cur) || !mli_hlp_mem_plan_conflict(buf, other))
+                continue;
+            is_free = cand >= other->offset + other->size || cand + buf->size <= other->offset;
+        }
+        if (is_free)
+            best = cand;
+    }
+    return best;
+}
+
+//=====================================================================
+// Public functions
+//=====================================================================
+
+mli_status mli_hlp_mem_plan(mli_mem_plan_buf *bufs, uint32_t num_bufs, uint32_t *peak_size, uint32_t num_banks) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_mem_plan(bufs, num_bufs, peak_size, num_banks), __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    for (uint32_t i = 0; i < num_bufs; i++) {
+        if (bufs[i].size == 0)
+            bufs[i].size = mli_prv_tensor_span_size(bufs[i].tensor);
+    }
+    for (uint32_t bank = 0; bank < num_banks; bank++)
+        peak_size[bank] = 0;
+
+    // Greedy by size: buffers are placed one by one in placement order. Placement of each buffer depends
+    // only on the buffers preceding it, so the next buffer is looked up instead of sorting them in place.
+    int64_t prev = -1;
+    for (uint32_t step = 0; step < num_bufs; step++) {
+        uint32_t cur = num_bufs;
+        for (uint32_t i = 0; i < num_bufs; i++) {
+            if (prev >= 0 && !mli_hlp_mem_plan_precedes(bufs, (uint32_t)prev, i))
+                continue;
+            if (cur == num_bufs || mli_hlp_mem_plan_precedes(bufs, i, cur))
+                cur = i;
+        }
+        MLI_ASSERT(cur < num_bufs);
+        bufs[cur].offset = mli_hlp_mem_plan_place(bufs, num_bufs, cur);
+        peak_size[bufs[cur].bank] = MAX(peak_size[bufs[cur].bank], bufs[cur].offset + bufs[cur].size);
+        prev = cur;
+    }
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_hlp_mem_plan_bind(const mli_mem_plan_buf *bufs, uint32_t num_bufs, int8_t *const *bank_mem,
+        uint32_t num_banks) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_mem_plan_bind(bufs, num_bufs, bank_mem, num_banks), __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    for (uint32_t i = 0; i < num_bufs; i++) {
+        mli_tensor *t = bufs[i].tensor;
+        if (t == NULL)
+            continue;
+        t->data.mem.pi8 = bank_mem[bufs[i].bank] + bufs[i].offset;
+        t->data.capacity = bufs[i].size;
+    }
+    return MLI_STATUS_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma MLI_CODE_SECTION_END()
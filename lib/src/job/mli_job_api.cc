@@ -0,0 +1,191 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+// Asynchronous execution of jobs (kernel calls, graph runs) with the handle model of the mli_mov API.
+// On host builds with threads, jobs are executed in order of start by a pool of worker threads. Workers are
+// persistent: they are created when no idle worker is left for a started job, and sleep between jobs.
+
+#include <stddef.h>
+
+#include "mli_config.h"
+#include "mli_debug.h"
+#include "mli_job_api.h"
+#include "mli_types.h"
+
+#if defined(MLI_HOST_THREADS)
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+class job_pool {
+public:
+    ~job_pool() {
+        {
+            std::lock_guard<std::mutex> lk(lock);
+            stop = true;
+        }
+        start_cv.notify_all();
+        for (uint32_t i = 0; i < num_workers; i++) {
+            workers[i].join();
+        }
+    }
+
+    // State of a handle is only changed under the lock once the handle is started.
+    mli_status submit(mli_job_handle_t *h) {
+        {
+            std::lock_guard<std::mutex> lk(lock);
+            if (h->state != MLI_JOB_STATE_PREPARED && h->state != MLI_JOB_STATE_DONE)
+                return MLI_STATUS_ARGUMENT_ERROR;
+            h->state = MLI_JOB_STATE_RUNNING;
+            h->next = nullptr;
+            if (tail != nullptr)
+                tail->next = h;
+            else
+                head = h;
+            tail = h;
+            if (num_idle == 0 && num_workers < MLI_MAX_NUM_JOB_WORKERS) {
+                workers[num_workers] = std::thread(&job_pool::worker_loop, this);
+                num_workers++;
+            }
+        }
+        start_cv.notify_one();
+        return MLI_STATUS_OK;
+    }
+
+    mli_job_state state(const mli_job_handle_t *h) {
+        std::lock_guard<std::mutex> lk(lock);
+        return h->state;
+    }
+
+    mli_status wait(mli_job_handle_t *h) {
+        std::unique_lock<std::mutex> lk(lock);
+        if (h->state == MLI_JOB_STATE_INVALID || h->state == MLI_JOB_STATE_PREPARED)
+            return MLI_STATUS_ARGUMENT_ERROR;
+        done_cv.wait(lk, [h] { return h->state == MLI_JOB_STATE_DONE; });
+        return h->status;
+    }
+
+private:
+    void worker_loop() {
+        std::unique_lock<std::mutex> lk(lock);
+        for (;;) {
+            num_idle++;
+            start_cv.wait(lk, [this] { return head != nullptr || stop; });
+            num_idle--;
+            // queued jobs are completed before the pool is stopped.
+            if (head == nullptr) return;
+            mli_job_handle_t *h = head;
+            head = h->next;
+            if (head == nullptr) tail = nullptr;
+            lk.unlock();
+
+            const mli_status status = h->fn(h->ctx);
+            // callback comes before the done state, so it has completed once mli_job_wait returns.
+            if (h->cb != NULL) {
+                h->cb(h->cookie);
+            }
+
+            lk.lock();
+            h->status = status;
+            h->state = MLI_JOB_STATE_DONE;
+            done_cv.notify_all();
+        }
+    }
+
+    std::mutex lock;
+    std::condition_variable start_cv;
+    std::condition_variable done_cv;
+    std::thread workers[MLI_MAX_NUM_JOB_WORKERS];
+    uint32_t num_workers = 0;
+    uint32_t num_idle = 0;
+    bool stop = false;
+    mli_job_handle_t *head = nullptr;
+    mli_job_handle_t *tail = nullptr;
+};
+
+job_pool pool;
+
+} // namespace
+
+#endif // MLI_HOST_THREADS
+
+#pragma MLI_CODE_SECTION_START(".mli_lib")
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+mli_status mli_job_prepare(mli_job_handle_t* h, mli_job_fn fn, void* ctx) {
+    if (h == NULL || fn == NULL)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    h->fn = fn;
+    h->ctx = ctx;
+    h->cb = NULL;
+    h->cookie = 0;
+    h->state = MLI_JOB_STATE_PREPARED;
+    h->status = MLI_STATUS_OK;
+    h->next = NULL;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_job_registercallback(mli_job_handle_t* h, void (*cb)(int32_t), int32_t cookie) {
+    if (h == NULL || h->state != MLI_JOB_STATE_PREPARED)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    h->cb = cb;
+    h->cookie = cookie;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_job_start(mli_job_handle_t* h) {
+    if (h == NULL)
+        return MLI_STATUS_ARGUMENT_ERROR;
+#if defined(MLI_HOST_THREADS)
+    return pool.submit(h);
+#else
+    if (h->state != MLI_JOB_STATE_PREPARED && h->state != MLI_JOB_STATE_DONE)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    h->state = MLI_JOB_STATE_RUNNING;
+    h->status = h->fn(h->ctx);
+    if (h->cb != NULL) {
+        h->cb(h->cookie);
+    }
+    h->state = MLI_JOB_STATE_DONE;
+    return MLI_STATUS_OK;
+#endif
+}
+
+bool mli_job_isdone(mli_job_handle_t* h) {
+    MLI_ASSERT(h != NULL);
+#if defined(MLI_HOST_THREADS)
+    return pool.state(h) == MLI_JOB_STATE_DONE;
+#else
+    return h->state == MLI_JOB_STATE_DONE;
+#endif
+}
+
+mli_status mli_job_wait(mli_job_handle_t* h) {
+    if (h == NULL)
+        return MLI_STATUS_ARGUMENT_ERROR;
+#if defined(MLI_HOST_THREADS)
+    return pool.wait(h);
+#else
+    if (h->state != MLI_JOB_STATE_DONE)
+        return MLI_STATUS_ARGUMENT_ERROR;
+    return h->status;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma MLI_CODE_SECTION_END()
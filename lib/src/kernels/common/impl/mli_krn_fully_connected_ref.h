@@ -16,6 +16,7 @@
 #include "mli_private_types.h"
 #include "mli_types.h"
 #include "mli_krn_dotprod.h"
+#include "mli_krn_epilogue.h"
 
 namespace mli {
 namespace krn {
@@ -26,7 +27,8 @@ namespace ref {
 //========================================================
 // Unified IP (Inner Product) template
 //========================================================
-template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, bool no_zp>
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, bool no_zp,
+          typename epilogue_T>
 MLI_FORCE_INLINE void inner_product(
         const MLI_PTR(io_T) __restrict in,
         const MLI_PTR(w_T)  __restrict weights,
@@ -37,7 +39,8 @@ MLI_FORCE_INLINE void inner_product(
         const int w_ch_out_mem_stride,
         quant_T quant_params,
         const io_T val_min_limit,
-        const io_T val_max_limit) {
+        const io_T val_max_limit,
+        const epilogue_T &epilogue) {
     // Unified Inner Product for both quantization scheme:  MLI_FX (symmetric data, scales are power of two)
     // and s8asym (assymetric data, scales of any value)
     // Calculation implies dotproduct and bias add:
@@ -73,23 +76,66 @@ MLI_FORCE_INLINE void inner_product(
         accu = mli_math_add_fx(accu, other_additives);
         accu = mli::krn::bias_additive(&biases[o_idx], accu, &quant_params);
 
-        // Cast result to output type with scaling
+        // Cast result to output type with scaling, apply built-in ReLU and epilogue
         io_T out_val = mli::krn::result_cast<io_T, acc_T, quant_T>(accu, &quant_params);
         out_val = MIN(out_val, val_max_limit);
         out_val = MAX(out_val, val_min_limit);
-        out[o_idx] = out_val;
+        out[o_idx] = epilogue.apply(out_val, 0, 0, o_idx);
     }
 }
 
+//========================================================================================
+// Inner product without epilogue uses the variant chosen for the platform,
+// otherwise the reference core applies the epilogue to each output value.
+//========================================================================================
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, bool no_zp>
+MLI_FORCE_INLINE void inner_product_epilogue(
+        const MLI_PTR(io_T) __restrict in,
+        const MLI_PTR(w_T)  __restrict weights,
+        const MLI_PTR(b_T)  __restrict biases,
+        MLI_CONV_OUT_PTR(io_T) __restrict out,
+        const int in_elements,
+        const int out_elements,
+        const int w_ch_out_mem_stride,
+        quant_T quant_params,
+        const io_T val_min_limit,
+        const io_T val_max_limit,
+        const no_epilogue &) {
+    mli::krn::inner_product<io_T, w_T, b_T, acc_T, quant_T, no_zp>(
+            in, weights, biases, out, in_elements, out_elements, w_ch_out_mem_stride,
+            quant_params, val_min_limit, val_max_limit);
+}
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, bool no_zp,
+          typename epilogue_T>
+MLI_FORCE_INLINE void inner_product_epilogue(
+        const MLI_PTR(io_T) __restrict in,
+        const MLI_PTR(w_T)  __restrict weights,
+        const MLI_PTR(b_T)  __restrict biases,
+        MLI_CONV_OUT_PTR(io_T) __restrict out,
+        const int in_elements,
+        const int out_elements,
+        const int w_ch_out_mem_stride,
+        quant_T quant_params,
+        const io_T val_min_limit,
+        const io_T val_max_limit,
+        const epilogue_T &epilogue) {
+    mli::krn::ref::inner_product<io_T, w_T, b_T, acc_T, quant_T, no_zp, epilogue_T>(
+            in, weights, biases, out, in_elements, out_elements, w_ch_out_mem_stride,
+            quant_params, val_min_limit, val_max_limit, epilogue);
+}
+
 //========================================================================================
 // Common routin for pre-calculation of various fully connected parameters and running it.
 //========================================================================================
-template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, bool is_bias_ext>
-MLI_FORCE_INLINE void fully_connected_prepare_and_run(
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, bool is_bias_ext,
+          typename epilogue_T>
+MLI_FORCE_INLINE void fully_connected_prepare_and_run_common(
         const mli_tensor *in,
         const mli_tensor *weights,
         const mli_tensor *bias,
         const mli_fully_connected_cfg *cfg,
+        const mli_epilogue_cfg *epilogue_cfg,
         mli_tensor *out) {
     mli_prv_fx_init_dsp_ctrl();
 
@@ -125,10 +171,38 @@ MLI_FORCE_INLINE void fully_connected_prepare_and_run(
     const int w_ch_out_mem_stride = (w_ch_out_mem_stride_from_tensor != 0) ?
             w_ch_out_mem_stride_from_tensor : ch_out;
 
+    epilogue_T ep;
+    define_epilogue(epilogue_cfg, out, &ep);
+
     // Run basic calculation
     //=======================================================================
-    mli::krn::inner_product<io_T, w_T, b_T, acc_T, quant_T, is_bias_ext>(
-            in_ptr, w_ptr, b_ptr, out_ptr, in_sz, ch_out, w_ch_out_mem_stride, /* cent_area, */ params, (io_T)val_limit.min, (io_T)val_limit.max);
+    inner_product_epilogue<io_T, w_T, b_T, acc_T, quant_T, is_bias_ext>(
+            in_ptr, w_ptr, b_ptr, out_ptr, in_sz, ch_out, w_ch_out_mem_stride, /* cent_area, */ params,
+            (io_T)val_limit.min, (io_T)val_limit.max, ep);
+    epilogue_update_out_params(epilogue_cfg, ep, out);
+}
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, bool is_bias_ext>
+MLI_FORCE_INLINE void fully_connected_prepare_and_run(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_fully_connected_cfg *cfg,
+        mli_tensor *out) {
+    fully_connected_prepare_and_run_common<io_T, w_T, b_T, acc_T, quant_T, is_bias_ext, no_epilogue>(
+            in, weights, bias, cfg, nullptr, out);
+}
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, bool is_bias_ext>
+MLI_FORCE_INLINE void fully_connected_prepare_and_run_epilogue(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_fully_connected_cfg *cfg,
+        const mli_epilogue_cfg *epilogue_cfg,
+        mli_tensor *out) {
+    fully_connected_prepare_and_run_common<io_T, w_T, b_T, acc_T, quant_T, is_bias_ext, epilogue<io_T>>(
+            in, weights, bias, cfg, epilogue_cfg, out);
 }
 #pragma MLI_CODE_SECTION_END()
 } // namespace ref
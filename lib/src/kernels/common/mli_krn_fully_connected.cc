@@ -143,6 +143,69 @@ mli_status mli_krn_fully_connected_sa8_sa8_sa32_ext_bias(
 
     return ret;
 }
+//========================================================
+// Epilogue functions
+//========================================================
+// Epilogue is applied by the reference core, so scalar accumulators are used on all platforms
+mli_status mli_krn_fully_connected_fx16_epilogue(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_fully_connected_cfg* cfg,
+        const mli_epilogue_cfg* epilogue,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_fully_connected_fx16(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_fully_connected_epilogue(epilogue, in, weights), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::fully_connected_prepare_and_run_epilogue
+        <int16_t, int16_t, int16_t, mli_acc40_t, mli::krn::fx_quant_specific_params, /*is_bias_ext = */ false>
+        (in, weights, bias, cfg, epilogue, out);
+
+    return ret;
+}
+
+mli_status mli_krn_fully_connected_fx16_fx8_fx8_epilogue(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_fully_connected_cfg* cfg,
+        const mli_epilogue_cfg* epilogue,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_fully_connected_fx8w16d(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_fully_connected_epilogue(epilogue, in, weights), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::fully_connected_prepare_and_run_epilogue
+        <int16_t, int8_t, int8_t, mli_acc32_t, mli::krn::fx_quant_specific_params, /*is_bias_ext = */ false>
+        (in, weights, bias, cfg, epilogue, out);
+
+    return ret;
+}
+
+mli_status mli_krn_fully_connected_sa8_sa8_sa32_epilogue(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_fully_connected_cfg* cfg,
+        const mli_epilogue_cfg* epilogue,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_fully_connected_sa8_sa8_sa32(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_fully_connected_epilogue(epilogue, in, weights), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::fully_connected_prepare_and_run_epilogue
+        <int8_t, int8_t, int32_t, mli_acc32_t, mli::krn::s8asym_quant_specific_params, /*is_bias_ext = */ false>
+        (in, weights, bias, cfg, epilogue, out);
+
+    return ret;
+}
 #pragma MLI_CODE_SECTION_END()
 
 #ifdef __cplusplus
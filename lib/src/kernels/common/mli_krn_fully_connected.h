@@ -30,14 +30,17 @@ namespace krn {
 #if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
 using mli::krn::vdsp::inner_product;
 using mli::krn::ref::fully_connected_prepare_and_run;
+using mli::krn::ref::fully_connected_prepare_and_run_epilogue;
 
 #elif !defined(MLI_BUILD_REFERENCE) && defined(__FXAPI__)
 using mli::krn::ref::inner_product;
 using mli::krn::ref::fully_connected_prepare_and_run;
+using mli::krn::ref::fully_connected_prepare_and_run_epilogue;
 
 #else
 using mli::krn::ref::inner_product;
 using mli::krn::ref::fully_connected_prepare_and_run;
+using mli::krn::ref::fully_connected_prepare_and_run_epilogue;
 
 #endif
 } // namespace krn
@@ -14,6 +14,7 @@
 #include "mli_prv_quant.h"
 #include "mli_types.h"
 #include "mli_prv_layout.h"
+#include "mli_krn_epilogue_decl.h"
 
 namespace mli {
 namespace krn {
@@ -28,7 +29,8 @@ namespace krn {
 // REF
 ////////////////////////////////////////////////////////////////////////////////
 namespace ref {
-template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, bool no_zp>
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, bool no_zp,
+          typename epilogue_T = no_epilogue>
 MLI_FORCE_INLINE void inner_product(
         const MLI_PTR(io_T) __restrict in,
         const MLI_PTR(w_T)  __restrict weights,
@@ -39,7 +41,8 @@ MLI_FORCE_INLINE void inner_product(
         const int w_ch_out_mem_stride,
         quant_T quant_params,
         const io_T val_min_limit,
-        const io_T val_max_limit);
+        const io_T val_max_limit,
+        const epilogue_T &epilogue = epilogue_T());
 
 template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, bool is_bias_ext>
 MLI_FORCE_INLINE void fully_connected_prepare_and_run(
@@ -48,6 +51,15 @@ MLI_FORCE_INLINE void fully_connected_prepare_and_run(
         const mli_tensor *bias,
         const mli_fully_connected_cfg *cfg,
         mli_tensor *out);
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, bool is_bias_ext>
+MLI_FORCE_INLINE void fully_connected_prepare_and_run_epilogue(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_fully_connected_cfg *cfg,
+        const mli_epilogue_cfg *epilogue_cfg,
+        mli_tensor *out);
 } // namespace ref
 
 ////////////////////////////////////////////////////////////////////////////////
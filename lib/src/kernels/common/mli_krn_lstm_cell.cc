@@ -105,6 +105,16 @@ mli_status mli_krn_lstm_cell_sa8_sa8_sa32 (
 
 }
 
+int32_t mli_krn_lstm_cell_get_scratch_size(
+        const mli_tensor * in,
+        const mli_tensor * weights_in,
+        const mli_rnn_cell_cfg * cfg) {
+    // Dense part keeps results of all 4 gates for a single step in the input element type.
+    // The size doesn't depend on the processing mode, so cfg is accepted for uniformity only.
+    const uint32_t out_elements = weights_in->shape[KRNL_RNN_W_OUT_ELEMS_DIM];
+    return 4 * out_elements * mli_hlp_tensor_element_size(in);
+}
+
 #pragma MLI_CODE_SECTION_END()
 
 #ifdef __cplusplus
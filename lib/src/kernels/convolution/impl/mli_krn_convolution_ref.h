@@ -9,6 +9,8 @@
 #ifndef _MLI_KRN_CONVOLUTION_REF_H_
 #define _MLI_KRN_CONVOLUTION_REF_H_
 
+#include <string.h>
+
 #include "mli_api.h"
 #include "mli_prv_tensor.h"
 #include "mli_prv_quant.h"
@@ -17,6 +19,8 @@
 #include "mli_types.h"
 #include "mli_krn_dotprod.h"
 #include "mli_prv_layout.h"
+#include "mli_prv_parallel.h"
+#include "mli_krn_epilogue.h"
 
 namespace mli {
 namespace krn {
@@ -27,7 +31,8 @@ namespace ref {
 //========================================================
 // Unified Generic Convolution 2D template
 //========================================================
-template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, int fix_kernel_width, int fix_kernel_height>
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, int fix_kernel_width, int fix_kernel_height,
+          typename epilogue_T>
 MLI_FORCE_INLINE void convolution2D(
         const tensor_private_t<MLI_PTR(io_T)> &in,
         const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights,
@@ -40,7 +45,8 @@ MLI_FORCE_INLINE void convolution2D(
         const int stride_height, const int stride_width,
         const int dilation_height, const int dilation_width,
         const int padding_top, const int padding_left,
-        const int padding_bot, const int padding_right) {
+        const int padding_bot, const int padding_right,
+        const epilogue_T &epilogue) {
     // Unified Generic convolution for all layouts (CHW/HWC/HWCN) and quantization scheme:  
     // MLI_FX (symmetric data, scales are power of two) and s8asym (assymetric data, scales of any value)
     // For each output point Calculation implies dotproduct and bias add:
@@ -118,11 +124,11 @@ MLI_FORCE_INLINE void convolution2D(
 
                 accu = mli::krn::bias_additive(&biases[out_ch_idx], accu, &quant_params);
 
-                // Cast result to output type, apply built-in ReLU Applying and write result
+                // Cast result to output type, apply built-in ReLU and epilogue and write result
                 io_T out_val = mli::krn::result_cast<io_T, acc_T, quant_T>(accu, &quant_params);
                 out_val = MIN(out_val, val_max_limit);
                 out_val = MAX(out_val, val_min_limit);
-                *out_ptr = out_val;
+                *out_ptr = epilogue.apply(out_val, H_idx, W_idx, out_ch_idx);
             } // for out_ch_idx
         } // for W_idx
     } // for H_idx 
@@ -131,7 +137,8 @@ MLI_FORCE_INLINE void convolution2D(
 //========================================================
 // Unified Depthwise convolution 2D template
 //========================================================
-template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, int fix_kernel_width, int fix_kernel_height>
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, int fix_kernel_width, int fix_kernel_height,
+          typename epilogue_T>
 MLI_FORCE_INLINE void depthwise_convolution2D(
         const tensor_private_t<MLI_PTR(io_T)> &in,
         const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights,
@@ -144,7 +151,8 @@ MLI_FORCE_INLINE void depthwise_convolution2D(
         const int stride_height, const int stride_width,
         const int dilation_height, const int dilation_width,
         const int padding_top, const int padding_left,
-        const int padding_bot, const int padding_right) {
+        const int padding_bot, const int padding_right,
+        const epilogue_T &epilogue) {
     // Unified Depthwise convolutions for all layouts (NCHW/HWCN) and quantization schemes:  
     // MLI_FX (symmetric data, scales are power of two) and s8asym (assymetric data, scales of any value)
     // For more info on calculations see generic convolution 2D notes above 
@@ -205,7 +213,7 @@ MLI_FORCE_INLINE void depthwise_convolution2D(
                 accu = mli::krn::bias_additive(&biases[out_ch_idx], accu, &quant_params);
                 //accu = mli_math_add(accu, other_additives);
 
-                // Cast result to output type, apply built-in ReLU Applying and write result
+                // Cast result to output type, apply built-in ReLU and epilogue and write result
                 io_T out_val = mli::krn::result_cast<io_T, acc_T, quant_T>(accu, &quant_params);
                 out_val = MIN(out_val, val_max_limit);
                 out_val = MAX(out_val, val_min_limit);
@@ -214,7 +222,7 @@ MLI_FORCE_INLINE void depthwise_convolution2D(
                         + out.row_mem_stride * H_idx
                         + out.col_mem_stride * W_idx
                         + out.ch_mem_stride * out_ch_idx;
-                *out_ptr = out_val;
+                *out_ptr = epilogue.apply(out_val, H_idx, W_idx, out_ch_idx);
             } // for in_ch_idx
         } // for W_idx
     } // for H_idx
@@ -225,10 +233,10 @@ MLI_FORCE_INLINE void depthwise_convolution2D_wrapper(
         MLI_PTR(io_T) __restrict in_ptr,
         MLI_PTR(w_T) __restrict w_ptr,
         MLI_CONV_OUT_PTR(io_T) __restrict out_ptr,
-        tensor_private_t<MLI_PTR(io_T)> &in,
-        conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights,
+        const tensor_private_t<MLI_PTR(io_T)> &in,
+        const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights,
         const MLI_PTR(b_T)  __restrict biases,
-        tensor_private_t<MLI_CONV_OUT_PTR(io_T)> &out,
+        const tensor_private_t<MLI_CONV_OUT_PTR(io_T)> &out,
         const rect_t &perception_area,
         quant_T quant_params,
         const io_T val_min_limit,
@@ -254,19 +262,25 @@ MLI_FORCE_INLINE void depthwise_convolution2D_wrapper(
 }
 
 //====================================================================================
-// Common routin for pre-calculation of various convolution parameters and running it.
+// Common routin for pre-calculation of various convolution parameters.
 //====================================================================================
 template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
           mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
-MLI_FORCE_INLINE void conv2d_prepare_and_run(
+MLI_FORCE_INLINE void conv2d_prepare(
         const mli_tensor *in,
         const mli_tensor *weights,
         const mli_tensor *bias,
         const mli_conv2d_cfg *cfg,
-        mli_tensor *out) {
-    mli_prv_fx_init_dsp_ctrl();
-    const uint8_t stride_width = cfg->stride_width;
-    const uint8_t stride_height = cfg->stride_height;
+        mli_tensor *out,
+        conv2d_plan_state<io_T, w_T, b_T, quant_T> *state) {
+    // Rank-4 feature maps are processed as batch of rank-3 items sharing all the parameters below
+    mli_tensor in_item, out_item;
+    state->batch = mli_prv_get_batch_item(in, &in_item, &state->in_batch_mem_stride);
+    mli_prv_get_batch_item(out, &out_item, &state->out_batch_mem_stride);
+    mli_tensor *out_batch = out;
+    in = &in_item;
+    out = &out_item;
+
     const bool    no_pad = (fix_kernel_height == 1) && (fix_kernel_width == 1);
     int padding_top = no_pad ? 0 : cfg->padding_top;
     int padding_bot = no_pad ? 0 : cfg->padding_bottom;
@@ -274,14 +288,20 @@ MLI_FORCE_INLINE void conv2d_prepare_and_run(
     int padding_right = no_pad ? 0 : cfg->padding_right;
     int dilation_width = cfg->dilation_width;
     int dilation_height = cfg->dilation_height;
+    state->stride_width = cfg->stride_width;
+    state->stride_height = cfg->stride_height;
+    state->dilation_width = dilation_width;
+    state->dilation_height = dilation_height;
 
     // Define output val limits (may affect built in ReLU)
     out->el_type = in->el_type;
 
     constexpr bool asym = std::is_same<quant_T, s8asym_quant_specific_params>::value;
     mli_minmax_t val_limit = mli_prv_get_relu_limits<io_T, asym>(&cfg->relu, out);
+    state->val_min_limit = (io_T)val_limit.min;
+    state->val_max_limit = (io_T)val_limit.max;
 
-    const MLI_PTR(b_T) bs = mli_prv_tensor_data_ptr<MLI_PTR(b_T)>(bias);
+    state->bias = mli_prv_tensor_data_ptr<MLI_PTR(b_T)>(bias);
 
     auto in_prv = (data_layout == LAYOUT_HWC || data_layout == LAYOUT_HWCN || data_layout == LAYOUT_HW1N) ?
             mli_prv_get_tensor_hwc<MLI_PTR(io_T)>(in)
@@ -308,8 +328,8 @@ MLI_FORCE_INLINE void conv2d_prepare_and_run(
     // in case not all input samples can be used, adjust the width and height.
     int effective_kernel_width = (weights_prv.kernel_width - 1) * dilation_width + 1;
     int effective_kernel_height = (weights_prv.kernel_height - 1) * dilation_height + 1;
-    padding_right = (out_prv.width * stride_width + effective_kernel_width - stride_width) - in_prv.width - padding_left;
-    padding_bot = (out_prv.height * stride_height + effective_kernel_height - stride_height) - in_prv.height - padding_top;
+    padding_right = (out_prv.width * state->stride_width + effective_kernel_width - state->stride_width) - in_prv.width - padding_left;
+    padding_bot = (out_prv.height * state->stride_height + effective_kernel_height - state->stride_height) - in_prv.height - padding_top;
     if (padding_right < 0) {
         in_prv.width += padding_right;
         padding_right = 0;
@@ -318,33 +338,273 @@ MLI_FORCE_INLINE void conv2d_prepare_and_run(
         in_prv.height += padding_bot;
         padding_bot = 0;
     }
+    state->padding_top = padding_top;
+    state->padding_bot = padding_bot;
+    state->padding_left = padding_left;
+    state->padding_right = padding_right;
+    state->in = in_prv;
+    state->weights = weights_prv;
+    state->out = out_prv;
 
     // Define quantization specific params
-    quant_T params;
-    define_quant_params(in, weights, bias, out, &params);
-
-    rect_t cent_area;
-    cent_area.row_beg = 0; cent_area.row_end = out_prv.height;
-    cent_area.clmn_beg = 0; cent_area.clmn_end = out_prv.width;
+    define_quant_params(in, weights, bias, out, &state->quant_params);
+    mli_prv_update_batch_tensor(out, out_batch);
+}
 
-    // Applying main convolution core (depends on layout)
-    //=======================================================================
+//====================================================================================
+// Convolution of one batch item. Without epilogue the variant chosen for the platform is used,
+// otherwise the reference core applies the epilogue to each output value.
+//====================================================================================
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
+          mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
+MLI_FORCE_INLINE void conv2d_run_item(
+        const conv2d_plan_state<io_T, w_T, b_T, quant_T> &state,
+        const tensor_private_t<MLI_PTR(io_T)> &in,
+        const tensor_private_t<MLI_CONV_OUT_PTR(io_T)> &out,
+        const rect_t &area,
+        const no_epilogue &) {
     if (conv_type == CONV_GENERAL) {
         mli::krn::convolution2D<io_T, w_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height>(
-                in_prv, weights_prv, bs, out_prv, cent_area, params,
-                (io_T)val_limit.min, (io_T)val_limit.max,
-                stride_height, stride_width, dilation_height, dilation_width,
-                padding_top, padding_left,
-                padding_bot, padding_right);
+                in, state.weights, state.bias, out, area, state.quant_params,
+                state.val_min_limit, state.val_max_limit,
+                state.stride_height, state.stride_width, state.dilation_height, state.dilation_width,
+                state.padding_top, state.padding_left,
+                state.padding_bot, state.padding_right);
     } else {
         depthwise_convolution2D_wrapper<io_T, w_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height>(
-                in_prv.ptr, weights_prv.ptr, out_prv.ptr,
-                in_prv, weights_prv, bs, out_prv, cent_area, params,
-                (io_T)val_limit.min, (io_T)val_limit.max,
-                stride_height, stride_width, dilation_height, dilation_width,
-                padding_top, padding_left,
-                padding_bot, padding_right);
+                in.ptr, state.weights.ptr, out.ptr,
+                in, state.weights, state.bias, out, area, state.quant_params,
+                state.val_min_limit, state.val_max_limit,
+                state.stride_height, state.stride_width, state.dilation_height, state.dilation_width,
+                state.padding_top, state.padding_left,
+                state.padding_bot, state.padding_right);
+    }
+}
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
+          mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height, typename epilogue_T>
+MLI_FORCE_INLINE void conv2d_run_item(
+        const conv2d_plan_state<io_T, w_T, b_T, quant_T> &state,
+        const tensor_private_t<MLI_PTR(io_T)> &in,
+        const tensor_private_t<MLI_CONV_OUT_PTR(io_T)> &out,
+        const rect_t &area,
+        const epilogue_T &epilogue) {
+    if (conv_type == CONV_GENERAL) {
+        mli::krn::ref::convolution2D<io_T, w_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height, epilogue_T>(
+                in, state.weights, state.bias, out, area, state.quant_params,
+                state.val_min_limit, state.val_max_limit,
+                state.stride_height, state.stride_width, state.dilation_height, state.dilation_width,
+                state.padding_top, state.padding_left,
+                state.padding_bot, state.padding_right, epilogue);
+    } else {
+        mli::krn::ref::depthwise_convolution2D<io_T, w_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height,
+                                               epilogue_T>(
+                in, state.weights, state.bias, out, area, state.quant_params,
+                state.val_min_limit, state.val_max_limit,
+                state.stride_height, state.stride_width, state.dilation_height, state.dilation_width,
+                state.padding_top, state.padding_left,
+                state.padding_bot, state.padding_right, epilogue);
+    }
+}
+
+//====================================================================================
+// Common routin for running convolution with pre-calculated parameters.
+//====================================================================================
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
+          mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height, typename epilogue_T>
+MLI_FORCE_INLINE void conv2d_run(const conv2d_plan_state<io_T, w_T, b_T, quant_T> &state,
+        const epilogue_T &epilogue) {
+    rect_t cent_area;
+    cent_area.row_beg = 0; cent_area.row_end = state.out.height;
+    cent_area.clmn_beg = 0; cent_area.clmn_end = state.out.width;
+
+    // Applying main convolution core (depends on layout)
+    // Output points are independent, so the area of all batch items may be split between threads.
+    //=======================================================================
+    mli::parallel_for_batch_area(state.batch, cent_area, [&state, &epilogue](uint32_t item, const rect_t &area) {
+        tensor_private_t<MLI_PTR(io_T)> in = state.in;
+        tensor_private_t<MLI_CONV_OUT_PTR(io_T)> out = state.out;
+        in.ptr += item * state.in_batch_mem_stride;
+        out.ptr += item * state.out_batch_mem_stride;
+        conv2d_run_item<io_T, w_T, b_T, acc_T, quant_T, conv_type, fix_kernel_width, fix_kernel_height>(
+                state, in, out, area, epilogue.batch_item(item));
+    });
+}
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
+          mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
+MLI_FORCE_INLINE void conv2d_prepare_and_run(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        mli_tensor *out) {
+    mli_prv_fx_init_dsp_ctrl();
+    conv2d_plan_state<io_T, w_T, b_T, quant_T> state;
+    conv2d_prepare<io_T, w_T, b_T, acc_T, quant_T, data_layout, conv_type, fix_kernel_width, fix_kernel_height>(
+            in, weights, bias, cfg, out, &state);
+    conv2d_run<io_T, w_T, b_T, acc_T, quant_T, conv_type, fix_kernel_width, fix_kernel_height>(state);
+}
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
+          mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
+MLI_FORCE_INLINE void conv2d_prepare_and_run_epilogue(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        const mli_epilogue_cfg *epilogue_cfg,
+        mli_tensor *out) {
+    mli_prv_fx_init_dsp_ctrl();
+    conv2d_plan_state<io_T, w_T, b_T, quant_T> state;
+    conv2d_prepare<io_T, w_T, b_T, acc_T, quant_T, data_layout, conv_type, fix_kernel_width, fix_kernel_height>(
+            in, weights, bias, cfg, out, &state);
+
+    // Epilogue parameters depend on output parameters defined by prepare
+    epilogue<io_T> ep;
+    define_epilogue(epilogue_cfg, out, &ep);
+    conv2d_run<io_T, w_T, b_T, acc_T, quant_T, conv_type, fix_kernel_width, fix_kernel_height>(state, ep);
+    epilogue_update_out_params(epilogue_cfg, ep, out);
+}
+
+//====================================================================================
+// Depthwise separable convolution: rows of depthwise output are computed into the rolling buffer
+// and right away consumed by pointwise convolution, so the intermediate map is never stored in full.
+//====================================================================================
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T>
+MLI_FORCE_INLINE void dw_separable_conv2d_prepare_and_run(
+        const mli_tensor *in,
+        const mli_tensor *dw_weights,
+        const mli_tensor *dw_bias,
+        const mli_tensor *pw_weights,
+        const mli_tensor *pw_bias,
+        const mli_dw_separable_conv2d_cfg *cfg,
+        mli_tensor *out) {
+    mli_prv_fx_init_dsp_ctrl();
+    mli_tensor mid;
+    mli_prv_get_dw_separable_mid(in, dw_weights, cfg, out, &mid);
+
+    mli_conv2d_cfg pw_cfg;
+    memset(&pw_cfg, 0, sizeof(pw_cfg));
+    pw_cfg.relu = cfg->pw_relu;
+    pw_cfg.stride_width = pw_cfg.stride_height = 1;
+    pw_cfg.dilation_width = pw_cfg.dilation_height = 1;
+
+    // Both parts are prepared for the full-size intermediate map which is then processed by steps of rows
+    conv2d_plan_state<io_T, w_T, b_T, quant_T> dw_state;
+    conv2d_plan_state<io_T, w_T, b_T, quant_T> pw_state;
+    conv2d_prepare<io_T, w_T, b_T, acc_T, quant_T, LAYOUT_HW1N, CONV_DEPTHWISE, KRN_SZ_VAR, KRN_SZ_VAR>(
+            in, dw_weights, dw_bias, &cfg->dw_cfg, &mid, &dw_state);
+    conv2d_prepare<io_T, w_T, b_T, acc_T, quant_T, LAYOUT_HWCN, CONV_GENERAL, KRN_SZ_1, KRN_SZ_1>(
+            &mid, pw_weights, pw_bias, &pw_cfg, out, &pw_state);
+
+    const int height = dw_state.out.height;
+    const int row_size = dw_state.out.row_mem_stride * sizeof(io_T);
+    const int rows_per_step = MIN((int)cfg->scratch_data.capacity / row_size, height);
+    const int effective_kernel_height = (dw_state.weights.kernel_height - 1) * dw_state.dilation_height + 1;
+
+    for (int row = 0; row < height; row += rows_per_step) {
+        const int rows = MIN(rows_per_step, height - row);
+        rect_t area;
+        area.row_beg = 0; area.row_end = rows;
+        area.clmn_beg = 0; area.clmn_end = dw_state.out.width;
+
+        // Depthwise part works on the view of input rows used by this step. Padding of the view
+        // is defined in the same way as conv2d_prepare does for the whole input.
+        conv2d_plan_state<io_T, w_T, b_T, quant_T> dw_step = dw_state;
+        const int in_row = row * dw_state.stride_height - dw_state.padding_top;
+        dw_step.padding_top = MAX(-in_row, 0);
+        dw_step.in.ptr += MAX(in_row, 0) * dw_state.in.row_mem_stride;
+        dw_step.in.height = dw_state.in.height - MAX(in_row, 0);
+        const int in_rows_required = (rows - 1) * dw_state.stride_height + effective_kernel_height
+                - dw_step.padding_top;
+        if (dw_step.in.height > in_rows_required) {
+            dw_step.in.height = in_rows_required;
+            dw_step.padding_bot = 0;
+        } else {
+            dw_step.padding_bot = in_rows_required - dw_step.in.height;
+        }
+        dw_step.out.height = rows;
+        conv2d_run_item<io_T, w_T, b_T, acc_T, quant_T, CONV_DEPTHWISE, KRN_SZ_VAR, KRN_SZ_VAR>(
+                dw_step, dw_step.in, dw_step.out, area, no_epilogue());
+
+        // Pointwise part consumes rows of the buffer and writes related rows of output
+        conv2d_plan_state<io_T, w_T, b_T, quant_T> pw_step = pw_state;
+        pw_step.in.height = rows;
+        pw_step.out.ptr += row * pw_state.out.row_mem_stride;
+        pw_step.out.height = rows;
+        conv2d_run_item<io_T, w_T, b_T, acc_T, quant_T, CONV_GENERAL, KRN_SZ_1, KRN_SZ_1>(
+                pw_step, pw_step.in, pw_step.out, area, no_epilogue());
+    }
+}
+
+//====================================================================================
+// Plan of convolution: state is pre-calculated once and reused for new input and output data.
+//====================================================================================
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
+          mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
+void conv2d_plan_run(const mli_conv2d_plan *plan, const void *in_data, void *out_data) {
+    mli_prv_fx_init_dsp_ctrl();
+    conv2d_plan_state<io_T, w_T, b_T, quant_T> state;
+    memcpy(&state, plan->state, sizeof(state));
+    state.in.ptr = (MLI_PTR(io_T))in_data;
+    state.out.ptr = (MLI_CONV_OUT_PTR(io_T))out_data;
+    conv2d_run<io_T, w_T, b_T, acc_T, quant_T, conv_type, fix_kernel_width, fix_kernel_height>(state);
+}
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
+          mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
+static MLI_FORCE_INLINE void conv2d_plan_create_fixed(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        mli_tensor *out,
+        mli_conv2d_plan *plan) {
+    typedef conv2d_plan_state<io_T, w_T, b_T, quant_T> state_t;
+    static_assert(sizeof(state_t) <= sizeof(plan->state), "Convolution state doesn't fit into plan");
+    state_t state;
+    conv2d_prepare<io_T, w_T, b_T, acc_T, quant_T, data_layout, conv_type, fix_kernel_width, fix_kernel_height>(
+            in, weights, bias, cfg, out, &state);
+    memcpy(plan->state, &state, sizeof(state));
+    plan->run = conv2d_plan_run<io_T, w_T, b_T, acc_T, quant_T, conv_type, fix_kernel_width, fix_kernel_height>;
+}
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
+          mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
+MLI_FORCE_INLINE void conv2d_plan_create(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        mli_tensor *out,
+        mli_conv2d_plan *plan) {
+#if MLI_SPEC_DISPATCH
+    // Plan of a generic kernel runs the code specialized for the kernel size of weights.
+    // Choice is the same as of generic kernels forwarding calls to specializations.
+    if (fix_kernel_width == KRN_SZ_VAR && fix_kernel_height == KRN_SZ_VAR) {
+        const int kernel_w = weights->shape[(data_layout == LAYOUT_HW1N) ? KRNL_DW_W_DIM_HW1N : KRNL_W_DIM_HWCN];
+        const int kernel_h = weights->shape[(data_layout == LAYOUT_HW1N) ? KRNL_DW_H_DIM_HW1N : KRNL_H_DIM_HWCN];
+
+        // Padding is ignored by k1x1 specialization
+        if ((conv_type == CONV_GENERAL) && (kernel_w == 1) && (kernel_h == 1) && (cfg->padding_left == 0) &&
+                (cfg->padding_right == 0) && (cfg->padding_top == 0) && (cfg->padding_bottom == 0)) {
+            conv2d_plan_create_fixed<io_T, w_T, b_T, acc_T, quant_T, data_layout, conv_type, KRN_SZ_1, KRN_SZ_1>(
+                    in, weights, bias, cfg, out, plan);
+            return;
+        } else if ((kernel_w == 3) && (kernel_h == 3)) {
+            conv2d_plan_create_fixed<io_T, w_T, b_T, acc_T, quant_T, data_layout, conv_type, KRN_SZ_3, KRN_SZ_3>(
+                    in, weights, bias, cfg, out, plan);
+            return;
+        } else if ((kernel_w == 5) && (kernel_h == 5)) {
+            conv2d_plan_create_fixed<io_T, w_T, b_T, acc_T, quant_T, data_layout, conv_type, KRN_SZ_5, KRN_SZ_5>(
+                    in, weights, bias, cfg, out, plan);
+            return;
+        }
     }
+#endif
+    conv2d_plan_create_fixed<io_T, w_T, b_T, acc_T, quant_T, data_layout, conv_type,
+                             fix_kernel_width, fix_kernel_height>(in, weights, bias, cfg, out, plan);
 }
 #pragma MLI_CODE_SECTION_END()
 } // namespace ref
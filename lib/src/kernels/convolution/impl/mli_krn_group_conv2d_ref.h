@@ -18,6 +18,7 @@
 #include "mli_krn_dotprod.h"
 #include "mli_prv_layout.h"
 #include "mli_krn_convolution.h"
+#include "mli_prv_parallel.h"
 
 namespace mli {
 namespace krn {
@@ -123,6 +124,15 @@ MLI_FORCE_INLINE void group_conv2d_prepare_and_run(
         const mli_conv2d_cfg *cfg,
         mli_tensor *out) {
     mli_prv_fx_init_dsp_ctrl();
+    // Rank-4 feature maps are processed as batch of rank-3 items sharing all the parameters below
+    mli_tensor in_item, out_item;
+    int32_t in_batch_mem_stride, out_batch_mem_stride;
+    const uint32_t batch = mli_prv_get_batch_item(in, &in_item, &in_batch_mem_stride);
+    mli_prv_get_batch_item(out, &out_item, &out_batch_mem_stride);
+    mli_tensor *out_batch = out;
+    in = &in_item;
+    out = &out_item;
+
     const uint8_t stride_width = cfg->stride_width;
     const uint8_t stride_height = cfg->stride_height;
     const bool    no_pad = (fix_kernel_height == 1) && (fix_kernel_width == 1);
@@ -198,36 +208,43 @@ MLI_FORCE_INLINE void group_conv2d_prepare_and_run(
     // Define quantization specific params
     quant_T params;
     define_quant_params(in, weights, bias, out, &params);
+    mli_prv_update_batch_tensor(out, out_batch);
 
     rect_t cent_area;
     cent_area.row_beg = 0; cent_area.row_end = out_height;
     cent_area.clmn_beg = 0; cent_area.clmn_end = out_width;
 
-    // Reuse all optimizations for convolution2d and depthwise_conv2d for particular cases of group_convolution2d
-    if (in_prv.ch == weights_prv.in_ch) {
-        mli::krn::convolution2D<io_T, w_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height>(
-                in_prv, weights_prv, bs, out_prv, cent_area, params,
-                (io_T)val_limit.min, (io_T)val_limit.max,
-                stride_height, stride_width, dilation_height, dilation_width,
-                padding_top, padding_left,
-                padding_bot, padding_right);
-    } else if (weights_prv.in_ch == 1 && in_prv.ch == weights_prv.out_ch) {
-        depthwise_convolution2D_wrapper<io_T, w_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height>(
-                in_prv.ptr, weights_prv.ptr, out_prv.ptr,
-                in_prv, weights_prv, bs, out_prv, cent_area, params,
-                (io_T)val_limit.min, (io_T)val_limit.max,
-                stride_height, stride_width, dilation_height, dilation_width,
-                padding_top, padding_left,
-                padding_bot, padding_right);
-    } else {
-        mli::krn::group_convolution2D<io_T, w_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height>(
-                in_prv, weights_prv, bs, out_prv, cent_area, params,
-                (io_T)val_limit.min, (io_T)val_limit.max,
-                stride_height, stride_width, dilation_height, dilation_width,
-                padding_top, padding_left,
-                padding_bot, padding_right);
-    }
-    
+    mli::parallel_for_batch_area(batch, cent_area, [&](uint32_t item, const rect_t &area) {
+        auto in_cur = in_prv;
+        auto out_cur = out_prv;
+        in_cur.ptr += item * in_batch_mem_stride;
+        out_cur.ptr += item * out_batch_mem_stride;
+
+        // Reuse all optimizations for convolution2d and depthwise_conv2d for particular cases of group_convolution2d
+        if (in_prv.ch == weights_prv.in_ch) {
+            mli::krn::convolution2D<io_T, w_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height>(
+                    in_cur, weights_prv, bs, out_cur, area, params,
+                    (io_T)val_limit.min, (io_T)val_limit.max,
+                    stride_height, stride_width, dilation_height, dilation_width,
+                    padding_top, padding_left,
+                    padding_bot, padding_right);
+        } else if (weights_prv.in_ch == 1 && in_prv.ch == weights_prv.out_ch) {
+            depthwise_convolution2D_wrapper<io_T, w_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height>(
+                    in_cur.ptr, weights_prv.ptr, out_cur.ptr,
+                    in_cur, weights_prv, bs, out_cur, area, params,
+                    (io_T)val_limit.min, (io_T)val_limit.max,
+                    stride_height, stride_width, dilation_height, dilation_width,
+                    padding_top, padding_left,
+                    padding_bot, padding_right);
+        } else {
+            mli::krn::group_convolution2D<io_T, w_T, b_T, acc_T, quant_T, fix_kernel_width, fix_kernel_height>(
+                    in_cur, weights_prv, bs, out_cur, area, params,
+                    (io_T)val_limit.min, (io_T)val_limit.max,
+                    stride_height, stride_width, dilation_height, dilation_width,
+                    padding_top, padding_left,
+                    padding_bot, padding_right);
+        }
+    });
 }
 #pragma MLI_CODE_SECTION_END()
 } // namespace ref
@@ -12,6 +12,7 @@
 #include "mli_api.h"
 #include "mli_krn_convolution.h"
 #include "mli_private_types.h"
+#include "mli_prv_parallel.h"
 #include "mli_prv_quant.h"
 #include "mli_prv_tensor.h"
 #include "mli_types.h"
@@ -102,6 +103,14 @@ MLI_FORCE_INLINE void transpose_conv2d_prepare_and_run(
         const mli_conv2d_cfg *cfg,
         mli_tensor *out) {
     mli_prv_fx_init_dsp_ctrl();
+    // Rank-4 feature maps are processed as batch of rank-3 items sharing all the parameters below
+    mli_tensor in_item, out_item;
+    int32_t in_batch_mem_stride, out_batch_mem_stride;
+    const uint32_t batch = mli_prv_get_batch_item(in, &in_item, &in_batch_mem_stride);
+    mli_prv_get_batch_item(out, &out_item, &out_batch_mem_stride);
+    mli_tensor *out_batch = out;
+    in = &in_item;
+    out = &out_item;
 
     constexpr int conv_fix_kernel_width = (fix_stride == 2) ? fix_kernel_width / 2 : KRN_SZ_VAR;
     constexpr int conv_fix_kernel_height = (fix_stride == 2) ? fix_kernel_height / 2 : KRN_SZ_VAR;
@@ -139,6 +148,7 @@ MLI_FORCE_INLINE void transpose_conv2d_prepare_and_run(
 
     quant_T quant_params;
     define_quant_params(in, weights, bias, out, &quant_params);
+    mli_prv_update_batch_tensor(out, out_batch);
 
     // Applying main convolution for each subtensor of weights pattern independently
     //=======================================================================
@@ -150,67 +160,72 @@ MLI_FORCE_INLINE void transpose_conv2d_prepare_and_run(
     // 2nd option looks more complicated, but doesn't require extra memory for input, can be implemented
     // using memstrides for weights and output, and more efficient as no extra multiplications with 0 
     // is needed. 
-    for (int krn_h_offset = 0; krn_h_offset < stride_height; krn_h_offset++) {
-        for (int krn_w_offset = 0; krn_w_offset < stride_width; krn_w_offset++) {
-            const auto weights_subtensor = 
-                get_mirrored_weights_subtensor_hwcn(weights_prv, stride_width, stride_height, 
-                                                    krn_w_offset, krn_h_offset);
-            
-            // Loping across kernel patterns defined by krn_*_offset we need to define exact out subtensor
-            // which is being filled with current weights subtensor. For this we need to define out subtensor size 
-            // and offset in the whole output tensor using paddings and strides.
-            auto cur_out = out_prv;
-            const int out_w_offset = (stride_width - krn_w_offset + effective_padding_left) % stride_width;
-            const int out_h_offset = (stride_height - krn_h_offset + effective_padding_top) % stride_height;
-            const int cur_out_height = CEIL_DIV(out_height - out_h_offset, stride_height);
-            const int cur_out_width = CEIL_DIV(out_width - out_w_offset, stride_width);
-            int out_mem_offset = out_prv.row_mem_stride * out_h_offset;
-            out_mem_offset += out_prv.col_mem_stride * out_w_offset;
-            cur_out.height = cur_out_height;
-            cur_out.width = cur_out_width;
-            cur_out.col_mem_stride *= stride_width;
-            cur_out.row_mem_stride *= stride_height;
-            cur_out.ptr += out_prv.row_mem_stride * out_h_offset;
-            cur_out.ptr += out_prv.col_mem_stride * out_w_offset;
-
-            // Kernel pattern and output subtensor for current calculations define specific perception area of input. 
-            // The size of this perception area can be defined using output and kernel sizes (see in_percept_area_*). 
-            // This perception area includes specific input subtensor and it's paddings on all sides. 
-            // For instance perception area across width can be the following:
-            //                 _______________________________________________________________   
-            //                 |**pad_l**|================input_tsr=================|**pad_r**|
-            //                 |   [1]   |                    [2]                   |    [3]  |
-            // 
-            // The specific size of each sub-area is defined according to output offsets (coordinates) and kernels offset:
-            //    [1] pad_l (left padding area) - input and kernel offsets reduces this effective value first 
-            //    [2] input_tsr - input tensor area which is reduced according to out offset 
-            //                    if padding on the left is not enough to compensate it.
-            //    [3] pad_r (right padding area) - can be defined as the rest points from input perception area
-
-            // Define input perception area size itself and [1] across width and height
-            const int in_percept_area_w = (cur_out_width + (weights_subtensor.kernel_width - 1)); 
-            const int in_percept_area_h = (cur_out_height + (weights_subtensor.kernel_height - 1));
-            const int cur_pad_left = CEIL_DIV(MAX(0, effective_padding_left - out_w_offset - krn_w_offset), stride_width);
-            const int cur_pad_top = CEIL_DIV(MAX(0, effective_padding_top - out_h_offset - krn_h_offset), stride_height);
-
-            // Define [2]
-            auto cur_in = in_prv;
-            const int in_w_offset = CEIL_DIV(MAX(0, out_w_offset - effective_padding_left), stride_width);
-            const int in_h_offset = CEIL_DIV(MAX(0, out_h_offset - effective_padding_top), stride_height);
-            cur_in.width = MIN(in_percept_area_w - cur_pad_left, cur_in.width - in_w_offset);
-            cur_in.height = MIN(in_percept_area_h - cur_pad_top, cur_in.height - in_h_offset);
-            cur_in.ptr += cur_in.row_mem_stride * in_h_offset + cur_in.col_mem_stride * in_w_offset;
-
-            // the rest points of perception area is [3]
-            const int cur_pad_right = MAX(0, in_percept_area_w - cur_pad_left - cur_in.width);
-            const int cur_pad_bot = MAX(0, in_percept_area_h - cur_pad_top - cur_in.height);
-
-            transpose_convolution2D<io_T, w_T, b_T, acc_T, quant_T, conv_fix_kernel_width, conv_fix_kernel_height>(
-                cur_in, weights_subtensor, bs, cur_out, quant_params,
-                (io_T)val_limit.min, (io_T)val_limit.max,
-                cur_pad_top, cur_pad_left, cur_pad_bot, cur_pad_right);
-        }
-    }
+    // Each pair of batch item and kernel pattern fills its own output points, so pairs are processed in parallel.
+    const uint32_t num_patterns = stride_height * stride_width;
+    mli::parallel_for(batch * num_patterns, [&](uint32_t task_idx) {
+        const uint32_t item = task_idx / num_patterns;
+        const int krn_h_offset = (task_idx % num_patterns) / stride_width;
+        const int krn_w_offset = (task_idx % num_patterns) % stride_width;
+        const auto weights_subtensor = 
+            get_mirrored_weights_subtensor_hwcn(weights_prv, stride_width, stride_height, 
+                                                krn_w_offset, krn_h_offset);
+        
+        // Loping across kernel patterns defined by krn_*_offset we need to define exact out subtensor
+        // which is being filled with current weights subtensor. For this we need to define out subtensor size 
+        // and offset in the whole output tensor using paddings and strides.
+        auto cur_out = out_prv;
+        cur_out.ptr += item * out_batch_mem_stride;
+        const int out_w_offset = (stride_width - krn_w_offset + effective_padding_left) % stride_width;
+        const int out_h_offset = (stride_height - krn_h_offset + effective_padding_top) % stride_height;
+        const int cur_out_height = CEIL_DIV(out_height - out_h_offset, stride_height);
+        const int cur_out_width = CEIL_DIV(out_width - out_w_offset, stride_width);
+        int out_mem_offset = out_prv.row_mem_stride * out_h_offset;
+        out_mem_offset += out_prv.col_mem_stride * out_w_offset;
+        cur_out.height = cur_out_height;
+        cur_out.width = cur_out_width;
+        cur_out.col_mem_stride *= stride_width;
+        cur_out.row_mem_stride *= stride_height;
+        cur_out.ptr += out_prv.row_mem_stride * out_h_offset;
+        cur_out.ptr += out_prv.col_mem_stride * out_w_offset;
+
+        // Kernel pattern and output subtensor for current calculations define specific perception area of input. 
+        // The size of this perception area can be defined using output and kernel sizes (see in_percept_area_*). 
+        // This perception area includes specific input subtensor and it's paddings on all sides. 
+        // For instance perception area across width can be the following:
+        //                 _______________________________________________________________   
+        //                 |**pad_l**|================input_tsr=================|**pad_r**|
+        //                 |   [1]   |                    [2]                   |    [3]  |
+        // 
+        // The specific size of each sub-area is defined according to output offsets (coordinates) and kernels offset:
+        //    [1] pad_l (left padding area) - input and kernel offsets reduces this effective value first 
+        //    [2] input_tsr - input tensor area which is reduced according to out offset 
+        //                    if padding on the left is not enough to compensate it.
+        //    [3] pad_r (right padding area) - can be defined as the rest points from input perception area
+
+        // Define input perception area size itself and [1] across width and height
+        const int in_percept_area_w = (cur_out_width + (weights_subtensor.kernel_width - 1)); 
+        const int in_percept_area_h = (cur_out_height + (weights_subtensor.kernel_height - 1));
+        const int cur_pad_left = CEIL_DIV(MAX(0, effective_padding_left - out_w_offset - krn_w_offset), stride_width);
+        const int cur_pad_top = CEIL_DIV(MAX(0, effective_padding_top - out_h_offset - krn_h_offset), stride_height);
+
+        // Define [2]
+        auto cur_in = in_prv;
+        cur_in.ptr += item * in_batch_mem_stride;
+        const int in_w_offset = CEIL_DIV(MAX(0, out_w_offset - effective_padding_left), stride_width);
+        const int in_h_offset = CEIL_DIV(MAX(0, out_h_offset - effective_padding_top), stride_height);
+        cur_in.width = MIN(in_percept_area_w - cur_pad_left, cur_in.width - in_w_offset);
+        cur_in.height = MIN(in_percept_area_h - cur_pad_top, cur_in.height - in_h_offset);
+        cur_in.ptr += cur_in.row_mem_stride * in_h_offset + cur_in.col_mem_stride * in_w_offset;
+
+        // the rest points of perception area is [3]
+        const int cur_pad_right = MAX(0, in_percept_area_w - cur_pad_left - cur_in.width);
+        const int cur_pad_bot = MAX(0, in_percept_area_h - cur_pad_top - cur_in.height);
+
+        transpose_convolution2D<io_T, w_T, b_T, acc_T, quant_T, conv_fix_kernel_width, conv_fix_kernel_height>(
+            cur_in, weights_subtensor, bs, cur_out, quant_params,
+            (io_T)val_limit.min, (io_T)val_limit.max,
+            cur_pad_top, cur_pad_left, cur_pad_bot, cur_pad_right);
+    });
 }
 #pragma MLI_CODE_SECTION_END()
 } // namespace ref
@@ -44,6 +44,21 @@ mli_status mli_krn_conv2d_hwcn_fx16(
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
+    int kernel_w = weights->shape[KRNL_W_DIM_HWCN];
+    int kernel_h = weights->shape[KRNL_H_DIM_HWCN];
+
+    // Padding is ignored by k1x1 specialization
+    if ((kernel_w == 1) && (kernel_h == 1) && (cfg->padding_left == 0) && (cfg->padding_right == 0) &&
+            (cfg->padding_top == 0) && (cfg->padding_bottom == 0)) {
+        return mli_krn_conv2d_hwcn_fx16_k1x1(in, weights, bias, cfg, out);
+    } else if ((kernel_w == 3) && (kernel_h == 3)) {
+        return mli_krn_conv2d_hwcn_fx16_k3x3(in, weights, bias, cfg, out);
+    } else if ((kernel_w == 5) && (kernel_h == 5)) {
+        return mli_krn_conv2d_hwcn_fx16_k5x5(in, weights, bias, cfg, out);
+    }
+#endif
+
     mli::krn::conv2d_prepare_and_run
             <int16_t, int16_t, int16_t, mli_fx16_accu_t, mli::krn::fx_quant_specific_params, LAYOUT_HWCN, mli::CONV_GENERAL, KRN_SZ_VAR, KRN_SZ_VAR>
             (in, weights, bias, cfg, out);
@@ -60,6 +75,21 @@ mli_status mli_krn_conv2d_hwcn_fx16_fx8_fx8(
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
+    int kernel_w = weights->shape[KRNL_W_DIM_HWCN];
+    int kernel_h = weights->shape[KRNL_H_DIM_HWCN];
+
+    // Padding is ignored by k1x1 specialization
+    if ((kernel_w == 1) && (kernel_h == 1) && (cfg->padding_left == 0) && (cfg->padding_right == 0) &&
+            (cfg->padding_top == 0) && (cfg->padding_bottom == 0)) {
+        return mli_krn_conv2d_hwcn_fx16_fx8_fx8_k1x1(in, weights, bias, cfg, out);
+    } else if ((kernel_w == 3) && (kernel_h == 3)) {
+        return mli_krn_conv2d_hwcn_fx16_fx8_fx8_k3x3(in, weights, bias, cfg, out);
+    } else if ((kernel_w == 5) && (kernel_h == 5)) {
+        return mli_krn_conv2d_hwcn_fx16_fx8_fx8_k5x5(in, weights, bias, cfg, out);
+    }
+#endif
+
     mli::krn::conv2d_prepare_and_run
             <int16_t, int8_t, int8_t, mli_fx16_fx8_fx8_accu_t, mli::krn::fx_quant_specific_params, LAYOUT_HWCN, mli::CONV_GENERAL, KRN_SZ_VAR, KRN_SZ_VAR>
             (in, weights, bias, cfg, out);
@@ -76,6 +106,21 @@ mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32(
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
+    int kernel_w = weights->shape[KRNL_W_DIM_HWCN];
+    int kernel_h = weights->shape[KRNL_H_DIM_HWCN];
+
+    // Padding is ignored by k1x1 specialization
+    if ((kernel_w == 1) && (kernel_h == 1) && (cfg->padding_left == 0) && (cfg->padding_right == 0) &&
+            (cfg->padding_top == 0) && (cfg->padding_bottom == 0)) {
+        return mli_krn_conv2d_hwcn_sa8_sa8_sa32_k1x1(in, weights, bias, cfg, out);
+    } else if ((kernel_w == 3) && (kernel_h == 3)) {
+        return mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3(in, weights, bias, cfg, out);
+    } else if ((kernel_w == 5) && (kernel_h == 5)) {
+        return mli_krn_conv2d_hwcn_sa8_sa8_sa32_k5x5(in, weights, bias, cfg, out);
+    }
+#endif
+
     mli::krn::conv2d_prepare_and_run
             <int8_t, int8_t, int32_t, mli_sa8_sa8_sa32_accu_t, mli::krn::s8asym_quant_specific_params, LAYOUT_HWCN, mli::CONV_GENERAL, KRN_SZ_VAR, KRN_SZ_VAR>
             (in, weights, bias, cfg, out);
@@ -235,6 +280,135 @@ mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_k5x5(
     return ret;
 }
 
+//========================================================
+// Epilogue functions
+//========================================================
+// Epilogue is applied by the reference core, so scalar accumulators are used on all platforms
+mli_status mli_krn_conv2d_hwcn_fx16_epilogue(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        const mli_epilogue_cfg* epilogue,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_fx16(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_epilogue(epilogue, in, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_prepare_and_run_epilogue
+            <int16_t, int16_t, int16_t, mli_acc40_t, mli::krn::fx_quant_specific_params, LAYOUT_HWCN, mli::CONV_GENERAL, KRN_SZ_VAR, KRN_SZ_VAR>
+            (in, weights, bias, cfg, epilogue, out);
+    return ret;
+}
+
+mli_status mli_krn_conv2d_hwcn_fx16_fx8_fx8_epilogue(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        const mli_epilogue_cfg* epilogue,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_fx16_fx8_fx8(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_epilogue(epilogue, in, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_prepare_and_run_epilogue
+            <int16_t, int8_t, int8_t, mli_acc32_t, mli::krn::fx_quant_specific_params, LAYOUT_HWCN, mli::CONV_GENERAL, KRN_SZ_VAR, KRN_SZ_VAR>
+            (in, weights, bias, cfg, epilogue, out);
+    return ret;
+}
+
+mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_epilogue(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        const mli_epilogue_cfg* epilogue,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_sa8_sa8_sa32(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_epilogue(epilogue, in, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_prepare_and_run_epilogue
+            <int8_t, int8_t, int32_t, mli_acc32_t, mli::krn::s8asym_quant_specific_params, LAYOUT_HWCN, mli::CONV_GENERAL, KRN_SZ_VAR, KRN_SZ_VAR>
+            (in, weights, bias, cfg, epilogue, out);
+    return ret;
+}
+
+//========================================================
+// Prepare functions of planned execution
+//========================================================
+mli_status mli_krn_conv2d_hwcn_fx16_prepare(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out,
+        mli_conv2d_plan* plan) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_fx16(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_prepare(plan), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_plan_create
+            <int16_t, int16_t, int16_t, mli_fx16_accu_t, mli::krn::fx_quant_specific_params, LAYOUT_HWCN, mli::CONV_GENERAL, KRN_SZ_VAR, KRN_SZ_VAR>
+            (in, weights, bias, cfg, out, plan);
+    return ret;
+}
+
+mli_status mli_krn_conv2d_hwcn_fx16_fx8_fx8_prepare(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out,
+        mli_conv2d_plan* plan) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_fx16_fx8_fx8(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_prepare(plan), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_plan_create
+            <int16_t, int8_t, int8_t, mli_fx16_fx8_fx8_accu_t, mli::krn::fx_quant_specific_params, LAYOUT_HWCN, mli::CONV_GENERAL, KRN_SZ_VAR, KRN_SZ_VAR>
+            (in, weights, bias, cfg, out, plan);
+    return ret;
+}
+
+mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepare(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out,
+        mli_conv2d_plan* plan) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_conv2d_hwcn_sa8_sa8_sa32(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_prepare(plan), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_plan_create
+            <int8_t, int8_t, int32_t, mli_sa8_sa8_sa32_accu_t, mli::krn::s8asym_quant_specific_params, LAYOUT_HWCN, mli::CONV_GENERAL, KRN_SZ_VAR, KRN_SZ_VAR>
+            (in, weights, bias, cfg, out, plan);
+    return ret;
+}
+
+mli_status mli_krn_conv2d_run(const mli_conv2d_plan* plan, const void* in_data, void* out_data) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_conv2d_run(plan, in_data, out_data), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+
+    plan->run(plan, in_data, out_data);
+    return ret;
+}
+
 
 #pragma MLI_CODE_SECTION_END()
 
@@ -31,16 +31,25 @@ namespace krn {
 using mli::krn::vdsp::convolution2D;
 using mli::krn::vdsp::depthwise_convolution2D;
 using mli::krn::ref::conv2d_prepare_and_run;
+using mli::krn::ref::conv2d_prepare_and_run_epilogue;
+using mli::krn::ref::dw_separable_conv2d_prepare_and_run;
+using mli::krn::ref::conv2d_plan_create;
 
 #elif !defined(MLI_BUILD_REFERENCE) && defined(__FXAPI__)
 using mli::krn::ref::convolution2D;
 using mli::krn::dsp::depthwise_convolution2D;
 using mli::krn::ref::conv2d_prepare_and_run;
+using mli::krn::ref::conv2d_prepare_and_run_epilogue;
+using mli::krn::ref::dw_separable_conv2d_prepare_and_run;
+using mli::krn::ref::conv2d_plan_create;
 
 #else
 using mli::krn::ref::convolution2D;
 using mli::krn::ref::depthwise_convolution2D;
 using mli::krn::ref::conv2d_prepare_and_run;
+using mli::krn::ref::conv2d_prepare_and_run_epilogue;
+using mli::krn::ref::dw_separable_conv2d_prepare_and_run;
+using mli::krn::ref::conv2d_plan_create;
 
 #endif
 } // namespace krn
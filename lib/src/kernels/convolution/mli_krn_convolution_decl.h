@@ -14,6 +14,7 @@
 #include "mli_prv_quant.h"
 #include "mli_types.h"
 #include "mli_prv_layout.h"
+#include "mli_krn_epilogue_decl.h"
 
 namespace mli {
 typedef enum {
@@ -31,6 +32,32 @@ typedef enum {
 #define STR_2 2
 
 namespace krn {
+/**
+ * Convolution state derived from kernel parameters. It's calculated once by conv2d_prepare
+ * and then used by conv2d_run (kept inside mli_conv2d_plan between these calls).
+ */
+template <typename io_T, typename w_T, typename b_T, typename quant_T>
+struct conv2d_plan_state {
+    tensor_private_t<MLI_PTR(io_T)> in;
+    conv2d_weights_tensor_private_t<MLI_PTR(w_T)> weights;
+    const MLI_PTR(b_T) bias;
+    tensor_private_t<MLI_CONV_OUT_PTR(io_T)> out;
+    quant_T quant_params;
+    io_T val_min_limit;
+    io_T val_max_limit;
+    int stride_height;
+    int stride_width;
+    int dilation_height;
+    int dilation_width;
+    int padding_top;
+    int padding_left;
+    int padding_bot;
+    int padding_right;
+    uint32_t batch;
+    int32_t in_batch_mem_stride;
+    int32_t out_batch_mem_stride;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions (in *_ref/*_dsp/*vdsp) that can be called from outside their own
 // file must be declared here. This includes all overloads. For example, if we
@@ -42,7 +69,8 @@ namespace krn {
 // REF
 ////////////////////////////////////////////////////////////////////////////////
 namespace ref {
-template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, int fix_kernel_width, int fix_kernel_height>
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, int fix_kernel_width, int fix_kernel_height,
+          typename epilogue_T = no_epilogue>
 MLI_FORCE_INLINE void convolution2D(
         const tensor_private_t<MLI_PTR(io_T)> &in,
         const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights,
@@ -55,9 +83,11 @@ MLI_FORCE_INLINE void convolution2D(
         const int stride_height, const int stride_width,
         const int dilation_height, const int dilation_width,
         const int padding_top, const int padding_left,
-        const int padding_bot, const int padding_right);
+        const int padding_bot, const int padding_right,
+        const epilogue_T &epilogue = epilogue_T());
 
-template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, int fix_kernel_width, int fix_kernel_height>
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T, int fix_kernel_width, int fix_kernel_height,
+          typename epilogue_T = no_epilogue>
 MLI_FORCE_INLINE void depthwise_convolution2D(
         const tensor_private_t<MLI_PTR(io_T)> &in,
         const conv2d_weights_tensor_private_t<MLI_PTR(w_T)> &weights,
@@ -70,7 +100,8 @@ MLI_FORCE_INLINE void depthwise_convolution2D(
         const int stride_height, const int stride_width,
         const int dilation_height, const int dilation_width,
         const int padding_top, const int padding_left,
-        const int padding_bot, const int padding_right);
+        const int padding_bot, const int padding_right,
+        const epilogue_T &epilogue = epilogue_T());
 
 template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
           mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
@@ -80,6 +111,51 @@ MLI_FORCE_INLINE void conv2d_prepare_and_run(
         const mli_tensor *bias,
         const mli_conv2d_cfg *cfg,
         mli_tensor *out);
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
+          mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
+MLI_FORCE_INLINE void conv2d_prepare(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        mli_tensor *out,
+        conv2d_plan_state<io_T, w_T, b_T, quant_T> *state);
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
+          mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height, typename epilogue_T = no_epilogue>
+MLI_FORCE_INLINE void conv2d_run(const conv2d_plan_state<io_T, w_T, b_T, quant_T> &state,
+        const epilogue_T &epilogue = epilogue_T());
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
+          mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
+MLI_FORCE_INLINE void conv2d_prepare_and_run_epilogue(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        const mli_epilogue_cfg *epilogue_cfg,
+        mli_tensor *out);
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T>
+MLI_FORCE_INLINE void dw_separable_conv2d_prepare_and_run(
+        const mli_tensor *in,
+        const mli_tensor *dw_weights,
+        const mli_tensor *dw_bias,
+        const mli_tensor *pw_weights,
+        const mli_tensor *pw_bias,
+        const mli_dw_separable_conv2d_cfg *cfg,
+        mli_tensor *out);
+
+template <typename io_T, typename w_T, typename b_T, typename acc_T, typename quant_T,
+          mli_layout_type data_layout, mli_conv_type conv_type, int fix_kernel_width, int fix_kernel_height>
+MLI_FORCE_INLINE void conv2d_plan_create(
+        const mli_tensor *in,
+        const mli_tensor *weights,
+        const mli_tensor *bias,
+        const mli_conv2d_cfg *cfg,
+        mli_tensor *out,
+        mli_conv2d_plan *plan);
 } // namespace ref
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -44,6 +44,17 @@ mli_status mli_krn_depthwise_conv2d_hwcn_fx16(
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
+    int kernel_w = weights->shape[KRNL_DW_W_DIM_HW1N];
+    int kernel_h = weights->shape[KRNL_DW_H_DIM_HW1N];
+
+    if ((kernel_w == 3) && (kernel_h == 3)) {
+        return mli_krn_depthwise_conv2d_hwcn_fx16_k3x3(in, weights, bias, cfg, out);
+    } else if ((kernel_w == 5) && (kernel_h == 5)) {
+        return mli_krn_depthwise_conv2d_hwcn_fx16_k5x5(in, weights, bias, cfg, out);
+    }
+#endif
+
     mli::krn::conv2d_prepare_and_run
             <int16_t, int16_t, int16_t, mli_fx16_accu_t, mli::krn::fx_quant_specific_params, LAYOUT_HW1N, mli::CONV_DEPTHWISE, KRN_SZ_VAR, KRN_SZ_VAR>
             (in, weights, bias, cfg, out);
@@ -60,6 +71,17 @@ mli_status mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8(
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
+    int kernel_w = weights->shape[KRNL_DW_W_DIM_HW1N];
+    int kernel_h = weights->shape[KRNL_DW_H_DIM_HW1N];
+
+    if ((kernel_w == 3) && (kernel_h == 3)) {
+        return mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_k3x3(in, weights, bias, cfg, out);
+    } else if ((kernel_w == 5) && (kernel_h == 5)) {
+        return mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_k5x5(in, weights, bias, cfg, out);
+    }
+#endif
+
     mli::krn::conv2d_prepare_and_run
             <int16_t, int8_t, int8_t, mli_fx16_fx8_fx8_accu_t, mli::krn::fx_quant_specific_params, LAYOUT_HW1N, mli::CONV_DEPTHWISE, KRN_SZ_VAR, KRN_SZ_VAR>
             (in, weights, bias, cfg, out);
@@ -76,6 +98,17 @@ mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32(
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
+    int kernel_w = weights->shape[KRNL_DW_W_DIM_HW1N];
+    int kernel_h = weights->shape[KRNL_DW_H_DIM_HW1N];
+
+    if ((kernel_w == 3) && (kernel_h == 3)) {
+        return mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k3x3(in, weights, bias, cfg, out);
+    } else if ((kernel_w == 5) && (kernel_h == 5)) {
+        return mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k5x5(in, weights, bias, cfg, out);
+    }
+#endif
+
     mli::krn::conv2d_prepare_and_run
             <int8_t, int8_t, int32_t, mli_sa8_sa8_sa32_accu_t, mli::krn::s8asym_quant_specific_params, LAYOUT_HW1N, mli::CONV_DEPTHWISE, KRN_SZ_VAR, KRN_SZ_VAR>
             (in, weights, bias, cfg, out);
@@ -184,12 +217,134 @@ mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k5x5(
     return ret;
 }
 
+//========================================================
+// Epilogue functions
+//========================================================
+// Epilogue is applied by the reference core, so scalar accumulators are used on all platforms
+mli_status mli_krn_depthwise_conv2d_hwcn_fx16_epilogue(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        const mli_epilogue_cfg* epilogue,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_depthwise_conv2d_hwcn_fx16(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_epilogue(epilogue, in, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_prepare_and_run_epilogue
+            <int16_t, int16_t, int16_t, mli_acc40_t, mli::krn::fx_quant_specific_params, LAYOUT_HW1N, mli::CONV_DEPTHWISE, KRN_SZ_VAR, KRN_SZ_VAR>
+            (in, weights, bias, cfg, epilogue, out);
+    return ret;
+}
+
+mli_status mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_epilogue(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        const mli_epilogue_cfg* epilogue,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_depthwise_conv2d_hwcn_fx16_fx8_fx8(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_epilogue(epilogue, in, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_prepare_and_run_epilogue
+            <int16_t, int8_t, int8_t, mli_acc32_t, mli::krn::fx_quant_specific_params, LAYOUT_HW1N, mli::CONV_DEPTHWISE, KRN_SZ_VAR, KRN_SZ_VAR>
+            (in, weights, bias, cfg, epilogue, out);
+    return ret;
+}
+
+mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_epilogue(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        const mli_epilogue_cfg* epilogue,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_depthwise_conv2d_hwcn_sa8_sa8_sa32(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_epilogue(epilogue, in, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_prepare_and_run_epilogue
+            <int8_t, int8_t, int32_t, mli_acc32_t, mli::krn::s8asym_quant_specific_params, LAYOUT_HW1N, mli::CONV_DEPTHWISE, KRN_SZ_VAR, KRN_SZ_VAR>
+            (in, weights, bias, cfg, epilogue, out);
+    return ret;
+}
+
+//========================================================
+// Prepare functions of planned execution
+//========================================================
+mli_status mli_krn_depthwise_conv2d_hwcn_fx16_prepare(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out,
+        mli_conv2d_plan* plan) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_depthwise_conv2d_hwcn_fx16(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_prepare(plan), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_plan_create
+            <int16_t, int16_t, int16_t, mli_fx16_accu_t, mli::krn::fx_quant_specific_params, LAYOUT_HW1N, mli::CONV_DEPTHWISE, KRN_SZ_VAR, KRN_SZ_VAR>
+            (in, weights, bias, cfg, out, plan);
+    return ret;
+}
+
+mli_status mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_prepare(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out,
+        mli_conv2d_plan* plan) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_depthwise_conv2d_hwcn_fx16_fx8_fx8(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_prepare(plan), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_plan_create
+            <int16_t, int8_t, int8_t, mli_fx16_fx8_fx8_accu_t, mli::krn::fx_quant_specific_params, LAYOUT_HW1N, mli::CONV_DEPTHWISE, KRN_SZ_VAR, KRN_SZ_VAR>
+            (in, weights, bias, cfg, out, plan);
+    return ret;
+}
+
+mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepare(
+        const mli_tensor* in,
+        const mli_tensor* weights,
+        const mli_tensor* bias,
+        const mli_conv2d_cfg* cfg,
+        mli_tensor* out,
+        mli_conv2d_plan* plan) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_depthwise_conv2d_hwcn_sa8_sa8_sa32(in, weights, bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_conv2d_prepare(plan), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::conv2d_plan_create
+            <int8_t, int8_t, int32_t, mli_sa8_sa8_sa32_accu_t, mli::krn::s8asym_quant_specific_params, LAYOUT_HW1N, mli::CONV_DEPTHWISE, KRN_SZ_VAR, KRN_SZ_VAR>
+            (in, weights, bias, cfg, out, plan);
+    return ret;
+}
+
 char * mli_debug_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32(
         const mli_tensor * in, 
         const mli_tensor * weights, 
         const mli_tensor * bias, 
         const mli_conv2d_cfg * cfg, 
         mli_tensor * out) {
+#if MLI_SPEC_DISPATCH
     int kernel_w = weights->shape[KRNL_DW_W_DIM_HW1N];
     int kernel_h = weights->shape[KRNL_DW_H_DIM_HW1N];
 
@@ -197,9 +352,9 @@ char * mli_debug_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32(
         return (char*)"mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k5x5";
     } else if ((kernel_w == 3) && (kernel_h == 3)) {
         return (char*)"mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k3x3";
-    } else {
-        return (char*)"mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32";
     }
+#endif
+    return (char*)"mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32";
 }
 #pragma MLI_CODE_SECTION_END()
 
@@ -0,0 +1,107 @@
+/*
+* Copyright 2020-2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+#include "mli_api.h"
+#include "mli_check.h"
+#include "mli_config.h"
+#include "mli_debug.h"
+#include "mli_krn_convolution.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
+typedef vNx4accshort_t mli_sa8_sa8_sa32_accu_t;
+typedef vNx2accint_t mli_fx16_accu_t;
+typedef vNx4accint_t mli_fx16_fx8_fx8_accu_t;
+#else
+typedef mli_acc32_t mli_sa8_sa8_sa32_accu_t;
+typedef mli_acc40_t mli_fx16_accu_t;
+typedef mli_acc32_t mli_fx16_fx8_fx8_accu_t;
+#endif
+
+#pragma MLI_CODE_SECTION_START(".mli_lib")
+
+//========================================================
+//
+//        MLI 2.0
+//
+//========================================================
+
+mli_status mli_krn_depthwise_separable_conv2d_hwcn_fx16(
+        const mli_tensor* in,
+        const mli_tensor* dw_weights,
+        const mli_tensor* dw_bias,
+        const mli_tensor* pw_weights,
+        const mli_tensor* pw_bias,
+        const mli_dw_separable_conv2d_cfg* cfg,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_depthwise_separable_conv2d_hwcn_fx16(
+            in, dw_weights, dw_bias, pw_weights, pw_bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::dw_separable_conv2d_prepare_and_run
+            <int16_t, int16_t, int16_t, mli_fx16_accu_t, mli::krn::fx_quant_specific_params>
+            (in, dw_weights, dw_bias, pw_weights, pw_bias, cfg, out);
+    return ret;
+}
+
+mli_status mli_krn_depthwise_separable_conv2d_hwcn_fx16_fx8_fx8(
+        const mli_tensor* in,
+        const mli_tensor* dw_weights,
+        const mli_tensor* dw_bias,
+        const mli_tensor* pw_weights,
+        const mli_tensor* pw_bias,
+        const mli_dw_separable_conv2d_cfg* cfg,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_depthwise_separable_conv2d_hwcn_fx16_fx8_fx8(
+            in, dw_weights, dw_bias, pw_weights, pw_bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::dw_separable_conv2d_prepare_and_run
+            <int16_t, int8_t, int8_t, mli_fx16_fx8_fx8_accu_t, mli::krn::fx_quant_specific_params>
+            (in, dw_weights, dw_bias, pw_weights, pw_bias, cfg, out);
+    return ret;
+}
+
+mli_status mli_krn_depthwise_separable_conv2d_hwcn_sa8_sa8_sa32(
+        const mli_tensor* in,
+        const mli_tensor* dw_weights,
+        const mli_tensor* dw_bias,
+        const mli_tensor* pw_weights,
+        const mli_tensor* pw_bias,
+        const mli_dw_separable_conv2d_cfg* cfg,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_depthwise_separable_conv2d_hwcn_sa8_sa8_sa32(
+            in, dw_weights, dw_bias, pw_weights, pw_bias, cfg, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::krn::dw_separable_conv2d_prepare_and_run
+            <int8_t, int8_t, int32_t, mli_sa8_sa8_sa32_accu_t, mli::krn::s8asym_quant_specific_params>
+            (in, dw_weights, dw_bias, pw_weights, pw_bias, cfg, out);
+    return ret;
+}
+
+int32_t mli_krn_depthwise_separable_conv2d_get_scratch_size(
+        const mli_tensor * in,
+        const mli_tensor * dw_weights,
+        const mli_tensor * out) {
+    // A single row of the intermediate map in the input element type
+    const uint32_t row_elements = out->shape[FMAP_W_DIM_HWC] * dw_weights->shape[KRNL_DW_N_DIM_HW1N];
+    return row_elements * mli_hlp_tensor_element_size(in);
+}
+
+#pragma MLI_CODE_SECTION_END()
+
+#ifdef __cplusplus
+}
+#endif
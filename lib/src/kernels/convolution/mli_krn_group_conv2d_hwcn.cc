@@ -44,6 +44,17 @@ mli_status mli_krn_group_conv2d_hwcn_fx16(
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
+    int kernel_w = weights->shape[KRNL_W_DIM_HWCN];
+    int kernel_h = weights->shape[KRNL_H_DIM_HWCN];
+
+    if ((kernel_w == 3) && (kernel_h == 3)) {
+        return mli_krn_group_conv2d_hwcn_fx16_k3x3(in, weights, bias, cfg, out);
+    } else if ((kernel_w == 5) && (kernel_h == 5)) {
+        return mli_krn_group_conv2d_hwcn_fx16_k5x5(in, weights, bias, cfg, out);
+    }
+#endif
+
     mli::krn::group_conv2d_prepare_and_run
             <int16_t, int16_t, int16_t, mli_fx16_accu_t_group, mli::krn::fx_quant_specific_params, LAYOUT_HWCN, KRN_SZ_VAR, KRN_SZ_VAR>
             (in, weights, bias, cfg, out);
@@ -60,6 +71,17 @@ mli_status mli_krn_group_conv2d_hwcn_fx16_fx8_fx8(
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
+    int kernel_w = weights->shape[KRNL_W_DIM_HWCN];
+    int kernel_h = weights->shape[KRNL_H_DIM_HWCN];
+
+    if ((kernel_w == 3) && (kernel_h == 3)) {
+        return mli_krn_group_conv2d_hwcn_fx16_fx8_fx8_k3x3(in, weights, bias, cfg, out);
+    } else if ((kernel_w == 5) && (kernel_h == 5)) {
+        return mli_krn_group_conv2d_hwcn_fx16_fx8_fx8_k5x5(in, weights, bias, cfg, out);
+    }
+#endif
+
     mli::krn::group_conv2d_prepare_and_run
             <int16_t, int8_t, int8_t, mli_fx16_fx8_fx8_accu_t_group, mli::krn::fx_quant_specific_params, LAYOUT_HWCN, KRN_SZ_VAR, KRN_SZ_VAR>
             (in, weights, bias, cfg, out);
@@ -76,6 +98,17 @@ mli_status mli_krn_group_conv2d_hwcn_sa8_sa8_sa32(
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
+    int kernel_w = weights->shape[KRNL_W_DIM_HWCN];
+    int kernel_h = weights->shape[KRNL_H_DIM_HWCN];
+
+    if ((kernel_w == 3) && (kernel_h == 3)) {
+        return mli_krn_group_conv2d_hwcn_sa8_sa8_sa32_k3x3(in, weights, bias, cfg, out);
+    } else if ((kernel_w == 5) && (kernel_h == 5)) {
+        return mli_krn_group_conv2d_hwcn_sa8_sa8_sa32_k5x5(in, weights, bias, cfg, out);
+    }
+#endif
+
     mli::krn::group_conv2d_prepare_and_run
             <int8_t, int8_t, int32_t, mli_sa8_sa8_sa32_accu_t_group, mli::krn::s8asym_quant_specific_params, LAYOUT_HWCN, KRN_SZ_VAR, KRN_SZ_VAR>
             (in, weights, bias, cfg, out);
@@ -41,6 +41,19 @@ mli_status mli_krn_transpose_conv2d_hwcn_fx16(
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
+    int kernel_w = weights->shape[KRNL_W_DIM_HWCN];
+    int kernel_h = weights->shape[KRNL_H_DIM_HWCN];
+
+    if ((cfg->stride_width == 2) && (cfg->stride_height == 2)) {
+        if ((kernel_w == 4) && (kernel_h == 4)) {
+            return mli_krn_transpose_conv2d_hwcn_fx16_k4x4_str2(in, weights, bias, cfg, out);
+        } else if ((kernel_w == 2) && (kernel_h == 2)) {
+            return mli_krn_transpose_conv2d_hwcn_fx16_k2x2_str2(in, weights, bias, cfg, out);
+        }
+    }
+#endif
+
     mli::krn::transpose_conv2d_prepare_and_run
         <int16_t, int16_t, int16_t, mli_fx16_accu_t, mli::krn::fx_quant_specific_params, KRN_SZ_VAR, KRN_SZ_VAR, STR_VAR>
         (in, weights, bias, cfg, out);
@@ -57,6 +70,19 @@ mli_status mli_krn_transpose_conv2d_hwcn_fx16_fx8_fx8(
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
+    int kernel_w = weights->shape[KRNL_W_DIM_HWCN];
+    int kernel_h = weights->shape[KRNL_H_DIM_HWCN];
+
+    if ((cfg->stride_width == 2) && (cfg->stride_height == 2)) {
+        if ((kernel_w == 4) && (kernel_h == 4)) {
+            return mli_krn_transpose_conv2d_hwcn_fx16_fx8_fx8_k4x4_str2(in, weights, bias, cfg, out);
+        } else if ((kernel_w == 2) && (kernel_h == 2)) {
+            return mli_krn_transpose_conv2d_hwcn_fx16_fx8_fx8_k2x2_str2(in, weights, bias, cfg, out);
+        }
+    }
+#endif
+
     mli::krn::transpose_conv2d_prepare_and_run
         <int16_t, int8_t, int8_t, mli_fx16_fx8_fx8_accu_t, mli::krn::fx_quant_specific_params, KRN_SZ_VAR, KRN_SZ_VAR, STR_VAR>
         (in, weights, bias, cfg, out);
@@ -73,6 +99,19 @@ mli_status mli_krn_transpose_conv2d_hwcn_sa8_sa8_sa32(
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
+    int kernel_w = weights->shape[KRNL_W_DIM_HWCN];
+    int kernel_h = weights->shape[KRNL_H_DIM_HWCN];
+
+    if ((cfg->stride_width == 2) && (cfg->stride_height == 2)) {
+        if ((kernel_w == 4) && (kernel_h == 4)) {
+            return mli_krn_transpose_conv2d_hwcn_sa8_sa8_sa32_k4x4_str2(in, weights, bias, cfg, out);
+        } else if ((kernel_w == 2) && (kernel_h == 2)) {
+            return mli_krn_transpose_conv2d_hwcn_sa8_sa8_sa32_k2x2_str2(in, weights, bias, cfg, out);
+        }
+    }
+#endif
+
     mli::krn::transpose_conv2d_prepare_and_run
         <int8_t, int8_t, int32_t, mli_sa8_sa8_sa32_accu_t, mli::krn::s8asym_quant_specific_params, KRN_SZ_VAR, KRN_SZ_VAR, STR_VAR>
         (in, weights, bias, cfg, out);
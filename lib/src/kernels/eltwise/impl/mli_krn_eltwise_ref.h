@@ -26,6 +26,12 @@
  * as the scaled result ((max - in_offset) * scale) will be limited by 24 bits including the sign bit.
  */
 #define MAX_MIN_UPPER_LIMIT_SHIFT 23
+/*
+ * Additional fractional bits of the fused multiply-add accumulator for asymmetric data.
+ * Product of two 8bit values with 8 extra bits fits 24 bits, so the addend aligned
+ * to the accumulator loses less precision on rounding.
+ */
+#define FMA_ACC_HEADROOM_SHIFT 8
 
 namespace mli {
 namespace krn {
@@ -197,7 +203,11 @@ void eltwise_op_basic(
         const int out_offset) {
 
     MLI_PRINTF_FUNC();
-    int *shape = (scalar_op2)? ((int *) in1->shape) : ((int *) in2->shape);
+    const int *shape = out->shape;
+    /* Operand which is broadcasted along the innermost dimension (zero memory stride)
+     * is passed to the inner loop as a scalar, so it's kept in register. */
+    const bool bcast_op1 = scalar_op1 || (in1->mem_stride[MLI_MAX_RANK - 1] == 0);
+    const bool bcast_op2 = scalar_op2 || (in2->mem_stride[MLI_MAX_RANK - 1] == 0);
     for (int pos0 = 0; pos0 < shape[0]; pos0++) {
         for (int pos1 = 0; pos1 < shape[1]; pos1++) {
             for (int pos2 = 0; pos2 < shape[2]; pos2++) {
@@ -205,9 +215,11 @@ void eltwise_op_basic(
                 int idx1 = POS(in1, pos0, pos1, pos2, pos3);
                 int idx2 = POS(in2, pos0, pos1, pos2, pos3);
                 int idx = POS(out, pos0, pos1, pos2, pos3);
+                const io_T val1 = (bcast_op1 && !scalar_op1) ? in1->ptr[idx1] : op1_s;
+                const io_T val2 = (bcast_op2 && !scalar_op2) ? in2->ptr[idx2] : op2_s;
                 mli::krn::eltwise_innerloop<io_T, func_type, convert>(
                         in1->ptr, in2->ptr, out->ptr, idx1, idx2, idx, shape[3],
-                        op1_s, op2_s, scalar_op1, scalar_op2, in_offset1, in_offset2,
+                        val1, val2, bcast_op1, bcast_op2, in_offset1, in_offset2,
                         out_offset, scale16_1, scale16_2, pre_op_shift1, pre_op_shift2, post_op_shift);
             } /* pos1 */
         } /* pos2 */
@@ -247,13 +259,14 @@ void eltwise_op_basic(
 //======================================================
 //
 //======================================================
-template <typename io_T, mli_eltwise_type func_type, bool convert, bool no_scalar , bool no_out_update,  bool shape_1d >
-void eltwise_prepare_and_run(
+template <typename io_T, mli_eltwise_type func_type, bool convert>
+void eltwise_define_params(
         const mli_tensor * in1,
         const mli_tensor * in2,
-        mli_tensor * out) {
+        const mli_tensor * out,
+        eltwise_params * params) {
 
-    MLI_PRINTF_FUNC();
+    // Requantization parameters are derived with the same DSP control state as the kernel uses
     mli_prv_fx_init_dsp_ctrl();
     int32_t scale_factor1 = 0, scale_factor2 = 0;
     int16_t scale16_1 = 1, scale_1 = 1, scale16_2 = 1, scale_2 = 1, scale_out = 1,
@@ -261,12 +274,6 @@ void eltwise_prepare_and_run(
     int16_t in_offset1 = 0, in_offset2 = 0, out_offset = 0;
     int pre_op_shift1 = 0, pre_op_shift2 = 0, post_op_shift = 0;
 
-    bool scalar_op1 = 0;
-    bool scalar_op2 = 0;
-    uint32_t in1_sz = 0;
-    uint32_t in2_sz = 0;
-    int flatten_count = 0;
-
     if (convert) {
         in_offset1 = in1->el_params.sa.zero_point.mem.i16;
         in_offset2 = in2->el_params.sa.zero_point.mem.i16;
@@ -340,6 +347,40 @@ void eltwise_prepare_and_run(
         post_op_shift = MIN(post_op_shift, max_shift);
     }
 
+    params->in_offset1 = in_offset1;
+    params->in_offset2 = in_offset2;
+    params->out_offset = out_offset;
+    params->scale16_1 = scale16_1;
+    params->scale16_2 = scale16_2;
+    params->pre_op_shift1 = pre_op_shift1;
+    params->pre_op_shift2 = pre_op_shift2;
+    params->post_op_shift = post_op_shift;
+}
+
+template <typename io_T, mli_eltwise_type func_type, bool convert, bool no_scalar , bool no_out_update,  bool shape_1d >
+void eltwise_run(
+        const mli_tensor * in1,
+        const mli_tensor * in2,
+        mli_tensor * out,
+        const eltwise_params * params) {
+
+    MLI_PRINTF_FUNC();
+    mli_prv_fx_init_dsp_ctrl();
+    const int16_t in_offset1 = params->in_offset1;
+    const int16_t in_offset2 = params->in_offset2;
+    const int16_t out_offset = params->out_offset;
+    const int16_t scale16_1 = params->scale16_1;
+    const int16_t scale16_2 = params->scale16_2;
+    const int pre_op_shift1 = params->pre_op_shift1;
+    const int pre_op_shift2 = params->pre_op_shift2;
+    const int post_op_shift = params->post_op_shift;
+
+    bool scalar_op1 = 0;
+    bool scalar_op2 = 0;
+    uint32_t in1_sz = 0;
+    uint32_t in2_sz = 0;
+    int flatten_count = 0;
+
     if (no_scalar){
         //assumption that always 0 
         scalar_op1 = 0;
@@ -352,18 +393,30 @@ void eltwise_prepare_and_run(
         scalar_op2 = (in2_sz == 1);
     }
 
+    /* Non scalar operands of different shapes are broadcasted to the shape of output */
+    bool broadcast = false;
+    if (!no_scalar && !shape_1d && !scalar_op1 && !scalar_op2) {
+        broadcast = !mli_prv_is_same_shape(in1, in2);
+    }
+
     /* Fill output tensor parameters
     //======================================
     */
     //no_out_update==true  assuming that always in1 is out no need to update out
     //                     or the user intentionally does not update the out
     if (!no_out_update){
-        const unsigned *shape_ptr = (in1_sz > in2_sz)? in1->shape: in2->shape;
-        int rank = (in1_sz > in2_sz)? (int)in1->rank: (int)in2->rank;
-        
-        out->rank = rank;
-        for (int k = 0; k < rank; k++)
-            out->shape[k] = shape_ptr[k];
+        if (broadcast) {
+            uint32_t rank = 0;
+            mli_prv_get_broadcast_shape(in1, in2, out->shape, &rank);
+            out->rank = rank;
+        } else {
+            const unsigned *shape_ptr = (in1_sz > in2_sz)? in1->shape: in2->shape;
+            int rank = (in1_sz > in2_sz)? (int)in1->rank: (int)in2->rank;
+
+            out->rank = rank;
+            for (int k = 0; k < rank; k++)
+                out->shape[k] = shape_ptr[k];
+        }
     }
 
     /* Extract in/out as scalar values */
@@ -399,6 +452,17 @@ void eltwise_prepare_and_run(
                     scale16_1, scale16_2, pre_op_shift1, pre_op_shift2, post_op_shift);
 
         return;
+    } else if (broadcast) {
+        auto in1_prv = mli_prv_get_broadcast_generic_tensor<MLI_PTR(io_T)>(in1, out);
+        auto in2_prv = mli_prv_get_broadcast_generic_tensor<MLI_PTR(io_T)>(in2, out);
+        auto out_prv = mli_prv_get_generic_tensor<MLI_OUT_PTR(io_T)>(out);
+        mli_prv_squash_broadcast_generic_tensor(&in1_prv, &in2_prv, &out_prv);
+
+        mli::krn::eltwise_op_basic<io_T, func_type, convert>(&in1_prv, &in2_prv, &out_prv,
+                                            in1_scalar, in2_scalar, scalar_op1, scalar_op2,
+                                            pre_op_shift1, pre_op_shift2, post_op_shift,
+                                            scale16_1, scale16_2, in_offset1, in_offset2, out_offset);
+        return;
     } else {
         flatten_count = 0;
         if (scalar_op1 && !scalar_op2) {
@@ -440,6 +504,169 @@ void eltwise_prepare_and_run(
 
 }
 
+template <typename io_T, mli_eltwise_type func_type, bool convert, bool no_scalar , bool no_out_update,  bool shape_1d >
+void eltwise_prepare_and_run(
+        const mli_tensor * in1,
+        const mli_tensor * in2,
+        mli_tensor * out) {
+
+    eltwise_params params;
+    mli::krn::eltwise_define_params<io_T, func_type, convert>(in1, in2, out, &params);
+    mli::krn::eltwise_run<io_T, func_type, convert, no_scalar, no_out_update, shape_1d>(in1, in2, out, &params);
+}
+
+//======================================================
+// Fused multiply-add: out = in1 * in2 + in3
+//======================================================
+template <typename io_T>
+MLI_FORCE_INLINE io_T eltwise_fma_perform_operation(
+        const io_T op1,
+        const io_T op2,
+        const io_T op3,
+        const eltwise_fma_params *params) {
+    const int16_t val1 = mli_math_sub_fx<int16_t>(op1, params->in_offset1);
+    const int16_t val2 = mli_math_sub_fx<int16_t>(op2, params->in_offset2);
+    const int16_t val3 = mli_math_sub_fx<int16_t>(op3, params->in_offset3);
+
+    /* Product and addend are accumulated in the wide accumulator without intermediate requantization */
+    int64_t acc = mli_math_mul_fx<int16_t, int32_t>(val1, val2);
+    acc = mli_math_asl_fx<int64_t>(acc, params->acc_shift);
+    int64_t addend = mli_math_mul_fx<int32_t, int64_t>((int32_t)val3, params->scale3);
+    acc = mli_math_add_fx<int64_t>(acc, mli_math_asr_rnd_fx<int64_t>(addend, params->shift3));
+
+    /* Single conversion to the output format */
+    int32_t res = mli_math_cast_fx<int64_t, int32_t>(acc * params->out_scale, params->out_shift);
+    res = mli_math_add_fx<int32_t>(res, params->out_offset);
+    res = mli_math_bound_range_fx<int32_t, int32_t>(res, params->limits.min, params->limits.max);
+    return (io_T)res;
+}
+
+template <typename io_T>
+void eltwise_fma_innerloop(
+        const MLI_PTR(io_T) __restrict op1_ptr,
+        const MLI_PTR(io_T) __restrict op2_ptr,
+        const MLI_PTR(io_T) __restrict op3_ptr,
+        MLI_OUT_PTR(io_T) __restrict out_ptr,
+        int idx1,
+        int idx2,
+        int idx3,
+        int idx_out,
+        const int count,
+        const io_T op1_s,
+        const io_T op2_s,
+        const io_T op3_s,
+        const bool scalar_op1,
+        const bool scalar_op2,
+        const bool scalar_op3,
+        const eltwise_fma_params *params) {
+    for (int pos = 0; pos < count; pos++) {
+        io_T val1 = (scalar_op1)? op1_s : op1_ptr[idx1];
+        io_T val2 = (scalar_op2)? op2_s : op2_ptr[idx2];
+        io_T val3 = (scalar_op3)? op3_s : op3_ptr[idx3];
+        out_ptr[idx_out] = mli::krn::eltwise_fma_perform_operation<io_T>(val1, val2, val3, params);
+        idx1++;
+        idx2++;
+        idx3++;
+        idx_out++;
+    }
+}
+
+template <typename io_T, bool convert>
+void eltwise_fma_prepare_and_run(
+        const mli_tensor *__restrict in1,
+        const mli_tensor *__restrict in2,
+        const mli_tensor *__restrict in3,
+        const mli_eltwise_fma_cfg *__restrict cfg,
+        mli_tensor *__restrict out) {
+
+    MLI_PRINTF_FUNC();
+    mli_prv_fx_init_dsp_ctrl();
+    eltwise_fma_params params;
+
+    if (convert) {
+        const int16_t scale_1 = in1->el_params.sa.scale.mem.i16;
+        const int16_t scale_2 = in2->el_params.sa.scale.mem.i16;
+        const int16_t scale_3 = in3->el_params.sa.scale.mem.i16;
+        const int16_t scale_out = out->el_params.sa.scale.mem.i16;
+        const int shift_12 = in1->el_params.sa.scale_frac_bits.mem.i8 + in2->el_params.sa.scale_frac_bits.mem.i8;
+        const int shift_3 = in3->el_params.sa.scale_frac_bits.mem.i8;
+        const int shift_out = out->el_params.sa.scale_frac_bits.mem.i8;
+        const int32_t scale_12 = (int32_t)scale_1 * scale_2;
+        int norm_shift;
+
+        params.in_offset1 = in1->el_params.sa.zero_point.mem.i16;
+        params.in_offset2 = in2->el_params.sa.zero_point.mem.i16;
+        params.in_offset3 = in3->el_params.sa.zero_point.mem.i16;
+        params.out_offset = out->el_params.sa.zero_point.mem.i16;
+        params.acc_shift = FMA_ACC_HEADROOM_SHIFT;
+
+        /* Addend in units of accumulator: scale_3 / (scale_1 * scale_2) */
+        int64_t ratio = mli_math_asl_fx<int64_t>(scale_3, IN_SCALE_SHIFT) / scale_12;
+        params.scale3 = mli_math_norm_cast_fx<int64_t, int32_t>(ratio, &norm_shift);
+        params.shift3 = IN_SCALE_SHIFT - norm_shift + shift_3 - shift_12 - params.acc_shift;
+
+        /* Accumulator in units of output: (scale_1 * scale_2) / scale_out */
+        ratio = mli_math_asl_fx<int64_t>(scale_12, INT32_TO_INT16) / scale_out;
+        params.out_scale = mli_math_norm_cast_fx<int64_t, int16_t>(ratio, &norm_shift);
+        params.out_shift = INT32_TO_INT16 - norm_shift + shift_12 + params.acc_shift - shift_out;
+    } else {
+        const int frac_12 = in1->el_params.fx.frac_bits + in2->el_params.fx.frac_bits;
+
+        params.in_offset1 = params.in_offset2 = params.in_offset3 = params.out_offset = 0;
+        params.acc_shift = 0;
+        params.scale3 = 1;
+        params.shift3 = in3->el_params.fx.frac_bits - frac_12;
+        params.out_scale = 1;
+        params.out_shift = frac_12 - out->el_params.fx.frac_bits;
+    }
+
+    /* Fill output tensor parameters: shape is the common broadcasted shape of all operands */
+    mli_tensor prod;
+    uint32_t rank = 0;
+    mli_prv_get_broadcast_shape(in1, in2, prod.shape, &prod.rank);
+    mli_prv_get_broadcast_shape(&prod, in3, out->shape, &rank);
+    out->rank = rank;
+    params.limits = mli_prv_get_relu_limits<io_T, convert>(&cfg->relu, out);
+
+    /* Operands with single element are kept in registers and broadcasted as scalars */
+    const bool scalar_op1 = (mli_prv_count_elem_num(in1) == 1);
+    const bool scalar_op2 = (mli_prv_count_elem_num(in2) == 1);
+    const bool scalar_op3 = (mli_prv_count_elem_num(in3) == 1);
+    const io_T op1_s = mli_prv_tensor_data_val<io_T>(in1);
+    const io_T op2_s = mli_prv_tensor_data_val<io_T>(in2);
+    const io_T op3_s = mli_prv_tensor_data_val<io_T>(in3);
+
+    auto in1_prv = mli_prv_get_broadcast_generic_tensor<MLI_PTR(io_T)>(in1, out);
+    auto in2_prv = mli_prv_get_broadcast_generic_tensor<MLI_PTR(io_T)>(in2, out);
+    auto in3_prv = mli_prv_get_broadcast_generic_tensor<MLI_PTR(io_T)>(in3, out);
+    auto out_prv = mli_prv_get_generic_tensor<MLI_OUT_PTR(io_T)>(out);
+    mli_prv_squash_broadcast_generic_tensor(&in1_prv, &in2_prv, &in3_prv, &out_prv);
+
+    /* Operand which is broadcasted along the innermost dimension (zero memory stride)
+     * is passed to the inner loop as a scalar, so it's kept in register. */
+    const bool bcast_op1 = scalar_op1 || (in1_prv.mem_stride[MLI_MAX_RANK - 1] == 0);
+    const bool bcast_op2 = scalar_op2 || (in2_prv.mem_stride[MLI_MAX_RANK - 1] == 0);
+    const bool bcast_op3 = scalar_op3 || (in3_prv.mem_stride[MLI_MAX_RANK - 1] == 0);
+    const int *shape = out_prv.shape;
+    for (int pos0 = 0; pos0 < shape[0]; pos0++) {
+        for (int pos1 = 0; pos1 < shape[1]; pos1++) {
+            for (int pos2 = 0; pos2 < shape[2]; pos2++) {
+                int pos3 = 0;
+                int idx1 = POS(&in1_prv, pos0, pos1, pos2, pos3);
+                int idx2 = POS(&in2_prv, pos0, pos1, pos2, pos3);
+                int idx3 = POS(&in3_prv, pos0, pos1, pos2, pos3);
+                int idx = POS(&out_prv, pos0, pos1, pos2, pos3);
+                const io_T val1 = (bcast_op1 && !scalar_op1) ? in1_prv.ptr[idx1] : op1_s;
+                const io_T val2 = (bcast_op2 && !scalar_op2) ? in2_prv.ptr[idx2] : op2_s;
+                const io_T val3 = (bcast_op3 && !scalar_op3) ? in3_prv.ptr[idx3] : op3_s;
+                mli::krn::eltwise_fma_innerloop<io_T>(
+                        in1_prv.ptr, in2_prv.ptr, in3_prv.ptr, out_prv.ptr, idx1, idx2, idx3, idx, shape[3],
+                        val1, val2, val3, bcast_op1, bcast_op2, bcast_op3, &params);
+            } /* pos2 */
+        } /* pos1 */
+    } /* pos0 */
+}
+
 } // namespace ref
 } // namespace krn
 } // namespace mli
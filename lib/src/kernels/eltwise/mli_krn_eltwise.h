@@ -29,22 +29,37 @@ namespace mli {
 namespace krn {
 #if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
 using mli::krn::ref::eltwise_prepare_and_run;
+using mli::krn::ref::eltwise_define_params;
+using mli::krn::ref::eltwise_run;
 using mli::krn::ref::eltwise_op_basic;
 using mli::krn::vdsp::eltwise_perform_operation;
 using mli::krn::vdsp::eltwise_innerloop;
+using mli::krn::ref::eltwise_fma_prepare_and_run;
+using mli::krn::ref::eltwise_fma_perform_operation;
+using mli::krn::ref::eltwise_fma_innerloop;
 
 #elif !defined(MLI_BUILD_REFERENCE) && defined(__FXAPI__)
 /* TODO replace with dsp version */
 using mli::krn::ref::eltwise_prepare_and_run;
+using mli::krn::ref::eltwise_define_params;
+using mli::krn::ref::eltwise_run;
 using mli::krn::ref::eltwise_op_basic;
 using mli::krn::ref::eltwise_perform_operation;
 using mli::krn::ref::eltwise_innerloop;
+using mli::krn::ref::eltwise_fma_prepare_and_run;
+using mli::krn::ref::eltwise_fma_perform_operation;
+using mli::krn::ref::eltwise_fma_innerloop;
 
 #else
 using mli::krn::ref::eltwise_prepare_and_run;
+using mli::krn::ref::eltwise_define_params;
+using mli::krn::ref::eltwise_run;
 using mli::krn::ref::eltwise_op_basic;
 using mli::krn::ref::eltwise_perform_operation;
 using mli::krn::ref::eltwise_innerloop;
+using mli::krn::ref::eltwise_fma_prepare_and_run;
+using mli::krn::ref::eltwise_fma_perform_operation;
+using mli::krn::ref::eltwise_fma_innerloop;
 
 #endif
 } // namespace krn
@@ -23,6 +23,36 @@ typedef enum {
     ELTWISE_MIN
 } mli_eltwise_type;
 
+/* Requantization parameters of two operands elementwise functions.
+ * They depend only on element parameters of tensors, so they can be defined once and reused. */
+struct eltwise_params {
+    int16_t in_offset1;
+    int16_t in_offset2;
+    int16_t out_offset;
+    int16_t scale16_1;
+    int16_t scale16_2;
+    int pre_op_shift1;
+    int pre_op_shift2;
+    int post_op_shift;
+};
+
+/* Parameters of fused multiply-add (out = in1 * in2 + in3) elementwise function.
+ * Product of the first two operands is accumulated with acc_shift additional fractional bits.
+ * Third operand is aligned to the accumulator with scale3 multiplier and shift3 right shift.
+ * Accumulator is converted to output with out_scale multiplier and out_shift right shift. */
+struct eltwise_fma_params {
+    int16_t in_offset1;
+    int16_t in_offset2;
+    int16_t in_offset3;
+    int16_t out_offset;
+    int32_t scale3;
+    int shift3;
+    int acc_shift;
+    int16_t out_scale;
+    int out_shift;
+    mli_minmax_t limits;
+};
+
 namespace krn {
 ////////////////////////////////////////////////////////////////////////////////
 // Functions (in *_ref/*_dsp/*vdsp) that can be called from outside their own
@@ -42,6 +72,20 @@ void eltwise_prepare_and_run(
         const mli_tensor *__restrict in2,
         mli_tensor *__restrict out);
 
+template <typename io_T, mli_eltwise_type func_type, bool convert = false>
+void eltwise_define_params(
+        const mli_tensor *__restrict in1,
+        const mli_tensor *__restrict in2,
+        const mli_tensor *__restrict out,
+        eltwise_params *__restrict params);
+
+template <typename io_T, mli_eltwise_type func_type, bool convert = false , bool no_scalar = false, bool no_out_update = false, bool shape_1d = false>
+void eltwise_run(
+        const mli_tensor *__restrict in1,
+        const mli_tensor *__restrict in2,
+        mli_tensor *__restrict out,
+        const eltwise_params *__restrict params);
+
 template <typename io_T, mli_eltwise_type func_type, bool convert = false>
 void eltwise_op_basic(
         const generic_tensor_private_t<MLI_PTR(io_T)> * __restrict in1,
@@ -126,6 +170,40 @@ void eltwise_innerloop(
         const int pre_op_shift1,
         const int pre_op_shift2,
         const int post_op_shift);
+
+template <typename io_T, bool convert>
+void eltwise_fma_prepare_and_run(
+        const mli_tensor *__restrict in1,
+        const mli_tensor *__restrict in2,
+        const mli_tensor *__restrict in3,
+        const mli_eltwise_fma_cfg *__restrict cfg,
+        mli_tensor *__restrict out);
+
+template <typename io_T>
+io_T eltwise_fma_perform_operation(
+        const io_T op1,
+        const io_T op2,
+        const io_T op3,
+        const eltwise_fma_params *params);
+
+template <typename io_T>
+void eltwise_fma_innerloop(
+        const MLI_PTR(io_T) __restrict op1_ptr,
+        const MLI_PTR(io_T) __restrict op2_ptr,
+        const MLI_PTR(io_T) __restrict op3_ptr,
+        MLI_OUT_PTR(io_T) __restrict out_ptr,
+        int idx1,
+        int idx2,
+        int idx3,
+        int idx_out,
+        const int count,
+        const io_T op1_s,
+        const io_T op2_s,
+        const io_T op3_s,
+        const bool scalar_op1,
+        const bool scalar_op2,
+        const bool scalar_op3,
+        const eltwise_fma_params *params);
 } // namespace ref
 
 ////////////////////////////////////////////////////////////////////////////////
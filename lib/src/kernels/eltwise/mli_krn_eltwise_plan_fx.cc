@@ -0,0 +1,103 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_krn_eltwise.h"
+
+#include "mli_config.h"
+#include "mli_debug.h"
+#include "mli_helpers_api.h"
+
+namespace mli {
+namespace krn {
+
+template <mli_eltwise_type func_type>
+static MLI_FORCE_INLINE void eltwise_sa8_fill_plan(
+        const mli_tensor* in1,
+        const mli_tensor* in2,
+        const mli_tensor* out,
+        mli_eltwise_plan* plan) {
+    eltwise_params params;
+    mli::krn::eltwise_define_params<int8_t, func_type, true>(in1, in2, out, &params);
+
+    plan->type = func_type;
+    plan->in_offset1 = params.in_offset1;
+    plan->in_offset2 = params.in_offset2;
+    plan->out_offset = params.out_offset;
+    plan->scale1 = params.scale16_1;
+    plan->scale2 = params.scale16_2;
+    plan->shift1 = (int8_t)params.pre_op_shift1;
+    plan->shift2 = (int8_t)params.pre_op_shift2;
+    plan->post_shift = (int8_t)params.post_op_shift;
+}
+
+} // namespace krn
+} // namespace mli
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma MLI_CODE_SECTION_START(".mli_lib")
+
+mli_status mli_krn_eltwise_add_sa8_prepare(const mli_tensor* in1, const mli_tensor* in2, const mli_tensor* out,
+        mli_eltwise_plan* plan) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_eltwise_prepare_sa8(in1, in2, out, plan), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+
+    mli::krn::eltwise_sa8_fill_plan<mli::ELTWISE_ADD>(in1, in2, out, plan);
+
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_krn_eltwise_sub_sa8_prepare(const mli_tensor* in1, const mli_tensor* in2, const mli_tensor* out,
+        mli_eltwise_plan* plan) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_eltwise_prepare_sa8(in1, in2, out, plan), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+
+    mli::krn::eltwise_sa8_fill_plan<mli::ELTWISE_SUB>(in1, in2, out, plan);
+
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_krn_eltwise_sa8_run(const mli_eltwise_plan* plan, const mli_tensor* in1, const mli_tensor* in2,
+        mli_tensor* out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_eltwise_run_sa8(plan, in1, in2, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    mli::eltwise_params params;
+    params.in_offset1 = plan->in_offset1;
+    params.in_offset2 = plan->in_offset2;
+    params.out_offset = plan->out_offset;
+    params.scale16_1 = plan->scale1;
+    params.scale16_2 = plan->scale2;
+    params.pre_op_shift1 = plan->shift1;
+    params.pre_op_shift2 = plan->shift2;
+    params.post_op_shift = plan->post_shift;
+
+    switch (plan->type) {
+    case mli::ELTWISE_ADD:
+        mli::krn::eltwise_run<int8_t, mli::ELTWISE_ADD, true>(in1, in2, out, &params);
+        break;
+    case mli::ELTWISE_SUB:
+        mli::krn::eltwise_run<int8_t, mli::ELTWISE_SUB, true>(in1, in2, out, &params);
+        break;
+    default:
+        MLI_ASSERT(0);
+        return MLI_STATUS_BAD_FUNC_CFG;
+    }
+
+    return MLI_STATUS_OK;
+}
+
+#pragma MLI_CODE_SECTION_END()
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -45,6 +45,7 @@ mli_status mli_krn_avepool_hwc_fx16(const mli_tensor * in, const mli_pool_cfg *
     if (ret != MLI_STATUS_OK) return ret;
     MLI_PRINT_COMPILE_OPTIONS();
 
+#if MLI_SPEC_DISPATCH
     int kernel_w = cfg->kernel_width;
     int kernel_h = cfg->kernel_height;
 
@@ -52,14 +53,16 @@ mli_status mli_krn_avepool_hwc_fx16(const mli_tensor * in, const mli_pool_cfg *
         return mli_krn_avepool_hwc_fx16_k3x3(in, cfg, out);
     } else if ((kernel_w == 2) && (kernel_h == 2)) {
         return mli_krn_avepool_hwc_fx16_k2x2(in, cfg, out);
-    } else {
-        mli::krn::mli_krn_pool_hwc<mli::krn::AVEPOOL, int16_t, POOL_NO_FIXED_KRN_SIZE>(in, cfg, out);
     }
+#endif
+
+    mli::krn::mli_krn_pool_hwc<mli::krn::AVEPOOL, int16_t, POOL_NO_FIXED_KRN_SIZE>(in, cfg, out);
 
     return MLI_STATUS_OK;
 }
 
 char * mli_debug_krn_avepool_hwc_fx16(const mli_tensor * in, const mli_pool_cfg * cfg, mli_tensor * out) {
+#if MLI_SPEC_DISPATCH
     int kernel_w = cfg->kernel_width;
     int kernel_h = cfg->kernel_height;
 
@@ -67,9 +70,9 @@ char * mli_debug_krn_avepool_hwc_fx16(const mli_tensor * in, const mli_pool_cfg
         return (char*)"mli_krn_avepool_hwc_fx16_k3x3";
     } else if ((kernel_w == 2) && (kernel_h == 2)) {
         return (char*)"mli_krn_avepool_hwc_fx16_k2x2";
-    } else {
-        return (char*)"mli_krn_avepool_hwc_fx16";
     }
+#endif
+    return (char*)"mli_krn_avepool_hwc_fx16";
 }
 
 #pragma MLI_CODE_SECTION_END()
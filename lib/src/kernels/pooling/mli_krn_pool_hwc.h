@@ -19,6 +19,7 @@
 #include "mli_prv_dsp.h"
 #include "mli_private_types.h"
 #include "mli_prv_layout.h"
+#include "mli_prv_parallel.h"
 
 namespace mli {
 namespace krn {
@@ -287,12 +288,17 @@ static MLI_FORCE_INLINE void mli_krn_pool_hwc_pad(
     const int nopad_clmn_end = CEIL_DIV(in.width + padding_left - kernel_width + 1, stride_width);
 
     if ((nopad_row_end - nopad_row_beg > 0) && (nopad_clmn_end - nopad_clmn_beg > 0)) {
-        mli_krn_pool_hwc_nopad<type, io_T, fixed_kernel_size, convert>(
-                nopad_row_beg, nopad_row_end, nopad_clmn_beg, nopad_clmn_end,
-                stride_width, stride_height, padding_top,
-                padding_bot, padding_left, padding_right,
-                in, out,
-                kernel_height, kernel_width, params);
+        rect_t nopad_area;
+        nopad_area.row_beg = nopad_row_beg; nopad_area.row_end = nopad_row_end;
+        nopad_area.clmn_beg = nopad_clmn_beg; nopad_area.clmn_end = nopad_clmn_end;
+        mli::parallel_for_area(nopad_area, [&](const rect_t &area) {
+            mli_krn_pool_hwc_nopad<type, io_T, fixed_kernel_size, convert>(
+                    area.row_beg, area.row_end, area.clmn_beg, area.clmn_end,
+                    stride_width, stride_height, padding_top,
+                    padding_bot, padding_left, padding_right,
+                    in, out,
+                    kernel_height, kernel_width, params);
+        });
     }
     // Phase 2: Process border part with more complex algorithm
     // (usually significantly smaller part of computations)
@@ -434,17 +440,31 @@ static MLI_FORCE_INLINE void mli_krn_pool_hwc_wrapper(
                                 in_, out_,
                                 kernel_height, kernel_width, params);
     } else {
-        mli_krn_pool_hwc_nopad<type, io_T, fixed_kernel_size, convert>(
-                                /*row_beg*/ 0, row_end, /*clmn_beg*/ 0, clmn_end,
-                                stride_width, stride_height,
-                                /*padding_top*/ 0, /*padding_bot*/ 0, /*padding_left*/ 0, /*padding_right*/ 0,
-                                in_, out_,
-                                kernel_height, kernel_width, params);
+        rect_t cent_area;
+        cent_area.row_beg = 0; cent_area.row_end = row_end;
+        cent_area.clmn_beg = 0; cent_area.clmn_end = clmn_end;
+        mli::parallel_for_area(cent_area, [&](const rect_t &area) {
+            mli_krn_pool_hwc_nopad<type, io_T, fixed_kernel_size, convert>(
+                                    area.row_beg, area.row_end, area.clmn_beg, area.clmn_end,
+                                    stride_width, stride_height,
+                                    /*padding_top*/ 0, /*padding_bot*/ 0, /*padding_left*/ 0, /*padding_right*/ 0,
+                                    in_, out_,
+                                    kernel_height, kernel_width, params);
+        });
     }
 }
 
 template <pool_type type, typename io_T, int fixed_kernel_size, bool convert = false>
 static void mli_krn_pool_hwc(const mli_tensor * in, const mli_pool_cfg * cfg, mli_tensor * out) {
+    // Rank-4 feature maps are processed as batch of rank-3 items sharing all the parameters below
+    mli_tensor in_item, out_item;
+    int32_t in_batch_mem_stride, out_batch_mem_stride;
+    const uint32_t batch = mli_prv_get_batch_item(in, &in_item, &in_batch_mem_stride);
+    mli_prv_get_batch_item(out, &out_item, &out_batch_mem_stride);
+    mli_tensor *out_batch = out;
+    in = &in_item;
+    out = &out_item;
+
     // Extract general avepool parameters
     int32_t stride_width = cfg->stride_width;
     int32_t stride_height = cfg->stride_height;
@@ -503,6 +523,7 @@ static void mli_krn_pool_hwc(const mli_tensor * in, const mli_pool_cfg * cfg, ml
     }
 
     const auto out_prv = mli_prv_get_tensor_hwc<MLI_OUT_PTR(io_T)>(out);
+    mli_prv_update_batch_tensor(out, out_batch);
     const int32_t row_beg = 0;
     const int32_t row_end = out_height;
     const int32_t clmn_beg = 0;
@@ -510,14 +531,16 @@ static void mli_krn_pool_hwc(const mli_tensor * in, const mli_pool_cfg * cfg, ml
 
     mli_prv_fx_init_dsp_ctrl();
 
-
-    mli_krn_pool_hwc_wrapper<type, io_T, fixed_kernel_size, convert>(in_prv.ptr, out_prv.ptr,
-                            row_beg, row_end, clmn_beg, clmn_end,
-                            stride_width, stride_height,
-                            padding_top, padding_bot, padding_left, padding_right,
-                            in_prv, out_prv,
-                            kernel_height, kernel_width, &params);
-
+    // Rows of each item are split between threads inside the wrapper
+    for (uint32_t item = 0; item < batch; item++) {
+        mli_krn_pool_hwc_wrapper<type, io_T, fixed_kernel_size, convert>(
+                                in_prv.ptr + item * in_batch_mem_stride, out_prv.ptr + item * out_batch_mem_stride,
+                                row_beg, row_end, clmn_beg, clmn_end,
+                                stride_width, stride_height,
+                                padding_top, padding_bot, padding_left, padding_right,
+                                in_prv, out_prv,
+                                kernel_height, kernel_width, &params);
+    }
 }
 
 } // krn
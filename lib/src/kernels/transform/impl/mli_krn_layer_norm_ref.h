@@ -0,0 +1,238 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_KRN_LAYER_NORM_REF_H_
+#define _MLI_KRN_LAYER_NORM_REF_H_
+
+#include "mli_check.h"
+#include "mli_config.h"
+#include "mli_debug.h"
+#include "mli_helpers_api.h"
+#include "mli_math.h"
+#include "mli_prv_dsp.h"
+#include "mli_prv_tensor.h"
+#include "mli_types.h"
+#include "mli_prv_activation_lut.h"
+#include "mli_prv_lut.h"
+
+const int kLayerNormLutFracBits = 8;
+/* Fractional bits of normalized values before scaling by gamma */
+const int kLayerNormFracBits = 16;
+const int kLayerNormBetaPreDivShift = 32;
+const int kLayerNormOutPreDivShift = 16;
+/* Epsilon added to the variance: 1e-5 = kLayerNormEpsilonMul * 2^(-kLayerNormEpsilonShift) */
+const int32_t kLayerNormEpsilonMul = 21475;
+const int kLayerNormEpsilonShift = 31;
+
+namespace mli {
+namespace krn {
+namespace ref {
+
+template<typename io_T, bool center>
+static MLI_FORCE_INLINE int16_t compute_row_statistics(
+        const MLI_PTR(io_T) vec_in,
+        const int16_t in_zp,
+        const int row_len,
+        const int64_t var_epsilon,
+        int64_t *sum,
+        int *norm_shift) {
+
+    /* First pass: sum and sum of squares of the row */
+    int32_t sum_acc = 0;
+    int64_t sum_sq_acc = 0;
+    for (int idx = 0; idx < row_len; idx++) {
+        const int16_t input = mli_math_sub_fx<int16_t>(vec_in[idx], in_zp);
+        if (center) {
+            sum_acc = mli_math_add_fx<int32_t>(sum_acc, input);
+        }
+        sum_sq_acc = mli_math_add_fx<int64_t>(sum_sq_acc, mli_math_mul_fx<int16_t, int32_t>(input, input));
+    }
+
+    /* Variance is kept multiplied by row_len^2 to avoid division:
+     *     var * row_len^2 = row_len * sum(x^2) - sum(x)^2
+     * For RMS normalization mean square is used instead:
+     *     mean(x^2) * row_len^2 = row_len * sum(x^2)
+     */
+    int64_t var_acc = (int64_t)row_len * sum_sq_acc;
+    if (center) {
+        var_acc -= (int64_t)sum_acc * sum_acc;
+    }
+    var_acc = mli_math_add_fx<int64_t>(var_acc, var_epsilon);
+    *sum = sum_acc;
+
+    int norm_shift_val = mli_math_norm_fx<int64_t, int>(var_acc);
+    /* To Cast int64_t to int16_t */
+    norm_shift_val = (sizeof(int64_t) - sizeof(int16_t)) * 8 - norm_shift_val;
+    /* Adjust norm_shift to even number because we are going to divide it by 2 */
+    if ((norm_shift_val & 0x1) == 0x1) {
+        norm_shift_val += 1;
+    }
+
+    *norm_shift = norm_shift_val;
+    /* Cast var_acc to Q7.8 to bring it to LUT input range */
+    return mli_math_cast_fx<int64_t, int16_t>(var_acc, norm_shift_val);
+}
+
+template <bool convert>
+static MLI_FORCE_INLINE int64_t define_var_epsilon(const mli_tensor *in, const int row_len) {
+    /* Epsilon in units of var_acc (squared input step divided by row_len^2):
+     *     var_epsilon = 1e-5 * row_len^2 / in_step^2,    in_step = in_scale * 2^(-in_frac_bits)
+     * It is kept positive even if it is below one unit, so the variance of a constant row isn't zero. */
+    const int in_frac_bits = (convert) ? in->el_params.sa.scale_frac_bits.mem.i8 : in->el_params.fx.frac_bits;
+    const int32_t in_scale = (convert) ? in->el_params.sa.scale.mem.i16 : 1;
+    const int eps_shift = 2 * in_frac_bits - kLayerNormEpsilonShift;
+    int64_t eps = mli_math_asl_fx<int64_t>((int64_t)row_len * row_len * kLayerNormEpsilonMul, MAX(eps_shift, 0));
+    eps = mli_math_asr_rnd_fx<int64_t>(eps / (in_scale * in_scale), MAX(-eps_shift, 0));
+    return MAX(eps, (int64_t)1);
+}
+
+template<typename io_T, bool center, bool shift_by_beta>
+static MLI_FORCE_INLINE void normalize_row(
+        const MLI_PTR(io_T) vec_in,
+        const MLI_PTR(io_T) gamma,
+        const MLI_PTR(io_T) beta,
+        MLI_OUT_PTR(io_T) vec_out,
+        const int64_t sum,
+        const int16_t inv_sqrt,
+        const int shift,
+        const int row_len,
+        const layer_norm_params *params) {
+
+    /* Second pass: (x - mean) / std = (row_len * x - sum(x)) * inv_sqrt(var * row_len^2) */
+    for (int idx = 0; idx < row_len; idx++) {
+        const int16_t input = mli_math_sub_fx<int16_t>(vec_in[idx], params->in_offset);
+        int64_t centered = (int64_t)row_len * input;
+        if (center) {
+            centered -= sum;
+        }
+        const int32_t norm_val = mli_math_cast_fx<int64_t, int32_t>(centered * inv_sqrt, shift);
+
+        const int16_t gamma_val = mli_math_sub_fx<int16_t>(gamma[idx], params->gamma_offset);
+        int64_t acc = mli_math_mul_fx<int32_t, int64_t>(norm_val, gamma_val);
+        if (shift_by_beta) {
+            const int16_t beta_val = mli_math_sub_fx<int16_t>(beta[idx], params->beta_offset);
+            int64_t beta_acc = mli_math_mul_fx<int32_t, int64_t>((int32_t)beta_val, params->beta_scale);
+            acc = mli_math_add_fx<int64_t>(acc, mli_math_asr_rnd_fx<int64_t>(beta_acc, params->beta_shift));
+        }
+
+        int32_t res = mli_math_cast_fx<int64_t, int32_t>(acc * params->out_scale, params->out_shift);
+        res = mli_math_add_fx<int32_t>(res, params->out_offset);
+        vec_out[idx] = mli_math_cast_fx<int32_t, io_T>(res, 0);
+    }
+}
+
+template <typename io_T, bool convert, bool center>
+static MLI_FORCE_INLINE mli_status layer_norm_run(const mli_tensor *in,
+        const mli_tensor *gamma,
+        const mli_tensor *beta,
+        const mli_lut *lut,
+        mli_tensor *out) {
+
+    mli_prv_fx_init_dsp_ctrl();
+
+    MLI_ASSERT(MLI_MAX_RANK == 4);
+
+    layer_norm_params params;
+    /* ****************************************************************************************************************
+     *                        Mathematical Derivations for the output requantization
+     * ----------------------------------------------------------------------------------------------------------------
+     *    Normalized value y is unitless and independent of input scale. It is kept with kLayerNormFracBits.
+     *    acc = y * (gamma - gamma_zp)                           in units of gamma_scale * 2^(-kLayerNormFracBits)
+     *    beta is converted to units of acc:
+     *        beta_acc = (beta - beta_zp) * beta_scale / gamma_scale * 2^kLayerNormFracBits
+     *    out = (acc + beta_acc) * gamma_scale / out_scale * 2^(-kLayerNormFracBits) + out_zp
+     *    For fx16 all scales are powers of two, so only shifts are used.
+     * ***************************************************************************************************************/
+    if (convert) {
+        const int16_t scale_gamma = gamma->el_params.sa.scale.mem.i16;
+        const int16_t scale_out = out->el_params.sa.scale.mem.i16;
+        const int shift_gamma = gamma->el_params.sa.scale_frac_bits.mem.i8;
+        const int shift_out = out->el_params.sa.scale_frac_bits.mem.i8;
+        int norm_shift;
+
+        params.in_offset = in->el_params.sa.zero_point.mem.i16;
+        params.gamma_offset = gamma->el_params.sa.zero_point.mem.i16;
+        params.out_offset = out->el_params.sa.zero_point.mem.i16;
+        params.beta_offset = 0;
+        params.beta_scale = 1;
+        params.beta_shift = 0;
+        if (center) {
+            const int16_t scale_beta = beta->el_params.sa.scale.mem.i16;
+            const int shift_beta = beta->el_params.sa.scale_frac_bits.mem.i8;
+            params.beta_offset = beta->el_params.sa.zero_point.mem.i16;
+
+            int64_t ratio = mli_math_asl_fx<int64_t>(scale_beta, kLayerNormBetaPreDivShift) / scale_gamma;
+            params.beta_scale = mli_math_norm_cast_fx<int64_t, int32_t>(ratio, &norm_shift);
+            params.beta_shift = kLayerNormBetaPreDivShift - norm_shift + shift_beta - shift_gamma
+                              - kLayerNormFracBits;
+        }
+
+        int64_t ratio = mli_math_asl_fx<int64_t>(scale_gamma, kLayerNormOutPreDivShift) / scale_out;
+        params.out_scale = mli_math_norm_cast_fx<int64_t, int16_t>(ratio, &norm_shift);
+        params.out_shift = kLayerNormOutPreDivShift - norm_shift + shift_gamma + kLayerNormFracBits - shift_out;
+    } else {
+        const int frac_gamma = gamma->el_params.fx.frac_bits;
+
+        params.in_offset = params.gamma_offset = params.beta_offset = params.out_offset = 0;
+        params.beta_scale = 1;
+        params.beta_shift = (center) ? beta->el_params.fx.frac_bits - frac_gamma - kLayerNormFracBits : 0;
+        params.out_scale = 1;
+        params.out_shift = kLayerNormFracBits + frac_gamma - out->el_params.fx.frac_bits;
+    }
+
+    /* Fill output tensor parameters (element parameters are provided by user) */
+    for (int idx = 0; idx < (int)in->rank; idx++) {
+        out->shape[idx] = in->shape[idx];
+    }
+    out->rank = in->rank;
+
+    const MLI_PTR(io_T) gamma_ptr = mli_prv_tensor_data_ptr<MLI_PTR(io_T)>(gamma);
+    const MLI_PTR(io_T) beta_ptr = (center) ? mli_prv_tensor_data_ptr<MLI_PTR(io_T)>(beta) : nullptr;
+
+    /* Get Generic Private Tensor and place the normalized (inner most) dim at last shape */
+    auto in_prv =  mli_prv_get_generic_tensor<MLI_PTR(io_T)>(in);
+    auto out_prv = mli_prv_get_generic_tensor<MLI_OUT_PTR(io_T)>(out);
+    mli_prv_reorder_generic_tensor<MLI_PTR(io_T)>(&in_prv);
+    mli_prv_reorder_generic_tensor<MLI_OUT_PTR(io_T)>(&out_prv);
+    const int row_len = in_prv.shape[3];
+
+    params.var_epsilon = mli::krn::define_var_epsilon<convert>(in, row_len);
+
+    for (int pos0 = 0; pos0 < in_prv.shape[0]; pos0++) {
+        for (int pos1 = 0; pos1 < in_prv.shape[1]; pos1++) {
+            for (int pos2 = 0; pos2 < in_prv.shape[2]; pos2++) {
+                const MLI_PTR(io_T) vec_in = in_prv.ptr + POS(&in_prv, pos0, pos1, pos2, 0);
+                MLI_OUT_PTR(io_T) vec_out = out_prv.ptr + POS(&out_prv, pos0, pos1, pos2, 0);
+
+                int64_t sum;
+                int norm_shift;
+                const int16_t var_cast = mli::krn::compute_row_statistics<io_T, center>(
+                        vec_in, params.in_offset, row_len, params.var_epsilon, &sum, &norm_shift);
+
+                /* inv_sqrt = 1/sqrt(var_acc) = 2^(-norm_shift/2) * (1/sqrt(var_cast)) (see l2_normalize) */
+                const int16_t inv_sqrt = mli::krn::activation_lut_one_elem_interpolate<int16_t, int16_t,
+                        /* convert_input */ false, /* convert_output */ false>(
+                        var_cast, lut, kLayerNormLutFracBits);
+                const int shift = lut->out_frac_bits + ((norm_shift + kLayerNormLutFracBits) >> 1)
+                                - kLayerNormFracBits;
+
+                mli::krn::normalize_row<io_T, center, /* shift_by_beta */ center>(
+                        vec_in, gamma_ptr, beta_ptr, vec_out, sum, inv_sqrt, shift, row_len, &params);
+            }
+        }
+    }
+
+    return MLI_STATUS_OK;
+}
+
+} // namespace ref
+} // namespace krn
+} // namespace mli
+
+#endif // _MLI_KRN_LAYER_NORM_REF_H_
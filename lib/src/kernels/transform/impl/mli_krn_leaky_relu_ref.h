@@ -254,7 +254,7 @@ static MLI_FORCE_INLINE void leaky_relu_define_identity_params(const mli_tensor
 }
 static MLI_FORCE_INLINE s8asym_quant_params leaky_relu_define_alpha_params(const mli_tensor *in, 
         const mli_tensor *slope_coeff,
-        mli_tensor *out,
+        const mli_tensor *out,
         const int8_t alpha_sa8,
         const s8asym_quant_params *identity_params) {
     
@@ -394,6 +394,119 @@ static MLI_FORCE_INLINE mli_status prelu_sa8_run(const mli_tensor *in,
     return MLI_STATUS_OK;
 }
 
+static MLI_FORCE_INLINE void prelu_sa8_define_plan(const mli_tensor *in,
+        const mli_tensor *slope_coeff,
+        const mli_prelu_cfg *cfg,
+        const mli_tensor *out,
+        mli_prelu_plan *plan) {
+
+    /* ****************************************************************************************************************
+     *    Requantization params of both branches depend only on element params of tensors and on slope values.
+     *    They are derived here once for each channel (see leaky_relu_define_alpha_params for the derivation) and
+     *    stored into the table provided by user, so prelu_sa8_planned_run doesn't need to recalculate them.
+     * ***************************************************************************************************************/
+    s8asym_quant_params identity_params;
+    leaky_relu_define_identity_params(in, out, &identity_params);
+
+    plan->axis = cfg->axis;
+    plan->in_offset = in->el_params.sa.zero_point.mem.i16;
+    plan->out_offset = out->el_params.sa.zero_point.mem.i16;
+    plan->identity.scale = identity_params.scale;
+    plan->identity.shift = identity_params.shift;
+
+    if (cfg->axis == -1) {
+        const int8_t alpha_sa8 = mli_prv_tensor_data_val<int8_t>(slope_coeff);
+        s8asym_quant_params alpha_params = mli::krn::ref::leaky_relu_define_alpha_params(
+                in, slope_coeff, out, alpha_sa8, &identity_params);
+        plan->slope_params[0].scale = alpha_params.scale;
+        plan->slope_params[0].shift = alpha_params.shift;
+        plan->slope_params_num = 1;
+    } else {
+        const MLI_PTR(int8_t) slope_ptr = mli_prv_tensor_data_ptr<MLI_PTR(int8_t)>(slope_coeff);
+        const int axis_shape = in->shape[cfg->axis];
+        const int axis_mem_stride = slope_coeff->mem_stride[cfg->axis];
+        for (int ch = 0; ch < axis_shape; ch++) {
+            s8asym_quant_params alpha_params = mli::krn::ref::leaky_relu_define_alpha_params(
+                    in, slope_coeff, out, slope_ptr[ch * axis_mem_stride], &identity_params);
+            plan->slope_params[ch].scale = alpha_params.scale;
+            plan->slope_params[ch].shift = alpha_params.shift;
+        }
+        plan->slope_params_num = axis_shape;
+    }
+}
+
+static MLI_FORCE_INLINE void compute_prelu_planned_inner_loop(
+        const MLI_PTR(int8_t) __restrict vec_in,
+        MLI_OUT_PTR(int8_t) __restrict vec_out,
+        const int16_t in_zp,
+        const int16_t out_zp,
+        const mli_prelu_requant_params identity_params,
+        const mli_prelu_requant_params *slope_params,
+        const int slope_params_step,
+        const int count) {
+    /* Both branches share the same offset, so only scale and shift are selected.
+     * Selection instead of branching keeps the loop body free of data dependent jumps. */
+    for (int idx = 0; idx < count; idx++) {
+        const int16_t input_sub = mli_math_sub_fx((int16_t)vec_in[idx], in_zp);
+        const bool is_neg = input_sub < 0;
+        const int16_t scale = is_neg ? slope_params->scale : identity_params.scale;
+        const int shift = is_neg ? slope_params->shift : identity_params.shift;
+        int32_t output = mli_math_asr_rnd_fx(mli_math_mul_fx<int16_t, int32_t>(scale, input_sub), shift);
+        output = mli_math_add_fx(output, (int32_t)out_zp);
+        vec_out[idx] = mli_math_cast_fx<int32_t, int8_t>(output, 0);
+        slope_params += slope_params_step;
+    }
+}
+
+static MLI_FORCE_INLINE mli_status prelu_sa8_planned_run(const mli_prelu_plan *plan,
+        const mli_tensor *in,
+        mli_tensor *out) {
+
+    mli_prv_fx_init_dsp_ctrl();
+
+    /* Copy tensor format */
+    for (int idx = 0; idx < (int)in->rank; idx++) {
+        out->shape[idx] = in->shape[idx];
+    }
+    out->rank = in->rank;
+    out->el_type = in->el_type;
+
+    /* Get Generic Private Tensor */
+    auto in_prv =  mli_prv_get_generic_tensor<MLI_PTR(int8_t)>(in);
+    auto out_prv = mli_prv_get_generic_tensor<MLI_OUT_PTR(int8_t)>(out);
+
+    /* Position of the slope axis after placing the inner most dim at last shape.
+     * In case of a single slope value all dimensions are treated as non axis ones. */
+    int axis = -1;
+    if (plan->axis != -1) {
+        axis = plan->axis + MLI_MAX_RANK - (int)in_prv.rank;
+    }
+    mli_prv_reorder_generic_tensor<MLI_PTR(int8_t)>(&in_prv);
+    mli_prv_reorder_generic_tensor<MLI_OUT_PTR(int8_t)>(&out_prv);
+
+    /* Slope table is walked along the row only if slope axis is the inner most (contiguous) one */
+    const int slope_params_step = (axis == MLI_MAX_RANK - 1) ? 1 : 0;
+
+    for (int pos0 = 0; pos0 < in_prv.shape[0]; pos0++) {
+        for (int pos1 = 0; pos1 < in_prv.shape[1]; pos1++) {
+            for (int pos2 = 0; pos2 < in_prv.shape[2]; pos2++) {
+                int ch = 0;
+                if (axis == 0) ch = pos0;
+                else if (axis == 1) ch = pos1;
+                else if (axis == 2) ch = pos2;
+
+                const MLI_PTR(int8_t) vec_in = in_prv.ptr + POS(&in_prv, pos0, pos1, pos2, 0);
+                MLI_OUT_PTR(int8_t) vec_out = out_prv.ptr + POS(&out_prv, pos0, pos1, pos2, 0);
+                mli::krn::compute_prelu_planned_inner_loop(vec_in, vec_out, plan->in_offset, plan->out_offset,
+                                                           plan->identity, &plan->slope_params[ch],
+                                                           slope_params_step, in_prv.shape[3]);
+            }
+        }
+    }
+
+    return MLI_STATUS_OK;
+}
+
 } // namespace ref
 } // namespace krn
 } // namespace mli
@@ -522,6 +522,49 @@ static MLI_FORCE_INLINE void compute_prelu_no_broadcast(
     }
 }
 
+static MLI_FORCE_INLINE void compute_prelu_planned_inner_loop(
+        const MLI_PTR(int8_t) __restrict vec_in,
+        MLI_OUT_PTR(int8_t) __restrict vec_out,
+        const int16_t in_zp,
+        const int16_t out_zp,
+        const mli_prelu_requant_params identity_params,
+        const mli_prelu_requant_params *slope_params,
+        const int slope_params_step,
+        const int count) {
+    s8asym_quant_params identity;
+    identity.offset = out_zp;
+    identity.scale = identity_params.scale;
+    identity.shift = identity_params.shift;
+
+    s8asym_quant_params_v alpha_params;
+    alpha_params.offset = (vNx4short_t)out_zp;
+    alpha_params.scale = (vNx4short_t)slope_params->scale;
+    alpha_params.shift = (vNx4short_t)slope_params->shift;
+
+    /* Scale and shift are interleaved in the table, so per-channel params are gathered with stride 2.
+     * Lanes beyond the row repeat its last channel to keep the gather inside the table. */
+    constexpr int num_lanes = get_number_lanes<vNx4char_t>();
+    const MLI_PTR(short) table = (const MLI_PTR(short))slope_params;
+    vNx4int_t lane_offsets;
+    for (int lane = 0; lane < num_lanes; lane++) {
+        lane_offsets[lane] = 2 * lane;
+    }
+
+    for (int idx = 0; idx < count; idx += num_lanes) {
+        const int remaining_part = mli_math_min_fx(count - idx, num_lanes);
+        if (slope_params_step != 0) {
+            const vNx4int_t offsets = mli_math_min_fx(lane_offsets, (vNx4int_t)(2 * (remaining_part - 1)));
+            alpha_params.scale = mli_prv_gather_load_nx4_samples(table + 2 * idx, offsets);
+            alpha_params.shift = mli_prv_gather_load_nx4_samples(table + 2 * idx + 1, offsets);
+        }
+        if (remaining_part == num_lanes) {
+            compute_prelu(vec_in + idx, vec_out + idx, in_zp, &identity, &alpha_params);
+        } else {
+            compute_prelu(vec_in + idx, vec_out + idx, in_zp, &identity, &alpha_params, remaining_part);
+        }
+    }
+}
+
 } // namespace vdsp
 } // namespace krn
 } // namespace mli
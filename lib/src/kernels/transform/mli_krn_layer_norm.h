@@ -0,0 +1,56 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_KRN_LAYER_NORM_H_
+#define _MLI_KRN_LAYER_NORM_H_
+
+#include "mli_krn_layer_norm_decl.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Setting up namespace
+////////////////////////////////////////////////////////////////////////////////
+// Selecting between different variants (depending on hardware features) is
+// done with 'using'. A completely different implementation can be used/'using'.
+// However, also only a part of the reference together with optimized functions
+// (from example *_dsp) can be used/'using'.
+
+namespace mli {
+namespace krn {
+#if !defined(MLI_BUILD_REFERENCE) && defined(__Xvec_width)
+using mli::krn::ref::compute_row_statistics;
+using mli::krn::ref::define_var_epsilon;
+using mli::krn::ref::normalize_row;
+using mli::krn::ref::layer_norm_run;
+
+#elif !defined(MLI_BUILD_REFERENCE) && defined(__FXAPI__)
+using mli::krn::ref::compute_row_statistics;
+using mli::krn::ref::define_var_epsilon;
+using mli::krn::ref::normalize_row;
+using mli::krn::ref::layer_norm_run;
+
+#else
+using mli::krn::ref::compute_row_statistics;
+using mli::krn::ref::define_var_epsilon;
+using mli::krn::ref::normalize_row;
+using mli::krn::ref::layer_norm_run;
+
+#endif
+} // namespace krn
+} // namespace mli
+
+////////////////////////////////////////////////////////////////////////////////
+// Include implementation
+////////////////////////////////////////////////////////////////////////////////
+// The reference (*_ref.h) implementation can run on all platforms and is always
+// included. Other variants are included based on capabilities. Implementations
+// below can depend on each other through declarations in *_decl.h.
+
+#include "impl/mli_krn_layer_norm_ref.h"
+
+#endif // _MLI_KRN_LAYER_NORM_H_
@@ -0,0 +1,95 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_KRN_LAYER_NORM_DECL_H_
+#define _MLI_KRN_LAYER_NORM_DECL_H_
+
+#include "mli_config.h"
+#include "mli_types.h"
+#include "mli_prv_tensor.h"
+
+namespace mli {
+
+// Requantization parameters of affine transformation applied to the normalized row
+struct layer_norm_params {
+    int16_t in_offset;
+    int16_t gamma_offset;
+    int16_t beta_offset;
+    int16_t out_offset;
+    int32_t beta_scale;
+    int beta_shift;
+    int16_t out_scale;
+    int out_shift;
+    int64_t var_epsilon;
+};
+
+namespace krn {
+////////////////////////////////////////////////////////////////////////////////
+// Functions (in *_ref/*_dsp/*vdsp) that can be called from outside their own
+// file must be declared here. This includes all overloads. For example, if we
+// have: io_T f(io_T a) and int8_t f(int8_t a), then both must be declared.
+// Not doing so, can cause the compiler to use the wrong overload.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// REF
+////////////////////////////////////////////////////////////////////////////////
+namespace ref {
+
+template<typename io_T, bool center>
+static MLI_FORCE_INLINE int16_t compute_row_statistics(
+        const MLI_PTR(io_T) vec_in,
+        const int16_t in_zp,
+        const int row_len,
+        const int64_t var_epsilon,
+        int64_t *sum,
+        int *norm_shift);
+
+template <bool convert>
+static MLI_FORCE_INLINE int64_t define_var_epsilon(const mli_tensor *in, const int row_len);
+
+template<typename io_T, bool center, bool shift_by_beta>
+static MLI_FORCE_INLINE void normalize_row(
+        const MLI_PTR(io_T) vec_in,
+        const MLI_PTR(io_T) gamma,
+        const MLI_PTR(io_T) beta,
+        MLI_OUT_PTR(io_T) vec_out,
+        const int64_t sum,
+        const int16_t inv_sqrt,
+        const int shift,
+        const int row_len,
+        const layer_norm_params *params);
+
+template <typename io_T, bool convert, bool center>
+static MLI_FORCE_INLINE mli_status layer_norm_run(const mli_tensor *in,
+        const mli_tensor *gamma,
+        const mli_tensor *beta,
+        const mli_lut *lut,
+        mli_tensor *out);
+
+} // namespace ref
+
+////////////////////////////////////////////////////////////////////////////////
+// DSP
+////////////////////////////////////////////////////////////////////////////////
+namespace dsp {
+
+} // namespace dsp
+
+////////////////////////////////////////////////////////////////////////////////
+// VDSP
+////////////////////////////////////////////////////////////////////////////////
+namespace vdsp {
+
+} // namespace vdsp
+
+} // namespace krn
+} // namespace mli
+
+#endif // _MLI_KRN_LAYER_NORM_DECL_H_
@@ -10,6 +10,7 @@
 #include "mli_check.h"
 #include "mli_debug.h"
 #include "mli_krn_prelu.h"
+#include "mli_krn_epilogue.h"
 #include "mli_api.h"
 
 #ifdef __cplusplus
@@ -62,6 +63,36 @@ mli_status mli_krn_prelu_sa8(const mli_tensor *in,
         return mli::krn::prelu_sa8_run(in, slope_coeff, cfg, out);
     }
 }
+
+mli_status mli_krn_prelu_sa8_prepare(const mli_tensor *in,
+        const mli_tensor *slope_coeff,
+        const mli_prelu_cfg *cfg,
+        const mli_tensor *out,
+        mli_prelu_plan *plan) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_prelu_prepare_sa8(in, slope_coeff, cfg, out, plan), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+
+    mli::krn::prelu_sa8_define_plan(in, slope_coeff, cfg, out, plan);
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_krn_prelu_sa8_run(const mli_prelu_plan *plan,
+        const mli_tensor *in,
+        mli_tensor *out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_prelu_run_sa8(plan, in, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    MLI_PRINT_COMPILE_OPTIONS();
+
+    return mli::krn::prelu_sa8_planned_run(plan, in, out);
+}
+
+mli_status mli_krn_epilogue_sa8_prepare(const mli_tensor *out, mli_epilogue_cfg *epilogue) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_epilogue_prepare_sa8(out, epilogue), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+
+    mli::krn::epilogue_sa8_define_slope_params(out, epilogue);
+    return MLI_STATUS_OK;
+}
 #pragma MLI_CODE_SECTION_END()
 
 #ifdef __cplusplus
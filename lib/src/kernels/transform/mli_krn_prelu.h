@@ -29,6 +29,9 @@ using mli::krn::vdsp::compute_prelu_no_broadcast;
 using mli::krn::vdsp::compute_prelu_broadcast;
 using mli::krn::ref::prelu_fx_run;
 using mli::krn::ref::prelu_sa8_run;
+using mli::krn::ref::prelu_sa8_define_plan;
+using mli::krn::vdsp::compute_prelu_planned_inner_loop;
+using mli::krn::ref::prelu_sa8_planned_run;
 
 #elif !defined(MLI_BUILD_REFERENCE) && defined(__FXAPI__)
 using mli::krn::dsp::compute_prelu;
@@ -37,6 +40,9 @@ using mli::krn::dsp::compute_prelu_no_broadcast;
 using mli::krn::ref::compute_prelu_broadcast;
 using mli::krn::ref::prelu_fx_run;
 using mli::krn::ref::prelu_sa8_run;
+using mli::krn::ref::prelu_sa8_define_plan;
+using mli::krn::ref::compute_prelu_planned_inner_loop;
+using mli::krn::ref::prelu_sa8_planned_run;
 
 #else
 using mli::krn::ref::compute_prelu;
@@ -45,6 +51,9 @@ using mli::krn::ref::compute_prelu_no_broadcast;
 using mli::krn::ref::compute_prelu_broadcast;
 using mli::krn::ref::prelu_fx_run;
 using mli::krn::ref::prelu_sa8_run;
+using mli::krn::ref::prelu_sa8_define_plan;
+using mli::krn::ref::compute_prelu_planned_inner_loop;
+using mli::krn::ref::prelu_sa8_planned_run;
 
 #endif
 } // namespace krn
@@ -121,6 +121,26 @@ static MLI_FORCE_INLINE mli_status prelu_sa8_run(const mli_tensor *in,
         const mli_prelu_cfg *cfg, 
         mli_tensor *out);
 
+static MLI_FORCE_INLINE void prelu_sa8_define_plan(const mli_tensor *in,
+        const mli_tensor *slope_coeff,
+        const mli_prelu_cfg *cfg,
+        const mli_tensor *out,
+        mli_prelu_plan *plan);
+
+static MLI_FORCE_INLINE void compute_prelu_planned_inner_loop(
+        const MLI_PTR(int8_t) __restrict vec_in,
+        MLI_OUT_PTR(int8_t) __restrict vec_out,
+        const int16_t in_zp,
+        const int16_t out_zp,
+        const mli_prelu_requant_params identity_params,
+        const mli_prelu_requant_params *slope_params,
+        const int slope_params_step,
+        const int count);
+
+static MLI_FORCE_INLINE mli_status prelu_sa8_planned_run(const mli_prelu_plan *plan,
+        const mli_tensor *in,
+        mli_tensor *out);
+
 } // namespace ref
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -304,6 +324,16 @@ static MLI_FORCE_INLINE void compute_prelu_no_broadcast(
         const generic_tensor_private_t<MLI_PTR(int8_t)> in_prv,
         const generic_tensor_private_t<MLI_OUT_PTR(int8_t)> out_prv,
         const int remaining_part = 0);
+
+static MLI_FORCE_INLINE void compute_prelu_planned_inner_loop(
+        const MLI_PTR(int8_t) __restrict vec_in,
+        MLI_OUT_PTR(int8_t) __restrict vec_out,
+        const int16_t in_zp,
+        const int16_t out_zp,
+        const mli_prelu_requant_params identity_params,
+        const mli_prelu_requant_params *slope_params,
+        const int slope_params_step,
+        const int count);
 #endif
 
 } // namespace vdsp
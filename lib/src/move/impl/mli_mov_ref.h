@@ -41,11 +41,22 @@ static MLI_FORCE_INLINE void mov_inner_loop (mli_mov_handle_t* h, const io_T* __
         uint32_t inner_subsample, uint32_t inner_src_shape,
         bool zero_inner_loop, bool src_in_vccm, bool dst_in_vccm,
         bool no_inner_src_stride, bool no_inner_dst_stride, bool small_size) {
-    if (zero_inner_loop) {
+    if (zero_inner_loop && no_inner_dst_stride) {
+        memset(&dst[inner_dst_offset], 0, inner_dst_size * sizeof(io_T));
+    } else if (zero_inner_loop) {
         for (uint32_t inner_idx = 0; inner_idx < inner_dst_size; inner_idx++) {
             uint32_t inner_dst_pos = (inner_idx + inner_dst_offset) * inner_dst_strde;
             dst[inner_dst_pos] = 0;
         }
+    } else if (no_inner_src_stride && no_inner_dst_stride) {
+        // contiguous on both sides: zeros for the pre padding, one bulk copy, zeros for the post padding.
+        const int first = MAX(0, (int)inner_pre_padding - (int)inner_src_offset);
+        const int last = MAX(first, MIN((int)inner_dst_size,
+                (int)inner_src_shape + (int)inner_pre_padding - (int)inner_src_offset));
+        io_T* __restrict pdst = &dst[inner_dst_offset];
+        memset(pdst, 0, first * sizeof(io_T));
+        memcpy(&pdst[first], &src[first + (int)inner_src_offset - (int)inner_pre_padding], (last - first) * sizeof(io_T));
+        memset(&pdst[last], 0, (inner_dst_size - last) * sizeof(io_T));
     } else {
         for (int inner_idx = 0; inner_idx < inner_dst_size; inner_idx++) {
             int inner_src_pos = inner_idx * inner_subsample + inner_src_offset - inner_pre_padding;
@@ -68,6 +79,10 @@ static MLI_FORCE_INLINE void mov_inner_loop (mli_mov_handle_t* h, const io_T* __
         uint32_t inner_subsample,
         bool src_in_vccm, bool dst_in_vccm,
         bool no_inner_src_stride, bool no_inner_dst_stride, bool small_size) {
+        if (no_inner_src_stride && no_inner_dst_stride) {
+            memcpy(dst, src, inner_dst_size * sizeof(io_T));
+            return;
+        }
         uint32_t inner_src_step = inner_subsample * inner_src_strde;
         for (int inner_idx = 0; inner_idx < inner_dst_size; inner_idx++) {
             int inner_src_pos = inner_idx * inner_src_step;
@@ -153,6 +168,56 @@ static MLI_FORCE_INLINE void mli_mov_basic_operation (mli_mov_handle_t* h, const
 
 }
 
+// Merges the two innermost (ordered) dimensions as long as rows are copied completely and are
+// contiguous in both src and dst, so that the inner loop works on one long run instead of many short ones.
+// Only done without permutation, so that ordered_pdim stays the identity.
+static MLI_FORCE_INLINE void mli_mov_collapse_inner_dims(uint32_t* ordered_dst_write_size, uint32_t* ordered_src_shape,
+    uint32_t* ordered_src_cpy_size, uint32_t* ordered_dst_mem_stride, uint32_t* ordered_src_mem_stride,
+    uint8_t* ordered_pre_padding, uint8_t* ordered_post_padding, uint8_t* ordered_pdim, uint32_t* ordered_offset,
+    uint32_t* ordered_dst_offset, uint32_t* ordered_subsample) {
+    for (int i = 0; i < MLI_MAX_RANK; i++) {
+        if (ordered_pdim[i] != i) return;
+    }
+    const int inner = MLI_MAX_RANK - 1;
+    const int outer = MLI_MAX_RANK - 2;
+    for (int merges = 0; merges < MLI_MAX_RANK - 1; merges++) {
+        const bool mergeable = (ordered_dst_write_size[outer] > 1)
+                && (ordered_subsample[outer] == 1) && (ordered_subsample[inner] == 1)
+                && (ordered_pre_padding[outer] == 0) && (ordered_post_padding[outer] == 0)
+                && (ordered_pre_padding[inner] == 0) && (ordered_post_padding[inner] == 0)
+                && (ordered_offset[inner] == 0) && (ordered_dst_offset[inner] == 0)
+                && (ordered_dst_write_size[inner] == ordered_src_shape[inner])
+                && (ordered_src_mem_stride[outer] == ordered_src_mem_stride[inner] * ordered_src_shape[inner])
+                && (ordered_dst_mem_stride[outer] == ordered_dst_mem_stride[inner] * ordered_dst_write_size[inner]);
+        if (!mergeable) return;
+
+        const uint32_t row = ordered_src_shape[inner];
+        ordered_dst_write_size[inner] *= ordered_dst_write_size[outer];
+        ordered_src_cpy_size[inner] = ordered_src_cpy_size[outer] * row;
+        ordered_src_shape[inner] *= ordered_src_shape[outer];
+        ordered_offset[inner] = ordered_offset[outer] * row;
+        ordered_dst_offset[inner] = ordered_dst_offset[outer] * row;
+        // shift the remaining outer dimensions inwards and make the outermost one neutral
+        for (int i = outer; i > 0; i--) {
+            ordered_dst_write_size[i] = ordered_dst_write_size[i - 1];
+            ordered_src_shape[i] = ordered_src_shape[i - 1];
+            ordered_src_cpy_size[i] = ordered_src_cpy_size[i - 1];
+            ordered_dst_mem_stride[i] = ordered_dst_mem_stride[i - 1];
+            ordered_src_mem_stride[i] = ordered_src_mem_stride[i - 1];
+            ordered_pre_padding[i] = ordered_pre_padding[i - 1];
+            ordered_post_padding[i] = ordered_post_padding[i - 1];
+            ordered_offset[i] = ordered_offset[i - 1];
+            ordered_dst_offset[i] = ordered_dst_offset[i - 1];
+            ordered_subsample[i] = ordered_subsample[i - 1];
+        }
+        ordered_dst_write_size[0] = ordered_src_shape[0] = ordered_src_cpy_size[0] = 1;
+        ordered_dst_mem_stride[0] = ordered_src_mem_stride[0] = 0;
+        ordered_pre_padding[0] = ordered_post_padding[0] = 0;
+        ordered_offset[0] = ordered_dst_offset[0] = 0;
+        ordered_subsample[0] = 1;
+    }
+}
+
 template<typename io_T, bool src_in_vccm, bool dst_in_vccm>
 static MLI_NO_INLINE void mli_mov_prepare_run (mli_mov_handle_t* h, const mli_tensor* src, const mli_mov_cfg_t* cfg,
         mli_tensor* dst, uint32_t* dst_write_size, uint32_t* src_mem_stride, uint32_t* src_cpy_size,
@@ -182,6 +247,9 @@ static MLI_NO_INLINE void mli_mov_prepare_run (mli_mov_handle_t* h, const mli_te
         ordered_dst_offset[i] = cfg->dst_offset[j];
         ordered_subsample[i] = cfg->sub_sample_step[j];
     }
+    mli_mov_collapse_inner_dims(ordered_dst_write_size, ordered_src_shape, ordered_src_cpy_size,
+            ordered_dst_mem_stride, ordered_src_mem_stride, ordered_pre_padding, ordered_post_padding,
+            ordered_pdim, ordered_offset, ordered_dst_offset, ordered_subsample);
     bool no_inner_src_stride = ((ordered_src_mem_stride[ordered_pdim[3]] * ordered_subsample[ordered_pdim[3]]) == 1);
     bool no_inner_dst_stride = (ordered_dst_mem_stride[3] == 1);
     bool small_size = (ordered_dst_write_size[3] * sizeof(io_T) < small_size_limit);
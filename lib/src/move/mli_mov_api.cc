@@ -19,17 +19,59 @@
 #include "mli_check.h"
 #include "mli_prv_load_store.h"
 #include "mli_prv_tensor.h"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 #pragma MLI_CODE_SECTION_START(".mli_lib")
 
-// singleton for dma channel pool
-static mli_mov_dma_pool_t dma_pool = MLI_MOV_DMA_POOL_INIT;
+// default context used by functions without a context parameter and by handles without a context
+static mli_context default_ctx = {MLI_MOV_DMA_POOL_INIT, {{0}}, 0};
+
+// context each dma channel is assigned to (NULL for a free channel). A channel is assigned
+// to one context at most, so resources indexed by channel can be shared by all contexts.
+static mli_context* dma_ch_owner[MAX_DMA_CHAN];
+static int32_t dma_ch_owner_lock;
+
+#if defined(MLI_MOV_HOST_ASYNC)
+// transfers prepared on a channel and waiting for mli_mov_start.
+static mli_mov_transfer_t transfertable[MAX_DMA_CHAN];
+#endif
+
+static MLI_FORCE_INLINE mli_context* mli_mov_get_ctx(const mli_mov_handle_t* h) {
+    return (h->ctx != NULL) ? h->ctx : &default_ctx;
+}
 
-// singleton for callback functions
-static mli_mov_cb_t callbacktable[MAX_DMA_CHAN] = {{0}};
+// Spin lock guarding the dma pool of a context or the channel assignment.
+// It is only held for a few status updates.
+static MLI_FORCE_INLINE void mli_mov_spin_lock(int32_t* lock) {
+#if defined(_MSC_VER)
+    while (_InterlockedExchange((volatile long*)lock, 1) != 0) {
+    }
+#else
+    while (__atomic_exchange_n(lock, 1, __ATOMIC_ACQUIRE) != 0) {
+    }
+#endif
+}
+
+static MLI_FORCE_INLINE void mli_mov_spin_unlock(int32_t* lock) {
+#if defined(_MSC_VER)
+    _InterlockedExchange((volatile long*)lock, 0);
+#else
+    __atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+#endif
+}
+
+static MLI_FORCE_INLINE void mli_mov_ctx_lock(mli_context* ctx) {
+    mli_mov_spin_lock(&ctx->lock);
+}
+
+static MLI_FORCE_INLINE void mli_mov_ctx_unlock(mli_context* ctx) {
+    mli_mov_spin_unlock(&ctx->lock);
+}
 
 //=====================================================================
 // Public functions
@@ -51,6 +93,14 @@ static mli_mov_cb_t callbacktable[MAX_DMA_CHAN] = {{0}};
  * The function will return once the complete data transfer is finished.
  */
 mli_status mli_mov_tensor_sync(const mli_tensor* src, const mli_mov_cfg_t* cfg, mli_tensor* dst) {
+    return mli_mov_tensor_sync_ctx(&default_ctx, src, cfg, dst);
+}
+
+/** 
+ * @brief Synchronous copy from src to dst using resources of a context
+ */
+mli_status mli_mov_tensor_sync_ctx(mli_context* ctx, const mli_tensor* src, const mli_mov_cfg_t* cfg,
+        mli_tensor* dst) {
     mli_status retval = MLI_STATUS_OK;
     mli_mov_handle_t h = {0};
 #if USE_DMA
@@ -60,7 +110,7 @@ mli_status mli_mov_tensor_sync(const mli_tensor* src, const mli_mov_cfg_t* cfg,
 #endif
 
     if (retval == MLI_STATUS_OK)
-        retval = mli_mov_acquire_handle(num_dma_channels, &h);
+        retval = mli_mov_acquire_handle_ctx(ctx, num_dma_channels, &h);
     if (retval == MLI_STATUS_OK)
         retval = mli_mov_prepare(&h, src, cfg, dst);
     if (retval == MLI_STATUS_OK)
@@ -83,34 +133,24 @@ mli_status mli_mov_tensor_sync(const mli_tensor* src, const mli_mov_cfg_t* cfg,
 // Asynchronous data movement functions
 //---------------------------------------------------------------------
 
-/** 
- * @brief Prepare asynchronous copy from src to dst
+/**
+ * @brief Validate and record a copy from src to dst
  *
- * @detail This function will prepare a data copy from the src tensor to the dst tensor
- * according to the settings in the cfg struct.
- * It assumes the destination tensor contains a valid pointer to a large enough buffer.
- * the size of this buffer is specified in the capacity field of the dst tensor.
- * the other fields of the dst tensor will be filled by the copy function.
- *
- * The function returns after the transfer has been prepared.
- * In case the DMA is used, this function will not start the DMA transfer.
+ * @detail This function checks the parameters, fills the dst tensor fields (except data pointer)
+ * and stores everything needed to perform the data copy in t. Tensor data is not copied here,
+ * only per-axis quantization parameters if dst provides its own memory for them.
  */
-
-mli_status mli_mov_prepare(mli_mov_handle_t* h, const mli_tensor* src, const mli_mov_cfg_t* cfg, mli_tensor* dst) {
+static mli_status mli_mov_record_transfer(mli_mov_handle_t* h, const mli_tensor* src, const mli_mov_cfg_t* cfg,
+        mli_tensor* dst, mli_mov_transfer_t* t) {
     mli_status retval = MLI_STATUS_OK;
     uint32_t src_mem_stride[MLI_MAX_RANK] = {0};
-    // check tensor, check if handle is valid
-    MLI_ASSERT(h != NULL);
-    MLI_ASSERT(h->state == MLI_MOV_STATE_OPEN || h->state == MLI_MOV_STATE_DONE);
+    // check tensor
     retval = MLI_CHECK_STATUS(mli_chk_data_movement(src,cfg,dst),__func__);
     if (retval != MLI_STATUS_OK) return retval;
     // copy tensor parameters from source to destination and compute missing parameters.
     int rank = dst->rank = src->rank;
     dst->el_type = src->el_type;
 
-    const bool src_in_vccm = mli_mem_is_inside_vccm(mli_prv_tensor_cast_data_ptr(src));
-    const bool dst_in_vccm = mli_mem_is_inside_vccm(mli_prv_tensor_cast_data_ptr(dst));
-
     if ((src->el_type == MLI_EL_SA_8 || src->el_type == MLI_EL_SA_32) && (src->el_params.sa.dim != -1)) {
         if ((dst->el_params.sa.scale.mem.pi16 != src->el_params.sa.scale.mem.pi16) &&
                 (dst->el_params.sa.scale.mem.pi16 != NULL)) {
@@ -168,10 +208,14 @@ mli_status mli_mov_prepare(mli_mov_handle_t* h, const mli_tensor* src, const mli
     if (retval != MLI_STATUS_OK) {
         return retval;
     }
-    // update state in the handle
-    h->state = MLI_MOV_STATE_PREPARED;
-
-    // copy tensor data, first check if it can be done in a single transfer.
+    // record the transfer, first check if it can be done in a single transfer.
+    t->src = *src;
+    t->cfg = *cfg;
+    for (int i = 0; i < MLI_MAX_RANK; i++) {
+        t->dst_write_size[i] = dst_write_size[i];
+        t->src_mem_stride[i] = src_mem_stride[i];
+        t->src_cpy_size[i] = src_cpy_size[i];
+    }
     bool is_possible_in_single1d_transfer = true;
     bool no_padding = true;
     int32_t stride = 1;
@@ -187,8 +231,70 @@ mli_status mli_mov_prepare(mli_mov_handle_t* h, const mli_tensor* src, const mli
         is_possible_in_single1d_transfer &= (cfg->perm_dim[i] == i);
         stride *= src->shape[i];
     }
+    t->no_padding = no_padding;
+    t->single_1d_transfer = is_possible_in_single1d_transfer;
+    t->dst = *dst;
+    return retval;
+}
+
+/** 
+ * @brief Prepare asynchronous copy from src to dst
+ *
+ * @detail This function will prepare a data copy from the src tensor to the dst tensor
+ * according to the settings in the cfg struct.
+ * It assumes the destination tensor contains a valid pointer to a large enough buffer.
+ * the size of this buffer is specified in the capacity field of the dst tensor.
+ * the other fields of the dst tensor will be filled by the copy function.
+ *
+ * The function returns after the transfer has been prepared.
+ * In case the DMA is used, this function will not start the DMA transfer.
+ */
+
+mli_status mli_mov_prepare(mli_mov_handle_t* h, const mli_tensor* src, const mli_mov_cfg_t* cfg, mli_tensor* dst) {
+    mli_mov_transfer_t t;
+    // check if handle is valid
+    MLI_ASSERT(h != NULL);
+    MLI_ASSERT(h->state == MLI_MOV_STATE_OPEN || h->state == MLI_MOV_STATE_DONE);
+    mli_status retval = mli_mov_record_transfer(h, src, cfg, dst, &t);
+    if (retval != MLI_STATUS_OK) return retval;
+
+    // update state in the handle
+    h->state = MLI_MOV_STATE_PREPARED;
+
+#if defined(MLI_MOV_HOST_ASYNC)
+    // handles which own a channel defer the copy to the channel worker started by mli_mov_start()
+    if (h->num_ch > 0) {
+        transfertable[h->dma_ch] = t;
+        h->state = MLI_MOV_STATE_DMA_CONFIGURED;
+        return retval;
+    }
+#endif
+    return mli_mov_execute_transfer(h, &t);
+}
+
+/**
+ * @brief Execute a recorded transfer
+ *
+ * @detail This function performs the data copy described by t in the calling thread.
+ * It is used by mli_mov_prepare() for direct copies and by the host copy engine for
+ * transfers that are deferred to mli_mov_start().
+ */
+mli_status mli_mov_execute_transfer(mli_mov_handle_t* h, const mli_mov_transfer_t* transfer) {
+    mli_status retval = MLI_STATUS_OK;
+    // local copy keeps recorded transfers (e.g. chains) untouched by the copy loops
+    mli_mov_transfer_t t = *transfer;
+    const mli_tensor* src = &t.src;
+    const mli_mov_cfg_t* cfg = &t.cfg;
+    mli_tensor* dst = &t.dst;
+    uint32_t* dst_write_size = t.dst_write_size;
+    uint32_t* src_mem_stride = t.src_mem_stride;
+    uint32_t* src_cpy_size = t.src_cpy_size;
+    const bool no_padding = t.no_padding;
 
-    if (is_possible_in_single1d_transfer) {
+    const bool src_in_vccm = mli_mem_is_inside_vccm(mli_prv_tensor_cast_data_ptr(src));
+    const bool dst_in_vccm = mli_mem_is_inside_vccm(mli_prv_tensor_cast_data_ptr(dst));
+
+    if (t.single_1d_transfer) {
         int copy_size = mli_hlp_count_elem_num(src, 0);
         copy_size *= mli_hlp_tensor_element_size(src);
         mli::mov::mli_mov_memcpy<int8_t>(h, src->data.mem.pi8, dst->data.mem.pi8, copy_size, 1, 1, src_in_vccm, dst_in_vccm, true, true, false);
@@ -260,8 +366,9 @@ mli_status mli_mov_registercallback(mli_mov_handle_t* h, void (*cb)(int32_t), in
     MLI_ASSERT(h != NULL);
     MLI_ASSERT(h->dma_ch < MAX_DMA_CHAN);
     // store the callback function ptr.
-    callbacktable[h->dma_ch].cb = cb;
-    callbacktable[h->dma_ch].cookie = cookie;
+    mli_context* ctx = mli_mov_get_ctx(h);
+    ctx->callbacks[h->dma_ch].cb = cb;
+    ctx->callbacks[h->dma_ch].cookie = cookie;
     // register isr to the DMA, and only call the cb once all channels are done
     // TODO
     return MLI_STATUS_OK;
@@ -284,12 +391,20 @@ mli_status mli_mov_start(mli_mov_handle_t* h, const mli_tensor* src, const mli_m
         // TODO
         h->state = MLI_MOV_STATE_DMA_RUNNING;
     } else
+#elif defined(MLI_MOV_HOST_ASYNC)
+    if (h->state == MLI_MOV_STATE_DMA_CONFIGURED) {
+        // hand the prepared transfer over to the worker of the channel.
+        // the callback is called by the worker after the copy is complete.
+        h->state = MLI_MOV_STATE_DMA_RUNNING;
+        mli_mov_host_submit(h->dma_ch, &transfertable[h->dma_ch], 1, &mli_mov_get_ctx(h)->callbacks[h->dma_ch]);
+    } else
 #endif
     {
     // in case DMA is not used, but direct copy was done, set state to DONE, and call callback.
+        const mli_mov_cb_t* cb = &mli_mov_get_ctx(h)->callbacks[h->dma_ch];
         h->state = MLI_MOV_STATE_DONE;
-        if (callbacktable[h->dma_ch].cb != NULL) {
-            callbacktable[h->dma_ch].cb(callbacktable[h->dma_ch].cookie);
+        if (cb->cb != NULL) {
+            cb->cb(cb->cookie);
         }
     }
     return MLI_STATUS_OK;
@@ -308,7 +423,14 @@ bool mli_mov_isdone(mli_mov_handle_t* h) {
     if (h->state == MLI_MOV_STATE_DONE) {
         done = true;
     } else if (h->state == MLI_MOV_STATE_DMA_RUNNING) {
+#if defined(MLI_MOV_HOST_ASYNC)
+        if (mli_mov_host_isdone(h->dma_ch)) {
+            h->state = MLI_MOV_STATE_DONE;
+            done = true;
+        }
+#else
         // TODO: poll dma status
+#endif
     } else {
         done = false;
     }
@@ -323,6 +445,12 @@ bool mli_mov_isdone(mli_mov_handle_t* h) {
 mli_status mli_mov_wait(mli_mov_handle_t* h) {
     MLI_ASSERT(h != NULL);
 
+#if defined(MLI_MOV_HOST_ASYNC)
+    if (h->state == MLI_MOV_STATE_DMA_RUNNING) {
+        // block on the channel worker instead of spinning
+        mli_mov_host_wait(h->dma_ch);
+    }
+#endif
     while(!mli_mov_isdone(h)){
         //active wait
     }
@@ -330,9 +458,92 @@ mli_status mli_mov_wait(mli_mov_handle_t* h) {
 }
 
 
+//---------------------------------------------------------------------
+// Data movement chains
+//---------------------------------------------------------------------
+
+/** 
+ * @brief Get size of memory required for a data movement chain
+ */
+uint32_t mli_mov_chain_get_mem_size(uint32_t num_transfers) {
+    return num_transfers * sizeof(mli_mov_transfer_t);
+}
+
+/** 
+ * @brief Prepare a chain of copies
+ *
+ * @detail This function validates all descriptors once and stores the pre-computed transfers
+ * in the chain memory, so that starting the chain only performs the data copies.
+ */
+mli_status mli_mov_chain_prepare(mli_mov_chain_t* chain, const mli_mov_chain_desc_t* desc, uint32_t num_desc) {
+    mli_status retval = MLI_CHECK_STATUS(mli_chk_data_movement_chain(chain, desc, num_desc), __func__);
+    if (retval != MLI_STATUS_OK) return retval;
+
+    // the handle is only needed for the copy of quantization parameters which is done directly.
+    mli_mov_handle_t h = {0};
+    mli_mov_transfer_t* transfers = static_cast<mli_mov_transfer_t*>(chain->transfers);
+    chain->num_transfers = 0;
+    for (uint32_t i = 0; i < num_desc; i++) {
+        retval = mli_mov_record_transfer(&h, desc[i].src, desc[i].cfg, desc[i].dst, &transfers[i]);
+        if (retval != MLI_STATUS_OK) return retval;
+    }
+    chain->num_transfers = num_desc;
+    return retval;
+}
+
+/** 
+ * @brief Start a chain of copies
+ *
+ * @detail This function executes all transfers of a prepared chain back-to-back on one handle.
+ * Completion of the whole chain is reported once, in the same way as for mli_mov_start().
+ */
+mli_status mli_mov_chain_start(mli_mov_handle_t* h, const mli_mov_chain_t* chain) {
+    mli_status retval = MLI_STATUS_OK;
+    MLI_ASSERT(h != NULL);
+    MLI_ASSERT(h->state == MLI_MOV_STATE_OPEN || h->state == MLI_MOV_STATE_DONE);
+    if (MLI_CHECK(chain != NULL && chain->num_transfers > 0, "Chain is not prepared")) return MLI_STATUS_BAD_FUNC_CFG;
+    const mli_mov_transfer_t* transfers = static_cast<const mli_mov_transfer_t*>(chain->transfers);
+    const mli_mov_cb_t* cb = &mli_mov_get_ctx(h)->callbacks[h->dma_ch];
+
+#if defined(MLI_MOV_HOST_ASYNC)
+    if (h->num_ch > 0) {
+        h->state = MLI_MOV_STATE_DMA_RUNNING;
+        mli_mov_host_submit(h->dma_ch, transfers, chain->num_transfers, cb);
+        return retval;
+    }
+#endif
+    for (uint32_t i = 0; i < chain->num_transfers && retval == MLI_STATUS_OK; i++) {
+        retval = mli_mov_execute_transfer(h, &transfers[i]);
+    }
+    h->state = MLI_MOV_STATE_DONE;
+    if (cb->cb != NULL) {
+        cb->cb(cb->cookie);
+    }
+    return retval;
+}
+
+
 //---------------------------------------------------------------------
 // functions to set available resources (e.g. dma channels)
 //---------------------------------------------------------------------
+/** 
+ * @brief Initialize a context
+ *
+ * @detail This function initializes the context with an empty pool of dma channels and no callbacks.
+ * Channels still assigned to a context previously placed at the same address become free.
+ */
+mli_status mli_context_init(mli_context* ctx) {
+    if (MLI_CHECK(ctx != NULL, "Bad context pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+
+    mli_mov_spin_lock(&dma_ch_owner_lock);
+    for (int i = 0; i < MAX_DMA_CHAN; i++) {
+        if (dma_ch_owner[i] == ctx) dma_ch_owner[i] = NULL;
+    }
+    memset(ctx, 0, sizeof(mli_context));
+    mli_mov_spin_unlock(&dma_ch_owner_lock);
+    return MLI_STATUS_OK;
+}
+
 /** 
  * @brief set dma channels that can be used by mli_mov functions
  *
@@ -340,13 +551,49 @@ mli_status mli_mov_wait(mli_mov_handle_t* h) {
  * that can be used by the mli_mov functions.
  */
 mli_status mli_mov_set_num_dma_ch(int ch_offset, int num_ch) {
-    dma_pool.base_channel = ch_offset;
-    dma_pool.pool_size = num_ch;
-    for (int i = 0; i < num_ch; i++) {
-        dma_pool.channel_status[i + ch_offset] = MLI_MOV_DMA_CH_AVAILABLE;
+    return mli_mov_set_num_dma_ch_ctx(&default_ctx, ch_offset, num_ch);
+}
+
+/** 
+ * @brief set dma channels that can be used by mli_mov functions of a context
+ *
+ * @detail Channels of the previous pool of the context are returned to the free channels first.
+ * The new pool is rejected if one of its channels is assigned to another context, or if one of
+ * the channels of the previous pool is still acquired by a handle.
+ */
+mli_status mli_mov_set_num_dma_ch_ctx(mli_context* ctx, int ch_offset, int num_ch) {
+    if (MLI_CHECK(ctx != NULL, "Bad context pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(ch_offset >= 0 && num_ch >= 0 && ch_offset + num_ch <= MAX_DMA_CHAN, "Wrong dma channels"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+
+    // Unlike the checks above, channel conflicts depend on the runtime state and are checked in all
+    // build modes, in the same way as the lack of free channels in mli_mov_acquire_handle_ctx().
+    mli_status retval = MLI_STATUS_OK;
+    mli_mov_spin_lock(&dma_ch_owner_lock);
+    mli_mov_ctx_lock(ctx);
+    for (int i = ch_offset; i < ch_offset + num_ch; i++) {
+        if (dma_ch_owner[i] != NULL && dma_ch_owner[i] != ctx) retval = MLI_STATUS_BAD_FUNC_CFG;
+    }
+    for (int i = 0; i < MAX_DMA_CHAN; i++) {
+        if (ctx->dma_pool.channel_status[i] == MLI_MOV_DMA_CH_IN_USE) retval = MLI_STATUS_BAD_FUNC_CFG;
     }
 
-    return MLI_STATUS_OK;
+    if (retval == MLI_STATUS_OK) {
+        for (int i = 0; i < MAX_DMA_CHAN; i++) {
+            ctx->dma_pool.channel_status[i] = MLI_MOV_DMA_CH_NOT_USED;
+            if (dma_ch_owner[i] == ctx) dma_ch_owner[i] = NULL;
+        }
+        ctx->dma_pool.base_channel = ch_offset;
+        ctx->dma_pool.pool_size = num_ch;
+        for (int i = ch_offset; i < ch_offset + num_ch; i++) {
+            ctx->dma_pool.channel_status[i] = MLI_MOV_DMA_CH_AVAILABLE;
+            dma_ch_owner[i] = ctx;
+        }
+    }
+    mli_mov_ctx_unlock(ctx);
+    mli_mov_spin_unlock(&dma_ch_owner_lock);
+
+    return retval;
 }
 
 /** 
@@ -355,25 +602,40 @@ mli_status mli_mov_set_num_dma_ch(int ch_offset, int num_ch) {
  * @detail This function finds the first available (block of) channel(s) in the pool.
  */
 mli_status mli_mov_acquire_handle(int num_ch, mli_mov_handle_t* h) {
+    return mli_mov_acquire_handle_ctx(&default_ctx, num_ch, h);
+}
+
+/** 
+ * @brief Acquire dma channel(s) of a context
+ *
+ * @detail This function finds the first available (block of) channel(s) in the pool of the context.
+ */
+mli_status mli_mov_acquire_handle_ctx(mli_context* ctx, int num_ch, mli_mov_handle_t* h) {
     mli_status retval = MLI_STATUS_NOT_ENGH_MEM; // TODO: add status for not enough dma channels
     MLI_ASSERT(h != NULL);
+    if (MLI_CHECK(ctx != NULL, "Bad context pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    mli_mov_dma_pool_t* dma_pool = &ctx->dma_pool;
+
+    mli_mov_ctx_lock(ctx);
     // find first available channel, and check if enough adjacent channels are available.
-    for (int i = dma_pool.base_channel; i < dma_pool.base_channel + dma_pool.pool_size; i++) {
+    for (int i = dma_pool->base_channel; i <= dma_pool->base_channel + dma_pool->pool_size - num_ch; i++) {
         bool found = true;
         for (int ch_cnt = 0; ch_cnt < num_ch; ch_cnt++) {
-            found &= (dma_pool.channel_status[i + ch_cnt] == MLI_MOV_DMA_CH_AVAILABLE);
+            found &= (dma_pool->channel_status[i + ch_cnt] == MLI_MOV_DMA_CH_AVAILABLE);
         }
         if (found) {
             h->state = MLI_MOV_STATE_OPEN;
             h->dma_ch = i;
             h->num_ch = num_ch;
+            h->ctx = ctx;
             for (int ch_cnt = 0; ch_cnt < num_ch; ch_cnt++) {
-                dma_pool.channel_status[i + ch_cnt] = MLI_MOV_DMA_CH_IN_USE;
+                dma_pool->channel_status[i + ch_cnt] = MLI_MOV_DMA_CH_IN_USE;
             }
             retval = MLI_STATUS_OK;
             break;
         }
     }
+    mli_mov_ctx_unlock(ctx);
 
     return retval;
 }
@@ -385,13 +647,23 @@ mli_status mli_mov_acquire_handle(int num_ch, mli_mov_handle_t* h) {
  */
 mli_status mli_mov_release_handle(mli_mov_handle_t* h) {
     MLI_ASSERT(h != NULL);
+#if defined(MLI_MOV_HOST_ASYNC)
+    // a channel can't go back to the pool while its worker is still copying
+    if (h->state == MLI_MOV_STATE_DMA_RUNNING) {
+        mli_mov_host_wait(h->dma_ch);
+    }
+#endif
 
+    mli_context* ctx = mli_mov_get_ctx(h);
+    mli_mov_ctx_lock(ctx);
     for (int ch_cnt = 0; ch_cnt < h->num_ch; ch_cnt++) {
-        dma_pool.channel_status[h->dma_ch + ch_cnt] = MLI_MOV_DMA_CH_AVAILABLE;
+        ctx->dma_pool.channel_status[h->dma_ch + ch_cnt] = MLI_MOV_DMA_CH_AVAILABLE;
     }
+    mli_mov_ctx_unlock(ctx);
     h->state = MLI_MOV_STATE_INVALID;
     h->dma_ch = 0;
     h->num_ch = 0;
+    h->ctx = NULL;
     return MLI_STATUS_OK;
 }
 
@@ -10,30 +10,50 @@
 #ifndef _MLI_MOV_DECL_H_
 #define _MLI_MOV_DECL_H_
 
+#include "mli_mov_api.h"
 #include "mli_types.h"
 #include "mli_prv_tensor.h"
 
 
 
-#define MAX_DMA_CHAN 16
-
-typedef enum {
-    MLI_MOV_DMA_CH_NOT_USED = 0,
-    MLI_MOV_DMA_CH_AVAILABLE,
-    MLI_MOV_DMA_CH_IN_USE
-} mli_mov_dma_ch_status_t;
+#define MAX_DMA_CHAN MLI_MOV_MAX_DMA_CHAN
 
+// Transfer recorded by mli_mov_prepare() when the copy is deferred to mli_mov_start().
+// Tensors and cfg are copies, so only the data buffers must stay alive until the transfer is done.
 typedef struct {
-    int base_channel;
-    int pool_size;
-    mli_mov_dma_ch_status_t channel_status[MAX_DMA_CHAN];
-} mli_mov_dma_pool_t;
-#define MLI_MOV_DMA_POOL_INIT {0, MAX_DMA_CHAN}
+    mli_tensor src;
+    mli_tensor dst;
+    mli_mov_cfg_t cfg;
+    uint32_t dst_write_size[MLI_MAX_RANK];
+    uint32_t src_mem_stride[MLI_MAX_RANK];
+    uint32_t src_cpy_size[MLI_MAX_RANK];
+    bool no_padding;
+    bool single_1d_transfer;
+} mli_mov_transfer_t;
 
-typedef struct {
-    void (*cb)(int32_t);
-    int32_t cookie;
-} mli_mov_cb_t;
+#if defined(MLI_MOV_HOST_ASYNC) && USE_DMA
+#error "MLI_MOV_HOST_ASYNC and USE_DMA are mutually exclusive"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Executes a recorded transfer in the calling thread.
+mli_status mli_mov_execute_transfer(mli_mov_handle_t* h, const mli_mov_transfer_t* t);
+
+#if defined(MLI_MOV_HOST_ASYNC)
+// Host "virtual DMA": one worker thread per channel of the pool executes the transfers.
+// num_transfers transfers from t are executed back-to-back; t must stay valid until done.
+// The callback (if any) is called from the worker thread once the data is in place.
+void mli_mov_host_submit(int ch, const mli_mov_transfer_t* t, uint32_t num_transfers, const mli_mov_cb_t* cb);
+bool mli_mov_host_isdone(int ch);
+void mli_mov_host_wait(int ch);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
 
 namespace mli {
 namespace mov {
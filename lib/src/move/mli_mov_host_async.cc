@@ -0,0 +1,126 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+// Host "virtual DMA" engine for the asynchronous mli_mov API.
+// Each channel of the mli_mov dma pool is served by its own worker thread, so transfers
+// started on different channels run concurrently with each other and with the caller.
+
+#include "mli_debug.h"
+#include "mli_mov_api.h"
+#include "mli_mov_decl.h"
+
+#if defined(MLI_MOV_HOST_ASYNC)
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+struct host_channel {
+    std::thread worker;
+    std::mutex lock;
+    std::condition_variable cv;
+    bool pending = false;
+    bool stop = false;
+    std::atomic<bool> busy{false};
+    const mli_mov_transfer_t* transfers = nullptr;
+    uint32_t num_transfers = 0;
+    mli_mov_cb_t cb;
+};
+
+void host_channel_loop(host_channel* ch) {
+    for (;;) {
+        std::unique_lock<std::mutex> lk(ch->lock);
+        ch->cv.wait(lk, [ch] { return ch->pending || ch->stop; });
+        if (!ch->pending) return;
+        ch->pending = false;
+        lk.unlock();
+
+        // the handle only carries dma state, which has no meaning for a host copy.
+        mli_mov_handle_t h = {0};
+        h.state = MLI_MOV_STATE_DMA_RUNNING;
+        for (uint32_t i = 0; i < ch->num_transfers; i++) {
+            mli_mov_execute_transfer(&h, &ch->transfers[i]);
+        }
+        // callback comes before the done flag, so it has completed once mli_mov_wait returns.
+        if (ch->cb.cb != NULL) {
+            ch->cb.cb(ch->cb.cookie);
+        }
+
+        lk.lock();
+        ch->busy.store(false, std::memory_order_release);
+        lk.unlock();
+        ch->cv.notify_all();
+    }
+}
+
+class host_engine {
+public:
+    ~host_engine() {
+        for (int i = 0; i < MAX_DMA_CHAN; i++) {
+            host_channel& ch = channels[i];
+            if (!ch.worker.joinable()) continue;
+            {
+                std::lock_guard<std::mutex> lk(ch.lock);
+                ch.stop = true;
+            }
+            ch.cv.notify_all();
+            ch.worker.join();
+        }
+    }
+
+    host_channel channels[MAX_DMA_CHAN];
+};
+
+host_engine engine;
+
+} // namespace
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void mli_mov_host_submit(int ch_idx, const mli_mov_transfer_t* t, uint32_t num_transfers, const mli_mov_cb_t* cb) {
+    MLI_ASSERT(ch_idx >= 0 && ch_idx < MAX_DMA_CHAN);
+    host_channel& ch = engine.channels[ch_idx];
+    MLI_ASSERT(!ch.busy.load(std::memory_order_acquire));
+    {
+        std::lock_guard<std::mutex> lk(ch.lock);
+        ch.transfers = t;
+        ch.num_transfers = num_transfers;
+        ch.cb = *cb;
+        ch.pending = true;
+        ch.busy.store(true, std::memory_order_relaxed);
+        // workers are created lazily, so channels that are never started cost nothing.
+        if (!ch.worker.joinable()) {
+            ch.worker = std::thread(host_channel_loop, &ch);
+        }
+    }
+    ch.cv.notify_all();
+}
+
+bool mli_mov_host_isdone(int ch_idx) {
+    MLI_ASSERT(ch_idx >= 0 && ch_idx < MAX_DMA_CHAN);
+    return !engine.channels[ch_idx].busy.load(std::memory_order_acquire);
+}
+
+void mli_mov_host_wait(int ch_idx) {
+    MLI_ASSERT(ch_idx >= 0 && ch_idx < MAX_DMA_CHAN);
+    host_channel& ch = engine.channels[ch_idx];
+    std::unique_lock<std::mutex> lk(ch.lock);
+    ch.cv.wait(lk, [&ch] { return !ch.busy.load(std::memory_order_relaxed); });
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MLI_MOV_HOST_ASYNC
@@ -87,6 +87,38 @@ mli_status mli_chk_depthwise_conv2d_hwcn_sa8_sa8_sa32(
         const mli_conv2d_cfg * cfg,
         const mli_tensor * out);
 
+mli_status mli_chk_conv2d_prepare(const mli_conv2d_plan * plan);
+mli_status mli_chk_conv2d_run(const mli_conv2d_plan * plan, const void * in_data, const void * out_data);
+mli_status mli_chk_conv2d_epilogue(const mli_epilogue_cfg * epilogue, const mli_tensor * in, const mli_tensor * out);
+mli_status mli_chk_epilogue_prepare_sa8(const mli_tensor * out, const mli_epilogue_cfg * epilogue);
+
+mli_status mli_chk_depthwise_separable_conv2d_hwcn_fx16(
+        const mli_tensor * in,
+        const mli_tensor * dw_weights,
+        const mli_tensor * dw_bias,
+        const mli_tensor * pw_weights,
+        const mli_tensor * pw_bias,
+        const mli_dw_separable_conv2d_cfg * cfg,
+        const mli_tensor * out);
+
+mli_status mli_chk_depthwise_separable_conv2d_hwcn_fx16_fx8_fx8(
+        const mli_tensor * in,
+        const mli_tensor * dw_weights,
+        const mli_tensor * dw_bias,
+        const mli_tensor * pw_weights,
+        const mli_tensor * pw_bias,
+        const mli_dw_separable_conv2d_cfg * cfg,
+        const mli_tensor * out);
+
+mli_status mli_chk_depthwise_separable_conv2d_hwcn_sa8_sa8_sa32(
+        const mli_tensor * in,
+        const mli_tensor * dw_weights,
+        const mli_tensor * dw_bias,
+        const mli_tensor * pw_weights,
+        const mli_tensor * pw_bias,
+        const mli_dw_separable_conv2d_cfg * cfg,
+        const mli_tensor * out);
+
 mli_status mli_chk_group_conv2d_hwcn(
         const mli_tensor * in,
         const mli_tensor * weights,
@@ -186,6 +218,9 @@ mli_status mli_chk_fully_connected_sa8_sa8_sa32(
         const mli_fully_connected_cfg * cfg,
         mli_tensor * out);
 
+mli_status mli_chk_fully_connected_epilogue(const mli_epilogue_cfg * epilogue,
+        const mli_tensor * in, const mli_tensor * weights);
+
 mli_status mli_chk_relu_fx8(const mli_tensor * in, const mli_relu_cfg * cfg, mli_tensor * out);
 mli_status mli_chk_relu_fx16(const mli_tensor * in, const mli_relu_cfg * cfg, mli_tensor * out);
 mli_status mli_chk_relu_sa8(const mli_tensor * in, const mli_relu_cfg * cfg, mli_tensor * out);
@@ -198,6 +233,14 @@ mli_status mli_chk_softmax_fx16(const mli_tensor * in, const mli_softmax_cfg* cf
 mli_status mli_chk_softmax_sa8(const mli_tensor * in, const mli_softmax_cfg* cfg, mli_tensor * out);
 mli_status mli_chk_l2_normalize_fx16(const mli_tensor * in, const mli_l2_normalize_cfg* cfg, mli_tensor * out);
 mli_status mli_chk_l2_normalize_sa8(const mli_tensor * in, const mli_l2_normalize_cfg* cfg, mli_tensor * out);
+mli_status mli_chk_layer_norm_fx16(const mli_tensor * in, const mli_tensor * gamma, const mli_tensor * beta,
+        const mli_lut * lut, mli_tensor * out);
+mli_status mli_chk_layer_norm_sa8(const mli_tensor * in, const mli_tensor * gamma, const mli_tensor * beta,
+        const mli_lut * lut, mli_tensor * out);
+mli_status mli_chk_rms_norm_fx16(const mli_tensor * in, const mli_tensor * gamma,
+        const mli_lut * lut, mli_tensor * out);
+mli_status mli_chk_rms_norm_sa8(const mli_tensor * in, const mli_tensor * gamma,
+        const mli_lut * lut, mli_tensor * out);
 mli_status mli_chk_leaky_relu(const mli_tensor * in, const mli_tensor * slope_coeff, mli_tensor * out);
 mli_status mli_chk_leaky_relu_fx8(const mli_tensor * in, const mli_tensor * slope_coeff, mli_tensor * out);
 mli_status mli_chk_leaky_relu_fx16(const mli_tensor * in, const mli_tensor * slope_coeff, mli_tensor * out);
@@ -208,6 +251,14 @@ mli_status mli_chk_eltwise_sa8(const mli_tensor * left, const mli_tensor * right
 mli_status mli_chk_eltwise_maxmin_fx8(const mli_tensor * left, const mli_tensor * right, mli_tensor * out);
 mli_status mli_chk_eltwise_maxmin_fx16(const mli_tensor * left, const mli_tensor * right, mli_tensor * out);
 mli_status mli_chk_eltwise_maxmin_sa8(const mli_tensor * left, const mli_tensor * right, mli_tensor * out);
+mli_status mli_chk_eltwise_prepare_sa8(const mli_tensor * in1, const mli_tensor * in2, const mli_tensor * out,
+        const mli_eltwise_plan * plan);
+mli_status mli_chk_eltwise_run_sa8(const mli_eltwise_plan * plan, const mli_tensor * in1, const mli_tensor * in2,
+        mli_tensor * out);
+mli_status mli_chk_eltwise_fma_fx16(const mli_tensor * in1, const mli_tensor * in2, const mli_tensor * in3,
+        const mli_eltwise_fma_cfg * cfg, mli_tensor * out);
+mli_status mli_chk_eltwise_fma_sa8(const mli_tensor * in1, const mli_tensor * in2, const mli_tensor * in3,
+        const mli_eltwise_fma_cfg * cfg, mli_tensor * out);
 
 mli_status mli_chk_prelu_fx8(
         const mli_tensor * in, 
@@ -227,6 +278,18 @@ mli_status mli_chk_prelu_sa8(
         const mli_prelu_cfg *cfg, 
         mli_tensor * out);
 
+mli_status mli_chk_prelu_prepare_sa8(
+        const mli_tensor * in,
+        const mli_tensor * slope_coeff,
+        const mli_prelu_cfg *cfg,
+        const mli_tensor * out,
+        const mli_prelu_plan *plan);
+
+mli_status mli_chk_prelu_run_sa8(
+        const mli_prelu_plan *plan,
+        const mli_tensor * in,
+        mli_tensor * out);
+
 mli_status mli_chk_rnn_dense_fx16(
         const mli_tensor **in,
         const mli_tensor **weights,
@@ -335,8 +398,23 @@ mli_status mli_chk_count_elem_num(const mli_tensor *in, uint32_t start_dim);
 mli_status mli_chk_convert_tensor(const mli_tensor *in, mli_tensor *out);
 mli_status mli_chk_point_to_subtensor(const mli_tensor *in, const mli_point_to_subtsr_cfg *cfg, mli_tensor *out);
 mli_status mli_chk_create_subtensor(const mli_tensor *in, const mli_sub_tensor_cfg *cfg, mli_tensor *out);
+mli_status mli_chk_concat_views(const mli_tensor *full, const mli_concat_cfg *cfg, const uint32_t *sizes,
+        const mli_tensor *views);
+mli_status mli_chk_blob_pack(const mli_tensor *const *tensors, const char *const *names, uint32_t num_tensors,
+        const void *blob, uint32_t blob_size);
+mli_status mli_chk_mem_plan(const mli_mem_plan_buf *bufs, uint32_t num_bufs, const uint32_t *peak_size,
+        uint32_t num_banks);
+mli_status mli_chk_mem_plan_bind(const mli_mem_plan_buf *bufs, uint32_t num_bufs, int8_t *const *bank_mem,
+        uint32_t num_banks);
 mli_status mli_chk_data_movement(const mli_tensor *in, const mli_mov_cfg_t *cfg, mli_tensor *out);
 mli_status mli_chk_data_movement_dst_tensor(const mli_tensor *t);
+mli_status mli_chk_data_movement_chain(const mli_mov_chain_t *chain, const mli_mov_chain_desc_t *desc, uint32_t num_desc);
+mli_status mli_chk_tile_layer(const mli_tile_layer *layer, const mli_tensor *in, const mli_tensor *out,
+        const mli_tile_plan *plan);
+mli_status mli_chk_tile_weights(const mli_tile_layer *layer, const mli_tensor *in, const mli_tensor *out,
+        const mli_tile_weights_plan *plan);
+mli_status mli_chk_graph_pack(const mli_graph_tensor_desc *tensors, uint32_t num_tensors,
+        const mli_graph_op_desc *ops, uint32_t num_ops, const void *data, uint32_t data_size);
 
 mli_status mli_chk_argmax_sa8(const mli_tensor *in, const mli_argmax_cfg *cfg, mli_tensor *out);
 mli_status mli_chk_argmax_fx16(const mli_tensor *in, const mli_argmax_cfg *cfg, mli_tensor *out);
@@ -0,0 +1,174 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_PRV_PARALLEL_H_
+#define _MLI_PRV_PARALLEL_H_
+
+#include <stdint.h>
+#include <type_traits>
+
+#include "mli_config.h"
+#include "mli_math_macros.h"
+#include "mli_private_types.h"
+
+// Number of tasks per thread an area is split into. Tasks are distributed between threads
+// dynamically (work stealing), so extra tasks balance rows of different cost (e.g. border rows).
+#define MLI_PRV_PARALLEL_TASKS_PER_THREAD (4)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of threads used by kernels called from the current thread
+ *
+ * @detail The thread override if it is set, otherwise the mli_hlp_set_num_threads setting (1 by default).
+ */
+uint32_t mli_prv_parallel_num_threads(void);
+
+/**
+ * @brief Maximum number of threads which can be used by kernels (1 if the library is built without threads)
+ */
+uint32_t mli_prv_parallel_max_threads(void);
+
+/**
+ * @brief Override number of threads for kernels called from the current thread
+ *
+ * @detail The global setting of mli_hlp_set_num_threads is not changed, so kernels called from other
+ * threads are not affected. 0 removes the override. Number of threads is checked in the same way as
+ * by mli_hlp_set_num_threads.
+ *
+ * @return MLI status code
+ */
+mli_status mli_prv_parallel_set_thread_override(uint32_t num_threads);
+
+/**
+ * @brief Thread override of the current thread (0 if it isn't set)
+ */
+uint32_t mli_prv_parallel_get_thread_override(void);
+
+/**
+ * @brief Run task function for each task index in [0, num_tasks)
+ *
+ * @detail Tasks are executed by the calling thread and the workers of a persistent thread pool.
+ * Each thread first takes tasks from its own contiguous range and then steals the remaining tasks of
+ * other threads. The function returns when all tasks are complete. Tasks must be independent of each other.
+ * If the pool is busy with another call (concurrent or nested), the tasks are executed by the calling thread.
+ */
+void mli_prv_parallel_run(uint32_t num_tasks, void (*task)(void *ctx, uint32_t task_idx), void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+namespace mli {
+
+template <typename F>
+static void parallel_index_task(void *ctx, uint32_t task_idx) {
+    (*static_cast<F *>(ctx))(task_idx);
+}
+
+/**
+ * @brief Process independent tasks with indexes in [0, num_tasks) by the thread pool
+ *
+ * @detail func(uint32_t task_idx) is called once for each index. Suitable for coarse tasks
+ * (e.g. batch items) which can't be split by output area.
+ */
+template <typename F>
+static inline void parallel_for(uint32_t num_tasks, F &&func) {
+    if (num_tasks <= 1 || mli_prv_parallel_num_threads() <= 1) {
+        for (uint32_t task_idx = 0; task_idx < num_tasks; task_idx++)
+            func(task_idx);
+        return;
+    }
+    mli_prv_parallel_run(num_tasks, parallel_index_task<typename std::remove_reference<F>::type>, &func);
+}
+
+template <typename F>
+struct parallel_area_ctx {
+    F *func;
+    rect_t area;
+    uint32_t row_tasks;
+    uint32_t clmn_tasks;
+};
+
+template <typename F>
+static void parallel_area_task(void *ctx, uint32_t task_idx) {
+    const parallel_area_ctx<F> *c = static_cast<const parallel_area_ctx<F> *>(ctx);
+    const uint32_t rows = c->area.row_end - c->area.row_beg;
+    const uint32_t clmns = c->area.clmn_end - c->area.clmn_beg;
+    const uint32_t row_idx = task_idx / c->clmn_tasks;
+    const uint32_t clmn_idx = task_idx % c->clmn_tasks;
+    rect_t sub_area;
+    sub_area.row_beg = c->area.row_beg + (rows * row_idx) / c->row_tasks;
+    sub_area.row_end = c->area.row_beg + (rows * (row_idx + 1)) / c->row_tasks;
+    sub_area.clmn_beg = c->area.clmn_beg + (clmns * clmn_idx) / c->clmn_tasks;
+    sub_area.clmn_end = c->area.clmn_beg + (clmns * (clmn_idx + 1)) / c->clmn_tasks;
+    (*c->func)(sub_area);
+}
+
+/**
+ * @brief Split output area into rectangles and process them by the thread pool
+ *
+ * @detail func(const rect_t &sub_area) is called for disjoint rectangles covering the area. Area is split
+ * by rows. Columns are split as well only if there are not enough rows for all tasks. Each output point
+ * must depend only on the input, so results are the same as of func(area) called by a single thread.
+ */
+template <typename F>
+static inline void parallel_for_area(const rect_t &area, F &&func) {
+    const uint32_t num_threads = mli_prv_parallel_num_threads();
+    const uint32_t rows = (area.row_end > area.row_beg) ? area.row_end - area.row_beg : 0;
+    const uint32_t clmns = (area.clmn_end > area.clmn_beg) ? area.clmn_end - area.clmn_beg : 0;
+    if (num_threads <= 1 || rows * clmns <= 1) {
+        func(area);
+        return;
+    }
+
+    const uint32_t num_tasks = num_threads * MLI_PRV_PARALLEL_TASKS_PER_THREAD;
+    parallel_area_ctx<typename std::remove_reference<F>::type> ctx;
+    ctx.func = &func;
+    ctx.area = area;
+    ctx.row_tasks = MIN(rows, num_tasks);
+    ctx.clmn_tasks = (rows >= num_threads) ? 1 : MIN(clmns, CEIL_DIV(num_tasks, rows));
+    mli_prv_parallel_run(ctx.row_tasks * ctx.clmn_tasks,
+            parallel_area_task<typename std::remove_reference<F>::type>, &ctx);
+}
+
+/**
+ * @brief Split output area of each item of a batch into rectangles and process them by the thread pool
+ *
+ * @detail Rows of all items are split between threads as one area, so both batch items and rows of each item
+ * run in parallel. func(uint32_t item, const rect_t &sub_area) is called for rectangles of one item each.
+ */
+template <typename F>
+static inline void parallel_for_batch_area(uint32_t batch, const rect_t &area, F &&func) {
+    const uint32_t rows = (area.row_end > area.row_beg) ? area.row_end - area.row_beg : 0;
+    if (batch == 0 || rows == 0)
+        return;
+
+    rect_t batch_area = area;
+    batch_area.row_beg = 0;
+    batch_area.row_end = batch * rows;
+    parallel_for_area(batch_area, [&area, &func, rows](const rect_t &sub_area) {
+        uint32_t row = sub_area.row_beg;
+        while (row < sub_area.row_end) {
+            const uint32_t item = row / rows;
+            const uint32_t item_row_end = MIN(sub_area.row_end, (item + 1) * rows);
+            rect_t item_area = sub_area;
+            item_area.row_beg = area.row_beg + row - item * rows;
+            item_area.row_end = area.row_beg + item_row_end - item * rows;
+            func(item, item_area);
+            row = item_row_end;
+        }
+    });
+}
+
+} // namespace mli
+
+#endif // _MLI_PRV_PARALLEL_H_
@@ -540,6 +540,112 @@ static MLI_FORCE_INLINE void mli_prv_squash_generic_tensor(
     }
 }
 
+/* Expand input tensor to the rank and shape of the output tensor following NumPy broadcasting rules
+ * (shapes are aligned on the innermost dimension). Memory stride of each broadcasted dimension is set to 0,
+ * so the same input elements are reused along it.
+ */
+template <typename T>
+static MLI_FORCE_INLINE generic_tensor_private_t<T> mli_prv_get_broadcast_generic_tensor(
+        const mli_tensor *in,
+        const mli_tensor *out) {
+    generic_tensor_private_t<T> tensor;
+    const int rank = out->rank;
+    const int rank_diff = rank - (int)in->rank;
+
+    MLI_ASSERT(rank_diff >= 0);
+    // Scalar tensor (rank 0) holds value instead of pointer. It's fully broadcasted and never dereferenced.
+    tensor.ptr = (in->rank > 0) ? mli_prv_tensor_data_ptr<T>(in) : nullptr;
+    tensor.rank = rank;
+
+    for (int i = 0; i < rank; i++) {
+        const int in_dim = i - rank_diff;
+        tensor.shape[i] = out->shape[i];
+        if (in_dim < 0 || (int)in->shape[in_dim] != (int)out->shape[i]) {
+            tensor.mem_stride[i] = 0;
+        } else {
+            tensor.mem_stride[i] = in->mem_stride[in_dim];
+        }
+    }
+
+    for (int i = rank; i < MLI_MAX_RANK; i++) {
+        tensor.shape[i] = 1;
+        tensor.mem_stride[i] = 0;
+    }
+
+    return tensor;
+}
+
+//This function squash dimensions of broadcasted tensors (see mli_prv_get_broadcast_generic_tensor).
+//Two neighbour dimensions are merged if it is possible for all tensors at once: either data is adjacent
+//in memory, or both dimensions are broadcasted (zero memory strides). Squashed dimensions are moved to the end
+//of the shape array, so the innermost one is always at MLI_MAX_RANK - 1.
+//shape and mem_stride are arrays of num pointers to the corresponding fields of each tensor.
+//Returns the rank of squashed tensors.
+static MLI_FORCE_INLINE int mli_prv_squash_broadcast_dims(
+        int *shape[],
+        int *mem_stride[],
+        const int num,
+        const int rank) {
+    int dst = MLI_MAX_RANK - 1;
+
+    MLI_ASSERT(rank > 0);
+    for (int t = 0; t < num; t++) {
+        shape[t][dst] = shape[t][rank - 1];
+        mem_stride[t][dst] = mem_stride[t][rank - 1];
+    }
+
+    for (int j = rank - 2; j >= 0; j--) {
+        // The last tensor in the list is the output one. It defines which dimensions may be skipped.
+        if (shape[num - 1][j] == 1) continue;
+
+        bool adjacent = true;
+        for (int t = 0; t < num; t++)
+            adjacent &= (mem_stride[t][j] == mem_stride[t][dst] * shape[t][dst]);
+
+        if (adjacent) {
+            for (int t = 0; t < num; t++)
+                shape[t][dst] *= shape[t][j];
+        } else {
+            dst--;
+            for (int t = 0; t < num; t++) {
+                shape[t][dst] = shape[t][j];
+                mem_stride[t][dst] = mem_stride[t][j];
+            }
+        }
+    }
+
+    for (int i = dst - 1; i >= 0; i--) {
+        for (int t = 0; t < num; t++) {
+            shape[t][i] = 1;
+            mem_stride[t][i] = 0;
+        }
+    }
+    return MLI_MAX_RANK - dst;
+}
+
+template <typename T_in, typename T_out>
+static MLI_FORCE_INLINE void mli_prv_squash_broadcast_generic_tensor(
+        generic_tensor_private_t<T_in> *in1_prv,
+        generic_tensor_private_t<T_in> *in2_prv,
+        generic_tensor_private_t<T_out> *out_prv) {
+    int *shape[] = {in1_prv->shape, in2_prv->shape, out_prv->shape};
+    int *mem_stride[] = {in1_prv->mem_stride, in2_prv->mem_stride, out_prv->mem_stride};
+    const int rank = mli_prv_squash_broadcast_dims(shape, mem_stride, 3, out_prv->rank);
+    in1_prv->rank = in2_prv->rank = out_prv->rank = rank;
+}
+
+template <typename T_in, typename T_out>
+static MLI_FORCE_INLINE void mli_prv_squash_broadcast_generic_tensor(
+        generic_tensor_private_t<T_in> *in1_prv,
+        generic_tensor_private_t<T_in> *in2_prv,
+        generic_tensor_private_t<T_in> *in3_prv,
+        generic_tensor_private_t<T_out> *out_prv) {
+    int *shape[] = {in1_prv->shape, in2_prv->shape, in3_prv->shape, out_prv->shape};
+    int *mem_stride[] = {in1_prv->mem_stride, in2_prv->mem_stride, in3_prv->mem_stride, out_prv->mem_stride};
+    const int rank = mli_prv_squash_broadcast_dims(shape, mem_stride, 4, out_prv->rank);
+    in1_prv->rank = in2_prv->rank = in3_prv->rank = out_prv->rank = rank;
+}
+
 template <typename T>
 static MLI_FORCE_INLINE conv2d_weights_tensor_private_t<T> mli_prv_get_conv2d_weights_tensor_nhwc(
         const mli_tensor *weights,
@@ -841,6 +947,120 @@ static MLI_FORCE_INLINE uint32_t mli_prv_count_elem_num(const mli_tensor *in) {
     return mli_prv_count_elem_num_part(in, 0);
 }
 
+/* Size in bytes spanned by tensor data taking its memory strides into account */
+static MLI_FORCE_INLINE uint32_t mli_prv_tensor_span_size(const mli_tensor *in) {
+    const uint32_t elem_size = mli_hlp_tensor_element_size(in);
+    uint32_t span = 1;
+    int32_t stride = 1;
+    for (int i = (int)in->rank - 1; i >= 0; i--) {
+        if (in->shape[i] == 0)
+            return 0;
+        if (in->mem_stride[i] != 0)
+            stride = in->mem_stride[i];
+        span += (in->shape[i] - 1) * stride;
+        stride *= in->shape[i];
+    }
+    return span * elem_size;
+}
+
+/* Rank-4 NHWC feature maps are a batch of rank-3 HWC feature maps which share all parameters of a kernel.
+ * Fills view of the first batch item (a copy of rank-3 tensor) and memory stride between items in elements.
+ * Returns number of batch items. Capacity of the view is reduced by the memory of other items, so the view
+ * fits into memory only if the whole batch fits. */
+static MLI_FORCE_INLINE uint32_t mli_prv_get_batch_item(const mli_tensor *in, mli_tensor *item,
+        int32_t *batch_mem_stride = nullptr) {
+    *item = *in;
+    if (batch_mem_stride != nullptr)
+        *batch_mem_stride = 0;
+    if (in->rank != 4)
+        return 1;
+
+    const uint32_t num = in->shape[0];
+    item->rank = 3;
+    for (int i = 0; i < 3; i++) {
+        item->shape[i] = in->shape[i + 1];
+        item->mem_stride[i] = in->mem_stride[i + 1];
+    }
+    item->shape[3] = 0;
+    item->mem_stride[3] = 0;
+    const uint32_t others_size = (num > 0) ? (num - 1) * in->mem_stride[0] * mli_hlp_tensor_element_size(in) : 0;
+    item->data.capacity = (in->data.capacity > others_size) ? in->data.capacity - others_size : 0;
+    if (batch_mem_stride != nullptr)
+        *batch_mem_stride = in->mem_stride[0];
+    return num;
+}
+
+/* Copy shape and element parameters derived by a kernel for the batch item view back to the batched tensor */
+static MLI_FORCE_INLINE void mli_prv_update_batch_tensor(const mli_tensor *item, mli_tensor *out) {
+    const int batch_dims = (out->rank == 4 && item->rank == 3) ? 1 : 0;
+    if (batch_dims == 0)
+        out->rank = item->rank;
+    for (uint32_t i = 0; i < item->rank; i++)
+        out->shape[i + batch_dims] = item->shape[i];
+    out->el_type = item->el_type;
+    out->el_params = item->el_params;
+}
+
+/* Fill full-size descriptor of the intermediate feature map of depthwise separable convolution (output of
+ * depthwise part and input of pointwise part) with data of the rolling buffer. Rows of the map are stored
+ * to the buffer by parts, so the capacity of descriptor is set to the size of the whole map. */
+static MLI_FORCE_INLINE void mli_prv_get_dw_separable_mid(
+        const mli_tensor *in,
+        const mli_tensor *dw_weights,
+        const mli_dw_separable_conv2d_cfg *cfg,
+        const mli_tensor *out,
+        mli_tensor *mid) {
+    mid->el_type = in->el_type;
+    mid->el_params = cfg->mid_el_params;
+    mid->data = cfg->scratch_data;
+    mid->rank = 3;
+    mid->shape[FMAP_H_DIM_HWC] = out->shape[FMAP_H_DIM_HWC];
+    mid->shape[FMAP_W_DIM_HWC] = out->shape[FMAP_W_DIM_HWC];
+    mid->shape[FMAP_C_DIM_HWC] = dw_weights->shape[KRNL_DW_N_DIM_HW1N];
+    mid->mem_stride[FMAP_C_DIM_HWC] = 1;
+    mid->mem_stride[FMAP_W_DIM_HWC] = mid->shape[FMAP_C_DIM_HWC];
+    mid->mem_stride[FMAP_H_DIM_HWC] = mid->shape[FMAP_W_DIM_HWC] * mid->shape[FMAP_C_DIM_HWC];
+    mid->shape[3] = 0;
+    mid->mem_stride[3] = 0;
+    mid->data.capacity = mid->shape[FMAP_H_DIM_HWC] * mid->mem_stride[FMAP_H_DIM_HWC] * mli_hlp_tensor_element_size(in);
+}
+
+/* Derive shape of the result of broadcasting in1 and in2 according to NumPy rules:
+ * shapes are aligned on the innermost dimension and each pair of dimensions must be equal
+ * or one of them must be 1. Returns false if shapes can't be broadcasted. */
+static MLI_FORCE_INLINE bool mli_prv_get_broadcast_shape(
+        const mli_tensor *in1,
+        const mli_tensor *in2,
+        uint32_t *shape,
+        uint32_t *rank) {
+    const int out_rank = MAX((int)in1->rank, (int)in2->rank);
+    const int diff1 = out_rank - (int)in1->rank;
+    const int diff2 = out_rank - (int)in2->rank;
+
+    for (int i = 0; i < out_rank; i++) {
+        const uint32_t dim1 = (i < diff1) ? 1 : in1->shape[i - diff1];
+        const uint32_t dim2 = (i < diff2) ? 1 : in2->shape[i - diff2];
+        if (dim1 != dim2 && dim1 != 1 && dim2 != 1)
+            return false;
+        shape[i] = MAX(dim1, dim2);
+    }
+    *rank = out_rank;
+    return true;
+}
+
+/* Check whether both tensors have exactly the same rank and shape */
+static MLI_FORCE_INLINE bool mli_prv_is_same_shape(
+        const mli_tensor *in1,
+        const mli_tensor *in2) {
+    if (in1->rank != in2->rank)
+        return false;
+    for (int i = 0; i < (int)in1->rank; i++) {
+        if (in1->shape[i] != in2->shape[i])
+            return false;
+    }
+    return true;
+}
+
 #ifdef __cplusplus
 }
 #endif
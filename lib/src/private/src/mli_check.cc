@@ -11,13 +11,17 @@
 
 #include <stdio.h>
 #include <assert.h>
+#include <string.h>
 
 #include "mli_config.h"
 #include "mli_debug.h"
+#include "mli_graph_api.h"
 #include "mli_helpers_api.h"
+#include "mli_kernels_api.h"
 #include "mli_math.h"
 #include "mli_math_macros.h"
 #include "mli_mem_info.h"
+#include "mli_mov_api.h"
 #include "mli_prv_activation_lut.h"
 #include "mli_prv_tensor.h"
 #include "mli_types.h"
@@ -339,6 +343,33 @@ static MLI_FORCE_INLINE bool check_mem_stride_matches(const mli_tensor *t1, cons
     return !fail;
 }
 
+// Rank-4 feature maps of convolution and pooling kernels are processed as batch of rank-3 items.
+// Replaces in and out by views of the first items, so the rest of checks are the same as for a single item.
+static MLI_FORCE_INLINE mli_status check_batch_items(const mli_tensor **in, const mli_tensor **out,
+        mli_tensor *in_item, mli_tensor *out_item) {
+    if ((*in)->rank != 4)
+        return MLI_STATUS_OK;
+    if (MLI_CHECK((*out)->rank == 4, "Wrong output rank") ||
+        MLI_CHECK((*out)->shape[0] == (*in)->shape[0], "Shape mismatch in and out batch"))
+        return MLI_STATUS_SHAPE_MISMATCH;
+
+    mli_prv_get_batch_item(*in, in_item);
+    mli_prv_get_batch_item(*out, out_item);
+    *in = in_item;
+    *out = out_item;
+    return MLI_STATUS_OK;
+}
+
+// Output items of a batch must fit into the output memory without overlapping each other.
+static MLI_FORCE_INLINE mli_status check_batch_out(const mli_tensor *in_batch, const mli_tensor *out_batch,
+        const uint32_t *item_shape) {
+    if (in_batch->rank != 4)
+        return MLI_STATUS_OK;
+    const uint32_t out_shape[4] = {out_batch->shape[0], item_shape[0], item_shape[1], item_shape[2]};
+    return check_tensor_private(out_shape, out_batch->mem_stride, 4, out_batch->data.capacity,
+            mli_hlp_tensor_element_size(out_batch));
+}
+
 static MLI_FORCE_INLINE bool check_quantized_on_tensor(const mli_tensor *t1, const mli_tensor *t2) {
     bool fail = false;
     if (t1->el_type == MLI_EL_SA_8 || t1->el_type == MLI_EL_SA_32) {
@@ -374,6 +405,12 @@ mli_status mli_chk_conv2d_hwcn (
     if (MLI_CHECK(out != NULL, "Bad Output tensor pointer")) return MLI_STATUS_BAD_TENSOR;
     if (MLI_CHECK(check_ptr_not_null(out), "Bad data pointer of output")) return MLI_STATUS_BAD_TENSOR;
 
+    const mli_tensor *in_batch = in;
+    const mli_tensor *out_batch = out;
+    mli_tensor in_item, out_item;
+    stat = MLI_CHECK_STATUS(check_batch_items(&in, &out, &in_item, &out_item), "Bad batch of feature maps");
+    if (stat != MLI_STATUS_OK) return stat;
+
     fail |= MLI_CHECK(in->rank == 3, "Wrong input rank");
     fail |= MLI_CHECK(weights->rank == 4, "Wrong weights rank");
     fail |= MLI_CHECK(bias->rank == 1, "Wrong bias rank");
@@ -409,6 +446,8 @@ mli_status mli_chk_conv2d_hwcn (
     fail |= MLI_CHECK(required_width <= effective_input_width, "incorrect output width");
     if (fail) return MLI_STATUS_BAD_FUNC_CFG;
     stat = check_tensor_private(out->shape, out->mem_stride, 3, out->data.capacity, mli_hlp_tensor_element_size(out));
+    if (stat == MLI_STATUS_OK)
+        stat = check_batch_out(in_batch, out_batch, out->shape);
 
     return stat;
 }
@@ -515,6 +554,12 @@ mli_status mli_chk_depthwise_conv2d_hwcn(
     if (MLI_CHECK(out != NULL , "Bad Output tensor  pointer")) return MLI_STATUS_BAD_TENSOR;
     if (MLI_CHECK(check_ptr_not_null(out), "Bad data pointer of output")) return MLI_STATUS_BAD_TENSOR;
 
+    const mli_tensor *in_batch = in;
+    const mli_tensor *out_batch = out;
+    mli_tensor in_item, out_item;
+    stat = MLI_CHECK_STATUS(check_batch_items(&in, &out, &in_item, &out_item), "Bad batch of feature maps");
+    if (stat != MLI_STATUS_OK) return stat;
+
     fail |= MLI_CHECK(in->rank == 3, "Wrong input rank");
     fail |= MLI_CHECK(weights->rank == 4, "Wrong weights rank");
     fail |= MLI_CHECK(bias->rank == 1, "Wrong bias rank");
@@ -551,6 +596,8 @@ mli_status mli_chk_depthwise_conv2d_hwcn(
     fail |= MLI_CHECK(required_width <= effective_input_width, "incorrect output width");
     if (fail) return MLI_STATUS_BAD_FUNC_CFG;
     stat = check_tensor_private(out->shape, out->mem_stride, 3, out->data.capacity, mli_hlp_tensor_element_size(out));
+    if (stat == MLI_STATUS_OK)
+        stat = check_batch_out(in_batch, out_batch, out->shape);
 
     return stat;
 }
@@ -635,6 +682,196 @@ mli_status mli_chk_depthwise_conv2d_hwcn_sa8_sa8_sa32(
     return MLI_STATUS_OK;
 }
 
+mli_status mli_chk_conv2d_prepare(const mli_conv2d_plan * plan) {
+    if (MLI_CHECK(plan != NULL, "Bad plan pointer"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_conv2d_run(const mli_conv2d_plan * plan, const void * in_data, const void * out_data) {
+    if (MLI_CHECK(plan != NULL, "Bad plan pointer") ||
+        MLI_CHECK(plan->run != NULL, "Plan wasn't prepared"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(in_data != NULL, "Bad input data pointer") ||
+        MLI_CHECK(out_data != NULL, "Bad output data pointer"))
+        return MLI_STATUS_BAD_TENSOR;
+    return MLI_STATUS_OK;
+}
+
+static mli_status mli_chk_epilogue(const mli_epilogue_cfg * epilogue, mli_element_type el_type,
+        uint32_t out_rank, const uint32_t * out_shape, bool is_prepared = true) {
+    if (MLI_CHECK(epilogue != NULL, "Bad epilogue pointer") ||
+        MLI_CHECK(epilogue->type >= MLI_EPILOGUE_NONE && epilogue->type <= MLI_EPILOGUE_ADD, "Wrong epilogue type"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+
+    if (epilogue->type == MLI_EPILOGUE_SIGM || epilogue->type == MLI_EPILOGUE_TANH) {
+        if (MLI_CHECK(epilogue->lut != NULL, "Bad LUT pointer"))
+            return MLI_STATUS_BAD_FUNC_CFG;
+        const int lut_capacity = (epilogue->type == MLI_EPILOGUE_SIGM) ?
+                sigmoid_lut_fx16.data.capacity : tanh_lut_fx16.data.capacity;
+        return MLI_CHECK_STATUS(mli_chk_lut(epilogue->lut, lut_capacity), "Epilogue LUT error");
+    }
+    if (epilogue->type == MLI_EPILOGUE_NONE)
+        return MLI_STATUS_OK;
+
+    const mli_tensor * operand = epilogue->operand;
+    if (MLI_CHECK(operand != NULL, "Bad epilogue operand pointer"))
+        return MLI_STATUS_BAD_TENSOR;
+    // Slope of leaky relu may be a scalar tensor
+    mli_status stat = (operand->rank == 0) ?
+            MLI_CHECK_STATUS(mli_chk_scalar_tensor(operand), "Bad epilogue operand tensor") :
+            MLI_CHECK_STATUS(mli_chk_tensor(operand), "Bad epilogue operand tensor");
+    if (stat != MLI_STATUS_OK) return stat;
+    if (MLI_CHECK(operand->el_type == el_type, "Epilogue operand must be of the same type as output"))
+        return MLI_STATUS_TYPE_MISMATCH;
+    if (el_type == MLI_EL_SA_8) {
+        if (epilogue->type == MLI_EPILOGUE_PRELU)
+            stat = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(operand, kZeroPointBitsMaxRange - 1), __func__);
+        else
+            stat = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(operand, kZeroPointBitsByteRange), __func__);
+        if (stat != MLI_STATUS_OK) return stat;
+        if (MLI_CHECK(operand->el_params.sa.dim < 0, "Epilogue operand: Per-tensor quantization is expected"))
+            return MLI_STATUS_INCOMPATEBLE_TENSORS;
+    }
+
+    bool fail = false;
+    if (epilogue->type == MLI_EPILOGUE_PRELU) {
+        // One slope for all values or one slope per output channel (innermost dimension)
+        const uint32_t slope_num = mli_prv_count_elem_num(operand);
+        fail |= MLI_CHECK(slope_num == 1 ||
+                          (slope_num == out_shape[out_rank - 1] && operand->shape[operand->rank - 1] == slope_num),
+                          "Slope must be a scalar or hold a slope per output channel");
+        if (fail) return MLI_STATUS_SHAPE_MISMATCH;
+        // Per-channel requantization parameters of sa8 are derived into the table of user by prepare function
+        if (el_type == MLI_EL_SA_8 && slope_num > 1) {
+            if (MLI_CHECK(epilogue->slope_params != NULL, "Bad pointer to the table of slope parameters"))
+                return MLI_STATUS_BAD_FUNC_CFG;
+            if (MLI_CHECK(slope_num <= epilogue->slope_params_capacity,
+                          "Capacity of the table of slope parameters is too small"))
+                return MLI_STATUS_NOT_ENGH_MEM;
+            if (is_prepared && MLI_CHECK(epilogue->slope_params_num == slope_num,
+                          "Table of slope parameters must be filled by mli_krn_epilogue_sa8_prepare"))
+                return MLI_STATUS_BAD_FUNC_CFG;
+        }
+    } else {
+        fail |= MLI_CHECK(operand->rank == out_rank, "Addend must be of the same rank as output");
+        for (uint32_t i = 0; i < out_rank && !fail; i++)
+            fail |= MLI_CHECK(operand->shape[i] == out_shape[i], "Addend must be of the same shape as output");
+    }
+    if (fail) return MLI_STATUS_SHAPE_MISMATCH;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_conv2d_epilogue(const mli_epilogue_cfg * epilogue, const mli_tensor * in, const mli_tensor * out) {
+    // Element type of output is defined by the kernel as the type of input
+    return mli_chk_epilogue(epilogue, in->el_type, out->rank, out->shape);
+}
+
+mli_status mli_chk_epilogue_prepare_sa8(const mli_tensor * out, const mli_epilogue_cfg * epilogue) {
+    if (MLI_CHECK(out != NULL, "Bad output tensor pointer"))
+        return MLI_STATUS_BAD_TENSOR;
+    if (MLI_CHECK(epilogue != NULL, "Bad epilogue pointer") ||
+        MLI_CHECK(epilogue->type == MLI_EPILOGUE_PRELU, "Only parametric RELU epilogue needs prepare") ||
+        MLI_CHECK(epilogue->operand != NULL, "Bad epilogue operand pointer"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(out->el_type == MLI_EL_SA_8, "Wrong output tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+    // Shape of output might be unknown before the kernel call, so the number of channels is taken from slope.
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(out, kZeroPointBitsByteRange), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    if (MLI_CHECK(out->el_params.sa.dim < 0, "Output tensor: Per-tensor quantization is expected"))
+        return MLI_STATUS_INCOMPATEBLE_TENSORS;
+    const uint32_t channels_shape[1] = {mli_prv_count_elem_num(epilogue->operand)};
+    return mli_chk_epilogue(epilogue, MLI_EL_SA_8, 1, channels_shape, false);
+}
+
+typedef mli_status (*mli_chk_conv2d_fn)(const mli_tensor *, const mli_tensor *, const mli_tensor *,
+        const mli_conv2d_cfg *, const mli_tensor *);
+
+static mli_status mli_chk_depthwise_separable_conv2d_hwcn(
+        const mli_tensor * in,
+        const mli_tensor * dw_weights,
+        const mli_tensor * dw_bias,
+        const mli_tensor * pw_weights,
+        const mli_tensor * pw_bias,
+        const mli_dw_separable_conv2d_cfg * cfg,
+        const mli_tensor * out,
+        mli_chk_conv2d_fn chk_dw,
+        mli_chk_conv2d_fn chk_pw) {
+    bool fail = false;
+    if (MLI_CHECK(cfg != NULL, "Bad config pointer"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(in != NULL, "Bad input tensor pointer") ||
+        MLI_CHECK(dw_weights != NULL, "Bad depthwise weights tensor pointer") ||
+        MLI_CHECK(pw_weights != NULL, "Bad pointwise weights tensor pointer") ||
+        MLI_CHECK(out != NULL, "Bad output tensor pointer"))
+        return MLI_STATUS_BAD_TENSOR;
+
+    fail |= MLI_CHECK(in->rank == 3, "Wrong input rank");
+    fail |= MLI_CHECK(out->rank == 3, "Wrong output rank");
+    fail |= MLI_CHECK(dw_weights->rank == 4, "Wrong depthwise weights rank");
+    fail |= MLI_CHECK(pw_weights->rank == 4, "Wrong pointwise weights rank");
+    if (fail) return MLI_STATUS_SHAPE_MISMATCH;
+    fail |= MLI_CHECK(pw_weights->shape[KRNL_H_DIM_HWCN] == 1 && pw_weights->shape[KRNL_W_DIM_HWCN] == 1,
+                      "Pointwise weights must be 1x1 filters");
+    if (fail) return MLI_STATUS_SHAPE_MISMATCH;
+
+    // Check scratch data
+    fail |= MLI_CHECK(check_ptr_not_null(cfg->scratch_data, in->el_type), "Bad data pointer of scratch data");
+    fail |= MLI_CHECK(mli_krn_depthwise_separable_conv2d_get_scratch_size(in, dw_weights, out) <=
+                      (int32_t)cfg->scratch_data.capacity, "capacity of scratch data is too small");
+    if (fail) return MLI_STATUS_BAD_FUNC_CFG;
+
+    // Each part is checked as a separate kernel with the full-size intermediate feature map
+    mli_tensor mid;
+    mli_prv_get_dw_separable_mid(in, dw_weights, cfg, out, &mid);
+    mli_status stat = MLI_CHECK_STATUS(chk_dw(in, dw_weights, dw_bias, &cfg->dw_cfg, &mid), "Depthwise part error");
+    if (stat != MLI_STATUS_OK) return stat;
+
+    mli_conv2d_cfg pw_cfg;
+    memset(&pw_cfg, 0, sizeof(pw_cfg));
+    pw_cfg.relu = cfg->pw_relu;
+    pw_cfg.stride_width = pw_cfg.stride_height = 1;
+    pw_cfg.dilation_width = pw_cfg.dilation_height = 1;
+    return MLI_CHECK_STATUS(chk_pw(&mid, pw_weights, pw_bias, &pw_cfg, out), "Pointwise part error");
+}
+
+mli_status mli_chk_depthwise_separable_conv2d_hwcn_fx16(
+        const mli_tensor * in,
+        const mli_tensor * dw_weights,
+        const mli_tensor * dw_bias,
+        const mli_tensor * pw_weights,
+        const mli_tensor * pw_bias,
+        const mli_dw_separable_conv2d_cfg * cfg,
+        const mli_tensor * out) {
+    return mli_chk_depthwise_separable_conv2d_hwcn(in, dw_weights, dw_bias, pw_weights, pw_bias, cfg, out,
+            mli_chk_depthwise_conv2d_hwcn_fx16, mli_chk_conv2d_hwcn_fx16);
+}
+
+mli_status mli_chk_depthwise_separable_conv2d_hwcn_fx16_fx8_fx8(
+        const mli_tensor * in,
+        const mli_tensor * dw_weights,
+        const mli_tensor * dw_bias,
+        const mli_tensor * pw_weights,
+        const mli_tensor * pw_bias,
+        const mli_dw_separable_conv2d_cfg * cfg,
+        const mli_tensor * out) {
+    return mli_chk_depthwise_separable_conv2d_hwcn(in, dw_weights, dw_bias, pw_weights, pw_bias, cfg, out,
+            mli_chk_depthwise_conv2d_hwcn_fx16_fx8_fx8, mli_chk_conv2d_hwcn_fx16_fx8_fx8);
+}
+
+mli_status mli_chk_depthwise_separable_conv2d_hwcn_sa8_sa8_sa32(
+        const mli_tensor * in,
+        const mli_tensor * dw_weights,
+        const mli_tensor * dw_bias,
+        const mli_tensor * pw_weights,
+        const mli_tensor * pw_bias,
+        const mli_dw_separable_conv2d_cfg * cfg,
+        const mli_tensor * out) {
+    return mli_chk_depthwise_separable_conv2d_hwcn(in, dw_weights, dw_bias, pw_weights, pw_bias, cfg, out,
+            mli_chk_depthwise_conv2d_hwcn_sa8_sa8_sa32, mli_chk_conv2d_hwcn_sa8_sa8_sa32);
+}
+
 mli_status mli_chk_group_conv2d_hwcn(
         const mli_tensor * in,
         const mli_tensor * weights,
@@ -653,6 +890,12 @@ mli_status mli_chk_group_conv2d_hwcn(
     if (MLI_CHECK(out != NULL , "Bad Output tensor  pointer")) return MLI_STATUS_BAD_TENSOR;
     if (MLI_CHECK(check_ptr_not_null(out), "Bad data pointer of output")) return MLI_STATUS_BAD_TENSOR;
 
+    const mli_tensor *in_batch = in;
+    const mli_tensor *out_batch = out;
+    mli_tensor in_item, out_item;
+    stat = MLI_CHECK_STATUS(check_batch_items(&in, &out, &in_item, &out_item), "Bad batch of feature maps");
+    if (stat != MLI_STATUS_OK) return stat;
+
     fail |= MLI_CHECK(in->rank == 3, "Wrong input rank");
     fail |= MLI_CHECK(weights->rank == 4, "Wrong weights rank");
     fail |= MLI_CHECK(bias->rank == 1, "Wrong bias rank");
@@ -691,6 +934,8 @@ mli_status mli_chk_group_conv2d_hwcn(
     fail |= MLI_CHECK(required_width <= effective_input_width, "incorrect output width");
     if (fail) return MLI_STATUS_BAD_FUNC_CFG;
     stat = check_tensor_private(out->shape, out->mem_stride, 3, out->data.capacity, mli_hlp_tensor_element_size(out));
+    if (stat == MLI_STATUS_OK)
+        stat = check_batch_out(in_batch, out_batch, out->shape);
 
     return stat;
 }
@@ -798,6 +1043,12 @@ mli_status mli_chk_transpose_conv2d_hwcn (
     if (MLI_CHECK(out != NULL, "Bad Output tensor pointer")) return MLI_STATUS_BAD_TENSOR;
     if (MLI_CHECK(check_ptr_not_null(out), "Bad data pointer of output")) return MLI_STATUS_BAD_TENSOR;
 
+    const mli_tensor *in_batch = in;
+    const mli_tensor *out_batch = out;
+    mli_tensor in_item, out_item;
+    stat = MLI_CHECK_STATUS(check_batch_items(&in, &out, &in_item, &out_item), "Bad batch of feature maps");
+    if (stat != MLI_STATUS_OK) return stat;
+
     fail |= MLI_CHECK(in->rank == 3, "Wrong input rank");
     fail |= MLI_CHECK(weights->rank == 4, "Wrong weights rank");
     fail |= MLI_CHECK(bias->rank == 1, "Wrong bias rank");
@@ -840,6 +1091,8 @@ mli_status mli_chk_transpose_conv2d_hwcn (
         (uint32_t)(effective_in_width + effective_padding_left + effective_padding_right - kernel_width + 1), // w
         weights->shape[KRNL_C_DIM_HWCN]}; // c
     stat = check_tensor_private(out_shape, out->mem_stride, 3, out->data.capacity, mli_hlp_tensor_element_size(out));
+    if (stat == MLI_STATUS_OK)
+        stat = check_batch_out(in_batch, out_batch, out_shape);
 
     return stat;
 }
@@ -983,6 +1236,12 @@ mli_status mli_chk_maxpool_hwc (const mli_tensor * in, const mli_pool_cfg * cfg,
     if (MLI_CHECK(out != NULL , "Bad Output tensor  pointer")) return MLI_STATUS_BAD_TENSOR;
     if (MLI_CHECK(check_ptr_not_null(out), "Bad data pointer of output")) return MLI_STATUS_BAD_TENSOR;
 
+    const mli_tensor *in_batch = in;
+    const mli_tensor *out_batch = out;
+    mli_tensor in_item, out_item;
+    stat = MLI_CHECK_STATUS(check_batch_items(&in, &out, &in_item, &out_item), "Bad batch of feature maps");
+    if (stat != MLI_STATUS_OK) return stat;
+
     fail |= MLI_CHECK(in->rank == 3, "Wrong input rank");
     if (fail) return MLI_STATUS_SHAPE_MISMATCH;
 
@@ -1007,6 +1266,8 @@ mli_status mli_chk_maxpool_hwc (const mli_tensor * in, const mli_pool_cfg * cfg,
                     cfg->stride_width), // w
             in->shape[FMAP_C_DIM_HWC]}; // c
     stat = check_tensor_private(out_shape, out->mem_stride, 3, out->data.capacity, mli_hlp_tensor_element_size(out));
+    if (stat == MLI_STATUS_OK)
+        stat = check_batch_out(in_batch, out_batch, out_shape);
 
     return stat;
 }
@@ -1052,6 +1313,12 @@ mli_status mli_chk_avepool_hwc (const mli_tensor * in, const mli_pool_cfg * cfg,
     if (MLI_CHECK(out != NULL , "Bad Output tensor  pointer")) return MLI_STATUS_BAD_TENSOR;
     if (MLI_CHECK(check_ptr_not_null(out), "Bad data pointer of output")) return MLI_STATUS_BAD_TENSOR;
 
+    const mli_tensor *in_batch = in;
+    const mli_tensor *out_batch = out;
+    mli_tensor in_item, out_item;
+    stat = MLI_CHECK_STATUS(check_batch_items(&in, &out, &in_item, &out_item), "Bad batch of feature maps");
+    if (stat != MLI_STATUS_OK) return stat;
+
     fail |= MLI_CHECK(in->rank == 3, "Wrong input rank");
     if (fail) return MLI_STATUS_SHAPE_MISMATCH;
 
@@ -1076,8 +1343,10 @@ mli_status mli_chk_avepool_hwc (const mli_tensor * in, const mli_pool_cfg * cfg,
                     cfg->stride_width), // w
             in->shape[FMAP_C_DIM_HWC]}; // c
     stat = check_tensor_private(out_shape, out->mem_stride, 3, out->data.capacity, mli_hlp_tensor_element_size(out));
+    if (stat == MLI_STATUS_OK)
+        stat = check_batch_out(in_batch, out_batch, out_shape);
 
-    return MLI_STATUS_OK;
+    return stat;
 }
 
 mli_status mli_chk_avepool_hwc_fx8 (const mli_tensor * in, const mli_pool_cfg * cfg, const mli_tensor * out) {
@@ -1255,6 +1524,13 @@ mli_status mli_chk_fully_connected_sa8_sa8_sa32(
     return MLI_STATUS_OK;
 }
 
+mli_status mli_chk_fully_connected_epilogue(const mli_epilogue_cfg * epilogue,
+        const mli_tensor * in, const mli_tensor * weights) {
+    // Output of the kernel is a vector of weights->shape[1] elements of the same type as input
+    const uint32_t out_shape[1] = {weights->shape[1]};
+    return mli_chk_epilogue(epilogue, in->el_type, 1, out_shape);
+}
+
 mli_status mli_chk_relu(const mli_tensor * in, const mli_relu_cfg * cfg, mli_tensor * out) {
     mli_status stat = MLI_STATUS_OK;
     bool fail = false;
@@ -1363,15 +1639,18 @@ mli_status mli_chk_eltwise (
             "Output tensor holds the same element type as the input tensors", funcname);
     if (fail) return MLI_STATUS_INCOMPATEBLE_TENSORS;
 
-    // If both tensors are not scalar their shapes must be exactly the same.
+    // If both tensors are not scalar their shapes must be broadcastable: aligned on the innermost
+    // dimension, each pair of dimensions must be equal or one of them must be 1.
+    uint32_t out_shape[MLI_MAX_RANK];
+    uint32_t out_rank = 0;
+    int out_sz = 0;
     if (!mli_tensor_is_scalar(in1) && !mli_tensor_is_scalar(in2)) {
-        fail |= MLI_CHECK2(in1->rank == in2->rank,
-                "If both tensors are not scalar their shapes must be exactly the same.", funcname);
-        for (int idx = 0; idx < (int)in1->rank; idx++) {
-            fail |= MLI_CHECK2(in1->shape[idx] == in2->shape[idx],
-                    "If both tensors are not scalar their shapes must be exactly the same.", funcname);
-        }
+        fail |= MLI_CHECK2(mli_prv_get_broadcast_shape(in1, in2, out_shape, &out_rank),
+                "If both tensors are not scalar their shapes must be the same or broadcastable.", funcname);
         if (fail) return MLI_STATUS_SHAPE_MISMATCH;
+        out_sz = 1;
+        for (int idx = 0; idx < (int)out_rank; idx++)
+            out_sz *= out_shape[idx];
     }
 
     fail |= MLI_CHECK(check_quantized_on_tensor(in1, in2), "Tensors should be quantized on tensor level");
@@ -1380,7 +1659,8 @@ mli_status mli_chk_eltwise (
     // Check that output contains enough space
     int in1_sz = mli_prv_count_elem_num(in1);
     int in2_sz = mli_prv_count_elem_num(in2);
-    fail |= MLI_CHECK2((MAX (in1_sz, in2_sz) * mli_hlp_tensor_element_size (in1)) <= out->data.capacity,
+    out_sz = MAX(out_sz, MAX(in1_sz, in2_sz));
+    fail |= MLI_CHECK2((out_sz * mli_hlp_tensor_element_size (in1)) <= out->data.capacity,
             "Capacity of output tensor is too small", funcname);
     if (fail) return MLI_STATUS_NOT_ENGH_MEM;
 
@@ -1505,6 +1785,138 @@ mli_status mli_chk_eltwise_sa8 (const mli_tensor * in1, const mli_tensor * in2,
     return MLI_STATUS_OK;
 }
 
+mli_status mli_chk_eltwise_prepare_sa8 (const mli_tensor * in1, const mli_tensor * in2, const mli_tensor * out,
+        const mli_eltwise_plan * plan) {
+    mli_status ret = MLI_STATUS_OK;
+    if (MLI_CHECK(in1 != NULL, "Bad input1 tensor pointer") ||
+        MLI_CHECK(in2 != NULL, "Bad input2 tensor pointer") ||
+        MLI_CHECK(out != NULL, "Bad output tensor pointer"))
+        return MLI_STATUS_BAD_TENSOR;
+    if (MLI_CHECK(plan != NULL, "Bad plan pointer"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(in1->el_type == MLI_EL_SA_8, "Wrong input tensor type") ||
+        MLI_CHECK(in2->el_type == MLI_EL_SA_8, "Wrong input tensor type") ||
+        MLI_CHECK(out->el_type == MLI_EL_SA_8, "Wrong output tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+
+    // Only element parameters of tensors are used to define the plan.
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(in1,      kZeroPointBitsByteRange), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(in2,      kZeroPointBitsByteRange), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(out,     kZeroPointBitsByteRange), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+
+    if (MLI_CHECK(in1->el_params.sa.dim < 0, "Input1 tensor: Per-tensor quantization is expected") ||
+            MLI_CHECK(in2->el_params.sa.dim < 0, "Input2 tensor: Per-tensor quantization is expected") ||
+            MLI_CHECK(out->el_params.sa.dim < 0, "Output tensor: Per-tensor quantization is expected"))
+        return MLI_STATUS_INCOMPATEBLE_TENSORS;
+
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_eltwise_run_sa8 (const mli_eltwise_plan * plan, const mli_tensor * in1, const mli_tensor * in2,
+        mli_tensor * out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_eltwise_sa8(in1, in2, out), __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+    if (MLI_CHECK(plan != NULL, "Bad plan pointer"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+    return MLI_STATUS_OK;
+}
+
+static mli_status mli_chk_eltwise_fma (
+        const mli_tensor * in1,
+        const mli_tensor * in2,
+        const mli_tensor * in3,
+        const mli_eltwise_fma_cfg * cfg,
+        mli_tensor * out,
+        const char *funcname) {
+    bool fail = false;
+    mli_status stat = MLI_STATUS_OK;
+
+    // Multiplication operands follow the same rules as for two operands elementwise functions
+    stat = MLI_CHECK_STATUS(mli_chk_eltwise(in1, in2, out, funcname), funcname);
+    if (stat != MLI_STATUS_OK) return stat;
+
+    if (mli_tensor_is_scalar(in3)) {
+        fail |= MLI_CHECK2(mli_chk_scalar_tensor(in3) == MLI_STATUS_OK, "bad in3 tensor", funcname);
+        if (fail) return MLI_STATUS_BAD_TENSOR;
+    } else {
+        stat = MLI_CHECK_STATUS(mli_chk_tensor(in3), "Bad input3 tensor");
+        if (stat != MLI_STATUS_OK) return stat;
+        fail |= MLI_CHECK(check_inner_most_dimension_is_one(in3),
+                          "Memory stride for inner most dimension of input must be 1");
+        if (fail) return MLI_STATUS_INCOMPATEBLE_TENSORS;
+    }
+    fail |= MLI_CHECK2(in3->el_type == in1->el_type,
+            "Addend tensor holds the same element type as the other input tensors", funcname);
+    if (fail) return MLI_STATUS_INCOMPATEBLE_TENSORS;
+
+    fail |= MLI_CHECK2(cfg != NULL, "Bad config pointer", funcname);
+    if (fail) return MLI_STATUS_BAD_FUNC_CFG;
+
+    // Shape of all three operands must be broadcastable to the common one.
+    mli_tensor prod;
+    uint32_t out_shape[MLI_MAX_RANK];
+    uint32_t out_rank = 0;
+    fail |= MLI_CHECK2(mli_prv_get_broadcast_shape(in1, in2, prod.shape, &prod.rank) &&
+                       mli_prv_get_broadcast_shape(&prod, in3, out_shape, &out_rank),
+                       "Shapes of input tensors must be the same or broadcastable.", funcname);
+    if (fail) return MLI_STATUS_SHAPE_MISMATCH;
+
+    // Check that output contains enough space
+    int out_sz = 1;
+    for (int idx = 0; idx < (int)out_rank; idx++)
+        out_sz *= out_shape[idx];
+    fail |= MLI_CHECK2((out_sz * mli_hlp_tensor_element_size (in1)) <= out->data.capacity,
+            "Capacity of output tensor is too small", funcname);
+    if (fail) return MLI_STATUS_NOT_ENGH_MEM;
+
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_eltwise_fma_fx16 (const mli_tensor * in1, const mli_tensor * in2, const mli_tensor * in3,
+        const mli_eltwise_fma_cfg * cfg, mli_tensor * out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_eltwise_fma(in1, in2, in3, cfg, out, __func__), "");
+    if (ret != MLI_STATUS_OK)
+        return ret;
+    if (MLI_CHECK(in1->el_type == MLI_EL_FX_16, "Wrong input tensor type") ||
+        MLI_CHECK(in2->el_type == MLI_EL_FX_16, "Wrong input tensor type") ||
+        MLI_CHECK(in3->el_type == MLI_EL_FX_16, "Wrong input tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_eltwise_fma_sa8 (const mli_tensor * in1, const mli_tensor * in2, const mli_tensor * in3,
+        const mli_eltwise_fma_cfg * cfg, mli_tensor * out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_eltwise_fma(in1, in2, in3, cfg, out, __func__), "");
+    if (ret != MLI_STATUS_OK)
+        return ret;
+    if (MLI_CHECK(in1->el_type == MLI_EL_SA_8, "Wrong input tensor type") ||
+        MLI_CHECK(in2->el_type == MLI_EL_SA_8, "Wrong input tensor type") ||
+        MLI_CHECK(in3->el_type == MLI_EL_SA_8, "Wrong input tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+
+    // Check additional requrements for tensor params.
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(in1,      kZeroPointBitsByteRange), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(in2,      kZeroPointBitsByteRange), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(in3,      kZeroPointBitsByteRange), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(out,     kZeroPointBitsByteRange), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+
+    if (MLI_CHECK(in1->el_params.sa.dim < 0, "Input1 tensor: Per-tensor quantization is expected") ||
+            MLI_CHECK(in2->el_params.sa.dim < 0, "Input2 tensor: Per-tensor quantization is expected") ||
+            MLI_CHECK(in3->el_params.sa.dim < 0, "Input3 tensor: Per-tensor quantization is expected") ||
+            MLI_CHECK(out->el_params.sa.dim < 0, "Output tensor: Per-tensor quantization is expected"))
+        return MLI_STATUS_INCOMPATEBLE_TENSORS;
+
+    return MLI_STATUS_OK;
+}
+
 mli_status mli_chk_basic_activation(const mli_tensor * in, mli_tensor * out) {
     mli_status stat = MLI_STATUS_OK;
     bool fail = false;
@@ -1628,6 +2040,107 @@ mli_status mli_chk_l2_normalize_sa8(const mli_tensor * in, const mli_l2_normaliz
     return MLI_STATUS_OK;
 }
 
+static mli_status mli_chk_layer_norm_coeff(const mli_tensor * in, const mli_tensor * coeff) {
+    mli_status stat = MLI_CHECK_STATUS(mli_chk_tensor (coeff), "Bad coefficients tensor");
+    if (stat != MLI_STATUS_OK) return stat;
+
+    // Coefficients are applied along the innermost dimension of input
+    if (MLI_CHECK(coeff->rank == 1, "Coefficients tensor must be 1D") ||
+        MLI_CHECK(coeff->shape[0] == in->shape[in->rank - 1],
+                  "Size of coefficients tensor must be equal to the innermost dimension of input") ||
+        MLI_CHECK(coeff->mem_stride[0] == 1, "Memory stride of coefficients tensor should be equal to 1"))
+        return MLI_STATUS_SHAPE_MISMATCH;
+    if (MLI_CHECK(coeff->el_type == in->el_type, "Element type has to be the same"))
+        return MLI_STATUS_TYPE_MISMATCH;
+    return MLI_STATUS_OK;
+}
+
+// beta is NULL for RMS normalization
+static mli_status mli_chk_layer_norm(const mli_tensor * in, const mli_tensor * gamma, const mli_tensor * beta,
+        const mli_lut * lut, mli_tensor * out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_basic_activation(in, out), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    if (MLI_CHECK(in->rank > 0, "Input tensor must have at least one dimension"))
+        return MLI_STATUS_BAD_TENSOR;
+
+    if (MLI_CHECK(lut != NULL, "Bad LUT pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    ret = MLI_CHECK_STATUS(mli_chk_lut(lut, invsqrt_lut_fx16.data.capacity), "Invsqrt LUT error");
+    if (ret != MLI_STATUS_OK) return ret;
+
+    if (MLI_CHECK(gamma != NULL, "Bad gamma tensor pointer")) return MLI_STATUS_BAD_TENSOR;
+    ret = MLI_CHECK_STATUS(mli_chk_layer_norm_coeff(in, gamma), "Bad gamma tensor");
+    if (ret != MLI_STATUS_OK) return ret;
+    if (beta != NULL) {
+        ret = MLI_CHECK_STATUS(mli_chk_layer_norm_coeff(in, beta), "Bad beta tensor");
+        if (ret != MLI_STATUS_OK) return ret;
+    }
+
+    if (MLI_CHECK(out->el_type == in->el_type, "Output tensor holds the same element type as input"))
+        return MLI_STATUS_TYPE_MISMATCH;
+    return MLI_STATUS_OK;
+}
+
+static mli_status mli_chk_norm_fx16(const mli_tensor * in, const mli_tensor * gamma, const mli_tensor * beta,
+        const mli_lut * lut, mli_tensor * out, const char *funcname) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_layer_norm(in, gamma, beta, lut, out), funcname);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+    if (MLI_CHECK(in->el_type == MLI_EL_FX_16, "Wrong input tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+    return MLI_STATUS_OK;
+}
+
+static mli_status mli_chk_norm_sa8(const mli_tensor * in, const mli_tensor * gamma, const mli_tensor * beta,
+        const mli_lut * lut, mli_tensor * out, const char *funcname) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_layer_norm(in, gamma, beta, lut, out), funcname);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+    if (MLI_CHECK(in->el_type == MLI_EL_SA_8, "Wrong input tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+
+    // Check additional requrements for tensor params.
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(in,      kZeroPointBitsByteRange), funcname);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(out,     kZeroPointBitsByteRange), funcname);
+    if (ret != MLI_STATUS_OK) return ret;
+    // Zero points of coefficients are subtracted in 16 bits, so they aren't limited to the byte range
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(gamma,   kZeroPointBitsMaxRange - 1), funcname);
+    if (ret != MLI_STATUS_OK) return ret;
+    if (beta != NULL) {
+        ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(beta, kZeroPointBitsMaxRange - 1), funcname);
+        if (ret != MLI_STATUS_OK) return ret;
+    }
+
+    if (MLI_CHECK(in->el_params.sa.dim < 0, "Input tensor: Per-tensor quantization is expected") ||
+        MLI_CHECK(gamma->el_params.sa.dim < 0, "Gamma tensor: Per-tensor quantization is expected") ||
+        MLI_CHECK(beta == NULL || beta->el_params.sa.dim < 0, "Beta tensor: Per-tensor quantization is expected") ||
+        MLI_CHECK(out->el_params.sa.dim < 0, "Output tensor: Per-tensor quantization is expected"))
+        return MLI_STATUS_INCOMPATEBLE_TENSORS;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_layer_norm_fx16(const mli_tensor * in, const mli_tensor * gamma, const mli_tensor * beta,
+        const mli_lut * lut, mli_tensor * out) {
+    if (MLI_CHECK(beta != NULL, "Bad beta tensor pointer")) return MLI_STATUS_BAD_TENSOR;
+    return mli_chk_norm_fx16(in, gamma, beta, lut, out, __func__);
+}
+
+mli_status mli_chk_layer_norm_sa8(const mli_tensor * in, const mli_tensor * gamma, const mli_tensor * beta,
+        const mli_lut * lut, mli_tensor * out) {
+    if (MLI_CHECK(beta != NULL, "Bad beta tensor pointer")) return MLI_STATUS_BAD_TENSOR;
+    return mli_chk_norm_sa8(in, gamma, beta, lut, out, __func__);
+}
+
+mli_status mli_chk_rms_norm_fx16(const mli_tensor * in, const mli_tensor * gamma,
+        const mli_lut * lut, mli_tensor * out) {
+    return mli_chk_norm_fx16(in, gamma, NULL, lut, out, __func__);
+}
+
+mli_status mli_chk_rms_norm_sa8(const mli_tensor * in, const mli_tensor * gamma,
+        const mli_lut * lut, mli_tensor * out) {
+    return mli_chk_norm_sa8(in, gamma, NULL, lut, out, __func__);
+}
+
 mli_status mli_chk_leaky_relu (const mli_tensor * in, const mli_tensor * slope_coeff, mli_tensor * out) {
     mli_status stat = MLI_STATUS_OK;
     bool fail = false;
@@ -1812,6 +2325,117 @@ mli_status mli_chk_prelu_sa8 (
     return MLI_STATUS_OK;
 }
 
+mli_status mli_chk_prelu_prepare_sa8 (
+        const mli_tensor * in,
+        const mli_tensor * slope_coeff,
+        const mli_prelu_cfg *cfg,
+        const mli_tensor * out,
+        const mli_prelu_plan *plan) {
+    mli_status ret = MLI_STATUS_OK;
+    bool fail = false;
+
+    if (MLI_CHECK(in != NULL, "Bad input tensor pointer") ||
+        MLI_CHECK(slope_coeff != NULL, "Bad slope_coeff tensor pointer") ||
+        MLI_CHECK(out != NULL, "Bad output tensor pointer"))
+        return MLI_STATUS_BAD_TENSOR;
+    if (MLI_CHECK(cfg != NULL, "Bad config pointer") ||
+        MLI_CHECK(plan != NULL, "Bad plan pointer") ||
+        MLI_CHECK(plan->slope_params != NULL, "Bad pointer to the table of slope parameters"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+
+    // Shape of input and data of slope tensor are used to define the plan.
+    ret = MLI_CHECK_STATUS(mli_chk_tensor (in), "Bad input tensor");
+    if (ret != MLI_STATUS_OK) return ret;
+    if (cfg->axis == -1) {
+        ret = MLI_CHECK_STATUS(mli_chk_scalar_tensor (slope_coeff), "Slope should be scalar tensor");
+    } else {
+        ret = MLI_CHECK_STATUS(mli_chk_tensor (slope_coeff), "Bad slope_coeff tensor");
+    }
+    if (ret != MLI_STATUS_OK) return ret;
+
+    if (cfg->axis != -1) {
+        if (MLI_CHECK(cfg->axis >= 0 && cfg->axis < (int32_t)in->rank, "Bad axis"))
+            return MLI_STATUS_BAD_FUNC_CFG;
+        for(uint32_t i = 0; i < in->rank; i++) {
+            if( i == cfg->axis) {
+                fail |= MLI_CHECK(in->shape[i] == slope_coeff->shape[i], "Bad Slope_Coeff Shape");
+            } else {
+                fail |= MLI_CHECK(slope_coeff->shape[i] == 1, "Bad Slope_Coeff Shape");
+            }
+        }
+        if (fail) return MLI_STATUS_INCOMPATEBLE_TENSORS;
+        if (MLI_CHECK(in->shape[cfg->axis] <= plan->slope_params_capacity,
+                      "Capacity of the table of slope parameters is too small"))
+            return MLI_STATUS_NOT_ENGH_MEM;
+    } else {
+        if (MLI_CHECK(plan->slope_params_capacity >= 1,
+                      "Capacity of the table of slope parameters is too small"))
+            return MLI_STATUS_NOT_ENGH_MEM;
+    }
+
+    if (MLI_CHECK(in->el_type == MLI_EL_SA_8, "Wrong input tensor type") ||
+        MLI_CHECK(slope_coeff->el_type == MLI_EL_SA_8, "Wrong slope_coeff tensor type") ||
+        MLI_CHECK(out->el_type == MLI_EL_SA_8, "Wrong output tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(in,      kZeroPointBitsByteRange), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(out,     kZeroPointBitsByteRange), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+    ret = MLI_CHECK_STATUS(mli_chk_tensor_quant_params(slope_coeff, kZeroPointBitsMaxRange - 1), __func__);
+    if (ret != MLI_STATUS_OK) return ret;
+
+    if (MLI_CHECK(in->el_params.sa.dim < 0, "Input tensor: Per-tensor quantization is expected"))
+        return MLI_STATUS_INCOMPATEBLE_TENSORS;
+    if (MLI_CHECK(out->el_params.sa.dim < 0, "Output tensor: Per-tensor quantization is expected"))
+        return MLI_STATUS_INCOMPATEBLE_TENSORS;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_prelu_run_sa8 (
+        const mli_prelu_plan *plan,
+        const mli_tensor * in,
+        mli_tensor * out) {
+    mli_status stat = MLI_STATUS_OK;
+    bool fail = false;
+
+    if (MLI_CHECK(plan != NULL, "Bad plan pointer") ||
+        MLI_CHECK(plan->slope_params != NULL, "Bad pointer to the table of slope parameters"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+
+    if (MLI_CHECK(out != NULL , "Bad Output tensor  pointer")) return MLI_STATUS_BAD_TENSOR;
+    stat = MLI_CHECK_STATUS(mli_mem_chk(out, MLI_OUT_PTR_IS_XY), "Memory check error");
+    if (stat != MLI_STATUS_OK) return stat;
+    stat = MLI_CHECK_STATUS(mli_chk_tensor (in), "Bad input tensor");
+    if (stat != MLI_STATUS_OK) return stat;
+    if (MLI_CHECK(check_ptr_not_null(out), "Bad data pointer of output")) return MLI_STATUS_BAD_TENSOR;
+
+    if (MLI_CHECK(in->el_type == MLI_EL_SA_8, "Wrong input tensor type") ||
+        MLI_CHECK(out->el_type == MLI_EL_SA_8, "Wrong output tensor type"))
+        return MLI_STATUS_TYPE_MISMATCH;
+
+    // Input must be compatible with the table of slope parameters stored in the plan
+    if (plan->axis == -1) {
+        fail |= MLI_CHECK(plan->slope_params_num == 1, "Plan is defined for per-channel slope");
+    } else {
+        if (MLI_CHECK(plan->axis >= 0 && plan->axis < (int32_t)in->rank, "Bad axis of the plan"))
+            return MLI_STATUS_BAD_FUNC_CFG;
+        fail |= MLI_CHECK(in->shape[plan->axis] == plan->slope_params_num,
+                          "Number of channels doesn't match the plan");
+    }
+    fail |= MLI_CHECK(check_inner_most_dimension_is_one(in),
+                      "Memory stride of the innermost dimension should be equal to 1 for the input tensor");
+    fail |= MLI_CHECK(check_inner_most_dimension_is_one(out),
+                      "Memory stride of the innermost dimension should be equal to 1 for the output tensor");
+    if (fail) return MLI_STATUS_INCOMPATEBLE_TENSORS;
+
+    fail |= MLI_CHECK((mli_prv_count_elem_num (in) * mli_hlp_tensor_element_size (in)) <= out->data.capacity,
+                      "Capacity of output tensor is too small");
+    if (fail) return MLI_STATUS_NOT_ENGH_MEM;
+
+    return MLI_STATUS_OK;
+}
+
 mli_status mli_chk_rnn_dense (
         const mli_tensor **in,
         const mli_tensor **weights,
@@ -2054,7 +2678,7 @@ mli_status mli_chk_lstm_cell (
 
     // Check scratch data
     fail |= MLI_CHECK(check_ptr_not_null(cfg->scratch_data, in->el_type), "Bad data pointer of scratch data");
-    fail |= MLI_CHECK((4 * out_elements * mli_hlp_tensor_element_size (in)) <= cfg->scratch_data.capacity,
+    fail |= MLI_CHECK(mli_krn_lstm_cell_get_scratch_size(in, weights_in, cfg) <= (int32_t)cfg->scratch_data.capacity,
                       "capacity of scratch data is too small");
     if (fail) return MLI_STATUS_BAD_FUNC_CFG;
 
@@ -2254,7 +2878,7 @@ mli_status mli_chk_gru_cell (
 
     // Check scratch data
     fail |= MLI_CHECK(check_ptr_not_null(cfg->scratch_data, in->el_type), "Bad data pointer of scratch data");
-    fail |= MLI_CHECK((3 * out_elements * mli_hlp_tensor_element_size (in)) <= cfg->scratch_data.capacity,
+    fail |= MLI_CHECK(mli_krn_gru_cell_get_scratch_size(in, weights_in, cfg) <= (int32_t)cfg->scratch_data.capacity,
                       "capacity of scratch data is too small");
     if (fail) return MLI_STATUS_BAD_FUNC_CFG;
 
@@ -2754,6 +3378,117 @@ mli_status mli_chk_create_subtensor(const mli_tensor *in, const mli_sub_tensor_c
     return MLI_STATUS_OK;
 }
 
+mli_status mli_chk_concat_views(const mli_tensor *full, const mli_concat_cfg *cfg, const uint32_t *sizes,
+        const mli_tensor *views) {
+    mli_status stat = MLI_STATUS_OK;
+    bool fail = false;
+
+    stat = MLI_CHECK_STATUS(mli_chk_tensor (full, /*check_bank=*/false), "Bad full tensor");
+    if (stat != MLI_STATUS_OK) return stat;
+    if (MLI_CHECK(views != NULL , "Bad views tensor array")) return MLI_STATUS_BAD_TENSOR;
+    if (MLI_CHECK(cfg != NULL , "Bad cfg pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(sizes != NULL , "Bad sizes pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+
+    fail |= MLI_CHECK(cfg->axis < full->rank, "wrong axis configuration");
+    fail |= MLI_CHECK(cfg->tensors_num <= MLI_CONCAT_MAX_TENSORS, "wrong number of tensors");
+    fail |= MLI_CHECK(cfg->tensors_num > 0, "wrong number of tensors");
+    if (fail) return MLI_STATUS_BAD_FUNC_CFG;
+
+    // Views must cover the concatenation axis of the full tensor without gaps
+    uint32_t axis_size = 0;
+    for (int idx = 0; idx < cfg->tensors_num; idx++) {
+        fail |= MLI_CHECK(sizes[idx] > 0, "Size of view along axis must be positive");
+        axis_size += sizes[idx];
+    }
+    fail |= MLI_CHECK(axis_size == full->shape[cfg->axis], "Sum of view sizes must be equal to the full tensor size");
+    if (fail) return MLI_STATUS_SHAPE_MISMATCH;
+
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_blob_pack(const mli_tensor *const *tensors, const char *const *names, uint32_t num_tensors,
+        const void *blob, uint32_t blob_size) {
+    if (MLI_CHECK(tensors != NULL || num_tensors == 0, "Bad tensors array")) return MLI_STATUS_BAD_TENSOR;
+    if (MLI_CHECK(names != NULL || num_tensors == 0, "Bad names array")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(blob != NULL, "Bad blob pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(((uintptr_t)blob & (sizeof(uint32_t) - 1)) == 0, "Blob must be aligned to 4 bytes"))
+        return MLI_STATUS_MISALIGNMENT_ERROR;
+
+    for (uint32_t i = 0; i < num_tensors; i++) {
+        mli_status stat = MLI_CHECK_STATUS(mli_chk_tensor(tensors[i], /*check_bank=*/false), "Bad tensor");
+        if (stat != MLI_STATUS_OK) return stat;
+        if (MLI_CHECK(mli_hlp_tensor_element_size(tensors[i]) != 0, "Wrong tensor element type"))
+            return MLI_STATUS_NOT_SUPPORTED;
+        if (MLI_CHECK(names[i] != NULL && strlen(names[i]) < MLI_BLOB_NAME_LEN, "Bad tensor name"))
+            return MLI_STATUS_BAD_FUNC_CFG;
+    }
+    if (MLI_CHECK(mli_hlp_blob_get_size(tensors, num_tensors) <= blob_size, "Not enough memory for blob"))
+        return MLI_STATUS_NOT_ENGH_MEM;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_graph_pack(const mli_graph_tensor_desc *tensors, uint32_t num_tensors,
+        const mli_graph_op_desc *ops, uint32_t num_ops, const void *data, uint32_t data_size) {
+    if (MLI_CHECK(tensors != NULL || num_tensors == 0, "Bad tensors array")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(ops != NULL || num_ops == 0, "Bad operations array")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(data != NULL, "Bad graph data pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(((uintptr_t)data & (sizeof(uint32_t) - 1)) == 0, "Graph data must be aligned to 4 bytes"))
+        return MLI_STATUS_MISALIGNMENT_ERROR;
+
+    for (uint32_t i = 0; i < num_tensors; i++) {
+        if (MLI_CHECK(memchr(tensors[i].name, 0, MLI_BLOB_NAME_LEN) != NULL, "Bad tensor name") ||
+            MLI_CHECK(tensors[i].rank <= MLI_MAX_RANK, "Wrong tensor rank"))
+            return MLI_STATUS_BAD_TENSOR;
+    }
+    for (uint32_t i = 0; i < num_ops; i++) {
+        if (MLI_CHECK(ops[i].num_inputs <= MLI_GRAPH_MAX_OP_INPUTS, "Too many inputs of operation"))
+            return MLI_STATUS_BAD_FUNC_CFG;
+    }
+    if (MLI_CHECK(mli_graph_get_size(num_tensors, num_ops) <= data_size, "Not enough memory for graph"))
+        return MLI_STATUS_NOT_ENGH_MEM;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_mem_plan(const mli_mem_plan_buf *bufs, uint32_t num_bufs, const uint32_t *peak_size,
+        uint32_t num_banks) {
+    if (MLI_CHECK(bufs != NULL || num_bufs == 0, "Bad buffers pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(peak_size != NULL && num_banks > 0, "Bad peak size pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+
+    for (uint32_t i = 0; i < num_bufs; i++) {
+        const mli_mem_plan_buf *buf = &bufs[i];
+        if (MLI_CHECK(buf->bank < num_banks, "Bank index is out of range") ||
+            MLI_CHECK(buf->first_op <= buf->last_op, "Buffer lifetime ends before it starts") ||
+            MLI_CHECK((buf->alignment & (buf->alignment - 1)) == 0, "Alignment must be a power of two"))
+            return MLI_STATUS_BAD_FUNC_CFG;
+        if (buf->size == 0) {
+            if (MLI_CHECK(buf->tensor != NULL, "Either size or tensor must be provided")) return MLI_STATUS_BAD_TENSOR;
+            if (MLI_CHECK(buf->tensor->rank <= MLI_MAX_RANK, "Wrong tensor rank") ||
+                MLI_CHECK(mli_hlp_tensor_element_size(buf->tensor) != 0, "Wrong tensor element type"))
+                return MLI_STATUS_BAD_TENSOR;
+        }
+    }
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_mem_plan_bind(const mli_mem_plan_buf *bufs, uint32_t num_bufs, int8_t *const *bank_mem,
+        uint32_t num_banks) {
+    if (MLI_CHECK(bufs != NULL || num_bufs == 0, "Bad buffers pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(bank_mem != NULL, "Bad bank memory pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+
+    for (uint32_t i = 0; i < num_bufs; i++) {
+        const mli_mem_plan_buf *buf = &bufs[i];
+        if (buf->tensor == NULL)
+            continue;
+        if (MLI_CHECK(buf->bank < num_banks, "Bank index is out of range")) return MLI_STATUS_BAD_FUNC_CFG;
+        if (MLI_CHECK(bank_mem[buf->bank] != NULL, "Bad bank memory pointer")) return MLI_STATUS_NOT_ENGH_MEM;
+        if (MLI_CHECK(buf->alignment == 0 ||
+                ((uintptr_t)(bank_mem[buf->bank] + buf->offset) & (buf->alignment - 1)) == 0,
+                "Bank memory isn't aligned as required by buffer"))
+            return MLI_STATUS_MISALIGNMENT_ERROR;
+    }
+    return MLI_STATUS_OK;
+}
+
 mli_status mli_chk_data_movement(const mli_tensor *in, const mli_mov_cfg_t *cfg, mli_tensor *out) {
     mli_status stat = MLI_STATUS_OK;
     // For data movement the tensor data can be allocated in external memory.
@@ -2821,6 +3556,117 @@ mli_status mli_chk_data_movement_dst_tensor(const mli_tensor *t) {
 
 }
 
+mli_status mli_chk_data_movement_chain(const mli_mov_chain_t *chain, const mli_mov_chain_desc_t *desc, uint32_t num_desc) {
+    if (MLI_CHECK(chain != NULL, "Bad chain pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(desc != NULL && num_desc > 0, "Bad descriptors list")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(chain->transfers != NULL, "Bad chain memory pointer")) return MLI_STATUS_NOT_ENGH_MEM;
+    if (MLI_CHECK(((uintptr_t)chain->transfers % sizeof(void *)) == 0, "Chain memory must be aligned to the size of a pointer"))
+        return MLI_STATUS_MISALIGNMENT_ERROR;
+    if (MLI_CHECK(chain->capacity >= mli_mov_chain_get_mem_size(num_desc), "Insufficient chain memory"))
+        return MLI_STATUS_NOT_ENGH_MEM;
+    for (uint32_t i = 0; i < num_desc; i++) {
+        if (MLI_CHECK(desc[i].src != NULL && desc[i].dst != NULL, "Bad tensor pointer in descriptor"))
+            return MLI_STATUS_BAD_TENSOR;
+    }
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_tile_layer(const mli_tile_layer *layer, const mli_tensor *in, const mli_tensor *out,
+        const mli_tile_plan *plan) {
+    mli_status stat = MLI_STATUS_OK;
+    if (MLI_CHECK(layer != NULL, "Bad layer pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(plan != NULL, "Bad plan pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK((layer->conv2d != NULL) != (layer->pool != NULL), "Exactly one of conv2d and pool kernels is expected") ||
+        MLI_CHECK(layer->fully_connected == NULL, "Fully connected layers can't be split into tiles"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+
+    // Input can be located in external memory. Tiles of it are copied to fast memory before processing
+    stat = MLI_CHECK_STATUS(mli_chk_tensor(in, false), "Bad input tensor");
+    if (stat != MLI_STATUS_OK) return stat;
+    if (MLI_CHECK(in->rank == 3, "Wrong input rank")) return MLI_STATUS_NOT_SUPPORTED;
+    if (MLI_CHECK(out != NULL, "Bad Output tensor  pointer")) return MLI_STATUS_BAD_TENSOR;
+    if (MLI_CHECK(check_ptr_not_null(out), "Bad data pointer of output")) return MLI_STATUS_BAD_TENSOR;
+
+    if (layer->conv2d != NULL) {
+        const mli_conv2d_cfg *cfg = layer->conv_cfg;
+        if (MLI_CHECK(cfg != NULL, "Bad cfg pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+        if (MLI_CHECK(layer->weights != NULL && layer->bias != NULL, "Bad weights or bias pointer"))
+            return MLI_STATUS_BAD_TENSOR;
+        if (MLI_CHECK(layer->weights->rank == 4, "Wrong weights rank")) return MLI_STATUS_NOT_SUPPORTED;
+        if (MLI_CHECK(out->rank == 3, "Output shape must be defined for convolution")) return MLI_STATUS_BAD_TENSOR;
+        if (MLI_CHECK(cfg->stride_height > 0 && cfg->stride_width > 0, "Stride should be greater than zero") ||
+            MLI_CHECK(cfg->dilation_height > 0 && cfg->dilation_width > 0, "Dilation should be greater than zero"))
+            return MLI_STATUS_BAD_FUNC_CFG;
+        int effective_kernel_height = (layer->weights->shape[KRNL_H_DIM_HWCN] - 1) * cfg->dilation_height + 1;
+        if (MLI_CHECK(cfg->padding_top < effective_kernel_height && cfg->padding_bottom < effective_kernel_height,
+                "Padding should be smaller than effective kernel size"))
+            return MLI_STATUS_BAD_FUNC_CFG;
+    } else {
+        const mli_pool_cfg *cfg = layer->pool_cfg;
+        if (MLI_CHECK(cfg != NULL, "Bad cfg pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+        if (MLI_CHECK(cfg->stride_height > 0 && cfg->stride_width > 0, "Stride should be greater than zero") ||
+            MLI_CHECK(cfg->kernel_height > 0 && cfg->kernel_width > 0, "Kernel size should be greater than zero"))
+            return MLI_STATUS_BAD_FUNC_CFG;
+        if (MLI_CHECK(cfg->padding_top < cfg->kernel_height && cfg->padding_bottom < cfg->kernel_height,
+                "Padding should be smaller than kernel size"))
+            return MLI_STATUS_BAD_FUNC_CFG;
+    }
+
+    if (MLI_CHECK(plan->fast_mem != NULL, "Bad fast memory pointer")) return MLI_STATUS_NOT_ENGH_MEM;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_chk_tile_weights(const mli_tile_layer *layer, const mli_tensor *in, const mli_tensor *out,
+        const mli_tile_weights_plan *plan) {
+    mli_status stat = MLI_STATUS_OK;
+    if (MLI_CHECK(layer != NULL, "Bad layer pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK(plan != NULL, "Bad plan pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+    if (MLI_CHECK((layer->conv2d != NULL) != (layer->fully_connected != NULL),
+            "Exactly one of conv2d and fully_connected kernels is expected") ||
+        MLI_CHECK(layer->pool == NULL, "Pooling layers have no weights to stream"))
+        return MLI_STATUS_BAD_FUNC_CFG;
+
+    // Weights can be located in external memory. Chunks of it are copied to fast memory before processing
+    if (MLI_CHECK(layer->weights != NULL && layer->bias != NULL, "Bad weights or bias pointer"))
+        return MLI_STATUS_BAD_TENSOR;
+    stat = MLI_CHECK_STATUS(mli_chk_tensor(layer->weights, false), "Bad weights tensor");
+    if (stat != MLI_STATUS_OK) return stat;
+    stat = MLI_CHECK_STATUS(mli_chk_tensor(layer->bias), "Bad bias tensor");
+    if (stat != MLI_STATUS_OK) return stat;
+    stat = MLI_CHECK_STATUS(mli_chk_tensor(in), "Bad input tensor");
+    if (stat != MLI_STATUS_OK) return stat;
+    if (MLI_CHECK(out != NULL, "Bad Output tensor  pointer")) return MLI_STATUS_BAD_TENSOR;
+    if (MLI_CHECK(check_ptr_not_null(out), "Bad data pointer of output")) return MLI_STATUS_BAD_TENSOR;
+    if (MLI_CHECK(layer->bias->rank == 1, "Wrong bias rank")) return MLI_STATUS_NOT_SUPPORTED;
+
+    if (layer->conv2d != NULL) {
+        if (MLI_CHECK(layer->conv_cfg != NULL, "Bad cfg pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+        if (MLI_CHECK(layer->weights->rank == 4, "Wrong weights rank") ||
+            MLI_CHECK(in->rank == 3, "Wrong input rank"))
+            return MLI_STATUS_NOT_SUPPORTED;
+        if (MLI_CHECK(out->rank == 3, "Output shape must be defined for convolution")) return MLI_STATUS_BAD_TENSOR;
+        // Each output channel must depend on the whole input. It isn't the case for depthwise and group convolutions
+        if (MLI_CHECK(layer->weights->shape[KRNL_D_DIM_HWCN] == in->shape[FMAP_C_DIM_HWC],
+                "Only convolutions without groups are supported"))
+            return MLI_STATUS_NOT_SUPPORTED;
+        if (MLI_CHECK(out->shape[FMAP_C_DIM_HWC] == layer->weights->shape[KRNL_C_DIM_HWCN],
+                "Shape mismatch output and weights"))
+            return MLI_STATUS_SHAPE_MISMATCH;
+    } else {
+        if (MLI_CHECK(layer->fc_cfg != NULL, "Bad cfg pointer")) return MLI_STATUS_BAD_FUNC_CFG;
+        if (MLI_CHECK(layer->weights->rank == 2, "Wrong weights rank")) return MLI_STATUS_NOT_SUPPORTED;
+        if (MLI_CHECK(out->mem_stride[0] == 0 || out->mem_stride[0] == 1,
+                "Memory Layout of output tensor must be contiguous"))
+            return MLI_STATUS_INCOMPATEBLE_TENSORS;
+    }
+    if (MLI_CHECK(layer->bias->shape[0] == layer->weights->shape[layer->weights->rank - 1],
+            "Shape mismatch bias and weights"))
+        return MLI_STATUS_SHAPE_MISMATCH;
+
+    if (MLI_CHECK(plan->fast_mem != NULL, "Bad fast memory pointer")) return MLI_STATUS_NOT_ENGH_MEM;
+    return MLI_STATUS_OK;
+}
+
 mli_status mli_chk_argmax(const mli_tensor *in, const mli_argmax_cfg *cfg, mli_tensor *out) {
     mli_status stat = MLI_STATUS_OK;
 
@@ -0,0 +1,212 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+// Host thread pool for kernels which split their output area between threads.
+// Workers are persistent: they are created on the first threaded call and sleep between calls.
+
+#include "mli_config.h"
+#include "mli_debug.h"
+#include "mli_helpers_api.h"
+#include "mli_prv_parallel.h"
+#include "mli_types.h"
+
+#if defined(MLI_HOST_THREADS)
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+// Range of tasks owned by a thread. Other threads steal from it by the same atomic increment.
+struct alignas(64) task_queue {
+    std::atomic<uint32_t> next{0};
+    uint32_t end = 0;
+};
+
+class thread_pool {
+public:
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lk(lock);
+            stop = true;
+        }
+        start_cv.notify_all();
+        for (uint32_t i = 0; i < num_workers; i++) {
+            workers[i].join();
+        }
+    }
+
+    void run(uint32_t num_threads, uint32_t num_tasks, void (*task)(void *, uint32_t), void *ctx) {
+        std::unique_lock<std::mutex> lk(lock);
+        while (num_workers < num_threads - 1) {
+            workers[num_workers] = std::thread(&thread_pool::worker_loop, this, num_workers + 1);
+            num_workers++;
+        }
+        job_task = task;
+        job_ctx = ctx;
+        job_threads = num_threads;
+        for (uint32_t i = 0; i < num_threads; i++) {
+            queues[i].next.store((num_tasks * i) / num_threads, std::memory_order_relaxed);
+            queues[i].end = (num_tasks * (i + 1)) / num_threads;
+        }
+        active = num_workers;
+        generation++;
+        lk.unlock();
+        start_cv.notify_all();
+
+        execute(0);
+
+        lk.lock();
+        done_cv.wait(lk, [this] { return active == 0; });
+    }
+
+    static thread_local bool in_job;
+    std::mutex dispatch_lock;
+
+private:
+    void execute(uint32_t self) {
+        in_job = true;
+        for (uint32_t i = 0; i < job_threads; i++) {
+            task_queue &q = queues[(self + i) % job_threads];
+            for (;;) {
+                const uint32_t task_idx = q.next.fetch_add(1, std::memory_order_relaxed);
+                if (task_idx >= q.end) break;
+                job_task(job_ctx, task_idx);
+            }
+        }
+        in_job = false;
+    }
+
+    void worker_loop(uint32_t self) {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lk(lock);
+        for (;;) {
+            start_cv.wait(lk, [this, seen] { return generation != seen || stop; });
+            if (stop) return;
+            seen = generation;
+            // workers beyond the current number of threads only take part in the completion count.
+            if (self < job_threads) {
+                lk.unlock();
+                execute(self);
+                lk.lock();
+            }
+            if (--active == 0) {
+                done_cv.notify_all();
+            }
+        }
+    }
+
+    std::mutex lock;
+    std::condition_variable start_cv;
+    std::condition_variable done_cv;
+    std::thread workers[MLI_MAX_NUM_THREADS - 1];
+    uint32_t num_workers = 0;
+    uint32_t active = 0;
+    uint64_t generation = 0;
+    bool stop = false;
+
+    void (*job_task)(void *, uint32_t) = nullptr;
+    void *job_ctx = nullptr;
+    uint32_t job_threads = 0;
+    task_queue queues[MLI_MAX_NUM_THREADS];
+};
+
+thread_local bool thread_pool::in_job = false;
+
+thread_pool pool;
+std::atomic<uint32_t> num_threads_setting{1};
+thread_local uint32_t num_threads_override = 0;
+
+} // namespace
+
+#endif // MLI_HOST_THREADS
+
+#pragma MLI_CODE_SECTION_START(".mli_lib")
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t mli_prv_parallel_num_threads(void) {
+#if defined(MLI_HOST_THREADS)
+    if (num_threads_override != 0)
+        return num_threads_override;
+    return num_threads_setting.load(std::memory_order_relaxed);
+#else
+    return 1;
+#endif
+}
+
+uint32_t mli_prv_parallel_max_threads(void) {
+#if defined(MLI_HOST_THREADS)
+    return MLI_MAX_NUM_THREADS;
+#else
+    return 1;
+#endif
+}
+
+mli_status mli_prv_parallel_set_thread_override(uint32_t num_threads) {
+    if (num_threads > MLI_MAX_NUM_THREADS)
+        return MLI_STATUS_ARGUMENT_ERROR;
+#if defined(MLI_HOST_THREADS)
+    num_threads_override = num_threads;
+    return MLI_STATUS_OK;
+#else
+    return (num_threads <= 1) ? MLI_STATUS_OK : MLI_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+uint32_t mli_prv_parallel_get_thread_override(void) {
+#if defined(MLI_HOST_THREADS)
+    return num_threads_override;
+#else
+    return 0;
+#endif
+}
+
+void mli_prv_parallel_run(uint32_t num_tasks, void (*task)(void *ctx, uint32_t task_idx), void *ctx) {
+#if defined(MLI_HOST_THREADS)
+    const uint32_t num_threads = MIN(mli_prv_parallel_num_threads(), num_tasks);
+    if (num_threads > 1 && !thread_pool::in_job && pool.dispatch_lock.try_lock()) {
+        pool.run(num_threads, num_tasks, task, ctx);
+        pool.dispatch_lock.unlock();
+        return;
+    }
+#endif
+    for (uint32_t task_idx = 0; task_idx < num_tasks; task_idx++) {
+        task(ctx, task_idx);
+    }
+}
+
+mli_status mli_hlp_set_num_threads(uint32_t num_threads) {
+    if (num_threads == 0 || num_threads > MLI_MAX_NUM_THREADS)
+        return MLI_STATUS_ARGUMENT_ERROR;
+#if defined(MLI_HOST_THREADS)
+    num_threads_setting.store(num_threads, std::memory_order_relaxed);
+    return MLI_STATUS_OK;
+#else
+    return (num_threads == 1) ? MLI_STATUS_OK : MLI_STATUS_NOT_SUPPORTED;
+#endif
+}
+
+uint32_t mli_hlp_get_num_threads(void) {
+#if defined(MLI_HOST_THREADS)
+    return num_threads_setting.load(std::memory_order_relaxed);
+#else
+    return 1;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma MLI_CODE_SECTION_END()
@@ -0,0 +1,423 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include <string.h>
+#include "mli_api.h"
+#include "mli_check.h"
+#include "mli_debug.h"
+#include "mli_math_macros.h"
+#include "mli_mov_api.h"
+#include "mli_tile_api.h"
+#include "mli_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma MLI_CODE_SECTION_START(".mli_lib")
+
+// Tile buffers in fast memory are placed with this alignment (in bytes)
+#define MLI_TILE_BUF_ALIGN 4
+#define MLI_TILE_ALIGN_SIZE(size) (CEIL_DIV((size), MLI_TILE_BUF_ALIGN) * MLI_TILE_BUF_ALIGN)
+
+// Geometry of a layer along the tiled (height) dimension
+typedef struct {
+    int kernel_height;      // effective kernel height (taking dilation into account)
+    int stride_height;
+    int padding_top;
+    int padding_bottom;
+} mli_tile_geometry;
+
+//=====================================================================
+// Private functions
+//=====================================================================
+
+static void mli_tile_get_geometry(const mli_tile_layer *layer, mli_tile_geometry *g) {
+    if (layer->conv2d != NULL) {
+        const mli_conv2d_cfg *cfg = layer->conv_cfg;
+        g->kernel_height = (layer->weights->shape[KRNL_H_DIM_HWCN] - 1) * cfg->dilation_height + 1;
+        g->stride_height = cfg->stride_height;
+        g->padding_top = cfg->padding_top;
+        g->padding_bottom = cfg->padding_bottom;
+    } else {
+        const mli_pool_cfg *cfg = layer->pool_cfg;
+        g->kernel_height = cfg->kernel_height;
+        g->stride_height = cfg->stride_height;
+        g->padding_top = cfg->padding_top;
+        g->padding_bottom = cfg->padding_bottom;
+    }
+}
+
+// Output shape of the whole layer. Convolutions use the shape provided in out like the kernels do,
+// while pooling kernels derive it from the input and configuration.
+static void mli_tile_get_out_shape(const mli_tile_layer *layer, const mli_tensor *in, const mli_tensor *out,
+        uint32_t *out_shape) {
+    if (layer->conv2d != NULL) {
+        out_shape[FMAP_H_DIM_HWC] = out->shape[FMAP_H_DIM_HWC];
+        out_shape[FMAP_W_DIM_HWC] = out->shape[FMAP_W_DIM_HWC];
+        out_shape[FMAP_C_DIM_HWC] = out->shape[FMAP_C_DIM_HWC];
+    } else {
+        const mli_pool_cfg *cfg = layer->pool_cfg;
+        const int in_height = in->shape[FMAP_H_DIM_HWC];
+        const int in_width = in->shape[FMAP_W_DIM_HWC];
+        out_shape[FMAP_H_DIM_HWC] = CEIL_DIV(in_height + cfg->padding_top + cfg->padding_bottom - cfg->kernel_height + 1,
+                cfg->stride_height);
+        out_shape[FMAP_W_DIM_HWC] = CEIL_DIV(in_width + cfg->padding_left + cfg->padding_right - cfg->kernel_width + 1,
+                cfg->stride_width);
+        out_shape[FMAP_C_DIM_HWC] = in->shape[FMAP_C_DIM_HWC];
+    }
+}
+
+// Input rows [in_beg, in_end) required for output rows [out_beg, out_end) and padding of the tile
+static void mli_tile_get_in_rows(const mli_tile_geometry *g, int in_height, int out_beg, int out_end,
+        int *in_beg, int *in_end, int *padding_top, int *padding_bottom) {
+    const int first = out_beg * g->stride_height - g->padding_top;
+    const int last = (out_end - 1) * g->stride_height - g->padding_top + g->kernel_height;
+    *padding_top = MAX(0, -first);
+    *padding_bottom = MAX(0, last - in_height);
+    *in_beg = MAX(0, first);
+    *in_end = MIN(in_height, last);
+}
+
+static mli_status mli_tile_load(mli_mov_handle_t *h, const mli_tensor *in, int in_beg, int in_end,
+        mli_tensor *in_tile) {
+    mli_mov_cfg_t cfg;
+    int offsets[MLI_MAX_RANK] = {in_beg, 0, 0, 0};
+    int sizes[MLI_MAX_RANK] = {in_end - in_beg, (int)in->shape[FMAP_W_DIM_HWC], (int)in->shape[FMAP_C_DIM_HWC], 0};
+    int dst_mem_stride[MLI_MAX_RANK] = {0};
+    mli_status ret = mli_mov_cfg_for_slice(&cfg, offsets, sizes, dst_mem_stride);
+    if (ret == MLI_STATUS_OK)
+        ret = mli_mov_prepare(h, in, &cfg, in_tile);
+    if (ret == MLI_STATUS_OK)
+        ret = mli_mov_start(h, in, &cfg, in_tile);
+    return ret;
+}
+
+// Number of elements per output channel of weights (all dimensions except the innermost one)
+static uint32_t mli_tile_get_channel_elements(const mli_tensor *weights) {
+    uint32_t elements = 1;
+    for (uint32_t i = 0; i + 1 < weights->rank; i++)
+        elements *= weights->shape[i];
+    return elements;
+}
+
+// Per-channel quantization parameters applied to dimension dim are sliced to channels [ch_beg, ch_beg + ch_num).
+// Per-tensor parameters and parameters applied to other dimensions are kept as is.
+static void mli_tile_slice_params(mli_tensor *t, int dim, int ch_beg, int ch_num) {
+    if ((t->el_type != MLI_EL_SA_8 && t->el_type != MLI_EL_SA_32) || t->el_params.sa.dim != dim)
+        return;
+    t->el_params.sa.zero_point.mem.pi16 += ch_beg;
+    t->el_params.sa.zero_point.capacity = ch_num * sizeof(int16_t);
+    t->el_params.sa.scale.mem.pi16 += ch_beg;
+    t->el_params.sa.scale.capacity = ch_num * sizeof(int16_t);
+    t->el_params.sa.scale_frac_bits.mem.pi8 += ch_beg;
+    t->el_params.sa.scale_frac_bits.capacity = ch_num * sizeof(int8_t);
+}
+
+static mli_status mli_tile_load_weights(mli_mov_handle_t *h, const mli_tensor *weights, int ch_beg, int ch_num,
+        mli_tensor *chunk) {
+    mli_mov_cfg_t cfg;
+    const int ch_dim = weights->rank - 1;
+    int offsets[MLI_MAX_RANK] = {0};
+    int sizes[MLI_MAX_RANK] = {0};
+    int dst_mem_stride[MLI_MAX_RANK] = {0};
+    for (int i = 0; i < ch_dim; i++)
+        sizes[i] = weights->shape[i];
+    offsets[ch_dim] = ch_beg;
+    sizes[ch_dim] = ch_num;
+
+    // Chunk takes quantization parameters of weights by pointers. They are sliced after the transfer is prepared.
+    chunk->el_params = weights->el_params;
+    memset(chunk->mem_stride, 0, sizeof(chunk->mem_stride));
+    mli_status ret = mli_mov_cfg_for_slice(&cfg, offsets, sizes, dst_mem_stride);
+    if (ret == MLI_STATUS_OK)
+        ret = mli_mov_prepare(h, weights, &cfg, chunk);
+    if (ret == MLI_STATUS_OK)
+        ret = mli_mov_start(h, weights, &cfg, chunk);
+    mli_tile_slice_params(chunk, ch_dim, ch_beg, ch_num);
+    return ret;
+}
+
+//=====================================================================
+// Public functions
+//=====================================================================
+
+mli_status mli_tile_prepare(const mli_tile_layer *layer, const mli_tensor *in, const mli_tensor *out,
+        mli_tile_plan *plan) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_tile_layer(layer, in, out, plan), __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    mli_tile_geometry g;
+    mli_tile_get_geometry(layer, &g);
+    mli_tile_get_out_shape(layer, in, out, plan->out_shape);
+
+    // kernels process inputs and outputs of the same element type
+    const uint32_t elem_size = mli_hlp_tensor_element_size(in);
+    const int in_height = in->shape[FMAP_H_DIM_HWC];
+    const uint32_t in_row_size = in->shape[FMAP_W_DIM_HWC] * in->shape[FMAP_C_DIM_HWC] * elem_size;
+    const uint32_t out_row_size = plan->out_shape[FMAP_W_DIM_HWC] * plan->out_shape[FMAP_C_DIM_HWC] * elem_size;
+    const int out_height = plan->out_shape[FMAP_H_DIM_HWC];
+
+    // Highest tile which allows to keep two input tiles (current and next one) and an output tile in fast memory
+    int out_rows = out_height;
+    for (; out_rows > 0; out_rows--) {
+        const int in_rows = MIN((out_rows - 1) * g.stride_height + g.kernel_height, in_height);
+        const uint32_t required = 2 * MLI_TILE_ALIGN_SIZE(in_rows * in_row_size) + out_rows * out_row_size;
+        if (required <= plan->fast_mem_size)
+            break;
+    }
+    // Not a debug check: fast memory budget is a property of the platform rather than a usage error
+    if (out_rows == 0)
+        return MLI_STATUS_NOT_ENGH_MEM;
+
+    plan->tile_out_rows = out_rows;
+    plan->tile_in_rows = MIN((out_rows - 1) * g.stride_height + g.kernel_height, in_height);
+    plan->num_tiles = CEIL_DIV(out_height, out_rows);
+    plan->in_buf_size = MLI_TILE_ALIGN_SIZE(plan->tile_in_rows * in_row_size);
+    plan->out_buf_size = out_rows * out_row_size;
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_tile_run(const mli_tile_layer *layer, const mli_tile_plan *plan, const mli_tensor *in,
+        mli_tensor *out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_tile_layer(layer, in, out, plan), __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+    MLI_ASSERT(plan->num_tiles > 0 && plan->tile_out_rows > 0);
+    MLI_ASSERT(2 * plan->in_buf_size + plan->out_buf_size <= plan->fast_mem_size);
+
+    mli_tile_geometry g;
+    mli_tile_get_geometry(layer, &g);
+    const int in_height = in->shape[FMAP_H_DIM_HWC];
+    const int out_height = plan->out_shape[FMAP_H_DIM_HWC];
+
+    // Ping-pong buffers for input tiles and a buffer for the output tile
+    mli_tensor in_tile[2] = {*in, *in};
+    for (int i = 0; i < 2; i++) {
+        in_tile[i].data.mem.pi8 = plan->fast_mem + i * plan->in_buf_size;
+        in_tile[i].data.capacity = plan->in_buf_size;
+        memset(in_tile[i].mem_stride, 0, sizeof(in_tile[i].mem_stride));
+    }
+    mli_tensor out_tile = *out;
+    out_tile.data.mem.pi8 = plan->fast_mem + 2 * plan->in_buf_size;
+    out_tile.data.capacity = plan->out_buf_size;
+
+    // Whole output as the destination of tile results. Memory strides of out are kept if provided.
+    mli_tensor out_full = *out;
+    int out_mem_stride[MLI_MAX_RANK] = {0};
+    out_full.rank = 3;
+    for (int i = 2; i >= 0; i--) {
+        out_full.shape[i] = plan->out_shape[i];
+        if (out->mem_stride[i] != 0)
+            out_mem_stride[i] = out->mem_stride[i];
+        else
+            out_mem_stride[i] = (i == 2) ? 1 : out_mem_stride[i + 1] * plan->out_shape[i + 1];
+    }
+
+    // Input of the next tile is loaded in background if a channel is available.
+    // Otherwise tiles are loaded by the handle without a channel in a blocking manner.
+    mli_mov_handle_t h = {0};
+    if (mli_mov_acquire_handle(1, &h) != MLI_STATUS_OK) {
+        ret = mli_mov_acquire_handle(0, &h);
+        if (ret != MLI_STATUS_OK)
+            return ret;
+    }
+
+    int in_beg, in_end, padding_top, padding_bottom;
+    mli_tile_get_in_rows(&g, in_height, 0, MIN((int)plan->tile_out_rows, out_height),
+            &in_beg, &in_end, &padding_top, &padding_bottom);
+    ret = mli_tile_load(&h, in, in_beg, in_end, &in_tile[0]);
+
+    for (uint32_t tile = 0; tile < plan->num_tiles && ret == MLI_STATUS_OK; tile++) {
+        const int cur = tile & 1;
+        const int out_beg = tile * plan->tile_out_rows;
+        const int out_end = MIN(out_beg + (int)plan->tile_out_rows, out_height);
+        mli_tile_get_in_rows(&g, in_height, out_beg, out_end, &in_beg, &in_end, &padding_top, &padding_bottom);
+        mli_mov_wait(&h);
+
+        if (tile + 1 < plan->num_tiles) {
+            int next_beg, next_end, next_top, next_bottom;
+            const int next_out_end = MIN(out_end + (int)plan->tile_out_rows, out_height);
+            mli_tile_get_in_rows(&g, in_height, out_end, next_out_end, &next_beg, &next_end, &next_top, &next_bottom);
+            ret = mli_tile_load(&h, in, next_beg, next_end, &in_tile[cur ^ 1]);
+            if (ret != MLI_STATUS_OK)
+                break;
+        }
+
+        out_tile.rank = 3;
+        out_tile.shape[FMAP_H_DIM_HWC] = out_end - out_beg;
+        out_tile.shape[FMAP_W_DIM_HWC] = plan->out_shape[FMAP_W_DIM_HWC];
+        out_tile.shape[FMAP_C_DIM_HWC] = plan->out_shape[FMAP_C_DIM_HWC];
+        out_tile.mem_stride[FMAP_H_DIM_HWC] = plan->out_shape[FMAP_W_DIM_HWC] * plan->out_shape[FMAP_C_DIM_HWC];
+        out_tile.mem_stride[FMAP_W_DIM_HWC] = plan->out_shape[FMAP_C_DIM_HWC];
+        out_tile.mem_stride[FMAP_C_DIM_HWC] = 1;
+        if (layer->conv2d != NULL) {
+            mli_conv2d_cfg cfg = *layer->conv_cfg;
+            cfg.padding_top = padding_top;
+            cfg.padding_bottom = padding_bottom;
+            ret = layer->conv2d(&in_tile[cur], layer->weights, layer->bias, &cfg, &out_tile);
+        } else {
+            mli_pool_cfg cfg = *layer->pool_cfg;
+            cfg.padding_top = padding_top;
+            cfg.padding_bottom = padding_bottom;
+            ret = layer->pool(&in_tile[cur], &cfg, &out_tile);
+        }
+        if (ret != MLI_STATUS_OK)
+            break;
+
+        mli_mov_cfg_t wb_cfg;
+        mli_tensor out_dst = out_full;
+        int dst_offsets[MLI_MAX_RANK] = {out_beg, 0, 0, 0};
+        ret = mli_mov_cfg_for_concat(&wb_cfg, dst_offsets, out_mem_stride);
+        if (ret == MLI_STATUS_OK)
+            ret = mli_mov_tensor_sync(&out_tile, &wb_cfg, &out_dst);
+    }
+
+    // release waits for a load which is still in flight after a failure
+    mli_mov_release_handle(&h);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    out->el_type = out_tile.el_type;
+    out->el_params = out_tile.el_params;
+    out->rank = 3;
+    for (int i = 0; i < 3; i++)
+        out->shape[i] = plan->out_shape[i];
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_tile_weights_prepare(const mli_tile_layer *layer, const mli_tensor *in, const mli_tensor *out,
+        mli_tile_weights_plan *plan) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_tile_weights(layer, in, out, plan), __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    const mli_tensor *weights = layer->weights;
+    const uint32_t out_channels = weights->shape[weights->rank - 1];
+    const uint32_t channel_size = mli_tile_get_channel_elements(weights) * mli_hlp_tensor_element_size(weights);
+
+    // Largest chunk which allows to keep two chunks (current and next one) in fast memory
+    uint32_t channels = MIN(out_channels, plan->fast_mem_size / (2 * channel_size));
+    for (; channels > 0; channels--) {
+        if (2 * MLI_TILE_ALIGN_SIZE(channels * channel_size) <= plan->fast_mem_size)
+            break;
+    }
+    // Not a debug check: fast memory budget is a property of the platform rather than a usage error
+    if (channels == 0)
+        return MLI_STATUS_NOT_ENGH_MEM;
+
+    plan->chunk_channels = channels;
+    plan->num_chunks = CEIL_DIV(out_channels, channels);
+    plan->buf_size = MLI_TILE_ALIGN_SIZE(channels * channel_size);
+    return MLI_STATUS_OK;
+}
+
+mli_status mli_tile_weights_run(const mli_tile_layer *layer, const mli_tile_weights_plan *plan,
+        const mli_tensor *in, mli_tensor *out) {
+    mli_status ret = MLI_CHECK_STATUS(mli_chk_tile_weights(layer, in, out, plan), __func__);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+    MLI_ASSERT(plan->num_chunks > 0 && plan->chunk_channels > 0);
+    MLI_ASSERT(2 * plan->buf_size <= plan->fast_mem_size);
+
+    const mli_tensor *weights = layer->weights;
+    const bool is_conv = layer->conv2d != NULL;
+    const int out_channels = weights->shape[weights->rank - 1];
+    // kernels produce outputs of the input element type
+    const uint32_t out_elem_size = mli_hlp_tensor_element_size(in);
+    const uint32_t bias_elem_size = mli_hlp_tensor_element_size(layer->bias);
+    const int bias_stride = (layer->bias->mem_stride[0] != 0) ? layer->bias->mem_stride[0] : 1;
+
+    // Ping-pong buffers for weights chunks
+    mli_tensor chunk[2] = {*weights, *weights};
+    for (int i = 0; i < 2; i++) {
+        chunk[i].data.mem.pi8 = plan->fast_mem + i * plan->buf_size;
+        chunk[i].data.capacity = plan->buf_size;
+    }
+
+    // Output channels are the innermost dimension for both layers. Each chunk writes its slice of them
+    // in place: convolution through memory strides of the whole output, fully connected as a contiguous part.
+    int out_mem_stride[MLI_MAX_RANK] = {0};
+    if (is_conv) {
+        for (int i = 2; i >= 0; i--) {
+            if (out->mem_stride[i] != 0)
+                out_mem_stride[i] = out->mem_stride[i];
+            else
+                out_mem_stride[i] = (i == 2) ? 1 : out_mem_stride[i + 1] * out->shape[i + 1];
+        }
+    } else {
+        out_mem_stride[0] = 1;
+    }
+    const int out_ch_stride = out_mem_stride[is_conv ? FMAP_C_DIM_HWC : 0];
+
+    // Next chunk is loaded in background if a channel is available.
+    // Otherwise chunks are loaded by the handle without a channel in a blocking manner.
+    mli_mov_handle_t h = {0};
+    if (mli_mov_acquire_handle(1, &h) != MLI_STATUS_OK) {
+        ret = mli_mov_acquire_handle(0, &h);
+        if (ret != MLI_STATUS_OK)
+            return ret;
+    }
+
+    ret = mli_tile_load_weights(&h, weights, 0, MIN((int)plan->chunk_channels, out_channels), &chunk[0]);
+
+    mli_tensor out_chunk = *out;
+    for (uint32_t idx = 0; idx < plan->num_chunks && ret == MLI_STATUS_OK; idx++) {
+        const int cur = idx & 1;
+        const int ch_beg = idx * plan->chunk_channels;
+        const int ch_num = MIN((int)plan->chunk_channels, out_channels - ch_beg);
+        mli_mov_wait(&h);
+
+        if (idx + 1 < plan->num_chunks) {
+            const int next_beg = ch_beg + ch_num;
+            const int next_num = MIN((int)plan->chunk_channels, out_channels - next_beg);
+            ret = mli_tile_load_weights(&h, weights, next_beg, next_num, &chunk[cur ^ 1]);
+            if (ret != MLI_STATUS_OK)
+                break;
+        }
+
+        mli_tensor bias_chunk = *layer->bias;
+        bias_chunk.data.mem.pi8 += ch_beg * bias_stride * bias_elem_size;
+        bias_chunk.data.capacity -= ch_beg * bias_stride * bias_elem_size;
+        bias_chunk.shape[0] = ch_num;
+        mli_tile_slice_params(&bias_chunk, 0, ch_beg, ch_num);
+
+        const uint32_t out_offset = ch_beg * out_ch_stride * out_elem_size;
+        out_chunk.data.mem.pi8 = out->data.mem.pi8 + out_offset;
+        out_chunk.data.capacity = out->data.capacity - out_offset;
+        for (int i = 0; i < MLI_MAX_RANK; i++)
+            out_chunk.mem_stride[i] = out_mem_stride[i];
+        if (is_conv) {
+            out_chunk.shape[FMAP_C_DIM_HWC] = ch_num;
+            ret = layer->conv2d(in, &chunk[cur], &bias_chunk, layer->conv_cfg, &out_chunk);
+        } else {
+            ret = layer->fully_connected(in, &chunk[cur], &bias_chunk, layer->fc_cfg, &out_chunk);
+        }
+    }
+
+    // release waits for a load which is still in flight after a failure
+    mli_mov_release_handle(&h);
+    if (ret != MLI_STATUS_OK)
+        return ret;
+
+    out->el_type = out_chunk.el_type;
+    out->el_params = out_chunk.el_params;
+    out->rank = out_chunk.rank;
+    for (uint32_t i = 0; i < out_chunk.rank; i++)
+        out->shape[i] = out_chunk.shape[i];
+    out->shape[out_chunk.rank - 1] = out_channels;
+    return MLI_STATUS_OK;
+}
+
+#pragma MLI_CODE_SECTION_END()
+
+#ifdef __cplusplus
+}
+#endif
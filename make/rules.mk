@@ -47,6 +47,18 @@ ifdef FULL_ACCU
 TOOLCHAIN_OPTIONS += -DFULL_ACCU=${FULL_ACCU}
 endif
 
+ifdef MLI_MOV_HOST_ASYNC
+TOOLCHAIN_OPTIONS += -DMLI_MOV_HOST_ASYNC=${MLI_MOV_HOST_ASYNC}
+endif
+
+ifdef MLI_HOST_THREADS
+TOOLCHAIN_OPTIONS += -DMLI_HOST_THREADS=${MLI_HOST_THREADS}
+endif
+
+ifdef MLI_SPEC_DISPATCH
+TOOLCHAIN_OPTIONS += -DMLI_SPEC_DISPATCH=${MLI_SPEC_DISPATCH}
+endif
+
 ifdef MLI_DEBUG_MODE
 TOOLCHAIN_OPTIONS += -DMLI_DEBUG_MODE=${MLI_DEBUG_MODE}
 endif
@@ -0,0 +1,85 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "test_tensor_utils.h"
+
+#include <string.h>
+
+#include "mli_api.h"
+
+namespace mli {
+namespace tst {
+
+mli_tensor make_tensor(void* data, uint32_t capacity, mli_element_type el_type, uint32_t rank,
+                       const uint32_t* shape) {
+    mli_tensor t;
+    memset(&t, 0, sizeof(t));
+    t.data.mem.pi8 = (int8_t*)data;
+    t.data.capacity = capacity;
+    t.rank = rank;
+    for (uint32_t i = 0; i < rank; i++)
+        t.shape[i] = shape[i];
+    if (rank > 0)
+        mli_hlp_set_tensor_mem_strides(&t);
+    t.el_type = el_type;
+    return t;
+}
+
+void set_sa_params(mli_element_params* params, int16_t zero_point, int16_t scale, int8_t scale_frac_bits) {
+    params->sa.type = MLI_EL_PARAM_SC16_ZP16;
+    params->sa.dim = -1;
+    params->sa.zero_point.mem.i16 = zero_point;
+    params->sa.scale.mem.i16 = scale;
+    params->sa.scale_frac_bits.mem.i8 = scale_frac_bits;
+}
+
+uint32_t make_batch_of_two(const mli_tensor* item, int8_t* mem, mli_tensor* batch) {
+    const uint32_t item_size = item->shape[0] * item->mem_stride[0] * mli_hlp_tensor_element_size(item);
+    *batch = *item;
+    batch->rank = 4;
+    for (int i = 3; i > 0; i--) {
+        batch->shape[i] = item->shape[i - 1];
+        batch->mem_stride[i] = item->mem_stride[i - 1];
+    }
+    batch->shape[0] = 2;
+    batch->mem_stride[0] = item->shape[0] * item->mem_stride[0];
+    batch->data.mem.pi8 = mem;
+    batch->data.capacity = 2 * item_size;
+    return item_size;
+}
+
+mli_status unpack_batch_of_two(const mli_tensor* out_batch, uint32_t item_size, mli_tensor* out) {
+    const int8_t* batch_mem = out_batch->data.mem.pi8;
+    if (out_batch->rank != 4 || memcmp(batch_mem, batch_mem + item_size, item_size) != 0)
+        return MLI_STATUS_SHAPE_MISMATCH;
+
+    for (int i = 0; i < 3; i++)
+        out->shape[i] = out_batch->shape[i + 1];
+    out->el_type = out_batch->el_type;
+    out->el_params = out_batch->el_params;
+    // Copy elements only: gaps between rows and columns of output must stay untouched
+    const uint32_t el_size = mli_hlp_tensor_element_size(out);
+    for (uint32_t h = 0; h < out->shape[0]; h++) {
+        for (uint32_t w = 0; w < out->shape[1]; w++) {
+            const uint32_t offset = (h * out->mem_stride[0] + w * out->mem_stride[1]) * el_size;
+            memcpy(out->data.mem.pi8 + offset, batch_mem + offset, out->shape[2] * el_size);
+        }
+    }
+    return MLI_STATUS_OK;
+}
+
+data_generator::data_generator(uint32_t seed) : state(seed) {}
+
+int32_t data_generator::next(int32_t range) {
+    state = state * 1103515245u + 12345u;
+    return (int32_t)((state >> 16) % (2 * range + 1)) - range;
+}
+
+} // namespace tst
+} // namespace mli
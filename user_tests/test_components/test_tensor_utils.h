@@ -0,0 +1,128 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#ifndef _MLI_USER_TESTS_TEST_TENSOR_UTILS_H_
+#define _MLI_USER_TESTS_TEST_TENSOR_UTILS_H_
+
+#include <stddef.h>
+#include <string.h>
+
+#include "mli_api.h"
+
+namespace mli {
+namespace tst {
+
+//===============================================================================================
+// Helpers for tests which compare two ways of computing the same result (fused vs. separate
+// kernel calls, template vs. generic API) on generated data instead of reference vectors.
+//===============================================================================================
+
+// Build tensor descriptor over the provided memory with dense memory strides.
+// Element parameters are left zeroed and must be set by the caller.
+//
+// params:
+// [IN] data - pointer to tensor data
+// [IN] capacity - size of data memory in bytes
+// [IN] el_type - element type of tensor
+// [IN] rank - rank of tensor. Scalar tensor is built for rank 0 (data is kept in data.mem then)
+// [IN] shape - shape of tensor (rank values). Might be nullptr for rank 0
+//
+// Returns tensor descriptor
+mli_tensor make_tensor(void* data, uint32_t capacity, mli_element_type el_type, uint32_t rank,
+                       const uint32_t* shape);
+
+// Set per-tensor asymmetric quantization parameters (MLI_EL_PARAM_SC16_ZP16)
+//
+// params:
+// [OUT] params - element parameters of a tensor
+// [IN] zero_point - zero point of tensor
+// [IN] scale - scale value of tensor
+// [IN] scale_frac_bits - fractional bits of scale value
+//
+// No return
+void set_sa_params(mli_element_params* params, int16_t zero_point, int16_t scale, int8_t scale_frac_bits);
+
+//===============================================================================================
+// Helpers for batched versions of kernels: input of rank-3 kernel is replicated into rank-4 tensor
+// of two items processed by one call. Both output items must be bit exact with the rank-3 kernel.
+//===============================================================================================
+
+// Build descriptor of rank-4 tensor of two items with shape and memory strides of the rank-3 item
+//
+// params:
+// [IN] item - rank-3 tensor
+// [IN] mem - memory for data of the batch (at least twice the size of item)
+// [OUT] batch - descriptor of the batch
+//
+// Returns size of one item in bytes
+uint32_t make_batch_of_two(const mli_tensor* item, int8_t* mem, mli_tensor* batch);
+
+// Check that both items of the output batch are equal and copy the first one into output
+// of rank-3 kernel. Only elements are copied: gaps between rows and columns of output stay untouched.
+//
+// params:
+// [IN] out_batch - output batch filled by kernel
+// [IN] item_size - size of one item in bytes returned by make_batch_of_two()
+// [IN/OUT] out - output tensor of rank-3 kernel. Shape and element params are taken from out_batch
+//
+// Returns MLI_STATUS_SHAPE_MISMATCH if items differ, MLI_STATUS_OK otherwise
+mli_status unpack_batch_of_two(const mli_tensor* out_batch, uint32_t item_size, mli_tensor* out);
+
+// Run kernel on the batch of two copies of input and take the first item of output batch as result.
+//
+// params:
+// [IN] func - callable as mli_status func(const mli_tensor* in_batch, mli_tensor* out_batch)
+// [IN] in - input tensor of rank-3 kernel
+// [IN/OUT] out - output tensor of rank-3 kernel
+// [IN] in_mem, out_mem - memory for input and output batches
+//
+// Returns status of func, or MLI_STATUS_NOT_ENGH_MEM if batches don't fit into provided memory,
+// or status of unpack_batch_of_two()
+template <typename batch_func, size_t in_mem_size, size_t out_mem_size>
+mli_status run_batch_of_two(batch_func func, const mli_tensor* in, mli_tensor* out,
+                            int8_t (&in_mem)[in_mem_size], int8_t (&out_mem)[out_mem_size]) {
+    mli_tensor in_batch, out_batch;
+    const uint32_t in_size = make_batch_of_two(in, in_mem, &in_batch);
+    const uint32_t out_size = make_batch_of_two(out, out_mem, &out_batch);
+    if (2 * in_size > in_mem_size || 2 * out_size > out_mem_size)
+        return MLI_STATUS_NOT_ENGH_MEM;
+    memcpy(in_mem, in->data.mem.pi8, in_size);
+    memcpy(in_mem + in_size, in->data.mem.pi8, in_size);
+    memset(out_mem, 0, out_mem_size);
+
+    mli_status ret = func(&in_batch, &out_batch);
+    if (ret != MLI_STATUS_OK) return ret;
+    return unpack_batch_of_two(&out_batch, out_size, out);
+}
+
+//===============================================================================================
+// Generator of reproducible pseudo-random test data (linear congruential generator).
+// The same seed gives the same sequence on all platforms.
+//===============================================================================================
+class data_generator {
+public:
+    explicit data_generator(uint32_t seed);
+
+    // Get next value from the sequence uniformly distributed in the [-range, range] interval
+    int32_t next(int32_t range);
+
+    // Fill array with values of the [-range, range] interval
+    template <typename T, size_t N>
+    void fill(T (&arr)[N], int32_t range) {
+        for (auto& v : arr) v = (T)next(range);
+    }
+
+private:
+    uint32_t state;
+};
+
+} // namespace tst
+} // namespace mli
+
+#endif // _MLI_USER_TESTS_TEST_TENSOR_UTILS_H_
@@ -0,0 +1,267 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_api.h"
+#include "mli_config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_crc32_calc.h"
+#include "test_memory_manager.h"
+#include "test_quality_metrics.h"
+#include "mli_types.h"
+#include "test_tensor_quantizer.h"
+#include "test_report.h"
+
+// Convolution with weights and bias loaded from a blob must give bit exact results of the kernel itself,
+// so vectors and checksums of convolution tests are reused.
+#include "../mli_krn_conv2d/vectors_mli_krn_conv2d.inc"
+
+using mli::tst::tensor_quantizer;
+using mli::tst::quality_metrics;
+using mli::tst::crc32_calc;
+using mli::tst::reporter_full;
+using mli::tst::memory_manager;
+
+typedef mli_status(*conv2d_func_ptr)(
+    const mli_tensor* /*input*/,
+    const mli_tensor* /*weights*/,
+    const mli_tensor* /*bias*/,
+    const mli_conv2d_cfg* /*cfg*/,
+    mli_tensor* /*output*/);
+
+struct blob_test_operands {
+    const char* descr;
+    const conv2d_func_ptr mli_krn_conv2d;
+    tensor_quantizer in;
+    tensor_quantizer weights;
+    tensor_quantizer bias;
+    tensor_quantizer out;
+    const mli_conv2d_cfg* cfg;
+    const quality_metrics threshold;
+    const crc32_calc check_sum;
+};
+
+// Checksums of test tensors for various mli calculations mode.
+// When developer finished implementation of kernel and consider it as ok, He need to populate
+// proper checksums for tests in order to highlight any change which affects results.
+#if defined(CRC_RM_CONVERGENT) || defined(CRC_RM_UP)
+// Shared CRC Results
+const crc32_calc test_1_chksum_fx16{ 0x3669E8DA }, test_1_chksum_sa8{ 0xA3FFD976 },
+                 test_2_chksum_sa8{ 0x5D288208 };
+#else // Not defined CRC_*
+const crc32_calc test_1_chksum_fx16, test_1_chksum_sa8,
+                 test_2_chksum_sa8;
+#endif
+
+const quality_metrics thresholds_fx16_general { quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                /* SNR_DB = */70.f, quality_metrics::kPassValueQuantErrPerc };
+
+const quality_metrics thresholds_sa8_general{ quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                              /* SNR_DB = */35.f, /*Quant Error Perc = */40.f };
+
+static const blob_test_operands tests_list[] = {
+    // Conv2D kernel_size=(3, 4), strides=(1, 1), with krn_padding and w/o ReLU.
+    // Weights and bias with fractional bits, and with per-axis quantization parameters.
+    {"Test 1 FX16",             mli_krn_conv2d_hwcn_fx16,
+                                input_1_fx16, weights_1_fx16, bias_1_fx16, test_1_out_fx16, &test_1_cfg,
+                                thresholds_fx16_general, test_1_chksum_fx16},
+    {"Test 1 SA8 Per Axis",     mli_krn_conv2d_hwcn_sa8_sa8_sa32,
+                                input_1_sa8, weights_1_sa8, bias_1_sa32, test_1_out_sa8, &test_1_cfg,
+                                thresholds_sa8_general, test_1_chksum_sa8},
+
+    // Conv2D with 7 kernels of (4, 3) size, strides = (2, 2), with krn_padding and with Gen_ReLU.
+    // Weights and bias with per-tensor quantization parameters.
+    {"Test 2 SA8 Per Tensor",   mli_krn_conv2d_hwcn_sa8_sa8_sa32,
+                                input_1_sa8, weights_2_sa8, bias_1_w2_per_tensor_sa32, test_2_out_sa8, &test_2_cfg,
+                                thresholds_sa8_general, test_2_chksum_sa8},
+};
+
+constexpr int kMemSize = 2247;
+constexpr int kBlobMemSize = 4096;
+static int8_t scratch_mem_in[kMemSize] = { 0 };
+static int8_t scratch_mem_w[kMemSize] = { 0 };
+static int8_t scratch_mem_b[kMemSize] = { 0 };
+static int8_t scratch_mem_out[kMemSize] = { 0 };
+alignas(MLI_BLOB_ALIGNMENT) static int8_t blob_mem[kBlobMemSize] = { 0 };
+alignas(MLI_BLOB_ALIGNMENT) static int8_t corrupted_blob_mem[kBlobMemSize] = { 0 };
+
+constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
+
+static bool is_inside_blob(const void* ptr, uint32_t size) {
+    const int8_t* p = (const int8_t*)ptr;
+    return p >= blob_mem && p + size <= blob_mem + kBlobMemSize;
+}
+
+// Blob tensor must describe the same tensor as the packed one, while all its memory is inside the blob
+static bool is_blob_tensor_valid(const mli_tensor& packed, const mli_tensor& loaded) {
+    bool is_valid = loaded.rank == packed.rank && loaded.el_type == packed.el_type &&
+                    ((uintptr_t)loaded.data.mem.pi8 % MLI_BLOB_ALIGNMENT) == 0 &&
+                    is_inside_blob(loaded.data.mem.pi8, loaded.data.capacity);
+    for (uint32_t dim = 0; dim < packed.rank && is_valid; dim++)
+        is_valid = loaded.shape[dim] == packed.shape[dim] && loaded.mem_stride[dim] == packed.mem_stride[dim];
+
+    if (!is_valid || packed.el_type == MLI_EL_FX_8 || packed.el_type == MLI_EL_FX_16)
+        return is_valid && loaded.el_params.fx.frac_bits == packed.el_params.fx.frac_bits;
+
+    const mli_element_params& p = packed.el_params;
+    const mli_element_params& l = loaded.el_params;
+    if (p.sa.dim < 0)
+        return l.sa.dim < 0 && l.sa.zero_point.mem.i16 == p.sa.zero_point.mem.i16 &&
+               l.sa.scale.mem.i16 == p.sa.scale.mem.i16 &&
+               l.sa.scale_frac_bits.mem.i8 == p.sa.scale_frac_bits.mem.i8;
+
+    const uint32_t num_vals = packed.shape[p.sa.dim];
+    return l.sa.dim == p.sa.dim &&
+           is_inside_blob(l.sa.zero_point.mem.pi16, l.sa.zero_point.capacity) &&
+           is_inside_blob(l.sa.scale.mem.pi16, l.sa.scale.capacity) &&
+           is_inside_blob(l.sa.scale_frac_bits.mem.pi8, l.sa.scale_frac_bits.capacity) &&
+           memcmp(l.sa.zero_point.mem.pi16, p.sa.zero_point.mem.pi16, num_vals * sizeof(int16_t)) == 0 &&
+           memcmp(l.sa.scale.mem.pi16, p.sa.scale.mem.pi16, num_vals * sizeof(int16_t)) == 0 &&
+           memcmp(l.sa.scale_frac_bits.mem.pi8, p.sa.scale_frac_bits.mem.pi8, num_vals * sizeof(int8_t)) == 0;
+}
+
+// Damaged or foreign blobs must be rejected by open regardless of debug mode
+static bool check_corrupted_blobs(uint32_t blob_size) {
+    uint32_t num_tensors = 0;
+    mli_tensor tsr;
+    bool is_passed = true;
+
+    memcpy(corrupted_blob_mem, blob_mem, blob_size);
+    corrupted_blob_mem[0] ^= 0x1;
+    is_passed &= mli_hlp_blob_open(corrupted_blob_mem, blob_size, &num_tensors) == MLI_STATUS_ARGUMENT_ERROR;
+
+    memcpy(corrupted_blob_mem, blob_mem, blob_size);
+    corrupted_blob_mem[sizeof(uint32_t)] += 1;
+    is_passed &= mli_hlp_blob_open(corrupted_blob_mem, blob_size, &num_tensors) == MLI_STATUS_NOT_SUPPORTED;
+
+    is_passed &= mli_hlp_blob_open(blob_mem, blob_size - 1, &num_tensors) == MLI_STATUS_LENGTH_ERROR;
+    is_passed &= mli_hlp_blob_open(blob_mem, sizeof(uint32_t), &num_tensors) == MLI_STATUS_LENGTH_ERROR;
+
+    memmove(corrupted_blob_mem + 2, blob_mem, blob_size);
+    is_passed &= mli_hlp_blob_open(corrupted_blob_mem + 2, blob_size, &num_tensors) == MLI_STATUS_MISALIGNMENT_ERROR;
+
+    is_passed &= mli_hlp_blob_find_tensor(blob_mem, "not_in_blob", &tsr) == MLI_STATUS_ARGUMENT_ERROR;
+    is_passed &= mli_hlp_blob_get_tensor(blob_mem, 2, &tsr) == MLI_STATUS_ARGUMENT_ERROR;
+    return is_passed;
+}
+
+int main() {
+    const reporter_full reporter;
+    bool final_status = true;
+    uint32_t last_blob_size = 0;
+
+    reporter.report_header("MLI|Helpers|Weights Blob Tests");
+    for (int i = 0; i < kTestsNum; ++i) {
+        memory_manager mem_in_keeper((int8_t*)(scratch_mem_in), sizeof(scratch_mem_in));
+        memory_manager mem_w_keeper((int8_t*)(scratch_mem_w), sizeof(scratch_mem_w));
+        memory_manager mem_b_keeper((int8_t*)(scratch_mem_b), sizeof(scratch_mem_b));
+        memory_manager mem_out_keeper((int8_t*)(scratch_mem_out), sizeof(scratch_mem_out));
+        bool is_test_passed = true;
+        const blob_test_operands* cur_test = &tests_list[i];
+        quality_metrics test_metics;
+
+        if (!(cur_test->in.is_valid() && cur_test->weights.is_valid() &&
+                cur_test->bias.is_valid() && cur_test->out.is_valid())) {
+            reporter.report_message(cur_test->descr, "FAILED at init: Bad source data for one of tensors");
+            is_test_passed = false;
+        }
+
+        mli_tensor input = cur_test->in.get_quantized_tensor(mem_in_keeper.allocate_memory(cur_test->in));
+        mli_tensor weights = cur_test->weights.get_quantized_tensor(mem_w_keeper.allocate_memory(cur_test->weights));
+        mli_tensor bias = cur_test->bias.get_quantized_tensor(mem_b_keeper.allocate_memory(cur_test->bias));
+        mli_tensor out = cur_test->out.get_not_quantized_tensor(mem_out_keeper.allocate_memory(cur_test->out));
+        if (is_test_passed &&
+                (tensor_quantizer::validate_tensor(input) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(weights) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(bias) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(out) != tensor_quantizer::kOk)) {
+            reporter.report_message(cur_test->descr,
+                                    "FAILED at quantization step: more memory for one of tensors might be required");
+            is_test_passed = false;
+        }
+
+        // Weights and bias are packed into the blob like a host tool does it for a model file
+        const mli_tensor* packed[] = {&weights, &bias};
+        const char* names[] = {"conv_weights", "conv_bias"};
+        const uint32_t blob_size = mli_hlp_blob_get_size(packed, 2);
+        if (is_test_passed && blob_size > sizeof(blob_mem)) {
+            reporter.report_message(cur_test->descr, "FAILED at init: more memory for blob is required");
+            is_test_passed = false;
+        }
+        memset(blob_mem, 0, sizeof(blob_mem));
+        if (is_test_passed &&
+                mli_hlp_blob_pack(packed, names, 2, blob_mem, blob_size) != MLI_STATUS_OK) {
+            reporter.report_message(cur_test->descr, "FAILED at packing: function returned bad status");
+            is_test_passed = false;
+        }
+
+        uint32_t num_tensors = 0;
+        mli_tensor blob_weights = { 0 };
+        mli_tensor blob_bias = { 0 };
+        if (is_test_passed &&
+                (mli_hlp_blob_open(blob_mem, blob_size, &num_tensors) != MLI_STATUS_OK || num_tensors != 2 ||
+                 mli_hlp_blob_find_tensor(blob_mem, names[0], &blob_weights) != MLI_STATUS_OK ||
+                 mli_hlp_blob_get_tensor(blob_mem, 1, &blob_bias) != MLI_STATUS_OK)) {
+            reporter.report_message(cur_test->descr, "FAILED at loading: function returned bad status");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                (!is_blob_tensor_valid(weights, blob_weights) || !is_blob_tensor_valid(bias, blob_bias))) {
+            reporter.report_message(cur_test->descr, "FAILED at loading: tensor doesn't match the packed one");
+            is_test_passed = false;
+        }
+
+        // Run specific kernel for test with parameters which point into the blob
+        if (is_test_passed &&
+                cur_test->mli_krn_conv2d(&input, &blob_weights, &blob_bias, cur_test->cfg, &out) != MLI_STATUS_OK) {
+            reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                (mem_in_keeper.is_memory_corrupted() || mem_out_keeper.is_memory_corrupted() ||
+                 mem_w_keeper.is_memory_corrupted() || mem_b_keeper.is_memory_corrupted())) {
+            reporter.report_message(cur_test->descr,
+                "FAILED after kernel run: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                test_metics.calculate_metrics(out, cur_test->out) == false) {
+            reporter.report_message(cur_test->descr, "FAILED at comparison output with reference");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed) {
+            crc32_calc data_crc;
+            data_crc(input);
+            data_crc(blob_weights);
+            data_crc(blob_bias);
+            data_crc(out);
+            is_test_passed &= reporter.evaluate_and_report_case(cur_test->descr, test_metics, cur_test->threshold,
+                                                                data_crc, cur_test->check_sum);
+        }
+        if (is_test_passed)
+            last_blob_size = blob_size;
+        final_status &= is_test_passed;
+    }
+
+    if (last_blob_size == 0 || !check_corrupted_blobs(last_blob_size)) {
+        reporter.report_message("Test 3 Corrupted Blobs", "FAILED: corrupted blob isn't rejected as expected");
+        final_status = false;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_hlp_blob", final_status);
+
+    return (final_status) ? 0 : 1;
+}
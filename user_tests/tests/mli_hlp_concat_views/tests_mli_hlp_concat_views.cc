@@ -0,0 +1,522 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_api.h"
+#include "mli_config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_crc32_calc.h"
+#include "test_memory_manager.h"
+#include "test_quality_metrics.h"
+#include "mli_types.h"
+#include "test_tensor_quantizer.h"
+#include "test_report.h"
+
+// Kernels writing to a view of the concatenated tensor must give bit exact results of the kernel itself,
+// so vectors and checksums of convolution, pooling and eltwise tests are reused.
+namespace conv {
+#include "../mli_krn_conv2d/vectors_mli_krn_conv2d.inc"
+}
+// Descriptor macros are shared by names between vector files
+#undef INPUT_1_TSR_SHARED_DESCR
+#undef INPUT_1_MEMSTR_TSR_SHARED_DESCR
+#undef INPUT_2_TSR_SHARED_DESCR
+#undef TEST_1_OUT_TSR_SHARED_DESCR
+#undef TEST_2_OUT_TSR_SHARED_DESCR
+#undef TEST_3_OUT_TSR_SHARED_DESCR
+#undef TEST_4_OUT_TSR_SHARED_DESCR
+#undef TEST_5_OUT_TSR_SHARED_DESCR
+#undef TEST_6_OUT_TSR_SHARED_DESCR
+#undef TEST_7_OUT_TSR_SHARED_DESCR
+#undef TEST_8_OUT_TSR_SHARED_DESCR
+#undef TEST_9_OUT_TSR_SHARED_DESCR
+#undef TEST_10_OUT_TSR_SHARED_DESCR
+#undef TEST_11_OUT_TSR_SHARED_DESCR
+namespace pool {
+#include "../mli_krn_maxpool/vectors_mli_krn_maxpool.inc"
+}
+#undef INPUT_1_TSR_SHARED_DESCR
+#undef INPUT_2_TSR_SHARED_DESCR
+#undef TEST_1_OUT_TSR_SHARED_DESCR
+#undef TEST_2_OUT_TSR_SHARED_DESCR
+#undef TEST_3_OUT_TSR_SHARED_DESCR
+#undef TEST_4_OUT_TSR_SHARED_DESCR
+#undef TEST_5_OUT_TSR_SHARED_DESCR
+#undef TEST_6_OUT_TSR_SHARED_DESCR
+#undef TEST_7_OUT_TSR_SHARED_DESCR
+namespace eltw {
+#include "../mli_krn_eltwise/vectors_mli_krn_eltwise.inc"
+}
+#undef BIAS_1_TSR_SHARED_DESCR
+#undef BIAS_2_TSR_SHARED_DESCR
+#undef INPUT_1_MEMSTR_TSR_SHARED_DESCR
+#undef INPUT_1_TSR_SHARED_DESCR
+#undef INPUT_2_TSR_SHARED_DESCR
+#undef TEST_1_OUT_TSR_SHARED_DESCR
+#undef TEST_2_OUT_TSR_SHARED_DESCR
+#undef TEST_3_OUT_TSR_SHARED_DESCR
+#undef TEST_4_OUT_TSR_SHARED_DESCR
+#undef TEST_5_OUT_TSR_SHARED_DESCR
+#undef TEST_6_OUT_TSR_SHARED_DESCR
+#undef TEST_7_OUT_TSR_SHARED_DESCR
+#undef TEST_8_OUT_TSR_SHARED_DESCR
+#undef TEST_9_OUT_TSR_SHARED_DESCR
+#undef TEST_10_OUT_TSR_SHARED_DESCR
+#undef WEIGHTS_1_TSR_SHARED_DESCR
+#undef WEIGHTS_2_MEMSTR_TSR_SHARED_DESCR
+#undef WEIGHTS_2_TSR_SHARED_DESCR
+#undef WEIGHTS_3_MEMSTR_TSR_SHARED_DESCR
+#undef WEIGHTS_4_MEMSTR_TSR_SHARED_DESCR
+namespace dw {
+#include "../mli_krn_depthwise_conv/vectors_mli_krn_depthwise_conv.inc"
+}
+#undef BIAS_1_TSR_SHARED_DESCR
+#undef BIAS_2_TSR_SHARED_DESCR
+#undef BIAS_3_TSR_SHARED_DESCR
+#undef INPUT_1
+#undef INPUT_1_MEMSTR_TSR_SHARED_DESCR
+#undef INPUT_1_TSR_SHARED_DESCR
+#undef INPUT_2_TSR_SHARED_DESCR
+#undef TEST_1_OUT_TSR_SHARED_DESCR
+#undef TEST_2_OUT_TSR_SHARED_DESCR
+#undef TEST_3_OUT_TSR_SHARED_DESCR
+#undef TEST_4_OUT_TSR_SHARED_DESCR
+#undef TEST_5_OUT_TSR_SHARED_DESCR
+#undef TEST_6_OUT_TSR_SHARED_DESCR
+#undef TEST_7_OUT_TSR_SHARED_DESCR
+#undef TEST_8_OUT_TSR_SHARED_DESCR
+#undef TEST_9_OUT_TSR_SHARED_DESCR
+#undef TEST_10_OUT_TSR_SHARED_DESCR
+#undef WEIGHTS_1_TSR_SHARED_DESCR
+#undef WEIGHTS_2_MEMSTR_TSR_SHARED_DESCR
+#undef WEIGHTS_2_TSR_SHARED_DESCR
+#undef WEIGHTS_5_TSR_SHARED_DESCR
+#undef WEIGHTS_6_TSR_SHARED_DESCR
+namespace grp {
+#include "../mli_krn_group_conv2d/vectors_mli_krn_group_conv2d.inc"
+}
+#undef BIAS_1_TSR_SHARED_DESCR
+#undef BIAS_2_TSR_SHARED_DESCR
+#undef INPUT_1_MEMSTR_TSR_SHARED_DESCR
+#undef INPUT_1_TSR_SHARED_DESCR
+#undef INPUT_2_MEMSTR_TSR_SHARED_DESCR
+#undef TEST_1_OUT_TSR_SHARED_DESCR
+#undef TEST_2_OUT_TSR_SHARED_DESCR
+#undef TEST_3_OUT_TSR_SHARED_DESCR
+#undef TEST_4_OUT_TSR_SHARED_DESCR
+#undef TEST_5_OUT_TSR_SHARED_DESCR
+#undef TEST_6_OUT_TSR_SHARED_DESCR
+#undef TEST_7_OUT_TSR_SHARED_DESCR
+#undef TEST_8_OUT_TSR_SHARED_DESCR
+#undef WEIGHTS_1_TSR_SHARED_DESCR
+#undef WEIGHTS_2_MEMSTR_TSR_SHARED_DESCR
+#undef WEIGHTS_2_TSR_SHARED_DESCR
+#undef WEIGHTS_3_MEMSTR_TSR_SHARED_DESCR
+#undef WEIGHTS_4_MEMSTR_TSR_SHARED_DESCR
+#undef WEIGHTS_5_MEMSTR_TSR_SHARED_DESCR
+namespace tconv {
+#include "../mli_krn_transpose_conv2d/vectors_mli_krn_transpose_conv2d.inc"
+}
+#undef INPUT_1_MEMSTR_TSR_SHARED_DESCR
+#undef INPUT_1_TSR_SHARED_DESCR
+#undef INPUT_2_MEMSTR_TSR_SHARED_DESCR
+#undef INPUT_2_TSR_SHARED_DESCR
+#undef INPUT_3_TSR_SHARED_DESCR
+#undef TEST_1_OUT_TSR_SHARED_DESCR
+#undef TEST_2_OUT_TSR_SHARED_DESCR
+#undef TEST_3_OUT_TSR_SHARED_DESCR
+#undef TEST_4_OUT_TSR_SHARED_DESCR
+#undef TEST_5_OUT_TSR_SHARED_DESCR
+#undef TEST_6_OUT_TSR_SHARED_DESCR
+#undef TEST_7_OUT_TSR_SHARED_DESCR
+#undef TEST_8_OUT_TSR_SHARED_DESCR
+namespace apool {
+#include "../mli_krn_avepool/vectors_mli_krn_avepool.inc"
+}
+
+using mli::tst::tensor_quantizer;
+using mli::tst::quality_metrics;
+using mli::tst::crc32_calc;
+using mli::tst::reporter_full;
+using mli::tst::memory_manager;
+
+typedef mli_status(*eltwise_func_ptr)(
+    const mli_tensor* /*in1*/,
+    const mli_tensor* /*in2*/,
+    mli_tensor* /*out*/);
+
+// Output of the kernel is one of two views of the full tensor. The other view is
+// of neighbour_size along the axis and must stay untouched by the kernel.
+struct concat_views_test_operands {
+    const char* descr;
+    const mli_tile_conv2d_fn conv2d;
+    const mli_tile_pool_fn pool;
+    const eltwise_func_ptr eltwise;
+    tensor_quantizer in1;
+    const tensor_quantizer* in2;
+    const tensor_quantizer* bias;
+    tensor_quantizer out;
+    const mli_conv2d_cfg* conv_cfg;
+    const mli_pool_cfg* pool_cfg;
+    const uint8_t axis;
+    const uint32_t neighbour_size;
+    const int out_view_idx;
+    const quality_metrics threshold;
+    const crc32_calc check_sum;
+};
+
+// Checksums of test tensors for various mli calculations mode.
+// When developer finished implementation of kernel and consider it as ok, He need to populate
+// proper checksums for tests in order to highlight any change which affects results.
+#if defined(CRC_RM_CONVERGENT) || defined(CRC_RM_UP)
+// Shared CRC Results
+const crc32_calc test_1_chksum_conv_fx16{ 0x3669E8DA }, test_1_chksum_conv_sa8{ 0xA3FFD976 },
+                 test_2_chksum_conv_fx16{ 0x6075722F }, test_2_chksum_conv_sa8{ 0x5D288208 },
+                 test_3_chksum_pool_fx16{ 0xB3CA162A }, test_3_chksum_pool_sa8{ 0x8952D11E },
+                 test_4_chksum_pool_fx16{ 0xB088F2F7 }, test_4_chksum_pool_sa8{ 0xCBAF5F7F },
+                                                        test_5_chksum_add_sa8{ 0x8BF4D950 },
+                                                        test_6_chksum_add_sa8{ 0xD64E0AB7 },
+                 test_7_chksum_mul_fx16{ 0xfc026def },  test_7_chksum_mul_sa8{ 0x3a54561 },
+                 test_8_chksum_dw_fx16{ 0xC2732A90 },   test_8_chksum_dw_sa8{ 0x9EF7413F },
+                 test_9_chksum_group_fx16{ 0x65FD03D2 }, test_9_chksum_group_sa8{ 0x33341D2B },
+                 test_10_chksum_tconv_fx16{ 0x7CD22049 }, test_10_chksum_tconv_sa8{ 0x59A71A0B },
+                 test_11_chksum_apool_fx16{ 0xA7542BBE };
+
+#if defined(AVEPOOL_16BIT_MUL)
+const crc32_calc test_11_chksum_apool_sa8{ 0xD825FD74 };
+#else
+const crc32_calc test_11_chksum_apool_sa8{ 0x60655C05 };
+#endif
+
+// Platform Specific CRC Results
+#if defined(CRC_RM_UP)
+const crc32_calc test_5_chksum_add_fx16{ 0xAC3BE4B7 }, test_6_chksum_add_fx16{ 0x78F7CB28 };
+#else
+const crc32_calc test_5_chksum_add_fx16{ 0x5C7970C5 }, test_6_chksum_add_fx16{ 0xA29485BE };
+#endif
+
+#else // Not defined CRC_*
+const crc32_calc test_1_chksum_conv_fx16, test_1_chksum_conv_sa8,
+                 test_2_chksum_conv_fx16, test_2_chksum_conv_sa8,
+                 test_3_chksum_pool_fx16, test_3_chksum_pool_sa8,
+                 test_4_chksum_pool_fx16, test_4_chksum_pool_sa8,
+                 test_5_chksum_add_fx16, test_5_chksum_add_sa8,
+                 test_6_chksum_add_fx16, test_6_chksum_add_sa8,
+                 test_7_chksum_mul_fx16, test_7_chksum_mul_sa8,
+                 test_8_chksum_dw_fx16, test_8_chksum_dw_sa8,
+                 test_9_chksum_group_fx16, test_9_chksum_group_sa8,
+                 test_10_chksum_tconv_fx16, test_10_chksum_tconv_sa8,
+                 test_11_chksum_apool_fx16, test_11_chksum_apool_sa8;
+#endif
+
+const quality_metrics thresholds_conv_fx16_general { quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                     /* SNR_DB = */70.f, quality_metrics::kPassValueQuantErrPerc };
+
+const quality_metrics thresholds_conv_sa8_general{ quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                   /* SNR_DB = */35.f, /*Quant Error Perc = */40.f };
+
+const quality_metrics thresholds_pool_fx16_general { quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                     /* SNR_DB = */84.f, /*Quant Error Perc = */ 99.9f };
+
+const quality_metrics thresholds_pool_sa8_general{ quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                   /* SNR_DB = */40.f, /*Quant Error Perc = */ 99.9f };
+
+const quality_metrics thresholds_group_sa8_general{ quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                    /* SNR_DB = */30.f, quality_metrics::kPassValueQuantErrPerc };
+
+const quality_metrics thresholds_apool_fx16_general { /* MaxAbsErr = */0.0003f, quality_metrics::kPassValueSnr,
+                                                      /* SNR_DB = */80.f, /*Quant Error Perc = */ 27.f };
+
+const quality_metrics thresholds_apool_sa8_general{ /* MaxAbsErr = */0.06f, quality_metrics::kPassValueSnr,
+                                                    /* SNR_DB = */30.f, /*Quant Error Perc = */ 13.f };
+
+const quality_metrics thresholds_eltwise_fx16_general { quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                        /* SNR DB = */ 60.f, quality_metrics::kPassValueQuantErrPerc };
+
+const quality_metrics thresholds_eltwise_sa8_general { quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                       /* SNR DB = */ 30.f, quality_metrics::kPassValueQuantErrPerc };
+
+static const concat_views_test_operands tests_list[] = {
+    // Conv2D kernel_size=(3, 4), strides=(1, 1), with krn_padding and w/o ReLU. Output is the second part of channels
+    {"Test 1 Conv FX16 Ch",  mli_krn_conv2d_hwcn_fx16, nullptr, nullptr,
+                             conv::input_1_fx16, &conv::weights_1_fx16, &conv::bias_1_fx16, conv::test_1_out_fx16,
+                             &conv::test_1_cfg, nullptr, FMAP_C_DIM_HWC, 3, 1,
+                             thresholds_conv_fx16_general, test_1_chksum_conv_fx16},
+    {"Test 1 Conv SA8 Ch",   mli_krn_conv2d_hwcn_sa8_sa8_sa32, nullptr, nullptr,
+                             conv::input_1_sa8, &conv::weights_1_sa8, &conv::bias_1_sa32, conv::test_1_out_sa8,
+                             &conv::test_1_cfg, nullptr, FMAP_C_DIM_HWC, 3, 1,
+                             thresholds_conv_sa8_general, test_1_chksum_conv_sa8},
+
+    // Conv2D with 7 kernels of (4, 3) size, strides = (2, 2), with krn_padding and with Gen_ReLU.
+    // Output is the first part of channels
+    {"Test 2 Conv FX16 Ch",  mli_krn_conv2d_hwcn_fx16, nullptr, nullptr,
+                             conv::input_1_fx16, &conv::weights_2_fx16, &conv::bias_1_fx16, conv::test_2_out_fx16,
+                             &conv::test_2_cfg, nullptr, FMAP_C_DIM_HWC, 5, 0,
+                             thresholds_conv_fx16_general, test_2_chksum_conv_fx16},
+    {"Test 2 Conv SA8 Ch",   mli_krn_conv2d_hwcn_sa8_sa8_sa32, nullptr, nullptr,
+                             conv::input_1_sa8, &conv::weights_2_sa8, &conv::bias_1_w2_per_tensor_sa32,
+                             conv::test_2_out_sa8, &conv::test_2_cfg, nullptr, FMAP_C_DIM_HWC, 5, 0,
+                             thresholds_conv_sa8_general, test_2_chksum_conv_sa8},
+
+    // Maxpool kernel_size=(4, 3), strides=(1, 1), w/o padding. Output is the second part of channels
+    {"Test 3 Pool FX16 Ch",  nullptr, mli_krn_maxpool_hwc_fx16, nullptr,
+                             pool::input_1_fx16, nullptr, nullptr, pool::test_1_out_fx16,
+                             nullptr, &pool::test_1_cfg, FMAP_C_DIM_HWC, 3, 1,
+                             thresholds_pool_fx16_general, test_3_chksum_pool_fx16},
+    {"Test 3 Pool SA8 Ch",   nullptr, mli_krn_maxpool_hwc_sa8, nullptr,
+                             pool::input_1_sa8, nullptr, nullptr, pool::test_1_out_sa8,
+                             nullptr, &pool::test_1_cfg, FMAP_C_DIM_HWC, 3, 1,
+                             thresholds_pool_sa8_general, test_3_chksum_pool_sa8},
+
+    // Maxpool kernel_size=(3, 4), strides=(2, 2), with krn_padding. Output is the first part of columns
+    {"Test 4 Pool FX16 Col",  nullptr, mli_krn_maxpool_hwc_fx16, nullptr,
+                              pool::input_1_fx16, nullptr, nullptr, pool::test_2_out_fx16,
+                              nullptr, &pool::test_2_cfg, FMAP_W_DIM_HWC, 2, 0,
+                              thresholds_pool_fx16_general, test_4_chksum_pool_fx16},
+    {"Test 4 Pool SA8 Col",   nullptr, mli_krn_maxpool_hwc_sa8, nullptr,
+                              pool::input_1_sa8, nullptr, nullptr, pool::test_2_out_sa8,
+                              nullptr, &pool::test_2_cfg, FMAP_W_DIM_HWC, 2, 0,
+                              thresholds_pool_sa8_general, test_4_chksum_pool_sa8},
+
+    // Eltwise add of two vectors. Output is the second part of the innermost dimension
+    {"Test 5 Add FX16 Inner",  nullptr, nullptr, mli_krn_eltwise_add_fx16,
+                               eltw::input_1_fx16, &eltw::input_2_fx16, nullptr, eltw::test_1_out_fx16,
+                               nullptr, nullptr, 1, 4, 1,
+                               thresholds_eltwise_fx16_general, test_5_chksum_add_fx16},
+    {"Test 5 Add SA8 Inner",   nullptr, nullptr, mli_krn_eltwise_add_sa8,
+                               eltw::input_1_sa8, &eltw::input_2_sa8, nullptr, eltw::test_1_out_sa8,
+                               nullptr, nullptr, 1, 4, 1,
+                               thresholds_eltwise_sa8_general, test_5_chksum_add_sa8},
+
+    // Eltwise add with per-channel broadcasting. Output is the first part of the innermost dimension
+    {"Test 6 Add FX16 Bcast",  nullptr, nullptr, mli_krn_eltwise_add_fx16,
+                               eltw::input_1_fx16, &eltw::input_4_fx16, nullptr, eltw::test_12_out_fx16,
+                               nullptr, nullptr, 1, 4, 0,
+                               thresholds_eltwise_fx16_general, test_6_chksum_add_fx16},
+    {"Test 6 Add SA8 Bcast",   nullptr, nullptr, mli_krn_eltwise_add_sa8,
+                               eltw::input_1_sa8, &eltw::input_4_sa8, nullptr, eltw::test_12_out_sa8,
+                               nullptr, nullptr, 1, 4, 0,
+                               thresholds_eltwise_sa8_general, test_6_chksum_add_sa8},
+
+    // Eltwise Mul of two vectors. Output is the second part of the outermost dimension
+    {"Test 7 Mul FX16 Outer",  nullptr, nullptr, mli_krn_eltwise_mul_fx16,
+                               eltw::input_1_fx16, &eltw::input_2_fx16, nullptr, eltw::test_6_out_fx16,
+                               nullptr, nullptr, 0, 2, 1,
+                               thresholds_eltwise_fx16_general, test_7_chksum_mul_fx16},
+    {"Test 7 Mul SA8 Outer",   nullptr, nullptr, mli_krn_eltwise_mul_sa8,
+                               eltw::input_1_sa8, &eltw::input_2_sa8, nullptr, eltw::test_6_out_sa8,
+                               nullptr, nullptr, 0, 2, 1,
+                               thresholds_eltwise_sa8_general, test_7_chksum_mul_sa8},
+
+    // Depthwise Conv2D kernel_size=(4, 3), strides=(2, 2), with krn_padding and Gen_ReLU.
+    // Output is the second part of channels
+    {"Test 8 DW Conv FX16 Ch",  mli_krn_depthwise_conv2d_hwcn_fx16, nullptr, nullptr,
+                                dw::input_1_fx16, &dw::weights_2_fx16, &dw::bias_2_fx16, dw::test_2_out_fx16,
+                                &dw::test_2_cfg, nullptr, FMAP_C_DIM_HWC, 2, 1,
+                                thresholds_conv_fx16_general, test_8_chksum_dw_fx16},
+    {"Test 8 DW Conv SA8 Ch",   mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32, nullptr, nullptr,
+                                dw::input_1_sa8, &dw::weights_2_sa8, &dw::bias_2_i1_w2_sa32, dw::test_2_out_sa8,
+                                &dw::test_2_cfg, nullptr, FMAP_C_DIM_HWC, 2, 1,
+                                thresholds_conv_sa8_general, test_8_chksum_dw_sa8},
+
+    // Group Conv2D kernel_size=(4, 3), strides=(1, 2), with krn_padding and Gen_ReLU.
+    // Output is the first part of channels
+    {"Test 9 Group Conv FX16 Ch",  mli_krn_group_conv2d_hwcn_fx16, nullptr, nullptr,
+                                   grp::input_1_fx16, &grp::weights_2_fx16, &grp::bias_2_fx16, grp::test_2_out_fx16,
+                                   &grp::test_2_cfg, nullptr, FMAP_C_DIM_HWC, 3, 0,
+                                   thresholds_conv_fx16_general, test_9_chksum_group_fx16},
+    {"Test 9 Group Conv SA8 Ch",   mli_krn_group_conv2d_hwcn_sa8_sa8_sa32, nullptr, nullptr,
+                                   grp::input_1_sa8, &grp::weights_2_sa8, &grp::bias_2_i1_w2_sa32,
+                                   grp::test_2_out_sa8, &grp::test_2_cfg, nullptr, FMAP_C_DIM_HWC, 3, 0,
+                                   thresholds_group_sa8_general, test_9_chksum_group_sa8},
+
+    // Transpose Conv2D kernel_size=(3, 4), strides=(2, 2), w/o ReLU. Output is the second part of channels
+    {"Test 10 Tr Conv FX16 Ch",  mli_krn_transpose_conv2d_hwcn_fx16, nullptr, nullptr,
+                                 tconv::input_1_fx16, &tconv::weights_1_fx16, &tconv::bias_1_fx16,
+                                 tconv::test_1_out_fx16, &tconv::test_1_cfg, nullptr, FMAP_C_DIM_HWC, 4, 1,
+                                 thresholds_conv_fx16_general, test_10_chksum_tconv_fx16},
+    {"Test 10 Tr Conv SA8 Ch",   mli_krn_transpose_conv2d_hwcn_sa8_sa8_sa32, nullptr, nullptr,
+                                 tconv::input_1_sa8, &tconv::weights_1_sa8, &tconv::bias_1_i1_w1_sa32,
+                                 tconv::test_1_out_sa8, &tconv::test_1_cfg, nullptr, FMAP_C_DIM_HWC, 4, 1,
+                                 thresholds_conv_sa8_general, test_10_chksum_tconv_sa8},
+
+    // Avepool kernel_size=(3, 4), strides=(2, 2), with krn_padding. Output is the first part of channels
+    {"Test 11 Avepool FX16 Ch",  nullptr, mli_krn_avepool_hwc_fx16, nullptr,
+                                 apool::input_1_fx16, nullptr, nullptr, apool::test_2_out_fx16,
+                                 nullptr, &apool::test_2_cfg, FMAP_C_DIM_HWC, 3, 0,
+                                 thresholds_apool_fx16_general, test_11_chksum_apool_fx16},
+    {"Test 11 Avepool SA8 Ch",   nullptr, mli_krn_avepool_hwc_sa8, nullptr,
+                                 apool::input_1_sa8, nullptr, nullptr, apool::test_2_out_sa8,
+                                 nullptr, &apool::test_2_cfg, FMAP_C_DIM_HWC, 3, 0,
+                                 thresholds_apool_sa8_general, test_11_chksum_apool_sa8},
+};
+
+constexpr int kMemSize = 2247;
+constexpr int kFullMemSize = 4096;
+constexpr int8_t kSentinel = 0x5A;
+static int8_t scratch_mem_in1[kMemSize] = { 0 };
+static int8_t scratch_mem_in2[kMemSize] = { 0 };
+static int8_t scratch_mem_b[kMemSize] = { 0 };
+static int8_t scratch_mem_out[kMemSize] = { 0 };
+static int8_t scratch_mem_neighbour[kFullMemSize] = { 0 };
+static int8_t scratch_mem_full[kFullMemSize] = { 0 };
+
+constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
+
+int main() {
+    const reporter_full reporter;
+    bool final_status = true;
+
+    reporter.report_header("MLI|Helpers|Concatenation Views Tests");
+    mli_mov_set_num_dma_ch(0, 1);
+    for (int i = 0; i < kTestsNum; ++i) {
+        memory_manager mem_in1_keeper((int8_t*)(scratch_mem_in1), sizeof(scratch_mem_in1));
+        memory_manager mem_in2_keeper((int8_t*)(scratch_mem_in2), sizeof(scratch_mem_in2));
+        memory_manager mem_b_keeper((int8_t*)(scratch_mem_b), sizeof(scratch_mem_b));
+        memory_manager mem_out_keeper((int8_t*)(scratch_mem_out), sizeof(scratch_mem_out));
+        bool is_test_passed = true;
+        const concat_views_test_operands* cur_test = &tests_list[i];
+        const bool is_conv = cur_test->conv2d != nullptr;
+        const bool is_eltwise = cur_test->eltwise != nullptr;
+        quality_metrics test_metics;
+
+        if (!(cur_test->in1.is_valid() && cur_test->out.is_valid() &&
+                (!(is_conv || is_eltwise) || cur_test->in2->is_valid()) &&
+                (!is_conv || cur_test->bias->is_valid()))) {
+            reporter.report_message(cur_test->descr, "FAILED at init: Bad source data for one of tensors");
+            is_test_passed = false;
+        }
+
+        mli_tensor input1 = cur_test->in1.get_quantized_tensor(mem_in1_keeper.allocate_memory(cur_test->in1));
+        mli_tensor out = cur_test->out.get_not_quantized_tensor(mem_out_keeper.allocate_memory(cur_test->out));
+        mli_tensor input2 = { 0 };
+        mli_tensor bias = { 0 };
+        if (is_conv || is_eltwise) {
+            input2 = cur_test->in2->get_quantized_tensor(mem_in2_keeper.allocate_memory(*cur_test->in2));
+        }
+        if (is_conv) {
+            bias = cur_test->bias->get_quantized_tensor(mem_b_keeper.allocate_memory(*cur_test->bias));
+        }
+        if (is_test_passed &&
+                (tensor_quantizer::validate_tensor(input1) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(out) != tensor_quantizer::kOk ||
+                 ((is_conv || is_eltwise) && tensor_quantizer::validate_tensor(input2) != tensor_quantizer::kOk) ||
+                 (is_conv && tensor_quantizer::validate_tensor(bias) != tensor_quantizer::kOk))) {
+            reporter.report_message(cur_test->descr,
+                                    "FAILED at quantization step: more memory for one of tensors might be required");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                (mem_in1_keeper.is_memory_corrupted() || mem_in2_keeper.is_memory_corrupted() ||
+                 mem_b_keeper.is_memory_corrupted() || mem_out_keeper.is_memory_corrupted())) {
+            reporter.report_message(cur_test->descr,
+                "FAILED at quantization step: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        // Full tensor holds the output of the kernel and its neighbour along the axis
+        mli_tensor full = out;
+        full.shape[cur_test->axis] += cur_test->neighbour_size;
+        mli_hlp_set_tensor_mem_strides(&full);
+        full.data.mem.pi8 = scratch_mem_full;
+        full.data.capacity = mli_hlp_count_elem_num(&full, 0) * mli_hlp_tensor_element_size(&full);
+        memset(scratch_mem_full, kSentinel, sizeof(scratch_mem_full));
+        if (is_test_passed && full.data.capacity > sizeof(scratch_mem_full)) {
+            reporter.report_message(cur_test->descr, "FAILED at init: more memory for full tensor is required");
+            is_test_passed = false;
+        }
+
+        const int out_idx = cur_test->out_view_idx;
+        const int neighbour_idx = 1 - out_idx;
+        const mli_concat_cfg cfg = {2, cur_test->axis};
+        uint32_t sizes[2];
+        sizes[out_idx] = out.shape[cur_test->axis];
+        sizes[neighbour_idx] = cur_test->neighbour_size;
+        mli_tensor views[2];
+        if (is_test_passed &&
+                mli_hlp_concat_views(&full, &cfg, sizes, views) != MLI_STATUS_OK) {
+            reporter.report_message(cur_test->descr, "FAILED at views creation: function returned bad status");
+            is_test_passed = false;
+        }
+
+        // Run specific kernel for test directly to the view of the full tensor
+        mli_status kernel_status = MLI_STATUS_OK;
+        if (is_test_passed) {
+            if (is_conv)
+                kernel_status = cur_test->conv2d(&input1, &input2, &bias, cur_test->conv_cfg, &views[out_idx]);
+            else if (is_eltwise)
+                kernel_status = cur_test->eltwise(&input1, &input2, &views[out_idx]);
+            else
+                kernel_status = cur_test->pool(&input1, cur_test->pool_cfg, &views[out_idx]);
+        }
+        if (is_test_passed && kernel_status != MLI_STATUS_OK) {
+            reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                (mem_in1_keeper.is_memory_corrupted() || mem_in2_keeper.is_memory_corrupted() ||
+                 mem_b_keeper.is_memory_corrupted() || mem_out_keeper.is_memory_corrupted())) {
+            reporter.report_message(cur_test->descr,
+                "FAILED after kernel run: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        // Views are gathered to dense tensors for comparison: the neighbour must keep its initial content.
+        mli_mov_cfg_t copy_cfg;
+        mli_mov_cfg_for_copy(&copy_cfg);
+        mli_tensor neighbour = views[neighbour_idx];
+        neighbour.data.mem.pi8 = scratch_mem_neighbour;
+        neighbour.data.capacity = sizeof(scratch_mem_neighbour);
+        mli_hlp_set_tensor_mem_strides(&neighbour);
+        memset(scratch_mem_neighbour, 0, sizeof(scratch_mem_neighbour));
+        if (is_test_passed &&
+                (mli_mov_tensor_sync(&views[out_idx], &copy_cfg, &out) != MLI_STATUS_OK ||
+                 mli_mov_tensor_sync(&views[neighbour_idx], &copy_cfg, &neighbour) != MLI_STATUS_OK)) {
+            reporter.report_message(cur_test->descr, "FAILED at gathering views: function returned bad status");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed) {
+            const uint32_t neighbour_bytes =
+                    mli_hlp_count_elem_num(&neighbour, 0) * mli_hlp_tensor_element_size(&neighbour);
+            for (uint32_t idx = 0; idx < neighbour_bytes && is_test_passed; idx++)
+                is_test_passed = scratch_mem_neighbour[idx] == kSentinel;
+            if (!is_test_passed)
+                reporter.report_message(cur_test->descr, "FAILED after kernel run: neighbour view is corrupted");
+        }
+
+        if (is_test_passed &&
+                test_metics.calculate_metrics(out, cur_test->out) == false) {
+            reporter.report_message(cur_test->descr, "FAILED at comparison output with reference");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed) {
+            crc32_calc data_crc;
+            data_crc(input1);
+            if (is_conv || is_eltwise)
+                data_crc(input2);
+            if (is_conv)
+                data_crc(bias);
+            data_crc(out);
+            is_test_passed &= reporter.evaluate_and_report_case(cur_test->descr, test_metics, cur_test->threshold,
+                                                                data_crc, cur_test->check_sum);
+        }
+        final_status &= is_test_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_hlp_concat_views", final_status);
+
+    return (final_status) ? 0 : 1;
+}
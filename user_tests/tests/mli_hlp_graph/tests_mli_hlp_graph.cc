@@ -0,0 +1,442 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_api.h"
+#include "mli_config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mli_types.h"
+#include "test_report.h"
+#include "test_tensor_utils.h"
+
+using mli::tst::reporter_basic;
+using mli::tst::make_tensor;
+using mli::tst::set_sa_params;
+using mli::tst::data_generator;
+
+// Small model in the style of examples: conv3x3 -> ReLU -> residual add -> maxpool2x2 -> fully connected.
+// Results of the graph runtime must be bit exact with the sequence of direct kernel calls.
+enum {
+    kTsrIn = 0, kTsrConvW, kTsrConvB, kTsrConvOut, kTsrReluOut, kTsrAddOut, kTsrPoolOut, kTsrFcW, kTsrFcB, kTsrOut,
+    kTensorsNum
+};
+constexpr uint32_t kOpsNum = 5;
+constexpr uint32_t kH = 8, kW = 8, kC = 4, kOutC = 10;
+constexpr uint32_t kFcIn = (kH / 2) * (kW / 2) * kC;
+
+// {name, kind, el_type, rank, shape, frac_bits, zero_point, scale, scale_frac_bits}
+static const mli_graph_tensor_desc graph_tensors[kTensorsNum] = {
+    {"in",       MLI_GRAPH_TENSOR_INPUT,    MLI_EL_SA_8, 3, {kH, kW, kC}, 0, -3, 16384, 16},
+    {"conv_w",   MLI_GRAPH_TENSOR_CONST,    MLI_EL_SA_8, 0, {0}, 0, 0, 0, 0},
+    {"conv_b",   MLI_GRAPH_TENSOR_CONST,    MLI_EL_SA_8, 0, {0}, 0, 0, 0, 0},
+    {"conv_out", MLI_GRAPH_TENSOR_INTERNAL, MLI_EL_SA_8, 0, {0}, 0, -10, 16384, 13},
+    {"relu_out", MLI_GRAPH_TENSOR_INTERNAL, MLI_EL_SA_8, 0, {0}, 0, -10, 16384, 13},
+    {"add_out",  MLI_GRAPH_TENSOR_INTERNAL, MLI_EL_SA_8, 0, {0}, 0, 5, 16384, 13},
+    {"pool_out", MLI_GRAPH_TENSOR_INTERNAL, MLI_EL_SA_8, 0, {0}, 0, 5, 16384, 13},
+    {"fc_w",     MLI_GRAPH_TENSOR_CONST,    MLI_EL_SA_8, 0, {0}, 0, 0, 0, 0},
+    {"fc_b",     MLI_GRAPH_TENSOR_CONST,    MLI_EL_SA_8, 0, {0}, 0, 0, 0, 0},
+    {"out",      MLI_GRAPH_TENSOR_OUTPUT,   MLI_EL_SA_8, 0, {0}, 0, 0, 16384, 10},
+};
+
+static const mli_conv2d_cfg conv_cfg = {{MLI_RELU_NONE, 0, 0}, 1, 1, 1, 1, 1, 1, 1, 1};
+static const mli_relu_cfg relu_cfg = {MLI_RELU_GEN, 0, 0};
+static const mli_pool_cfg pool_cfg = {2, 2, 2, 2, 0, 0, 0, 0};
+static const mli_fully_connected_cfg fc_cfg = {{MLI_RELU_NONE, 0, 0}};
+
+static mli_graph_op_desc graph_ops[kOpsNum];
+
+static void init_graph_ops() {
+    memset(graph_ops, 0, sizeof(graph_ops));
+    graph_ops[0] = {MLI_GRAPH_OP_CONV2D, 3, {kTsrIn, kTsrConvW, kTsrConvB}, kTsrConvOut, {}};
+    graph_ops[0].cfg.conv2d = conv_cfg;
+    graph_ops[1] = {MLI_GRAPH_OP_RELU, 1, {kTsrConvOut}, kTsrReluOut, {}};
+    graph_ops[1].cfg.relu = relu_cfg;
+    graph_ops[2] = {MLI_GRAPH_OP_ELTWISE_ADD, 2, {kTsrReluOut, kTsrIn}, kTsrAddOut, {}};
+    graph_ops[3] = {MLI_GRAPH_OP_MAXPOOL, 1, {kTsrAddOut}, kTsrPoolOut, {}};
+    graph_ops[3].cfg.pool = pool_cfg;
+    graph_ops[4] = {MLI_GRAPH_OP_FULLY_CONNECTED, 3, {kTsrPoolOut, kTsrFcW, kTsrFcB}, kTsrOut, {}};
+    graph_ops[4].cfg.fc = fc_cfg;
+}
+
+constexpr uint32_t kFmapSize = kH * kW * kC;
+static int8_t in_data[kFmapSize];
+static int8_t conv_w_data[3 * 3 * kC * kC];
+static int32_t conv_b_data[kC];
+static int8_t fc_w_data[kFcIn * kOutC];
+static int32_t fc_b_data[kOutC];
+static int8_t ref_mem[4][kFmapSize];
+static int8_t ref_out_data[kOutC];
+
+constexpr uint32_t kBlobMemSize = 4096;
+constexpr uint32_t kGraphMemSize = 2048;
+constexpr uint32_t kStateMemSize = 8192;
+constexpr uint32_t kArenaMemSize = 2048;
+constexpr uint32_t kTuningMemSize = 256;
+alignas(MLI_BLOB_ALIGNMENT) static int8_t blob_mem[kBlobMemSize];
+alignas(8) static int8_t graph_mem[kGraphMemSize];
+alignas(8) static int8_t corrupted_graph_mem[kGraphMemSize];
+alignas(8) static int8_t state_mem[kStateMemSize];
+alignas(MLI_GRAPH_ALIGNMENT) static int8_t arena_mem[kArenaMemSize];
+alignas(8) static int8_t tuning_mem[kTuningMemSize];
+alignas(8) static int8_t corrupted_tuning_mem[kTuningMemSize];
+
+static mli_tensor make_desc_tensor(uint32_t idx, void* data, uint32_t capacity, const uint32_t* shape,
+                                   uint32_t rank) {
+    const mli_graph_tensor_desc& d = graph_tensors[idx];
+    mli_tensor t = make_tensor(data, capacity, MLI_EL_SA_8, rank, shape);
+    set_sa_params(&t.el_params, (int16_t)d.zero_point, (int16_t)d.scale, (int8_t)d.scale_frac_bits);
+    return t;
+}
+
+// Bias scale is the product of input and weights scales, so conv and fc bias have 16384 * 16384 >> 14
+static const uint32_t conv_w_shape[] = {3, 3, kC, kC};
+static const uint32_t fc_w_shape[] = {kFcIn, kOutC};
+static const uint32_t conv_b_shape[] = {kC};
+static const uint32_t fc_b_shape[] = {kOutC};
+static mli_tensor conv_w, conv_b, fc_w, fc_b;
+
+static void init_data() {
+    data_generator gen(12345);
+    gen.fill(in_data, 100);
+    gen.fill(conv_w_data, 60);
+    gen.fill(conv_b_data, 3000);
+    gen.fill(fc_w_data, 60);
+    gen.fill(fc_b_data, 3000);
+
+    conv_w = make_tensor(conv_w_data, sizeof(conv_w_data), MLI_EL_SA_8, 4, conv_w_shape);
+    set_sa_params(&conv_w.el_params, 0, 16384, 19);
+    conv_b = make_tensor(conv_b_data, sizeof(conv_b_data), MLI_EL_SA_32, 1, conv_b_shape);
+    set_sa_params(&conv_b.el_params, 0, 16384, 21);
+    fc_w = make_tensor(fc_w_data, sizeof(fc_w_data), MLI_EL_SA_8, 2, fc_w_shape);
+    set_sa_params(&fc_w.el_params, 0, 16384, 19);
+    fc_b = make_tensor(fc_b_data, sizeof(fc_b_data), MLI_EL_SA_32, 1, fc_b_shape);
+    set_sa_params(&fc_b.el_params, 0, 16384, 18);
+}
+
+// Reference: the same layers called one by one as in examples
+static bool run_reference() {
+    const uint32_t fmap_shape[] = {kH, kW, kC};
+    const uint32_t pool_shape[] = {kH / 2, kW / 2, kC};
+    mli_tensor in = make_desc_tensor(kTsrIn, in_data, sizeof(in_data), fmap_shape, 3);
+    mli_tensor conv_out = make_desc_tensor(kTsrConvOut, ref_mem[0], kFmapSize, fmap_shape, 3);
+    mli_tensor relu_out = make_desc_tensor(kTsrReluOut, ref_mem[1], kFmapSize, fmap_shape, 3);
+    mli_tensor add_out = make_desc_tensor(kTsrAddOut, ref_mem[2], kFmapSize, fmap_shape, 3);
+    mli_tensor pool_out = make_desc_tensor(kTsrPoolOut, ref_mem[3], kFmapSize, pool_shape, 3);
+    mli_tensor out = make_desc_tensor(kTsrOut, ref_out_data, sizeof(ref_out_data), fc_b_shape, 1);
+
+    return mli_krn_conv2d_hwcn_sa8_sa8_sa32(&in, &conv_w, &conv_b, &conv_cfg, &conv_out) == MLI_STATUS_OK &&
+           mli_krn_relu_sa8(&conv_out, &relu_cfg, &relu_out) == MLI_STATUS_OK &&
+           mli_krn_eltwise_add_sa8(&relu_out, &in, &add_out) == MLI_STATUS_OK &&
+           mli_krn_maxpool_hwc_sa8(&add_out, &pool_cfg, &pool_out) == MLI_STATUS_OK &&
+           mli_krn_fully_connected_sa8_sa8_sa32(&pool_out, &fc_w, &fc_b, &fc_cfg, &out) == MLI_STATUS_OK;
+}
+
+// Per-op profiling hooks: count calls and check that they are paired and ordered
+struct hooks_log {
+    uint32_t before_num;
+    uint32_t after_num;
+    int32_t last_op;
+    bool is_valid;
+};
+
+static void log_before_op(void* ctx, uint32_t op_idx, const mli_graph_op_desc* op) {
+    hooks_log* log = (hooks_log*)ctx;
+    log->is_valid &= log->before_num == log->after_num && (int32_t)op_idx > log->last_op &&
+                     op->type != MLI_GRAPH_OP_NOP;
+    log->before_num++;
+}
+
+static void log_after_op(void* ctx, uint32_t op_idx, const mli_graph_op_desc* op, mli_status status) {
+    hooks_log* log = (hooks_log*)ctx;
+    log->is_valid &= log->before_num == log->after_num + 1 && status == MLI_STATUS_OK && op != NULL;
+    log->last_op = (int32_t)op_idx;
+    log->after_num++;
+}
+
+static uint32_t load_graph(mli_graph* graph, uint32_t graph_size) {
+    uint32_t state_size = 0;
+    if (mli_graph_open(graph_mem, graph_size, &state_size) != MLI_STATUS_OK || state_size > kStateMemSize)
+        return 0;
+    if (mli_graph_load(graph, graph_mem, blob_mem, state_mem, state_size) != MLI_STATUS_OK)
+        return 0;
+    return state_size;
+}
+
+// Plans, binds and runs the loaded graph; compares its output with the reference
+static bool run_graph(mli_graph* graph, uint32_t expected_ops, uint32_t* arena_size) {
+    mli_tensor* in = NULL;
+    mli_tensor* out = NULL;
+    hooks_log log = {0, 0, -1, true};
+    if (mli_graph_plan(graph, arena_size) != MLI_STATUS_OK || *arena_size > kArenaMemSize ||
+            mli_graph_bind(graph, arena_mem, kArenaMemSize) != MLI_STATUS_OK ||
+            mli_graph_find_tensor(graph, "in", &in) != MLI_STATUS_OK ||
+            mli_graph_find_tensor(graph, "out", &out) != MLI_STATUS_OK)
+        return false;
+
+    memset(arena_mem, 0x55, sizeof(arena_mem));
+    memcpy(in->data.mem.pi8, in_data, sizeof(in_data));
+    graph->hooks.before_op = log_before_op;
+    graph->hooks.after_op = log_after_op;
+    graph->hooks.ctx = &log;
+    if (mli_graph_run(graph) != MLI_STATUS_OK)
+        return false;
+    if (!log.is_valid || log.before_num != expected_ops || log.after_num != expected_ops)
+        return false;
+    if (out->rank != 1 || out->shape[0] != kOutC || memcmp(out->data.mem.pi8, ref_out_data, kOutC) != 0)
+        return false;
+
+    // The second run without hooks must give the same result. Memory of the input is shared with later
+    // tensors (including the output), so the input is filled again after the output is cleared.
+    graph->hooks.before_op = NULL;
+    graph->hooks.after_op = NULL;
+    memset(out->data.mem.pi8, 0, kOutC);
+    memcpy(in->data.mem.pi8, in_data, sizeof(in_data));
+    return mli_graph_run(graph) == MLI_STATUS_OK && memcmp(out->data.mem.pi8, ref_out_data, kOutC) == 0;
+}
+
+// Damaged graphs must be rejected by open or load regardless of debug mode
+static bool check_corrupted_graphs(uint32_t graph_size) {
+    const uint32_t header_size = 64;
+    const uint32_t tensor_desc_size = 96;
+    const uint32_t op_desc_size = 80;
+    int8_t* ops = corrupted_graph_mem + header_size + kTensorsNum * tensor_desc_size;
+    uint32_t state_size = 0;
+    mli_graph graph;
+    bool is_passed = true;
+
+    memcpy(corrupted_graph_mem, graph_mem, graph_size);
+    corrupted_graph_mem[0] ^= 0x1;
+    is_passed &= mli_graph_open(corrupted_graph_mem, graph_size, &state_size) == MLI_STATUS_ARGUMENT_ERROR;
+
+    memcpy(corrupted_graph_mem, graph_mem, graph_size);
+    corrupted_graph_mem[sizeof(uint32_t)] += 1;
+    is_passed &= mli_graph_open(corrupted_graph_mem, graph_size, &state_size) == MLI_STATUS_NOT_SUPPORTED;
+
+    is_passed &= mli_graph_open(graph_mem, graph_size - 1, &state_size) == MLI_STATUS_LENGTH_ERROR;
+
+    // Output of the first operation refers to a tensor out of range
+    memcpy(corrupted_graph_mem, graph_mem, graph_size);
+    ((uint32_t*)ops)[5] = kTensorsNum;
+    is_passed &= mli_graph_open(corrupted_graph_mem, graph_size, &state_size) == MLI_STATUS_BAD_TENSOR;
+
+    // Operations in wrong order: ReLU consumes the convolution output before it is produced
+    memcpy(corrupted_graph_mem, graph_mem, graph_size);
+    memcpy(ops, graph_mem + (ops - corrupted_graph_mem) + op_desc_size, op_desc_size);
+    memcpy(ops + op_desc_size, graph_mem + (ops - corrupted_graph_mem), op_desc_size);
+    is_passed &= mli_graph_open(corrupted_graph_mem, graph_size, &state_size) == MLI_STATUS_OK &&
+                 mli_graph_load(&graph, corrupted_graph_mem, blob_mem, state_mem, state_size) == MLI_STATUS_BAD_TENSOR;
+
+    // Constant tensors are not found without the blob
+    is_passed &= mli_graph_open(graph_mem, graph_size, &state_size) == MLI_STATUS_OK &&
+                 mli_graph_load(&graph, graph_mem, NULL, state_mem, state_size) == MLI_STATUS_ARGUMENT_ERROR;
+
+    // Not enough state or arena memory, run before bind
+    uint32_t arena_size = 0;
+    is_passed &= mli_graph_load(&graph, graph_mem, blob_mem, state_mem, state_size - 1) == MLI_STATUS_NOT_ENGH_MEM;
+    is_passed &= mli_graph_load(&graph, graph_mem, blob_mem, state_mem, state_size) == MLI_STATUS_OK &&
+                 mli_graph_run(&graph) == MLI_STATUS_ARGUMENT_ERROR &&
+                 mli_graph_plan(&graph, &arena_size) == MLI_STATUS_OK &&
+                 mli_graph_bind(&graph, arena_mem, arena_size - 1) == MLI_STATUS_NOT_ENGH_MEM &&
+                 mli_graph_run(&graph) == MLI_STATUS_ARGUMENT_ERROR;
+    return is_passed;
+}
+
+// Timer with a constant step: all variants take the same time, so the first supported one is selected
+static uint64_t counting_timer(void* ctx) {
+    return (*(uint64_t*)ctx)++;
+}
+
+// Tunes the graph, stores the winners and applies them to a graph loaded again
+static bool check_tuning(uint32_t graph_size) {
+    const uint32_t tuning_size = mli_graph_tuning_get_size(kOpsNum);
+    const uint32_t record_size = 16;
+    uint32_t* records = (uint32_t*)(tuning_mem + tuning_size - kOpsNum * record_size);
+    uint64_t time = 0;
+    const mli_graph_tune_cfg tune_cfg = {counting_timer, &time, 2, 2};
+    uint32_t arena_size = 0;
+    mli_tensor* in = NULL;
+    mli_graph graph;
+    bool is_passed = tuning_size <= kTuningMemSize;
+
+    is_passed &= load_graph(&graph, graph_size) != 0 &&
+                 mli_graph_tune(&graph, &tune_cfg) == MLI_STATUS_ARGUMENT_ERROR &&
+                 mli_graph_plan(&graph, &arena_size) == MLI_STATUS_OK &&
+                 mli_graph_bind(&graph, arena_mem, kArenaMemSize) == MLI_STATUS_OK &&
+                 mli_graph_find_tensor(&graph, "in", &in) == MLI_STATUS_OK;
+    if (!is_passed)
+        return false;
+    memcpy(in->data.mem.pi8, in_data, sizeof(in_data));
+    is_passed &= mli_graph_tune(&graph, &tune_cfg) == MLI_STATUS_OK && time > 0;
+
+    // Planned kernels go first among variants; threads are tried for convolution and pooling only
+    is_passed &= graph.variants[0].impl == MLI_GRAPH_IMPL_PLANNED && graph.variants[0].num_threads == 1 &&
+                 graph.variants[1].impl == MLI_GRAPH_IMPL_DIRECT && graph.variants[1].num_threads == 0 &&
+                 graph.variants[2].impl == MLI_GRAPH_IMPL_PLANNED && graph.variants[2].num_threads == 0 &&
+                 graph.variants[3].impl == MLI_GRAPH_IMPL_DIRECT && graph.variants[3].num_threads == 1 &&
+                 graph.variants[4].impl == MLI_GRAPH_IMPL_DIRECT && graph.variants[4].num_threads == 0;
+    is_passed &= mli_graph_tuning_pack(&graph, tuning_mem, tuning_size) == MLI_STATUS_OK;
+
+    // Tuned graph gives the same result as the default one
+    is_passed &= load_graph(&graph, graph_size) != 0 &&
+                 mli_graph_set_tuning(&graph, tuning_mem, tuning_size) == MLI_STATUS_OK &&
+                 graph.variants[0].impl == MLI_GRAPH_IMPL_PLANNED && graph.variants[3].num_threads == 1 &&
+                 run_graph(&graph, kOpsNum, &arena_size);
+
+    // Direct kernel calls for all operations
+    for (uint32_t i = 0; i < kOpsNum; i++)
+        records[i * record_size / sizeof(uint32_t) + 1] = MLI_GRAPH_IMPL_DIRECT;
+    is_passed &= load_graph(&graph, graph_size) != 0 &&
+                 mli_graph_set_tuning(&graph, tuning_mem, tuning_size) == MLI_STATUS_OK &&
+                 run_graph(&graph, kOpsNum, &arena_size);
+    return is_passed;
+}
+
+// Damaged tuning records must be rejected regardless of debug mode and leave variants untouched
+static bool check_corrupted_tuning(uint32_t graph_size) {
+    const uint32_t tuning_size = mli_graph_tuning_get_size(kOpsNum);
+    const uint32_t header_size = 32;
+    uint32_t* header = (uint32_t*)corrupted_tuning_mem;
+    uint32_t* records = (uint32_t*)(corrupted_tuning_mem + header_size);
+    mli_graph graph;
+    bool is_passed = load_graph(&graph, graph_size) != 0 &&
+                     mli_graph_tuning_pack(&graph, tuning_mem, tuning_size - 1) == MLI_STATUS_NOT_ENGH_MEM &&
+                     mli_graph_tuning_pack(&graph, tuning_mem, tuning_size) == MLI_STATUS_OK;
+    if (!is_passed)
+        return false;
+
+    memcpy(corrupted_tuning_mem, tuning_mem, tuning_size);
+    header[0] ^= 0x1;
+    is_passed &= mli_graph_set_tuning(&graph, corrupted_tuning_mem, tuning_size) == MLI_STATUS_ARGUMENT_ERROR;
+
+    memcpy(corrupted_tuning_mem, tuning_mem, tuning_size);
+    header[1] += 1;
+    is_passed &= mli_graph_set_tuning(&graph, corrupted_tuning_mem, tuning_size) == MLI_STATUS_NOT_SUPPORTED;
+
+    // Records of another graph
+    memcpy(corrupted_tuning_mem, tuning_mem, tuning_size);
+    header[4] -= 1;
+    is_passed &= mli_graph_set_tuning(&graph, corrupted_tuning_mem, tuning_size) == MLI_STATUS_BAD_FUNC_CFG;
+
+    memcpy(corrupted_tuning_mem, tuning_mem, tuning_size);
+    records[0] = MLI_GRAPH_OP_RELU;
+    is_passed &= mli_graph_set_tuning(&graph, corrupted_tuning_mem, tuning_size) == MLI_STATUS_BAD_FUNC_CFG;
+
+    // ReLU has no planned kernel
+    memcpy(corrupted_tuning_mem, tuning_mem, tuning_size);
+    records[1 * 4 + 1] = MLI_GRAPH_IMPL_PLANNED;
+    is_passed &= mli_graph_set_tuning(&graph, corrupted_tuning_mem, tuning_size) == MLI_STATUS_BAD_FUNC_CFG;
+
+    memcpy(corrupted_tuning_mem, tuning_mem, tuning_size);
+    records[1] = MLI_GRAPH_IMPL_NUM;
+    is_passed &= mli_graph_set_tuning(&graph, corrupted_tuning_mem, tuning_size) == MLI_STATUS_BAD_FUNC_CFG;
+
+    memcpy(corrupted_tuning_mem, tuning_mem, tuning_size);
+    records[2] = MLI_MAX_NUM_THREADS + 1;
+    is_passed &= mli_graph_set_tuning(&graph, corrupted_tuning_mem, tuning_size) == MLI_STATUS_BAD_FUNC_CFG;
+
+    is_passed &= mli_graph_set_tuning(&graph, tuning_mem, tuning_size - 1) == MLI_STATUS_LENGTH_ERROR;
+    for (uint32_t i = 0; i < kOpsNum; i++)
+        is_passed &= graph.variants[i].impl == MLI_GRAPH_IMPL_DEFAULT && graph.variants[i].num_threads == 0;
+    return is_passed;
+}
+
+// Graph run as a job gives the same result as the blocking run
+static bool check_graph_job(uint32_t graph_size) {
+    uint32_t arena_size = 0;
+    mli_tensor* in = NULL;
+    mli_tensor* out = NULL;
+    mli_job_handle_t h;
+    mli_graph graph;
+    bool is_passed = load_graph(&graph, graph_size) != 0 &&
+                     mli_graph_prepare_job(&graph, &h) == MLI_STATUS_ARGUMENT_ERROR &&
+                     mli_graph_plan(&graph, &arena_size) == MLI_STATUS_OK &&
+                     mli_graph_bind(&graph, arena_mem, kArenaMemSize) == MLI_STATUS_OK &&
+                     mli_graph_find_tensor(&graph, "in", &in) == MLI_STATUS_OK &&
+                     mli_graph_find_tensor(&graph, "out", &out) == MLI_STATUS_OK;
+    if (!is_passed)
+        return false;
+
+    memset(arena_mem, 0x55, sizeof(arena_mem));
+    memcpy(in->data.mem.pi8, in_data, sizeof(in_data));
+    return mli_graph_prepare_job(&graph, &h) == MLI_STATUS_OK && mli_job_start(&h) == MLI_STATUS_OK &&
+           mli_job_wait(&h) == MLI_STATUS_OK && mli_job_isdone(&h) &&
+           memcmp(out->data.mem.pi8, ref_out_data, kOutC) == 0;
+}
+
+int main() {
+    const reporter_basic reporter;
+    bool final_status = true;
+    bool is_test_passed = true;
+    mli_graph graph;
+    uint32_t arena_size = 0;
+    uint32_t fused_arena_size = 0;
+
+    reporter.report_header("MLI|Helpers|Graph Runtime Tests");
+    init_data();
+    init_graph_ops();
+
+    // Constants are packed into the blob and the graph is serialized like a host tool does it for a model file
+    const mli_tensor* packed[] = {&conv_w, &conv_b, &fc_w, &fc_b};
+    const char* names[] = {"conv_w", "conv_b", "fc_w", "fc_b"};
+    const uint32_t blob_size = mli_hlp_blob_get_size(packed, 4);
+    const uint32_t graph_size = mli_graph_get_size(kTensorsNum, kOpsNum);
+    uint32_t num_tensors = 0;
+    if (blob_size > kBlobMemSize || graph_size > kGraphMemSize ||
+            mli_hlp_blob_pack(packed, names, 4, blob_mem, blob_size) != MLI_STATUS_OK ||
+            mli_hlp_blob_open(blob_mem, blob_size, &num_tensors) != MLI_STATUS_OK ||
+            mli_graph_pack(graph_tensors, kTensorsNum, graph_ops, kOpsNum, graph_mem, graph_size) != MLI_STATUS_OK ||
+            !run_reference()) {
+        reporter.report_case("Init", "FAILED at init: packing or reference failed", false);
+        final_status = false;
+    }
+
+    if (final_status) {
+        is_test_passed = load_graph(&graph, graph_size) != 0 && run_graph(&graph, kOpsNum, &arena_size);
+        reporter.report_case("Test 1 SA8 Run", is_test_passed ? "" : "FAILED: output differs from kernel calls",
+                             is_test_passed);
+        final_status &= is_test_passed;
+
+        // ReLU is folded into the convolution: one operation and one intermediate tensor less
+        is_test_passed = load_graph(&graph, graph_size) != 0 &&
+                         mli_graph_apply_pass(&graph, mli_graph_fuse_relu, NULL) == MLI_STATUS_OK &&
+                         graph.ops[1].type == MLI_GRAPH_OP_NOP && graph.ops[0].output == kTsrReluOut &&
+                         graph.ops[0].cfg.conv2d.relu.type == MLI_RELU_GEN &&
+                         run_graph(&graph, kOpsNum - 1, &fused_arena_size) && fused_arena_size <= arena_size;
+        reporter.report_case("Test 2 SA8 Fused ReLU", is_test_passed ? "" : "FAILED: fused graph differs",
+                             is_test_passed);
+        final_status &= is_test_passed;
+
+        is_test_passed = check_corrupted_graphs(graph_size);
+        reporter.report_case("Test 3 Corrupted Graphs",
+                             is_test_passed ? "" : "FAILED: corrupted graph isn't rejected as expected", is_test_passed);
+        final_status &= is_test_passed;
+
+        is_test_passed = check_tuning(graph_size);
+        reporter.report_case("Test 4 SA8 Tuning", is_test_passed ? "" : "FAILED: tuned graph differs",
+                             is_test_passed);
+        final_status &= is_test_passed;
+
+        is_test_passed = check_corrupted_tuning(graph_size);
+        reporter.report_case("Test 5 Corrupted Tuning",
+                             is_test_passed ? "" : "FAILED: corrupted tuning isn't rejected as expected", is_test_passed);
+        final_status &= is_test_passed;
+
+        is_test_passed = check_graph_job(graph_size);
+        reporter.report_case("Test 6 SA8 Job Run", is_test_passed ? "" : "FAILED: job output differs",
+                             is_test_passed);
+        final_status &= is_test_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_hlp_graph", final_status);
+
+    return (final_status) ? 0 : 1;
+}
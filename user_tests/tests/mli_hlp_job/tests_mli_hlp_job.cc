@@ -0,0 +1,139 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_api.h"
+#include "mli_config.h"
+
+#include <atomic>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mli_types.h"
+#include "test_report.h"
+
+using mli::tst::reporter_basic;
+
+// Kernel calls wrapped into jobs: each job applies ReLU to its own fx16 slice.
+// Results of jobs must be bit exact with direct kernel calls.
+constexpr uint32_t kJobsNum = 8;
+constexpr uint32_t kSliceSize = 1024;
+
+struct relu_job_ctx {
+    mli_tensor in;
+    mli_tensor out;
+    mli_relu_cfg cfg;
+};
+
+static int16_t in_data[kJobsNum][kSliceSize];
+static int16_t out_data[kJobsNum][kSliceSize];
+static int16_t ref_data[kJobsNum][kSliceSize];
+static relu_job_ctx job_ctx[kJobsNum];
+static mli_job_handle_t handles[kJobsNum];
+static std::atomic<uint32_t> callbacks_mask{0};
+
+static mli_tensor make_fx16_tensor(int16_t* data) {
+    mli_tensor t = {0};
+    t.data.mem.pi16 = data;
+    t.data.capacity = kSliceSize * sizeof(int16_t);
+    t.shape[0] = kSliceSize;
+    t.mem_stride[0] = 1;
+    t.rank = 1;
+    t.el_type = MLI_EL_FX_16;
+    t.el_params.fx.frac_bits = 8;
+    return t;
+}
+
+static void init_data() {
+    for (uint32_t job = 0; job < kJobsNum; job++) {
+        for (uint32_t i = 0; i < kSliceSize; i++)
+            in_data[job][i] = (int16_t)((i * 37 + job * 101) % 4096 - 2048);
+        job_ctx[job].in = make_fx16_tensor(in_data[job]);
+        job_ctx[job].out = make_fx16_tensor(out_data[job]);
+        job_ctx[job].cfg = {job % 2 == 0 ? MLI_RELU_GEN : MLI_RELU_6, 0, 0};
+    }
+}
+
+static mli_status relu_job(void* ctx) {
+    relu_job_ctx* c = (relu_job_ctx*)ctx;
+    return mli_krn_relu_fx16(&c->in, &c->cfg, &c->out);
+}
+
+static mli_status failing_job(void* ctx) {
+    (void)ctx;
+    return MLI_STATUS_NOT_SUPPORTED;
+}
+
+static void job_done(int32_t cookie) {
+    callbacks_mask.fetch_or(1u << cookie);
+}
+
+// Jobs are started together, run concurrently and are waited for in reverse order
+static bool check_kernel_jobs() {
+    bool is_passed = true;
+    for (uint32_t job = 0; job < kJobsNum; job++) {
+        mli_tensor ref = make_fx16_tensor(ref_data[job]);
+        is_passed &= mli_krn_relu_fx16(&job_ctx[job].in, &job_ctx[job].cfg, &ref) == MLI_STATUS_OK;
+    }
+    memset(out_data, 0, sizeof(out_data));
+    callbacks_mask.store(0);
+    for (uint32_t job = 0; job < kJobsNum; job++) {
+        is_passed &= mli_job_prepare(&handles[job], relu_job, &job_ctx[job]) == MLI_STATUS_OK &&
+                     mli_job_registercallback(&handles[job], job_done, (int32_t)job) == MLI_STATUS_OK &&
+                     mli_job_start(&handles[job]) == MLI_STATUS_OK;
+    }
+    for (uint32_t job = kJobsNum; job > 0; job--) {
+        is_passed &= mli_job_wait(&handles[job - 1]) == MLI_STATUS_OK && mli_job_isdone(&handles[job - 1]);
+    }
+    is_passed &= callbacks_mask.load() == (1u << kJobsNum) - 1;
+    is_passed &= memcmp(out_data, ref_data, sizeof(out_data)) == 0;
+
+    // A done job can be started again with the same callback
+    memset(out_data[0], 0, sizeof(out_data[0]));
+    callbacks_mask.store(0);
+    is_passed &= mli_job_start(&handles[0]) == MLI_STATUS_OK && mli_job_wait(&handles[0]) == MLI_STATUS_OK &&
+                 callbacks_mask.load() == 1 && memcmp(out_data[0], ref_data[0], sizeof(out_data[0])) == 0;
+    return is_passed;
+}
+
+// Status of the job function is returned by wait; misused handles are rejected
+static bool check_job_status() {
+    mli_job_handle_t h;
+    bool is_passed = true;
+    is_passed &= mli_job_prepare(&h, NULL, NULL) == MLI_STATUS_ARGUMENT_ERROR;
+    is_passed &= mli_job_prepare(&h, failing_job, NULL) == MLI_STATUS_OK && !mli_job_isdone(&h) &&
+                 mli_job_wait(&h) == MLI_STATUS_ARGUMENT_ERROR;
+    is_passed &= mli_job_start(&h) == MLI_STATUS_OK && mli_job_wait(&h) == MLI_STATUS_NOT_SUPPORTED &&
+                 mli_job_isdone(&h);
+    is_passed &= mli_job_registercallback(&h, job_done, 0) == MLI_STATUS_ARGUMENT_ERROR;
+    return is_passed;
+}
+
+int main() {
+    const reporter_basic reporter;
+    bool final_status = true;
+    bool is_test_passed = true;
+
+    reporter.report_header("MLI|Helpers|Job Tests");
+    init_data();
+
+    is_test_passed = check_kernel_jobs();
+    reporter.report_case("Test 1 FX16 ReLU Jobs", is_test_passed ? "" : "FAILED: jobs differ from kernel calls",
+                         is_test_passed);
+    final_status &= is_test_passed;
+
+    is_test_passed = check_job_status();
+    reporter.report_case("Test 2 Job Status", is_test_passed ? "" : "FAILED: job status isn't reported as expected",
+                         is_test_passed);
+    final_status &= is_test_passed;
+
+    reporter.report_outline("[AUTO] Group: mli_hlp_job", final_status);
+
+    return (final_status) ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_api.h"
+#include "mli_config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mli_types.h"
+#include "test_report.h"
+
+using mli::tst::reporter_basic;
+
+// Buffers are described as {tensor, size, alignment, bank, first_op, last_op, offset}
+constexpr uint32_t kMaxBufs = 8;
+constexpr uint32_t kMaxBanks = 2;
+
+struct mem_plan_test_operands {
+    const char* descr;
+    const mli_mem_plan_buf bufs[kMaxBufs];
+    const uint32_t num_bufs;
+    const uint32_t num_banks;
+    const uint32_t peak_expected[kMaxBanks];
+};
+
+// Tensors which sizes are derived by the planner: fx16 4x5x6 and sa8 4x5x6 view into 4x5x8 tensor
+static mli_tensor tensor_fx16 = {
+    /* .data = */ { 0 },
+    /* .mem_stride = */ { 0 },
+    /* .shape = */ {4, 5, 6},
+    /* .rank = */ 3,
+    /* .el_type = */ MLI_EL_FX_16,
+    /* .el_params = */ { 0 }
+};
+static mli_tensor tensor_sa8_memstr = {
+    /* .data = */ { 0 },
+    /* .mem_stride = */ {40, 8, 1},
+    /* .shape = */ {4, 5, 6},
+    /* .rank = */ 3,
+    /* .el_type = */ MLI_EL_SA_8,
+    /* .el_params = */ { 0 }
+};
+
+static const mem_plan_test_operands tests_list[] = {
+    // Chain of layers (like cifar10 example): each tensor is produced by one operation and consumed by the next one.
+    // Peak is defined by the largest pair of adjacent tensors.
+    {"Test 1 Chain", {{nullptr, 3072, 0, 0, 0, 1}, {nullptr, 32768, 0, 0, 1, 2}, {nullptr, 8192, 0, 0, 2, 3},
+                      {nullptr, 8192, 0, 0, 3, 4}, {nullptr, 2048, 0, 0, 4, 5}, {nullptr, 2048, 0, 0, 5, 6},
+                      {nullptr, 512, 0, 0, 6, 7}, {nullptr, 40, 0, 0, 7, 8}},
+                      8, 1, {40960}},
+
+    // Residual connection: input of the block is alive until the elementwise add
+    {"Test 2 Residual", {{nullptr, 1000, 0, 0, 0, 2}, {nullptr, 600, 0, 0, 0, 1}, {nullptr, 600, 0, 0, 1, 2},
+                         {nullptr, 1000, 0, 0, 2, 3}},
+                         4, 1, {2600}},
+
+    // Alignment and per-bank placement
+    {"Test 3 Align Banks", {{nullptr, 10, 0, 0, 0, 0}, {nullptr, 7, 16, 0, 0, 0}, {nullptr, 100, 0, 1, 0, 0},
+                            {nullptr, 50, 0, 1, 1, 1}},
+                            4, 2, {23, 100}},
+
+    // Sizes derived from tensors including memory strides
+    {"Test 4 Tensors", {{&tensor_fx16, 0, 4, 0, 0, 1}, {&tensor_sa8_memstr, 0, 4, 0, 0, 1}},
+                       2, 1, {240 + 158}},
+};
+
+constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
+constexpr int kBankMemSize = 1024;
+alignas(16) static int8_t bank_mem_0[kBankMemSize] = { 0 };
+alignas(16) static int8_t bank_mem_1[kBankMemSize] = { 0 };
+
+// Buffers which are alive at the same time in the same bank must not overlap and each
+// buffer must be aligned and lie within the peak size of its bank.
+static bool is_plan_valid(const mli_mem_plan_buf* bufs, uint32_t num_bufs, const uint32_t* peak) {
+    for (uint32_t i = 0; i < num_bufs; i++) {
+        const mli_mem_plan_buf* a = &bufs[i];
+        if (a->offset + a->size > peak[a->bank])
+            return false;
+        if (a->alignment != 0 && a->offset % a->alignment != 0)
+            return false;
+        for (uint32_t j = i + 1; j < num_bufs; j++) {
+            const mli_mem_plan_buf* b = &bufs[j];
+            const bool alive_together = a->bank == b->bank && a->first_op <= b->last_op && b->first_op <= a->last_op;
+            const bool overlap = a->offset < b->offset + b->size && b->offset < a->offset + a->size;
+            if (alive_together && overlap)
+                return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    const reporter_basic reporter;
+    bool final_status = true;
+
+    reporter.report_header("MLI|Helpers|Static Memory Planner Tests");
+    for (int i = 0; i < kTestsNum; ++i) {
+        bool is_test_passed = true;
+        const mem_plan_test_operands* cur_test = &tests_list[i];
+        mli_mem_plan_buf bufs[kMaxBufs];
+        uint32_t peak[kMaxBanks] = { 0 };
+        memcpy(bufs, cur_test->bufs, sizeof(bufs));
+
+        if (mli_hlp_mem_plan(bufs, cur_test->num_bufs, peak, cur_test->num_banks) != MLI_STATUS_OK) {
+            is_test_passed = false;
+            reporter.report_case(cur_test->descr, "FAILED at planning: function returned bad status", is_test_passed);
+        }
+
+        if (is_test_passed && !is_plan_valid(bufs, cur_test->num_bufs, peak)) {
+            is_test_passed = false;
+            reporter.report_case(cur_test->descr, "FAILED at planning: buffers alive together overlap", is_test_passed);
+        }
+
+        for (uint32_t bank = 0; is_test_passed && bank < cur_test->num_banks; bank++) {
+            if (peak[bank] != cur_test->peak_expected[bank]) {
+                is_test_passed = false;
+                reporter.report_case(cur_test->descr, "FAILED at planning: not expected peak size", is_test_passed);
+            }
+        }
+
+        int8_t* const bank_mem[kMaxBanks] = {bank_mem_0, bank_mem_1};
+        if (is_test_passed &&
+                mli_hlp_mem_plan_bind(bufs, cur_test->num_bufs, bank_mem, cur_test->num_banks) != MLI_STATUS_OK) {
+            is_test_passed = false;
+            reporter.report_case(cur_test->descr, "FAILED at binding: function returned bad status", is_test_passed);
+        }
+
+        for (uint32_t idx = 0; is_test_passed && idx < cur_test->num_bufs; idx++) {
+            const mli_tensor* t = bufs[idx].tensor;
+            if (t != nullptr && (t->data.mem.pi8 != bank_mem[bufs[idx].bank] + bufs[idx].offset ||
+                                 t->data.capacity != bufs[idx].size)) {
+                is_test_passed = false;
+                reporter.report_case(cur_test->descr, "FAILED at binding: wrong tensor data container", is_test_passed);
+            }
+        }
+
+        if (is_test_passed) {
+            reporter.report_case(cur_test->descr, nullptr, is_test_passed);
+        }
+        final_status &= is_test_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_hlp_mem_plan", final_status);
+
+    return (final_status) ? 0 : 1;
+}
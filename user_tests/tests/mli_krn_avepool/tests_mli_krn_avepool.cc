@@ -11,12 +11,14 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "test_crc32_calc.h"
 #include "test_memory_manager.h"
 #include "test_quality_metrics.h"
 #include "mli_types.h"
 #include "test_tensor_quantizer.h"
+#include "test_tensor_utils.h"
 #include "test_report.h"
 
 #include "vectors_mli_krn_avepool.inc"
@@ -27,12 +29,52 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::run_batch_of_two;
 
 typedef mli_status(*avepool_func_ptr)(
     const mli_tensor* /*in*/,
     const mli_pool_cfg* /*cfg*/,
     mli_tensor* /*out*/);
 
+// Threaded versions of kernels: output area is split between threads of the pool.
+// Results must be bit exact with single-threaded kernels. Builds without threads run them in the calling thread.
+static mli_status mli_krn_avepool_hwc_fx16_threads(const mli_tensor* in, const mli_pool_cfg* cfg, mli_tensor* out) {
+    mli_hlp_set_num_threads(3);
+    mli_status ret = mli_krn_avepool_hwc_fx16(in, cfg, out);
+    mli_hlp_set_num_threads(1);
+    return ret;
+}
+
+static mli_status mli_krn_avepool_hwc_sa8_threads(const mli_tensor* in, const mli_pool_cfg* cfg, mli_tensor* out) {
+    mli_hlp_set_num_threads(7);
+    mli_status ret = mli_krn_avepool_hwc_sa8(in, cfg, out);
+    mli_hlp_set_num_threads(1);
+    return ret;
+}
+
+// Batched versions of kernels: input is replicated into rank-4 tensor of two items processed by one call.
+// Both output items must be bit exact with the rank-3 kernel, the first one is checked as output of the test.
+constexpr int kBatchMemSize = 2 * 2047;
+static IO_DATA_ATTR int8_t batch_mem_in[kBatchMemSize] = { 0 };
+static IO_DATA_ATTR int8_t batch_mem_out[kBatchMemSize] = { 0 };
+
+static mli_status avepool_batch_of_two(avepool_func_ptr func, const mli_tensor* in, const mli_pool_cfg* cfg, mli_tensor* out) {
+    return run_batch_of_two([=](const mli_tensor* in_batch, mli_tensor* out_batch) {
+        return func(in_batch, cfg, out_batch);
+    }, in, out, batch_mem_in, batch_mem_out);
+}
+
+static mli_status mli_krn_avepool_hwc_fx16_batch_threads(const mli_tensor* in, const mli_pool_cfg* cfg, mli_tensor* out) {
+    mli_hlp_set_num_threads(3);
+    mli_status ret = avepool_batch_of_two(mli_krn_avepool_hwc_fx16, in, cfg, out);
+    mli_hlp_set_num_threads(1);
+    return ret;
+}
+
+static mli_status mli_krn_avepool_hwc_sa8_k3x3_batch(const mli_tensor* in, const mli_pool_cfg* cfg, mli_tensor* out) {
+    return avepool_batch_of_two(mli_krn_avepool_hwc_sa8_k3x3, in, cfg, out);
+}
+
 struct avepool_test_operands {
     const char* descr;
     const avepool_func_ptr mli_krn_avepool;
@@ -179,6 +221,22 @@ static const avepool_test_operands tests_list[] = {
     {"Test 8 SA8 Huge Vals",   mli_krn_avepool_hwc_sa8,
                                input_3_sa8, test_8_out_sa8, test_8_cfg,
                                thresholds_sa8_test_huge_vals, test_8_chksum_sa8},
+
+    // Threaded pooling (same operands and checksums as in tests 1 and 2)
+    {"Test 9 FX16 Threads",    mli_krn_avepool_hwc_fx16_threads,
+                               input_1_fx16, test_1_out_fx16, test_1_cfg,
+                               thresholds_fx16_general, test_1_chksum_fx16},
+    {"Test 9 SA8 Threads",     mli_krn_avepool_hwc_sa8_threads,
+                               input_1_sa8, test_2_out_sa8, test_2_cfg,
+                               thresholds_sa8_general, test_2_chksum_sa8},
+
+    // Batch of two items in rank-4 tensors (same operands and checksums as in tests 3 and 7)
+    {"Test 10 FX16 Batch Threads Memstr", mli_krn_avepool_hwc_fx16_batch_threads,
+                                         input_1_memstr_fx16, test_3_out_fx16, test_3_cfg,
+                                         thresholds_fx16_general, test_3_chksum_fx16},
+    {"Test 10 SA8 k3x3 Batch",            mli_krn_avepool_hwc_sa8_k3x3_batch,
+                                         input_1_memstr_sa8, test_7_out_sa8, test_7_cfg,
+                                         thresholds_sa8_general, test_7_chksum_sa8},
 };
 
 constexpr int kMemSize = 2047;
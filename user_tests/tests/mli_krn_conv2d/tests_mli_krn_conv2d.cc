@@ -19,6 +19,7 @@
 #include "test_quality_metrics.h"
 #include "mli_types.h"
 #include "test_tensor_quantizer.h"
+#include "test_tensor_utils.h"
 #include "test_report.h"
 
 #include "vectors_mli_krn_conv2d.inc"
@@ -29,6 +30,7 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::run_batch_of_two;
 
 typedef mli_status(*conv2d_func_ptr)(
     const mli_tensor* /*input*/,
@@ -37,6 +39,76 @@ typedef mli_status(*conv2d_func_ptr)(
     const mli_conv2d_cfg* /*cfg*/,
     mli_tensor* /*output*/);
 
+// Planned versions of kernels: state of the kernel is derived once by prepare function
+// and reused by run function for data of tensors. Results must be bit exact with non planned kernels.
+static mli_status mli_krn_conv2d_hwcn_fx16_planned(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_conv2d_plan plan;
+    mli_status ret = mli_krn_conv2d_hwcn_fx16_prepare(in, weights, bias, cfg, out, &plan);
+    if (ret != MLI_STATUS_OK) return ret;
+    return mli_krn_conv2d_run(&plan, in->data.mem.pi8, out->data.mem.pi8);
+}
+
+static mli_status mli_krn_conv2d_hwcn_fx16_fx8_fx8_planned(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_conv2d_plan plan;
+    mli_status ret = mli_krn_conv2d_hwcn_fx16_fx8_fx8_prepare(in, weights, bias, cfg, out, &plan);
+    if (ret != MLI_STATUS_OK) return ret;
+    return mli_krn_conv2d_run(&plan, in->data.mem.pi8, out->data.mem.pi8);
+}
+
+static mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_planned(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_conv2d_plan plan;
+    mli_status ret = mli_krn_conv2d_hwcn_sa8_sa8_sa32_prepare(in, weights, bias, cfg, out, &plan);
+    if (ret != MLI_STATUS_OK) return ret;
+    return mli_krn_conv2d_run(&plan, in->data.mem.pi8, out->data.mem.pi8);
+}
+
+// Threaded versions of kernels: output area is split between threads of the pool.
+// Results must be bit exact with single-threaded kernels. Builds without threads run them in the calling thread.
+static mli_status mli_krn_conv2d_hwcn_fx16_threads(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_hlp_set_num_threads(3);
+    mli_status ret = mli_krn_conv2d_hwcn_fx16(in, weights, bias, cfg, out);
+    mli_hlp_set_num_threads(1);
+    return ret;
+}
+
+static mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3_threads(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_hlp_set_num_threads(7);
+    mli_status ret = mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3(in, weights, bias, cfg, out);
+    mli_hlp_set_num_threads(1);
+    return ret;
+}
+
+// Batched versions of kernels: input is replicated into rank-4 tensor of two items processed by one call.
+// Both output items must be bit exact with the rank-3 kernel, the first one is checked as output of the test.
+constexpr int kBatchMemSize = 2 * 2247;
+static IO_DATA_ATTR int8_t batch_mem_in[kBatchMemSize] = { 0 };
+static IO_DATA_ATTR int8_t batch_mem_out[kBatchMemSize] = { 0 };
+
+static mli_status conv2d_batch_of_two(conv2d_func_ptr func, const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    return run_batch_of_two([=](const mli_tensor* in_batch, mli_tensor* out_batch) {
+        return func(in_batch, weights, bias, cfg, out_batch);
+    }, in, out, batch_mem_in, batch_mem_out);
+}
+
+static mli_status mli_krn_conv2d_hwcn_fx16_batch_threads(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_hlp_set_num_threads(3);
+    mli_status ret = conv2d_batch_of_two(mli_krn_conv2d_hwcn_fx16, in, weights, bias, cfg, out);
+    mli_hlp_set_num_threads(1);
+    return ret;
+}
+
+static mli_status mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3_batch(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    return conv2d_batch_of_two(mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3, in, weights, bias, cfg, out);
+}
+
 struct conv2d_test_operands {
     const char* descr;
     const conv2d_func_ptr mli_krn_conv2d;
@@ -242,6 +314,36 @@ static const conv2d_test_operands tests_list[] = {
     {"Test 11 SA8_SA8_SA32 Huge Vals", mli_krn_conv2d_hwcn_sa8_sa8_sa32, 
                                        input_2_sa8, weights_6_sa8, bias_2_i2_w6_sa32, test_11_out_sa8, test_11_cfg,
                                        thresholds_sa8_general, test_11_chksum_sa8},
+
+    // Planned convolution (same operands and checksums as in tests 4 and 2)
+    {"Test 12 FX16 Plan IO_Memstr",         mli_krn_conv2d_hwcn_fx16_planned,
+                                            input_1_memstr_fx16, weights_1_fx16, bias_1_fx16, test_4_out_fx16,
+                                            test_4_cfg, thresholds_fx16_general, test_4_chksum_fx16},
+    {"Test 12 FX16_FX8_FX8 Plan IO_Memstr", mli_krn_conv2d_hwcn_fx16_fx8_fx8_planned,
+                                            input_1_memstr_fx16, weights_1_fx8, bias_1_fx8, test_4_out_fx16,
+                                            test_4_cfg, thresholds_fx16_fx8_fx8_test4, test_4_chksum_fx16_fx8_fx8},
+    {"Test 12 SA8_SA8_SA32 Plan IO_Memstr", mli_krn_conv2d_hwcn_sa8_sa8_sa32_planned,
+                                            input_1_memstr_sa8, weights_1_sa8, bias_1_sa32, test_4_out_sa8,
+                                            test_4_cfg, thresholds_sa8_general, test_4_chksum_sa8},
+    {"Test 13 SA8_SA8_SA32 Plan ReluGen",   mli_krn_conv2d_hwcn_sa8_sa8_sa32_planned,
+                                            input_1_sa8, weights_2_sa8, bias_1_w2_per_tensor_sa32, test_2_out_sa8,
+                                            test_2_cfg, thresholds_sa8_general, test_2_chksum_sa8},
+
+    // Threaded convolution (same operands and checksums as in tests 9-1 and 7)
+    {"Test 14 FX16 Threads Dil+Pad",        mli_krn_conv2d_hwcn_fx16_threads,
+                                            input_1_fx16, weights_4_memstr_fx16, bias_1_fx16, test_9_out_fx16,
+                                            test_9_cfg, thresholds_fx16_general, test_9_chksum_fx16},
+    {"Test 14 SA8_SA8_SA32 k3x3 Threads",   mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3_threads,
+                                            input_1_sa8, weights_4_memstr_sa8, bias_1_w4_sa32, test_7_out_sa8,
+                                            test_7_cfg, thresholds_sa8_general, test_7_chksum_sa8},
+
+    // Batch of two items in rank-4 tensors (same operands and checksums as in tests 9-1 and 7)
+    {"Test 15 FX16 Batch Threads Dil+Pad",  mli_krn_conv2d_hwcn_fx16_batch_threads,
+                                            input_1_fx16, weights_4_memstr_fx16, bias_1_fx16, test_9_out_fx16,
+                                            test_9_cfg, thresholds_fx16_general, test_9_chksum_fx16},
+    {"Test 15 SA8_SA8_SA32 k3x3 Batch",     mli_krn_conv2d_hwcn_sa8_sa8_sa32_k3x3_batch,
+                                            input_1_sa8, weights_4_memstr_sa8, bias_1_w4_sa32, test_7_out_sa8,
+                                            test_7_cfg, thresholds_sa8_general, test_7_chksum_sa8},
 };
 
 constexpr int kMemSize = 2247;
@@ -281,7 +383,11 @@ int main() {
                 strstr(cur_test->descr, "Test 10 FX16 k5x5 Dil") != nullptr ||
                 strstr(cur_test->descr, "Test 10 SA8_SA8_SA32 k5x5 Dil") != nullptr || 
                 strstr(cur_test->descr, "Test 11 FX16 Huge Vals") != nullptr ||
-                strstr(cur_test->descr, "Test 11 SA8_SA8_SA32 Huge Vals") != nullptr) {
+                strstr(cur_test->descr, "Test 11 SA8_SA8_SA32 Huge Vals") != nullptr ||
+                strstr(cur_test->descr, "Test 12 SA8_SA8_SA32 Plan") != nullptr ||
+                strstr(cur_test->descr, "Test 13 SA8_SA8_SA32 Plan") != nullptr ||
+                strstr(cur_test->descr, "Test 14 SA8_SA8_SA32 k3x3 Threads") != nullptr ||
+                strstr(cur_test->descr, "Test 15 SA8_SA8_SA32 k3x3 Batch") != nullptr) {
             // VPX fails bitwise comparison with reference .
             reporter.report_message(cur_test->descr, "SKIPPED due to a known issue");
             continue;
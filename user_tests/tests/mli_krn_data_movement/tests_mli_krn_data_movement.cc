@@ -168,6 +168,131 @@ static const data_movement_test_operands tests_list[] = {
 
 };
 
+// Asynchronous flavour of mli_mov_tensor_sync: the transfer is started on a channel acquired
+// from the pool and completion is observed through both the callback and mli_mov_wait().
+static int32_t async_done_cookie = -1;
+static void async_done_cb(int32_t cookie) {
+    async_done_cookie = cookie;
+}
+
+static mli_status mli_mov_tensor_async(const mli_tensor* src, const mli_mov_cfg_t* cfg, mli_tensor* dst) {
+    constexpr int32_t kCookie = 0x5A;
+    mli_mov_handle_t h = {0};
+    async_done_cookie = -1;
+    mli_status retval = mli_mov_acquire_handle(1, &h);
+    if (retval == MLI_STATUS_OK)
+        retval = mli_mov_prepare(&h, src, cfg, dst);
+    if (retval == MLI_STATUS_OK)
+        retval = mli_mov_registercallback(&h, async_done_cb, kCookie);
+    if (retval == MLI_STATUS_OK)
+        retval = mli_mov_start(&h, src, cfg, dst);
+    if (retval == MLI_STATUS_OK)
+        retval = mli_mov_wait(&h);
+    if (retval == MLI_STATUS_OK && (!mli_mov_isdone(&h) || async_done_cookie != kCookie))
+        retval = MLI_STATUS_SPEC_PARAM_MISMATCH;
+    // the callback table is per channel, so unregister it for the next user of the channel.
+    mli_mov_registercallback(&h, NULL, 0);
+    mli_mov_release_handle(&h);
+    return retval;
+}
+
+// Chain flavour: src is copied into an intermediate tensor and from there into dst with the test cfg.
+// Both transfers run back-to-back on one handle, and the prepared chain is started twice.
+constexpr int kChainMemSize = 1024;
+constexpr int kChainScratchSize = 2048;
+alignas(8) static int8_t chain_mem[kChainMemSize] = { 0 };
+alignas(8) static int8_t chain_scratch[kChainScratchSize] = { 0 };
+
+static mli_status mli_mov_tensor_chain(const mli_tensor* src, const mli_mov_cfg_t* cfg, mli_tensor* dst) {
+    constexpr int32_t kCookie = 0x3C;
+    constexpr int kStarts = 2;
+    mli_tensor tmp = *src;
+    tmp.data.mem.pi8 = chain_scratch;
+    tmp.data.capacity = sizeof(chain_scratch);
+    for (int i = 0; i < MLI_MAX_RANK; i++) tmp.mem_stride[i] = 0;
+    mli_mov_cfg_t copy_cfg;
+    mli_mov_cfg_for_copy(&copy_cfg);
+
+    const mli_mov_chain_desc_t desc[] = {{src, &copy_cfg, &tmp}, {&tmp, cfg, dst}};
+    mli_mov_chain_t chain = {chain_mem, sizeof(chain_mem), 0};
+    mli_mov_handle_t h = {0};
+    mli_status retval = mli_mov_chain_prepare(&chain, desc, sizeof(desc) / sizeof(desc[0]));
+    if (retval == MLI_STATUS_OK)
+        retval = mli_mov_acquire_handle(1, &h);
+    if (retval == MLI_STATUS_OK)
+        retval = mli_mov_registercallback(&h, async_done_cb, kCookie);
+    for (int start = 0; start < kStarts && retval == MLI_STATUS_OK; start++) {
+        async_done_cookie = -1;
+        memset(chain_scratch, 0, sizeof(chain_scratch));
+        retval = mli_mov_chain_start(&h, &chain);
+        if (retval == MLI_STATUS_OK)
+            retval = mli_mov_wait(&h);
+        if (retval == MLI_STATUS_OK && async_done_cookie != kCookie)
+            retval = MLI_STATUS_SPEC_PARAM_MISMATCH;
+    }
+    mli_mov_registercallback(&h, NULL, 0);
+    mli_mov_release_handle(&h);
+    return retval;
+}
+
+// Context flavour: the transfer is done on a channel of a separate context while the only channel
+// of the default context is taken. Callbacks registered in the default context must not be called.
+static mli_context test_ctx;
+static mli_status mli_mov_tensor_ctx(const mli_tensor* src, const mli_mov_cfg_t* cfg, mli_tensor* dst) {
+    constexpr int32_t kCookie = 0x69;
+    constexpr int32_t kDefaultCookie = 0x11;
+    mli_mov_handle_t busy_h = {0};
+    mli_mov_handle_t h = {0};
+    async_done_cookie = -1;
+    mli_status retval = mli_mov_acquire_handle(1, &busy_h);
+    if (retval == MLI_STATUS_OK)
+        retval = mli_mov_registercallback(&busy_h, async_done_cb, kDefaultCookie);
+    if (retval == MLI_STATUS_OK)
+        retval = mli_mov_acquire_handle_ctx(&test_ctx, 1, &h);
+    if (retval == MLI_STATUS_OK)
+        retval = mli_mov_prepare(&h, src, cfg, dst);
+    if (retval == MLI_STATUS_OK)
+        retval = mli_mov_registercallback(&h, async_done_cb, kCookie);
+    if (retval == MLI_STATUS_OK)
+        retval = mli_mov_start(&h, src, cfg, dst);
+    if (retval == MLI_STATUS_OK)
+        retval = mli_mov_wait(&h);
+    if (retval == MLI_STATUS_OK && async_done_cookie != kCookie)
+        retval = MLI_STATUS_SPEC_PARAM_MISMATCH;
+    mli_mov_registercallback(&h, NULL, 0);
+    mli_mov_release_handle(&h);
+    mli_mov_registercallback(&busy_h, NULL, 0);
+    mli_mov_release_handle(&busy_h);
+    return retval;
+}
+
+// Dma channels are assigned to one context at most: pools overlapping the pool of another context
+// (default one included) are rejected, and a new pool of a context frees channels of the previous one.
+// Expects channel 0 in the default context and channel 1 in test_ctx.
+static bool check_dma_ch_assignment() {
+    mli_context other_ctx;
+    mli_mov_handle_t h = {0};
+    bool is_passed = (mli_context_init(&other_ctx) == MLI_STATUS_OK);
+    is_passed &= (mli_mov_set_num_dma_ch_ctx(&other_ctx, 0, 2) == MLI_STATUS_BAD_FUNC_CFG);
+    is_passed &= (mli_mov_set_num_dma_ch_ctx(&other_ctx, 2, 2) == MLI_STATUS_OK);
+    is_passed &= (mli_mov_set_num_dma_ch_ctx(&test_ctx, 3, 1) == MLI_STATUS_BAD_FUNC_CFG);
+    is_passed &= (mli_mov_set_num_dma_ch(2, 1) == MLI_STATUS_BAD_FUNC_CFG);
+
+    // pool can't be changed while one of its channels is acquired
+    is_passed &= (mli_mov_acquire_handle_ctx(&other_ctx, 2, &h) == MLI_STATUS_OK) && (h.dma_ch == 2);
+    is_passed &= (mli_mov_set_num_dma_ch_ctx(&other_ctx, 4, 1) == MLI_STATUS_BAD_FUNC_CFG);
+    mli_mov_release_handle(&h);
+
+    // empty pool frees the channels, and channels of the previous pool are not available any more
+    is_passed &= (mli_mov_set_num_dma_ch_ctx(&other_ctx, 0, 0) == MLI_STATUS_OK);
+    is_passed &= (mli_mov_set_num_dma_ch_ctx(&test_ctx, 3, 1) == MLI_STATUS_OK);
+    is_passed &= (mli_mov_acquire_handle_ctx(&test_ctx, 2, &h) != MLI_STATUS_OK);
+    is_passed &= (mli_mov_acquire_handle_ctx(&test_ctx, 1, &h) == MLI_STATUS_OK) && (h.dma_ch == 3);
+    mli_mov_release_handle(&h);
+    is_passed &= (mli_mov_set_num_dma_ch_ctx(&test_ctx, 1, 1) == MLI_STATUS_OK);
+    return is_passed;
+}
+
 constexpr int kMemSize = 2048;
 static int8_t scratch_mem_in_outside[kMemSize]  = { 0 };
 static IO_DATA_ATTR int8_t scratch_mem_in_inside[kMemSize] = { 0 };
@@ -181,7 +306,19 @@ int main() {
     bool final_status = true;
 
     reporter.report_header("MLI|Kernels|Data Movement Functions Tests");
-    for (int i = 0; i < kTestsNum; ++i) {
+    mli_mov_set_num_dma_ch(0, 1);
+    mli_context_init(&test_ctx);
+    mli_mov_set_num_dma_ch_ctx(&test_ctx, 1, 1);
+    // All cases are repeated through the asynchronous API, as a chain and in a separate context;
+    // results must be identical.
+    const mov_tensor_sync_ptr pass_funcs[] = {nullptr, mli_mov_tensor_async, mli_mov_tensor_chain,
+                                              mli_mov_tensor_ctx};
+    const char* pass_suffix[] = {"", " Async", " Chain", " Ctx"};
+    constexpr int kPassesNum = sizeof(pass_funcs) / sizeof(pass_funcs[0]);
+    for (int test_idx = 0; test_idx < kPassesNum * kTestsNum; ++test_idx) {
+        const int i = test_idx % kTestsNum;
+        const int pass = test_idx / kTestsNum;
+        char pass_descr[64];
 
         memory_manager mem_in_keeper(mem[i].in_mem == CCM_MEM ? (int8_t*)scratch_mem_in_inside : (int8_t*)scratch_mem_in_outside,
                 mem[i].in_mem == CCM_MEM ? sizeof(scratch_mem_in_inside) : sizeof(scratch_mem_in_outside));
@@ -190,11 +327,18 @@ int main() {
 
         bool is_test_passed = true;
         const data_movement_test_operands* cur_test = &tests_list[i];
+        const char* descr = cur_test->descr;
+        mov_tensor_sync_ptr mov_func = cur_test->mli_krn_data_movement;
+        if (pass_funcs[pass] != nullptr) {
+            snprintf(pass_descr, sizeof(pass_descr), "%s%s", cur_test->descr, pass_suffix[pass]);
+            descr = pass_descr;
+            mov_func = pass_funcs[pass];
+        }
         quality_metrics test_metics;
 
         if (!(cur_test->in.is_valid() && cur_test->out.is_valid())) {
 
-            reporter.report_message(cur_test->descr, "FAILED at init: bad source data for one of tensors");
+            reporter.report_message(descr, "FAILED at init: bad source data for one of tensors");
             is_test_passed = false;
         }
 
@@ -211,7 +355,7 @@ int main() {
                 (tensor_quantizer::validate_tensor(input) != tensor_quantizer::kOk ||
                  tensor_quantizer::validate_tensor(out) != tensor_quantizer::kOk)) {
 
-            reporter.report_message(cur_test->descr,
+            reporter.report_message(descr,
                                     "FAILED at quantization step: more memory for one of tensors might be required");
             is_test_passed = false;
         }
@@ -219,7 +363,7 @@ int main() {
         if (is_test_passed &&
                 (mem_in_keeper.is_memory_corrupted() ||
                  mem_out_keeper.is_memory_corrupted())) {
-            reporter.report_message(cur_test->descr,
+            reporter.report_message(descr,
                 "FAILED at quantization step: memory beside one of operands is corrupted");
             is_test_passed = false;
         }
@@ -228,25 +372,25 @@ int main() {
         mli_mov_cfg_all(&cfg,offsets_cfg[i],sizes_cfg[i],sub_sample[i],out_offsets_cfg[i],out_mem_stride_cfg[i],
                 perm_dim[i],padd_left[i],padd_right[i],padd_top[i],padd_bottom[i]);
         // Run specific kernel for test
-        mli_status stat = cur_test->mli_krn_data_movement(&input,&cfg, &out);
+        mli_status stat = mov_func(&input,&cfg, &out);
 
         if (is_test_passed &&
                 stat != MLI_STATUS_OK) {
-            reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
+            reporter.report_message(descr, "FAILED at kernel run: kernel returned bad status");
             is_test_passed = false;
         }
 
         if (is_test_passed &&
                 (mem_in_keeper.is_memory_corrupted() ||
                  mem_out_keeper.is_memory_corrupted())) {
-            reporter.report_message(cur_test->descr,
+            reporter.report_message(descr,
                 "FAILED after kernel run: memory beside one of operands is corrupted");
             is_test_passed = false;
         }
 
         if (is_test_passed &&
                 test_metics.calculate_metrics(out, cur_test->out) == false) {
-            reporter.report_message(cur_test->descr, "FAILED at comparison output with reference");
+            reporter.report_message(descr, "FAILED at comparison output with reference");
             is_test_passed = false;
         }
 
@@ -273,7 +417,7 @@ int main() {
                 }
             }
             if (!is_test_passed) {
-                reporter.report_message(cur_test->descr,
+                reporter.report_message(descr,
                     is_per_tensor_quant ? "FAILED as element params of output tensor was modified"
                                         : "FAILED as per-axis quantization of output tensor isn't supported");
             }
@@ -283,7 +427,7 @@ int main() {
             crc32_calc data_crc;
             data_crc(input);
             data_crc(out);
-            is_test_passed &= reporter.evaluate_and_report_case(cur_test->descr, test_metics, cur_test->threshold,
+            is_test_passed &= reporter.evaluate_and_report_case(descr, test_metics, cur_test->threshold,
                                                                 data_crc, cur_test->check_sum);
 
         }
@@ -291,6 +435,11 @@ int main() {
         final_status &= (is_test_passed);
     }
 
+    if (!check_dma_ch_assignment()) {
+        reporter.report_message("Test DMA channels assignment", "FAILED at check of channels shared by contexts");
+        final_status = false;
+    }
+
     reporter.report_outline("[AUTO] Group: Data Movement", final_status);
 
     return (final_status) ? 0 : 1;
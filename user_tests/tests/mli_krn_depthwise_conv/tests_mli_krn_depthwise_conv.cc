@@ -37,6 +37,50 @@ typedef mli_status(*depthwise_conv_func_ptr)(
     const mli_conv2d_cfg* /*cfg*/,
     mli_tensor* /*output*/);
 
+// Planned versions of kernels: state of the kernel is derived once by prepare function
+// and reused by run function for data of tensors. Results must be bit exact with non planned kernels.
+static mli_status mli_krn_depthwise_conv2d_hwcn_fx16_planned(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_conv2d_plan plan;
+    mli_status ret = mli_krn_depthwise_conv2d_hwcn_fx16_prepare(in, weights, bias, cfg, out, &plan);
+    if (ret != MLI_STATUS_OK) return ret;
+    return mli_krn_conv2d_run(&plan, in->data.mem.pi8, out->data.mem.pi8);
+}
+
+static mli_status mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_planned(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_conv2d_plan plan;
+    mli_status ret = mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_prepare(in, weights, bias, cfg, out, &plan);
+    if (ret != MLI_STATUS_OK) return ret;
+    return mli_krn_conv2d_run(&plan, in->data.mem.pi8, out->data.mem.pi8);
+}
+
+static mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_planned(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_conv2d_plan plan;
+    mli_status ret = mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_prepare(in, weights, bias, cfg, out, &plan);
+    if (ret != MLI_STATUS_OK) return ret;
+    return mli_krn_conv2d_run(&plan, in->data.mem.pi8, out->data.mem.pi8);
+}
+
+// Threaded versions of kernels: output area is split between threads of the pool.
+// Results must be bit exact with single-threaded kernels. Builds without threads run them in the calling thread.
+static mli_status mli_krn_depthwise_conv2d_hwcn_fx16_threads(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_hlp_set_num_threads(3);
+    mli_status ret = mli_krn_depthwise_conv2d_hwcn_fx16(in, weights, bias, cfg, out);
+    mli_hlp_set_num_threads(1);
+    return ret;
+}
+
+static mli_status mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k3x3_threads(const mli_tensor* in,
+        const mli_tensor* weights, const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_hlp_set_num_threads(7);
+    mli_status ret = mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k3x3(in, weights, bias, cfg, out);
+    mli_hlp_set_num_threads(1);
+    return ret;
+}
+
 struct depthwise_conv_test_operands {
     const char* descr;
     const depthwise_conv_func_ptr mli_krn_depthwise_conv;
@@ -224,6 +268,24 @@ static const depthwise_conv_test_operands tests_list[] = {
                                        input_2_sa8, weights_5_sa8, bias_3_i2_w5_sa32, test_10_out_sa8, 
                                        test_10_cfg, thresholds_sa8_general, test_10_chksum_sa8},
 
+    // Planned depthwise convolution (same operands and checksums as in test 4)
+    {"Test 11 FX16 Plan Relu1 Mstr",         mli_krn_depthwise_conv2d_hwcn_fx16_planned,
+                                             input_1b_memstr_fx16, weights_1_fx16, bias_1_fx16, test_4_out_fx16,
+                                             test_4_cfg, thresholds_fx16_general, test_4_chksum_fx16},
+    {"Test 11 FX16_FX8_FX8 Plan Relu1 Mstr", mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8_planned,
+                                             input_1b_memstr_fx16, weights_1_fx8, bias_1_fx8, test_4_out_fx16,
+                                             test_4_cfg, thresholds_fx16_fx8_fx8_general, test_4_chksum_fx16_fx8_fx8},
+    {"Test 11 SA8_SA8_SA32 Plan Relu1 Mstr", mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_planned,
+                                             input_1b_memstr_sa8, weights_1_sa8_per_axis, bias_1_sa32_per_axis,
+                                             test_4_out_sa8, test_4_cfg, thresholds_sa8_general, test_4_chksum_sa8},
+
+    // Threaded depthwise convolution (same operands and checksums as in tests 2 and 6)
+    {"Test 12 FX16 Threads ReluGen",         mli_krn_depthwise_conv2d_hwcn_fx16_threads,
+                                             input_1_fx16, weights_2_fx16, bias_2_fx16, test_2_out_fx16,
+                                             test_2_cfg, thresholds_fx16_general, test_2_chksum_fx16},
+    {"Test 12 SA8_SA8_SA32 k3x3 Threads",    mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_k3x3_threads,
+                                             input_1_memstr_sa8, weights_3_sa8_per_axis, bias_2_i1_w3_sa32_per_axis,
+                                             test_6_out_sa8, test_6_cfg, thresholds_sa8_general, test_6_chksum_sa8},
 };
 
 constexpr int kMemSize = 2047;
@@ -259,7 +321,9 @@ int main() {
                 strstr(cur_test->descr, "Test 8-1 SA8") != nullptr ||
                 strstr(cur_test->descr, "Test 8-2 SA8") != nullptr ||
                 strstr(cur_test->descr, "Test 9 SA8_SA8_SA32 k5x5 Dil") != nullptr ||
-                strstr(cur_test->descr, "Test 10 SA8_SA8_SA32 Huge Vals") != nullptr) {
+                strstr(cur_test->descr, "Test 10 SA8_SA8_SA32 Huge Vals") != nullptr ||
+                strstr(cur_test->descr, "Test 11 SA8_SA8_SA32 Plan") != nullptr ||
+                strstr(cur_test->descr, "Test 12 SA8_SA8_SA32 k3x3 Threads") != nullptr) {
             // VPX fails bitwise comparison with reference .
             reporter.report_message(cur_test->descr, "SKIPPED due to a known issue");
             continue;
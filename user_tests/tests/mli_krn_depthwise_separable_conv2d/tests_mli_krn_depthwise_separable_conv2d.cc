@@ -0,0 +1,230 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_api.h"
+#include "mli_config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mli_types.h"
+#include "test_report.h"
+#include "test_tensor_utils.h"
+
+using mli::tst::data_generator;
+using mli::tst::make_tensor;
+using mli::tst::reporter_basic;
+using mli::tst::set_sa_params;
+
+// Fused depthwise separable convolution must be bit exact with depthwise convolution
+// followed by pointwise convolution with a full-size intermediate tensor.
+constexpr uint32_t kH = 9, kW = 7, kC = 4, kOutC = 6;
+constexpr uint32_t kFmapSize = kH * kW * kOutC;
+constexpr uint32_t kMidSize = kH * kW * kC;
+
+static int8_t in_sa8[kH * kW * kC];
+static int16_t in_fx16[kH * kW * kC];
+static int8_t dw_w_8[3 * 3 * kC];
+static int16_t dw_w_16[3 * 3 * kC];
+static int8_t dw_b_8[kC];
+static int16_t dw_b_16[kC];
+static int32_t dw_b_32[kC];
+static int8_t pw_w_8[kC * kOutC];
+static int16_t pw_w_16[kC * kOutC];
+static int8_t pw_b_8[kOutC];
+static int16_t pw_b_16[kOutC];
+static int32_t pw_b_32[kOutC];
+
+static int16_t mid_mem[kMidSize];
+static int16_t scratch_mem[kMidSize];
+static int16_t ref_mem[kFmapSize];
+static int16_t fused_mem[kFmapSize];
+
+enum data_type { kSa8, kFx16, kFx16Fx8 };
+
+struct test_case {
+    const char* name;
+    data_type type;
+    mli_conv2d_cfg dw_cfg;
+    mli_relu_type pw_relu;
+    uint32_t scratch_rows;
+};
+
+static void init_data() {
+    data_generator gen(1234);
+    gen.fill(in_sa8, 100);
+    gen.fill(in_fx16, 1500);
+    gen.fill(dw_w_8, 100);
+    gen.fill(dw_w_16, 600);
+    gen.fill(dw_b_8, 60);
+    gen.fill(dw_b_16, 2000);
+    gen.fill(dw_b_32, 3000);
+    gen.fill(pw_w_8, 60);
+    gen.fill(pw_w_16, 600);
+    gen.fill(pw_b_8, 60);
+    gen.fill(pw_b_16, 2000);
+    gen.fill(pw_b_32, 3000);
+}
+
+// Tensors of both parts of the block. Element parameters of mid are the ones of cfg.mid_el_params.
+struct block_tensors {
+    mli_tensor in;
+    mli_tensor dw_weights;
+    mli_tensor dw_bias;
+    mli_tensor pw_weights;
+    mli_tensor pw_bias;
+    mli_tensor mid;
+    mli_tensor out;
+};
+
+static block_tensors make_block(data_type type, const mli_conv2d_cfg& dw_cfg, void* out_mem) {
+    static const uint32_t in_shape[] = {kH, kW, kC};
+    static const uint32_t dw_w_shape[] = {3, 3, 1, kC};
+    static const uint32_t dw_b_shape[] = {kC};
+    static const uint32_t pw_w_shape[] = {1, 1, kC, kOutC};
+    static const uint32_t pw_b_shape[] = {kOutC};
+    const uint32_t eff_kh = 2 * dw_cfg.dilation_height + 1;
+    const uint32_t eff_kw = 2 * dw_cfg.dilation_width + 1;
+    const uint32_t out_h = (kH + dw_cfg.padding_top + dw_cfg.padding_bottom - eff_kh) / dw_cfg.stride_height + 1;
+    const uint32_t out_w = (kW + dw_cfg.padding_left + dw_cfg.padding_right - eff_kw) / dw_cfg.stride_width + 1;
+    const uint32_t mid_shape[] = {out_h, out_w, kC};
+    const uint32_t out_shape[] = {out_h, out_w, kOutC};
+
+    block_tensors t;
+    if (type == kSa8) {
+        t.in = make_tensor(in_sa8, sizeof(in_sa8), MLI_EL_SA_8, 3, in_shape);
+        t.dw_weights = make_tensor(dw_w_8, sizeof(dw_w_8), MLI_EL_SA_8, 4, dw_w_shape);
+        t.dw_bias = make_tensor(dw_b_32, sizeof(dw_b_32), MLI_EL_SA_32, 1, dw_b_shape);
+        t.pw_weights = make_tensor(pw_w_8, sizeof(pw_w_8), MLI_EL_SA_8, 4, pw_w_shape);
+        t.pw_bias = make_tensor(pw_b_32, sizeof(pw_b_32), MLI_EL_SA_32, 1, pw_b_shape);
+        t.mid = make_tensor(mid_mem, kMidSize, MLI_EL_SA_8, 3, mid_shape);
+        t.out = make_tensor(out_mem, kFmapSize, MLI_EL_SA_8, 3, out_shape);
+        set_sa_params(&t.in.el_params, -3, 16384, 16);
+        set_sa_params(&t.dw_weights.el_params, 0, 16384, 19);
+        set_sa_params(&t.dw_bias.el_params, 0, 16384, 21);
+        set_sa_params(&t.mid.el_params, 5, 16384, 15);
+        set_sa_params(&t.pw_weights.el_params, 0, 16384, 20);
+        set_sa_params(&t.pw_bias.el_params, 0, 16384, 21);
+        set_sa_params(&t.out.el_params, -10, 16384, 14);
+    } else {
+        const bool is_fx8 = (type == kFx16Fx8);
+        const mli_element_type w_type = is_fx8 ? MLI_EL_FX_8 : MLI_EL_FX_16;
+        t.in = make_tensor(in_fx16, sizeof(in_fx16), MLI_EL_FX_16, 3, in_shape);
+        t.dw_weights = is_fx8 ? make_tensor(dw_w_8, sizeof(dw_w_8), w_type, 4, dw_w_shape)
+                              : make_tensor(dw_w_16, sizeof(dw_w_16), w_type, 4, dw_w_shape);
+        t.dw_bias = is_fx8 ? make_tensor(dw_b_8, sizeof(dw_b_8), w_type, 1, dw_b_shape)
+                           : make_tensor(dw_b_16, sizeof(dw_b_16), w_type, 1, dw_b_shape);
+        t.pw_weights = is_fx8 ? make_tensor(pw_w_8, sizeof(pw_w_8), w_type, 4, pw_w_shape)
+                              : make_tensor(pw_w_16, sizeof(pw_w_16), w_type, 4, pw_w_shape);
+        t.pw_bias = is_fx8 ? make_tensor(pw_b_8, sizeof(pw_b_8), w_type, 1, pw_b_shape)
+                           : make_tensor(pw_b_16, sizeof(pw_b_16), w_type, 1, pw_b_shape);
+        t.mid = make_tensor(mid_mem, sizeof(mid_mem), MLI_EL_FX_16, 3, mid_shape);
+        t.out = make_tensor(out_mem, sizeof(fused_mem), MLI_EL_FX_16, 3, out_shape);
+        t.in.el_params.fx.frac_bits = 10;
+        t.dw_weights.el_params.fx.frac_bits = is_fx8 ? 6 : 12;
+        t.dw_bias.el_params.fx.frac_bits = is_fx8 ? 5 : 12;
+        t.mid.el_params.fx.frac_bits = 9;
+        t.pw_weights.el_params.fx.frac_bits = is_fx8 ? 6 : 12;
+        t.pw_bias.el_params.fx.frac_bits = is_fx8 ? 5 : 12;
+        t.out.el_params.fx.frac_bits = 8;
+    }
+    return t;
+}
+
+static mli_status run_reference(data_type type, const mli_conv2d_cfg& dw_cfg, const mli_conv2d_cfg& pw_cfg,
+                                 block_tensors* t) {
+    mli_status ret;
+    if (type == kSa8) {
+        ret = mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32(&t->in, &t->dw_weights, &t->dw_bias, &dw_cfg, &t->mid);
+        if (ret == MLI_STATUS_OK)
+            ret = mli_krn_conv2d_hwcn_sa8_sa8_sa32(&t->mid, &t->pw_weights, &t->pw_bias, &pw_cfg, &t->out);
+    } else if (type == kFx16) {
+        ret = mli_krn_depthwise_conv2d_hwcn_fx16(&t->in, &t->dw_weights, &t->dw_bias, &dw_cfg, &t->mid);
+        if (ret == MLI_STATUS_OK)
+            ret = mli_krn_conv2d_hwcn_fx16(&t->mid, &t->pw_weights, &t->pw_bias, &pw_cfg, &t->out);
+    } else {
+        ret = mli_krn_depthwise_conv2d_hwcn_fx16_fx8_fx8(&t->in, &t->dw_weights, &t->dw_bias, &dw_cfg, &t->mid);
+        if (ret == MLI_STATUS_OK)
+            ret = mli_krn_conv2d_hwcn_fx16_fx8_fx8(&t->mid, &t->pw_weights, &t->pw_bias, &pw_cfg, &t->out);
+    }
+    return ret;
+}
+
+static mli_status run_fused(data_type type, const mli_dw_separable_conv2d_cfg& cfg, block_tensors* t) {
+    if (type == kSa8)
+        return mli_krn_depthwise_separable_conv2d_hwcn_sa8_sa8_sa32(&t->in, &t->dw_weights, &t->dw_bias,
+                                                                   &t->pw_weights, &t->pw_bias, &cfg, &t->out);
+    if (type == kFx16)
+        return mli_krn_depthwise_separable_conv2d_hwcn_fx16(&t->in, &t->dw_weights, &t->dw_bias,
+                                                           &t->pw_weights, &t->pw_bias, &cfg, &t->out);
+    return mli_krn_depthwise_separable_conv2d_hwcn_fx16_fx8_fx8(&t->in, &t->dw_weights, &t->dw_bias,
+                                                               &t->pw_weights, &t->pw_bias, &cfg, &t->out);
+}
+
+static bool run_case(const test_case& c) {
+    memset(mid_mem, 0, sizeof(mid_mem));
+    memset(ref_mem, 0x55, sizeof(ref_mem));
+    memset(fused_mem, 0x33, sizeof(fused_mem));
+    memset(scratch_mem, 0x77, sizeof(scratch_mem));
+
+    mli_conv2d_cfg pw_cfg;
+    memset(&pw_cfg, 0, sizeof(pw_cfg));
+    pw_cfg.relu.type = c.pw_relu;
+    pw_cfg.stride_width = pw_cfg.stride_height = 1;
+    pw_cfg.dilation_width = pw_cfg.dilation_height = 1;
+
+    block_tensors ref = make_block(c.type, c.dw_cfg, ref_mem);
+    if (run_reference(c.type, c.dw_cfg, pw_cfg, &ref) != MLI_STATUS_OK)
+        return false;
+
+    block_tensors fused = make_block(c.type, c.dw_cfg, fused_mem);
+    mli_dw_separable_conv2d_cfg cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.dw_cfg = c.dw_cfg;
+    cfg.pw_relu.type = c.pw_relu;
+    cfg.mid_el_params = fused.mid.el_params;
+    cfg.scratch_data.mem.pi16 = scratch_mem;
+    cfg.scratch_data.capacity = c.scratch_rows *
+            mli_krn_depthwise_separable_conv2d_get_scratch_size(&fused.in, &fused.dw_weights, &fused.out);
+    if (cfg.scratch_data.capacity > sizeof(scratch_mem) || run_fused(c.type, cfg, &fused) != MLI_STATUS_OK)
+        return false;
+
+    const uint32_t size = mli_hlp_count_elem_num(&ref.out, 0) * mli_hlp_tensor_element_size(&ref.out);
+    return memcmp(ref_mem, fused_mem, size) == 0;
+}
+
+int main() {
+    const reporter_basic reporter;
+    bool final_status = true;
+
+    reporter.report_header("MLI|Kernels|Depthwise Separable Convolution Tests");
+    init_data();
+
+    // dw_cfg fields: relu, strides (w, h), paddings (left, right, top, bottom), dilations (w, h)
+    const test_case cases[] = {
+        {"Test 1 SA8 Single Row", kSa8, {{MLI_RELU_NONE, 0, 0}, 1, 1, 1, 1, 1, 1, 1, 1}, MLI_RELU_NONE, 1},
+        {"Test 2 SA8 Stride 2 ReLU", kSa8, {{MLI_RELU_GEN, 0, 0}, 2, 2, 1, 0, 1, 0, 1, 1}, MLI_RELU_6, 3},
+        {"Test 3 SA8 Whole Map", kSa8, {{MLI_RELU_6, 0, 0}, 1, 1, 0, 0, 0, 0, 1, 1}, MLI_RELU_GEN, kH},
+        {"Test 4 FX16 Dilation 2", kFx16, {{MLI_RELU_NONE, 0, 0}, 1, 1, 2, 2, 2, 2, 2, 2}, MLI_RELU_NONE, 2},
+        {"Test 5 FX16 Stride 2", kFx16, {{MLI_RELU_GEN, 0, 0}, 2, 2, 1, 1, 1, 1, 1, 1}, MLI_RELU_1, 1},
+        {"Test 6 FX16_FX8_FX8 Rows 4", kFx16Fx8, {{MLI_RELU_NONE, 0, 0}, 1, 2, 1, 1, 1, 1, 1, 1}, MLI_RELU_GEN, 4},
+    };
+
+    for (const test_case& c : cases) {
+        const bool is_test_passed = run_case(c);
+        reporter.report_case(c.name, is_test_passed ? "" : "FAILED: result differs from separate kernels",
+                             is_test_passed);
+        final_status &= is_test_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_krn_depthwise_separable_conv2d", final_status);
+
+    return (final_status) ? 0 : 1;
+}
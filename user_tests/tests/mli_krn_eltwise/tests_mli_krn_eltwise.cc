@@ -34,6 +34,22 @@ typedef mli_status(*eltwise_func_ptr)(
     const mli_tensor* /*in2*/,
     mli_tensor* /*out*/);
 
+// Planned versions of sa8 kernels: requantization parameters are derived once by prepare function
+// and reused by run function. Results must be bit exact with non planned kernels.
+static mli_status mli_krn_eltwise_add_sa8_planned(const mli_tensor* in1, const mli_tensor* in2, mli_tensor* out) {
+    mli_eltwise_plan plan;
+    mli_status ret = mli_krn_eltwise_add_sa8_prepare(in1, in2, out, &plan);
+    if (ret != MLI_STATUS_OK) return ret;
+    return mli_krn_eltwise_sa8_run(&plan, in1, in2, out);
+}
+
+static mli_status mli_krn_eltwise_sub_sa8_planned(const mli_tensor* in1, const mli_tensor* in2, mli_tensor* out) {
+    mli_eltwise_plan plan;
+    mli_status ret = mli_krn_eltwise_sub_sa8_prepare(in1, in2, out, &plan);
+    if (ret != MLI_STATUS_OK) return ret;
+    return mli_krn_eltwise_sa8_run(&plan, in1, in2, out);
+}
+
 struct eltwise_test_operands {
     const char* descr;
     const eltwise_func_ptr mli_krn_eltwise;
@@ -60,17 +76,22 @@ const crc32_calc                                    test_1_chksum_sa8{ 0x8BF4D95
                   test_8_chksum_fx16{ 0x68889D84 }, test_8_chksum_sa8{ 0x2D86F301 },
                   test_9_chksum_fx16{ 0x9417F3D7 }, test_9_chksum_sa8{ 0x351016DF },
                   test_10_chksum_fx16{ 0xD728E430 }, test_10_chksum_sa8{ 0xDC1A832D },
-                  test_11_chksum_fx16{ 0xBF03F2E0 }, test_11_chksum_sa8{ 0xD36B7E94 };
+                  test_11_chksum_fx16{ 0xBF03F2E0 }, test_11_chksum_sa8{ 0xD36B7E94 },
+                                                    test_12_chksum_sa8{ 0xD64E0AB7 },
+                  test_13_chksum_fx16{ 0xC9C48767 }, test_13_chksum_sa8{ 0x7D71B96A },
+                                                    test_14_chksum_sa8{ 0xE1A18E3F };
 
 // Platform Specific CRC Results
 #if defined(CRC_RM_UP)
 const crc32_calc test_1_chksum_fx16{ 0xAC3BE4B7 }, test_2_chksum_fx16{ 0x170065BD },
                  test_3_chksum_fx16{ 0x1E1FA5DD }, test_4_chksum_fx16{ 0xE27C401E },
-                 test_5_chksum_fx16{ 0x1a678d57 };
+                 test_5_chksum_fx16{ 0x1a678d57 }, test_12_chksum_fx16{ 0x78F7CB28 },
+                 test_14_chksum_fx16{ 0xCFB615A2 };
 #else
 const crc32_calc test_1_chksum_fx16{ 0x5C7970C5 }, test_2_chksum_fx16{ 0x10D03580 },
                  test_3_chksum_fx16{ 0x6DD8F3E6 }, test_4_chksum_fx16{ 0xE27C401E },
-                 test_5_chksum_fx16{ 0x1DB7DD6A };
+                 test_5_chksum_fx16{ 0x1DB7DD6A }, test_12_chksum_fx16{ 0xA29485BE },
+                 test_14_chksum_fx16{ 0x31FF7CB2 };
 #endif
 
 #else  // Not defined CRC_*
@@ -84,7 +105,10 @@ const crc32_calc  test_1_chksum_fx16, test_1_chksum_sa8,
                   test_8_chksum_fx16, test_8_chksum_sa8,
                   test_9_chksum_fx16, test_9_chksum_sa8,
                   test_10_chksum_fx16, test_10_chksum_sa8,
-                  test_11_chksum_fx16, test_11_chksum_sa8;
+                  test_11_chksum_fx16, test_11_chksum_sa8,
+                  test_12_chksum_fx16, test_12_chksum_sa8,
+                  test_13_chksum_fx16, test_13_chksum_sa8,
+                  test_14_chksum_fx16, test_14_chksum_sa8;
 
 #endif
 
@@ -182,6 +206,44 @@ static const eltwise_test_operands tests_list[] = {
     {"Test 11 SA8 Min vec & scalar",  mli_krn_eltwise_min_sa8,
                                     input_1_sa8_13, input_3_sa8_13, test_11_out_sa8,
                                     thresholds_sa8_general, test_11_chksum_sa8},
+
+    // Eltwise add with per-channel broadcasting
+    {"Test 12 FX16 Add bcast chan",  mli_krn_eltwise_add_fx16,
+                                     input_1_fx16, input_4_fx16, test_12_out_fx16,
+                                     thresholds_fx16_general, test_12_chksum_fx16},
+    {"Test 12 SA8 Add bcast chan",  mli_krn_eltwise_add_sa8,
+                                    input_1_sa8, input_4_sa8, test_12_out_sa8,
+                                    thresholds_sa8_general, test_12_chksum_sa8},
+
+    // Eltwise mul with per-row broadcasting
+    {"Test 13 FX16 Mul bcast row",  mli_krn_eltwise_mul_fx16,
+                                    input_1_fx16, input_5_fx16, test_13_out_fx16,
+                                    thresholds_fx16_general, test_13_chksum_fx16},
+    {"Test 13 SA8 Mul bcast row",  mli_krn_eltwise_mul_sa8,
+                                   input_1_sa8, input_5_sa8, test_13_out_sa8,
+                                   thresholds_sa8_general, test_13_chksum_sa8},
+
+    // Eltwise sub with broadcasting of the first operand
+    {"Test 14 FX16 Sub bcast row",  mli_krn_eltwise_sub_fx16,
+                                    input_5_fx16, input_1_fx16, test_14_out_fx16,
+                                    thresholds_fx16_general, test_14_chksum_fx16},
+    {"Test 14 SA8 Sub bcast row",  mli_krn_eltwise_sub_sa8,
+                                   input_5_sa8, input_1_sa8, test_14_out_sa8,
+                                   thresholds_sa8_general, test_14_chksum_sa8},
+
+    // Planned eltwise add/sub (same operands and checksums as in tests 1, 2, 3 and 12)
+    {"Test 15 SA8 Plan Add vectors",  mli_krn_eltwise_add_sa8_planned,
+                                      input_1_sa8, input_2_sa8, test_1_out_sa8,
+                                      thresholds_sa8_general, test_1_chksum_sa8},
+    {"Test 16 SA8 Plan Add scalar",  mli_krn_eltwise_add_sa8_planned,
+                                     input_2_sa8, input_3_sa8, test_2_out_sa8,
+                                     thresholds_sa8_general, test_2_chksum_sa8},
+    {"Test 17 SA8 Plan Sub vectors",  mli_krn_eltwise_sub_sa8_planned,
+                                      input_1_sa8, input_2_sa8, test_3_out_sa8,
+                                      thresholds_sa8_general, test_3_chksum_sa8},
+    {"Test 18 SA8 Plan Add bcast",  mli_krn_eltwise_add_sa8_planned,
+                                    input_1_sa8, input_4_sa8, test_12_out_sa8,
+                                    thresholds_sa8_general, test_12_chksum_sa8},
 };
 
 constexpr int kMemSize = 2048;
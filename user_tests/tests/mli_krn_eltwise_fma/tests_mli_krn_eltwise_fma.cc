@@ -0,0 +1,220 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_crc32_calc.h"
+#include "test_memory_manager.h"
+#include "test_quality_metrics.h"
+#include "mli_types.h"
+#include "test_tensor_quantizer.h"
+#include "test_report.h"
+
+#include "vectors_mli_krn_eltwise_fma.inc"
+
+
+using mli::tst::tensor_quantizer;
+using mli::tst::quality_metrics;
+using mli::tst::crc32_calc;
+using mli::tst::reporter_full;
+using mli::tst::memory_manager;
+
+typedef mli_status(*eltwise_fma_func_ptr)(
+    const mli_tensor* /*in1*/,
+    const mli_tensor* /*in2*/,
+    const mli_tensor* /*in3*/,
+    const mli_eltwise_fma_cfg* /*cfg*/,
+    mli_tensor* /*out*/);
+
+struct eltwise_fma_test_operands {
+    const char* descr;
+    const eltwise_fma_func_ptr mli_krn_eltwise_fma;
+    tensor_quantizer in1;
+    tensor_quantizer in2;
+    tensor_quantizer in3;
+    tensor_quantizer out;
+    const mli_eltwise_fma_cfg cfg;
+    const quality_metrics threshold;
+    const crc32_calc check_sum;
+};
+
+// Checksums of test tensors for various mli calculations mode.
+// When developer finished implementation of kernel and consider it as ok, one needs to populate
+// proper checksums for tests in order to highlight any change which affects results.
+#if defined(CRC_RM_CONVERGENT) || defined(CRC_RM_UP)
+
+// Shared CRC Results
+const crc32_calc  test_1_chksum_fx16{ 0x220DDE90 }, test_1_chksum_sa8{ 0x24193AD5 },
+                  test_2_chksum_fx16{ 0x05810E3D }, test_2_chksum_sa8{ 0xC41B83D7 },
+                                                    test_3_chksum_sa8{ 0x3A721C49 },
+                  test_4_chksum_fx16{ 0xA3AA328A }, test_4_chksum_sa8{ 0x69A27693 };
+
+// Platform Specific CRC Results
+#if defined(CRC_RM_UP)
+const crc32_calc test_3_chksum_fx16{ 0xA2E94D63 };
+#else
+const crc32_calc test_3_chksum_fx16{ 0xEA1CBA6D };
+#endif
+
+#else  // Not defined CRC_*
+const crc32_calc  test_1_chksum_fx16, test_1_chksum_sa8,
+                  test_2_chksum_fx16, test_2_chksum_sa8,
+                  test_3_chksum_fx16, test_3_chksum_sa8,
+                  test_4_chksum_fx16, test_4_chksum_sa8;
+
+#endif
+
+const quality_metrics thresholds_fx16_general { quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                /* SNR DB = */ 60.f, quality_metrics::kPassValueQuantErrPerc };
+
+const quality_metrics thresholds_sa8_general { quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                               /* SNR DB = */ 30.f, quality_metrics::kPassValueQuantErrPerc };
+
+static const eltwise_fma_test_operands tests_list[] = {
+    // Fused multiply-add of three tensors of the same shape
+    {"Test 1 FX16 FMA three tensors",  mli_krn_eltwise_fma_fx16,
+                                       input_1_fx16, input_2_fx16, input_3_fx16, test_1_out_fx16,
+                                       {{MLI_RELU_NONE, 0, 0}}, thresholds_fx16_general, test_1_chksum_fx16},
+    {"Test 1 SA8 FMA three tensors",  mli_krn_eltwise_fma_sa8,
+                                      input_1_sa8, input_2_sa8, input_3_sa8, test_1_out_sa8,
+                                      {{MLI_RELU_NONE, 0, 0}}, thresholds_sa8_general, test_1_chksum_sa8},
+
+    // Fused multiply-add with per-channel addend and ReLU
+    {"Test 2 FX16 FMA bcast c Relu",  mli_krn_eltwise_fma_fx16,
+                                           input_1_fx16, input_2_fx16, input_4_fx16, test_2_out_fx16,
+                                           {{MLI_RELU_GEN, 0, 0}}, thresholds_fx16_general, test_2_chksum_fx16},
+    {"Test 2 SA8 FMA bcast c Relu",  mli_krn_eltwise_fma_sa8,
+                                          input_1_sa8, input_2_sa8, input_4_sa8, test_2_out_sa8,
+                                          {{MLI_RELU_GEN, 0, 0}}, thresholds_sa8_general, test_2_chksum_sa8},
+
+    // Fused multiply-add with scalar multiplier
+    {"Test 3 FX16 FMA scalar mul",  mli_krn_eltwise_fma_fx16,
+                                    input_1_fx16, input_6_fx16, input_3_fx16, test_3_out_fx16,
+                                    {{MLI_RELU_NONE, 0, 0}}, thresholds_fx16_general, test_3_chksum_fx16},
+    {"Test 3 SA8 FMA scalar mul",  mli_krn_eltwise_fma_sa8,
+                                   input_1_sa8, input_6_sa8, input_3_sa8, test_3_out_sa8,
+                                   {{MLI_RELU_NONE, 0, 0}}, thresholds_sa8_general, test_3_chksum_sa8},
+
+    // Fused multiply-add with per-row multiplier, scalar addend and ReLU
+    {"Test 4 FX16 FMA bcast row Relu",  mli_krn_eltwise_fma_fx16,
+                                        input_1_fx16, input_5_fx16, input_6_fx16, test_4_out_fx16,
+                                        {{MLI_RELU_GEN, 0, 0}}, thresholds_fx16_general, test_4_chksum_fx16},
+    {"Test 4 SA8 FMA bcast row Relu",  mli_krn_eltwise_fma_sa8,
+                                       input_1_sa8, input_5_sa8, input_6_sa8, test_4_out_sa8,
+                                       {{MLI_RELU_GEN, 0, 0}}, thresholds_sa8_general, test_4_chksum_sa8},
+};
+
+constexpr int kMemSize = 2048;
+static IO_DATA_ATTR int8_t scratch_mem_in1[kMemSize] = { 0 };
+static IO_DATA_ATTR int8_t scratch_mem_in2[kMemSize] = { 0 };
+static IO_DATA_ATTR int8_t scratch_mem_in3[kMemSize] = { 0 };
+static IO_DATA_ATTR int8_t scratch_mem_out[kMemSize] = { 0 };
+
+constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
+
+int main() {
+    const reporter_full reporter;
+    bool final_status = true;
+
+    reporter.report_header("MLI|Kernels|Fused Multiply-Add Eltwise Function Tests");
+    for (int i = 0; i < kTestsNum; ++i) {
+        memory_manager mem_in1_keeper((int8_t*)(scratch_mem_in1), sizeof(scratch_mem_in1));
+        memory_manager mem_in2_keeper((int8_t*)(scratch_mem_in2), sizeof(scratch_mem_in2));
+        memory_manager mem_in3_keeper((int8_t*)(scratch_mem_in3), sizeof(scratch_mem_in3));
+        memory_manager mem_out_keeper((int8_t*)(scratch_mem_out), sizeof(scratch_mem_out));
+        bool is_test_passed = true;
+        const eltwise_fma_test_operands* cur_test = &tests_list[i];
+        quality_metrics test_metics;
+        if (!(cur_test->in1.is_valid() && cur_test->in2.is_valid() && cur_test->in3.is_valid() &&
+                cur_test->out.is_valid())) {
+            reporter.report_message(cur_test->descr, "FAILED at init: Bad source data for one of tensors");
+            is_test_passed = false;
+        }
+
+        mli_tensor input1 = cur_test->in1.get_quantized_tensor(mem_in1_keeper.allocate_memory(cur_test->in1));
+        mli_tensor input2 = cur_test->in2.get_quantized_tensor(mem_in2_keeper.allocate_memory(cur_test->in2));
+        mli_tensor input3 = cur_test->in3.get_quantized_tensor(mem_in3_keeper.allocate_memory(cur_test->in3));
+        mli_tensor out = cur_test->out.get_not_quantized_tensor(mem_out_keeper.allocate_memory(cur_test->out));
+        mli_tensor source_out_tensor = out;
+        if (is_test_passed &&
+                (tensor_quantizer::validate_tensor(input1) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(input2) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(input3) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(out) != tensor_quantizer::kOk)) {
+            reporter.report_message(cur_test->descr,
+                                    "FAILED at quantization step: more memory for one of tensors might be required");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                (mem_in1_keeper.is_memory_corrupted() || mem_in2_keeper.is_memory_corrupted() ||
+                        mem_in3_keeper.is_memory_corrupted() || mem_out_keeper.is_memory_corrupted())) {
+            reporter.report_message(cur_test->descr,
+                "FAILED at quantization step: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        // Run specific kernel for test
+        if (is_test_passed &&
+                cur_test->mli_krn_eltwise_fma(&input1, &input2, &input3, &cur_test->cfg, &out) != MLI_STATUS_OK) {
+            reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                (mem_in1_keeper.is_memory_corrupted() || mem_in2_keeper.is_memory_corrupted() ||
+                        mem_in3_keeper.is_memory_corrupted() || mem_out_keeper.is_memory_corrupted())) {
+            reporter.report_message(cur_test->descr,
+                "FAILED after kernel run: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                test_metics.calculate_metrics(out, cur_test->out) == false) {
+            reporter.report_message(cur_test->descr, "FAILED at comparison output with reference");
+            is_test_passed = false;
+        }
+
+        // Check that kernel didn't modify quantization parameters provided by user.
+        if (is_test_passed) {
+            if (out.el_type == MLI_EL_FX_16) {
+                is_test_passed &= out.el_params.fx.frac_bits == source_out_tensor.el_params.fx.frac_bits;
+            } else if (out.el_type == MLI_EL_SA_8) {
+                is_test_passed &=
+                    (out.el_params.sa.scale.mem.i16 == source_out_tensor.el_params.sa.scale.mem.i16) &&
+                    (out.el_params.sa.zero_point.mem.i16 == source_out_tensor.el_params.sa.zero_point.mem.i16) &&
+                    (out.el_params.sa.scale_frac_bits.mem.i8 ==
+                        source_out_tensor.el_params.sa.scale_frac_bits.mem.i8);
+            }
+            if (!is_test_passed) {
+                reporter.report_message(cur_test->descr, "FAILED as element params of output tensor was modified");
+            }
+        }
+
+        if (is_test_passed) {
+            crc32_calc data_crc;
+            data_crc(input1);
+            data_crc(input2);
+            data_crc(input3);
+            data_crc(out);
+            is_test_passed &= reporter.evaluate_and_report_case(cur_test->descr, test_metics, cur_test->threshold,
+                                                                data_crc, cur_test->check_sum);
+        }
+
+        final_status &= is_test_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_krn_eltwise_fma", final_status);
+
+    return (final_status) ? 0 : 1;
+}
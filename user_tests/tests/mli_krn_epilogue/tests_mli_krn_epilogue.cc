@@ -0,0 +1,313 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_api.h"
+#include "mli_config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mli_types.h"
+#include "test_report.h"
+#include "test_tensor_utils.h"
+
+using mli::tst::data_generator;
+using mli::tst::make_tensor;
+using mli::tst::reporter_basic;
+using mli::tst::set_sa_params;
+
+// Kernels with epilogue must be bit exact with the kernel followed by the related activation or eltwise kernel.
+constexpr uint32_t kH = 6, kW = 6, kC = 4, kOutC = 5, kFcIn = 24;
+constexpr uint32_t kFmapSize = kH * kW * kOutC;
+
+static int8_t in_sa8[kH * kW * kC];
+static int16_t in_fx16[kH * kW * kC];
+static int8_t conv_w_sa8[3 * 3 * kC * kOutC];
+static int16_t conv_w_fx16[3 * 3 * kC * kOutC];
+static int32_t conv_b_sa32[kOutC];
+static int16_t conv_b_fx16[kOutC];
+static int8_t dw_w_sa8[3 * 3 * kC];
+static int16_t dw_w_fx16[3 * 3 * kC];
+static int8_t fc_w_sa8[kFcIn * kOutC];
+static int16_t fc_w_fx16[kFcIn * kOutC];
+static int8_t slope_sa8[kOutC];
+static int16_t slope_fx16[kOutC];
+static mli_prelu_requant_params slope_params[kOutC];
+static int8_t addend_sa8[kFmapSize];
+static int16_t addend_fx16[kFmapSize];
+
+static int16_t tmp_mem[kFmapSize];
+static int16_t ref_mem[kFmapSize];
+static int16_t fused_mem[kFmapSize];
+static int16_t lut_mem[512];
+
+static const mli_conv2d_cfg conv_cfg = {{MLI_RELU_NONE, 0, 0}, 1, 1, 1, 1, 1, 1, 1, 1};
+static const mli_fully_connected_cfg fc_cfg = {{MLI_RELU_NONE, 0, 0}};
+
+static mli_tensor make_sa_tensor(void* data, uint32_t capacity, mli_element_type el_type, uint32_t rank,
+                                 const uint32_t* shape, int16_t zero_point, int16_t scale, int8_t scale_frac_bits) {
+    mli_tensor t = make_tensor(data, capacity, el_type, rank, shape);
+    set_sa_params(&t.el_params, zero_point, scale, scale_frac_bits);
+    return t;
+}
+
+static mli_tensor make_fx_tensor(void* data, uint32_t capacity, mli_element_type el_type, uint32_t rank,
+                                 const uint32_t* shape, int8_t frac_bits) {
+    mli_tensor t = make_tensor(data, capacity, el_type, rank, shape);
+    t.el_params.fx.frac_bits = frac_bits;
+    return t;
+}
+
+static void init_data() {
+    data_generator gen(4321);
+    gen.fill(in_sa8, 100);
+    gen.fill(in_fx16, 1500);
+    gen.fill(conv_w_sa8, 60);
+    gen.fill(conv_w_fx16, 300);
+    gen.fill(conv_b_sa32, 3000);
+    gen.fill(conv_b_fx16, 2000);
+    gen.fill(dw_w_sa8, 100);
+    gen.fill(dw_w_fx16, 600);
+    gen.fill(fc_w_sa8, 60);
+    gen.fill(fc_w_fx16, 400);
+    gen.fill(slope_sa8, 120);
+    gen.fill(slope_fx16, 100);
+    gen.fill(addend_sa8, 120);
+    gen.fill(addend_fx16, 4000);
+}
+
+// Operation of a test case: conv2d, depthwise conv2d or fully connected with its tensors
+enum layer_type { kConv, kDepthwise, kFc };
+
+struct layer_tensors {
+    mli_tensor in;
+    mli_tensor weights;
+    mli_tensor bias;
+    mli_tensor out;
+};
+
+static layer_tensors make_layer(layer_type layer, bool is_sa8, void* out_mem) {
+    static const uint32_t fmap_in_shape[] = {kH, kW, kC};
+    static const uint32_t fmap_out_shape[] = {kH, kW, kOutC};
+    static const uint32_t dw_out_shape[] = {kH, kW, kC};
+    static const uint32_t conv_w_shape[] = {3, 3, kC, kOutC};
+    static const uint32_t dw_w_shape[] = {3, 3, 1, kC};
+    static const uint32_t fc_in_shape[] = {kFcIn};
+    static const uint32_t fc_w_shape[] = {kFcIn, kOutC};
+    static const uint32_t conv_b_shape[] = {kOutC};
+    static const uint32_t dw_b_shape[] = {kC};
+
+    const uint32_t* in_shape = (layer == kFc) ? fc_in_shape : fmap_in_shape;
+    const uint32_t in_rank = (layer == kFc) ? 1 : 3;
+    const uint32_t* w_shape = (layer == kConv) ? conv_w_shape : (layer == kDepthwise) ? dw_w_shape : fc_w_shape;
+    const uint32_t w_rank = (layer == kFc) ? 2 : 4;
+    const uint32_t* b_shape = (layer == kDepthwise) ? dw_b_shape : conv_b_shape;
+    const uint32_t* out_shape = (layer == kConv) ? fmap_out_shape : (layer == kDepthwise) ? dw_out_shape : conv_b_shape;
+    const uint32_t out_rank = (layer == kFc) ? 1 : 3;
+
+    layer_tensors t;
+    if (is_sa8) {
+        int8_t* w_data = (layer == kConv) ? conv_w_sa8 : (layer == kDepthwise) ? dw_w_sa8 : fc_w_sa8;
+        const uint32_t w_size = (layer == kConv) ? sizeof(conv_w_sa8) :
+                (layer == kDepthwise) ? sizeof(dw_w_sa8) : sizeof(fc_w_sa8);
+        t.in = make_sa_tensor(in_sa8, sizeof(in_sa8), MLI_EL_SA_8, in_rank, in_shape, -3, 16384, 16);
+        t.weights = make_sa_tensor(w_data, w_size, MLI_EL_SA_8, w_rank, w_shape, 0, 16384, 19);
+        t.bias = make_sa_tensor(conv_b_sa32, sizeof(conv_b_sa32), MLI_EL_SA_32, 1, b_shape, 0, 16384, 21);
+        t.out = make_sa_tensor(out_mem, kFmapSize, MLI_EL_SA_8, out_rank, out_shape, -10, 16384, 13);
+    } else {
+        int16_t* w_data = (layer == kConv) ? conv_w_fx16 : (layer == kDepthwise) ? dw_w_fx16 : fc_w_fx16;
+        const uint32_t w_size = (layer == kConv) ? sizeof(conv_w_fx16) :
+                (layer == kDepthwise) ? sizeof(dw_w_fx16) : sizeof(fc_w_fx16);
+        t.in = make_fx_tensor(in_fx16, sizeof(in_fx16), MLI_EL_FX_16, in_rank, in_shape, 10);
+        t.weights = make_fx_tensor(w_data, w_size, MLI_EL_FX_16, w_rank, w_shape, 12);
+        t.bias = make_fx_tensor(conv_b_fx16, sizeof(conv_b_fx16), MLI_EL_FX_16, 1, b_shape, 12);
+        t.out = make_fx_tensor(out_mem, kFmapSize * sizeof(int16_t), MLI_EL_FX_16, out_rank, out_shape, 9);
+    }
+    return t;
+}
+
+static mli_status run_layer(layer_type layer, bool is_sa8, layer_tensors* t, const mli_epilogue_cfg* epilogue) {
+    if (epilogue == NULL) {
+        if (layer == kConv)
+            return is_sa8 ? mli_krn_conv2d_hwcn_sa8_sa8_sa32(&t->in, &t->weights, &t->bias, &conv_cfg, &t->out)
+                          : mli_krn_conv2d_hwcn_fx16(&t->in, &t->weights, &t->bias, &conv_cfg, &t->out);
+        if (layer == kDepthwise)
+            return is_sa8 ? mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32(&t->in, &t->weights, &t->bias, &conv_cfg, &t->out)
+                          : mli_krn_depthwise_conv2d_hwcn_fx16(&t->in, &t->weights, &t->bias, &conv_cfg, &t->out);
+        return is_sa8 ? mli_krn_fully_connected_sa8_sa8_sa32(&t->in, &t->weights, &t->bias, &fc_cfg, &t->out)
+                      : mli_krn_fully_connected_fx16(&t->in, &t->weights, &t->bias, &fc_cfg, &t->out);
+    }
+    if (layer == kConv)
+        return is_sa8 ? mli_krn_conv2d_hwcn_sa8_sa8_sa32_epilogue(&t->in, &t->weights, &t->bias, &conv_cfg,
+                                                                  epilogue, &t->out)
+                      : mli_krn_conv2d_hwcn_fx16_epilogue(&t->in, &t->weights, &t->bias, &conv_cfg, epilogue, &t->out);
+    if (layer == kDepthwise)
+        return is_sa8 ? mli_krn_depthwise_conv2d_hwcn_sa8_sa8_sa32_epilogue(&t->in, &t->weights, &t->bias, &conv_cfg,
+                                                                            epilogue, &t->out)
+                      : mli_krn_depthwise_conv2d_hwcn_fx16_epilogue(&t->in, &t->weights, &t->bias, &conv_cfg,
+                                                                    epilogue, &t->out);
+    return is_sa8 ? mli_krn_fully_connected_sa8_sa8_sa32_epilogue(&t->in, &t->weights, &t->bias, &fc_cfg,
+                                                                  epilogue, &t->out)
+                  : mli_krn_fully_connected_fx16_epilogue(&t->in, &t->weights, &t->bias, &fc_cfg, epilogue, &t->out);
+}
+
+// Applies the operation of epilogue by the separate kernel
+static mli_status run_separate_op(const mli_epilogue_cfg* epilogue, bool is_sa8, const mli_tensor* in,
+                                  mli_tensor* out) {
+    switch (epilogue->type) {
+    case MLI_EPILOGUE_SIGM:
+        return is_sa8 ? mli_krn_sigm_sa8(in, epilogue->lut, out) : mli_krn_sigm_fx16(in, epilogue->lut, out);
+    case MLI_EPILOGUE_TANH:
+        return is_sa8 ? mli_krn_tanh_sa8(in, epilogue->lut, out) : mli_krn_tanh_fx16(in, epilogue->lut, out);
+    case MLI_EPILOGUE_PRELU:
+        if (mli_hlp_count_elem_num(epilogue->operand, 0) == 1) {
+            return is_sa8 ? mli_krn_leaky_relu_sa8(in, epilogue->operand, out)
+                          : mli_krn_leaky_relu_fx16(in, epilogue->operand, out);
+        } else {
+            const mli_prelu_cfg prelu_cfg = {(int32_t)in->rank - 1};
+            return is_sa8 ? mli_krn_prelu_sa8(in, epilogue->operand, &prelu_cfg, out)
+                          : mli_krn_prelu_fx16(in, epilogue->operand, &prelu_cfg, out);
+        }
+    case MLI_EPILOGUE_ADD:
+        return is_sa8 ? mli_krn_eltwise_add_sa8(in, epilogue->operand, out)
+                      : mli_krn_eltwise_add_fx16(in, epilogue->operand, out);
+    default:
+        return MLI_STATUS_NOT_SUPPORTED;
+    }
+}
+
+static bool tensors_equal(const mli_tensor* ref, const mli_tensor* fused) {
+    if (ref->rank != fused->rank || ref->el_type != fused->el_type)
+        return false;
+    for (uint32_t i = 0; i < ref->rank; i++)
+        if (ref->shape[i] != fused->shape[i])
+            return false;
+    if (ref->el_type == MLI_EL_SA_8) {
+        if (ref->el_params.sa.zero_point.mem.i16 != fused->el_params.sa.zero_point.mem.i16 ||
+                ref->el_params.sa.scale.mem.i16 != fused->el_params.sa.scale.mem.i16 ||
+                ref->el_params.sa.scale_frac_bits.mem.i8 != fused->el_params.sa.scale_frac_bits.mem.i8)
+            return false;
+    } else if (ref->el_params.fx.frac_bits != fused->el_params.fx.frac_bits) {
+        return false;
+    }
+    const uint32_t size = mli_hlp_count_elem_num(ref, 0) * mli_hlp_tensor_element_size(ref);
+    return memcmp(ref->data.mem.pi8, fused->data.mem.pi8, size) == 0;
+}
+
+static bool run_case(layer_type layer, bool is_sa8, const mli_epilogue_cfg* case_epilogue) {
+    mli_epilogue_cfg prepared_epilogue = *case_epilogue;
+    const mli_epilogue_cfg* epilogue = &prepared_epilogue;
+    memset(tmp_mem, 0, sizeof(tmp_mem));
+    memset(ref_mem, 0x55, sizeof(ref_mem));
+    memset(fused_mem, 0x33, sizeof(fused_mem));
+
+    // Reference: the layer and then the separate kernel
+    layer_tensors ref = make_layer(layer, is_sa8, tmp_mem);
+    mli_tensor ref_out = ref.out;
+    ref_out.data.mem.pi8 = (int8_t*)ref_mem;
+    if (run_layer(layer, is_sa8, &ref, NULL) != MLI_STATUS_OK ||
+            run_separate_op(epilogue, is_sa8, &ref.out, &ref_out) != MLI_STATUS_OK)
+        return false;
+
+    // Table of sa8 prelu is filled once by prepare function. Kernels must only read the configuration.
+    layer_tensors fused = make_layer(layer, is_sa8, fused_mem);
+    if (is_sa8 && epilogue->type == MLI_EPILOGUE_PRELU &&
+            mli_krn_epilogue_sa8_prepare(&fused.out, &prepared_epilogue) != MLI_STATUS_OK)
+        return false;
+    mli_epilogue_cfg epilogue_before;
+    memcpy(&epilogue_before, epilogue, sizeof(epilogue_before));
+    mli_prelu_requant_params slope_params_before[kOutC];
+    memcpy(slope_params_before, slope_params, sizeof(slope_params));
+    if (run_layer(layer, is_sa8, &fused, epilogue) != MLI_STATUS_OK)
+        return false;
+    return tensors_equal(&ref_out, &fused.out) &&
+           memcmp(&epilogue_before, epilogue, sizeof(epilogue_before)) == 0 &&
+           memcmp(slope_params_before, slope_params, sizeof(slope_params)) == 0;
+}
+
+int main() {
+    const reporter_basic reporter;
+    bool final_status = true;
+
+    reporter.report_header("MLI|Kernels|Epilogue Tests");
+    init_data();
+
+    mli_lut sigm_lut, tanh_lut;
+    sigm_lut.data.mem.pi16 = lut_mem;
+    sigm_lut.data.capacity = sizeof(lut_mem) / 2;
+    tanh_lut.data.mem.pi16 = lut_mem + 256;
+    tanh_lut.data.capacity = sizeof(lut_mem) / 2;
+    if (mli_krn_sigm_get_lut_size() > (int32_t)sizeof(lut_mem) / 2 ||
+            mli_krn_tanh_get_lut_size() > (int32_t)sizeof(lut_mem) / 2 ||
+            mli_krn_sigm_create_lut(&sigm_lut) != MLI_STATUS_OK ||
+            mli_krn_tanh_create_lut(&tanh_lut) != MLI_STATUS_OK) {
+        reporter.report_case("Init", "FAILED at init: LUT creation failed", false);
+        reporter.report_outline("[AUTO] Group: mli_krn_epilogue", false);
+        return 1;
+    }
+
+    // Slopes: scalar (as leaky relu has) and one per output channel (prelu along the innermost axis)
+    const uint32_t slope_shape[] = {1, 1, kOutC};
+    const uint32_t dw_slope_shape[] = {1, 1, kC};
+    mli_tensor slope_sa8_tsr = make_sa_tensor(slope_sa8, sizeof(slope_sa8), MLI_EL_SA_8, 3, slope_shape, 2, 16384, 21);
+    mli_tensor slope_fx16_tsr = make_fx_tensor(slope_fx16, sizeof(slope_fx16), MLI_EL_FX_16, 3, slope_shape, 8);
+    mli_tensor dw_slope_sa8_tsr = make_sa_tensor(slope_sa8, kC, MLI_EL_SA_8, 3, dw_slope_shape, 2, 16384, 21);
+    mli_tensor scalar_slope_fx16 = make_fx_tensor(NULL, 0, MLI_EL_FX_16, 0, NULL, 8);
+    scalar_slope_fx16.data.mem.i16 = 51;
+    mli_tensor scalar_slope_sa8 = make_sa_tensor(NULL, 0, MLI_EL_SA_8, 0, NULL, 0, 16384, 21);
+    scalar_slope_sa8.data.mem.i8 = 26;
+
+    // Addends of the output shape with parameters different from output (as a residual branch has)
+    const uint32_t conv_out_shape[] = {kH, kW, kOutC};
+    const uint32_t dw_out_shape[] = {kH, kW, kC};
+    const uint32_t fc_out_shape[] = {kOutC};
+    mli_tensor conv_addend_sa8 = make_sa_tensor(addend_sa8, sizeof(addend_sa8), MLI_EL_SA_8, 3, conv_out_shape,
+                                                7, 16384, 14);
+    mli_tensor dw_addend_sa8 = make_sa_tensor(addend_sa8, sizeof(addend_sa8), MLI_EL_SA_8, 3, dw_out_shape,
+                                              7, 16384, 14);
+    mli_tensor dw_addend_fx16 = make_fx_tensor(addend_fx16, sizeof(addend_fx16), MLI_EL_FX_16, 3, dw_out_shape, 9);
+    mli_tensor fc_addend_fx16 = make_fx_tensor(addend_fx16, sizeof(addend_fx16), MLI_EL_FX_16, 1, fc_out_shape, 9);
+    mli_tensor fc_addend_sa8 = make_sa_tensor(addend_sa8, sizeof(addend_sa8), MLI_EL_SA_8, 1, fc_out_shape,
+                                              -5, 16384, 12);
+
+    struct test_case {
+        const char* name;
+        layer_type layer;
+        bool is_sa8;
+        mli_epilogue_cfg epilogue;
+    };
+    const test_case cases[] = {
+        {"Test 1 Conv2D SA8 + Sigm", kConv, true, {MLI_EPILOGUE_SIGM, &sigm_lut, NULL}},
+        {"Test 2 Conv2D FX16 + Tanh", kConv, false, {MLI_EPILOGUE_TANH, &tanh_lut, NULL}},
+        {"Test 3 Conv2D SA8 + PReLU", kConv, true, {MLI_EPILOGUE_PRELU, NULL, &slope_sa8_tsr, slope_params, kOutC}},
+        {"Test 4 Conv2D FX16 + PReLU", kConv, false, {MLI_EPILOGUE_PRELU, NULL, &slope_fx16_tsr}},
+        {"Test 5 Conv2D SA8 + Add", kConv, true, {MLI_EPILOGUE_ADD, NULL, &conv_addend_sa8}},
+        {"Test 6 DW SA8 + Leaky ReLU", kDepthwise, true, {MLI_EPILOGUE_PRELU, NULL, &scalar_slope_sa8}},
+        {"Test 7 DW SA8 + PReLU", kDepthwise, true, {MLI_EPILOGUE_PRELU, NULL, &dw_slope_sa8_tsr, slope_params, kOutC}},
+        {"Test 8 DW FX16 + Leaky ReLU", kDepthwise, false, {MLI_EPILOGUE_PRELU, NULL, &scalar_slope_fx16}},
+        {"Test 9 DW SA8 + Add", kDepthwise, true, {MLI_EPILOGUE_ADD, NULL, &dw_addend_sa8}},
+        {"Test 10 DW FX16 + Add", kDepthwise, false, {MLI_EPILOGUE_ADD, NULL, &dw_addend_fx16}},
+        {"Test 11 FC SA8 + Tanh", kFc, true, {MLI_EPILOGUE_TANH, &tanh_lut, NULL}},
+        {"Test 12 FC FX16 + Sigm", kFc, false, {MLI_EPILOGUE_SIGM, &sigm_lut, NULL}},
+        {"Test 13 FC SA8 + Add", kFc, true, {MLI_EPILOGUE_ADD, NULL, &fc_addend_sa8}},
+        {"Test 14 FC FX16 + Add", kFc, false, {MLI_EPILOGUE_ADD, NULL, &fc_addend_fx16}},
+    };
+
+    for (const test_case& c : cases) {
+        const bool is_test_passed = run_case(c.layer, c.is_sa8, &c.epilogue);
+        reporter.report_case(c.name, is_test_passed ? "" : "FAILED: result differs from separate kernels",
+                             is_test_passed);
+        final_status &= is_test_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_krn_epilogue", final_status);
+
+    return (final_status) ? 0 : 1;
+}
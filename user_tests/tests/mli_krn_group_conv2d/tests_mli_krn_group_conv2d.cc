@@ -20,6 +20,7 @@
 #include "test_quality_metrics.h"
 
 #include "test_tensor_quantizer.h"
+#include "test_tensor_utils.h"
 #include "test_report.h"
 
 #include "vectors_mli_krn_group_conv2d.inc"
@@ -30,6 +31,7 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::run_batch_of_two;
 
 typedef mli_status(*group_conv2d_func_ptr)(
     const mli_tensor* /*input*/,
@@ -38,6 +40,37 @@ typedef mli_status(*group_conv2d_func_ptr)(
     const mli_conv2d_cfg* /*cfg*/,
     mli_tensor* /*output*/);
 
+// Batched versions of kernels: input is replicated into rank-4 tensor of two items processed by one call.
+// Both output items must be bit exact with the rank-3 kernel, the first one is checked as output of the test.
+constexpr int kBatchMemSize = 2 * 2247;
+static IO_DATA_ATTR int8_t batch_mem_in[kBatchMemSize] = { 0 };
+static IO_DATA_ATTR int8_t batch_mem_out[kBatchMemSize] = { 0 };
+
+static mli_status group_conv2d_batch_of_two(group_conv2d_func_ptr func, const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    return run_batch_of_two([=](const mli_tensor* in_batch, mli_tensor* out_batch) {
+        return func(in_batch, weights, bias, cfg, out_batch);
+    }, in, out, batch_mem_in, batch_mem_out);
+}
+
+static mli_status mli_krn_group_conv2d_hwcn_fx16_k3x3_batch(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    return group_conv2d_batch_of_two(mli_krn_group_conv2d_hwcn_fx16_k3x3, in, weights, bias, cfg, out);
+}
+
+static mli_status mli_krn_group_conv2d_hwcn_fx16_fx8_fx8_k3x3_batch(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    return group_conv2d_batch_of_two(mli_krn_group_conv2d_hwcn_fx16_fx8_fx8_k3x3, in, weights, bias, cfg, out);
+}
+
+static mli_status mli_krn_group_conv2d_hwcn_sa8_sa8_sa32_k3x3_batch_threads(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_hlp_set_num_threads(3);
+    mli_status ret = group_conv2d_batch_of_two(mli_krn_group_conv2d_hwcn_sa8_sa8_sa32_k3x3, in, weights, bias, cfg, out);
+    mli_hlp_set_num_threads(1);
+    return ret;
+}
+
 struct group_conv2d_test_operands {
     const char* descr;
     const group_conv2d_func_ptr mli_krn_group_conv2d;
@@ -263,6 +296,22 @@ static const group_conv2d_test_operands tests_list[] = {
                                        test_10_out_sa8, test_10_cfg, thresholds_sa8_general, test_10_chksum_sa8},
 #else
 #error incorrect make configuration
+#endif
+    // Batch of two items in rank-4 tensors (same operands and checksums as in test 9)
+#ifdef COMPILE_FOR_FX16
+    {"Test 11 FX16 k3x3 Batch",        mli_krn_group_conv2d_hwcn_fx16_k3x3_batch,
+                                       input_1_memstr_fx16, weights_7_memstr_fx16, bias_9_fx16, test_9_out_fx16,
+                                       test_9_cfg, thresholds_fx16_general, test_9_chksum_fx16},
+#elif COMPILE_FOR_FX16_FX8_FX8
+    {"Test 11 FX16_FX8 k3x3 Batch",    mli_krn_group_conv2d_hwcn_fx16_fx8_fx8_k3x3_batch,
+                                       input_1_memstr_fx16, weights_7_memstr_fx8, bias_9_fx8, test_9_out_fx16,
+                                       test_9_cfg, thresholds_fx16_fx8_fx8_general, test_9_chksum_fx16_fx8_fx8},
+#elif COMPILE_FOR_SA8_SA8_SA32
+    {"Test 11 SA8 k3x3 Batch Threads", mli_krn_group_conv2d_hwcn_sa8_sa8_sa32_k3x3_batch_threads,
+                                       input_1_memstr_sa8, weights_7_memstr_sa8, bias_9_i1_w7_sa32,
+                                       test_9_out_sa8, test_9_cfg, thresholds_sa8_general, test_9_chksum_sa8},
+#else
+#error incorrect make configuration
 #endif
 };
 
@@ -298,7 +347,8 @@ int main() {
             strstr(cur_test->descr, "Test 7 FX16 W_Memstr") != nullptr ||
             strstr(cur_test->descr, "Test 9 FX16 k3x3 Mstr+Dil") != nullptr ||
             strstr(cur_test->descr, "Test 10 FX16 k5x5 Mstr+Dil") != nullptr ||
-            strstr(cur_test->descr, "Test 10 SA8 k5x5 Mstr+Dil") != nullptr) {
+            strstr(cur_test->descr, "Test 10 SA8 k5x5 Mstr+Dil") != nullptr ||
+            strstr(cur_test->descr, "Test 11 FX16 k3x3 Batch") != nullptr) {
             // VPX fails bitwise comparison with reference .
             reporter.report_message(cur_test->descr, "SKIPPED due to a known issue");
             continue;
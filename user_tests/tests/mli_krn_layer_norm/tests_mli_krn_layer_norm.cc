@@ -0,0 +1,268 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_api.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mli_types.h"
+
+#include "test_crc32_calc.h"
+#include "test_memory_manager.h"
+#include "test_quality_metrics.h"
+#include "test_report.h"
+#include "test_tensor_quantizer.h"
+
+#include "vectors_mli_krn_layer_norm.inc"
+
+
+using mli::tst::tensor_quantizer;
+using mli::tst::quality_metrics;
+using mli::tst::crc32_calc;
+using mli::tst::reporter_full;
+using mli::tst::memory_manager;
+
+typedef mli_status (*layer_norm_func_ptr)(
+    const mli_tensor* /*in*/,
+    const mli_tensor* /*gamma*/,
+    const mli_tensor* /*beta*/,
+    const mli_lut* /*lut*/,
+    mli_tensor* /*out*/);
+
+// RMS normalization doesn't use beta tensor
+static mli_status mli_krn_rms_norm_fx16_wrapper(const mli_tensor* in, const mli_tensor* gamma,
+                                                const mli_tensor* /*beta*/, const mli_lut* lut, mli_tensor* out) {
+    return mli_krn_rms_norm_fx16(in, gamma, lut, out);
+}
+
+static mli_status mli_krn_rms_norm_sa8_wrapper(const mli_tensor* in, const mli_tensor* gamma,
+                                               const mli_tensor* /*beta*/, const mli_lut* lut, mli_tensor* out) {
+    return mli_krn_rms_norm_sa8(in, gamma, lut, out);
+}
+
+struct layer_norm_test_operands {
+    const char* descr;
+    const layer_norm_func_ptr mli_krn_layer_norm;
+    tensor_quantizer in;
+    tensor_quantizer gamma;
+    tensor_quantizer beta;
+    tensor_quantizer out;
+    const quality_metrics threshold;
+    const crc32_calc check_sum;
+    const bool in_place_comp;
+};
+
+#if defined(CRC_RM_CONVERGENT) || defined(CRC_RM_UP)
+
+// Shared CRC Results
+const crc32_calc  test_1_chksum_fx16{ 0xBCCE6153 }, test_1_chksum_sa8{ 0x2D01A6A0 },
+                  test_2_chksum_fx16{ 0x94DAFAE0 }, test_2_chksum_sa8{ 0xAFC98EA5 },
+                  test_3_chksum_fx16{ 0x8C9AB18E }, test_3_chksum_sa8{ 0x85982BCC },
+                  test_4_chksum_fx16{ 0x9271EEBB }, test_4_chksum_sa8{ 0x4B1FD933 },
+                  test_5_chksum_fx16{ 0xF0C7E6B8 }, test_5_chksum_sa8{ 0xA138855D },
+                  test_6_chksum_fx16{ 0x4F24371A }, test_6_chksum_sa8{ 0x9EF18A16 };
+
+#else  // Not defined CRC_*
+const crc32_calc  test_1_chksum_fx16, test_1_chksum_sa8,
+                  test_2_chksum_fx16, test_2_chksum_sa8,
+                  test_3_chksum_fx16, test_3_chksum_sa8,
+                  test_4_chksum_fx16, test_4_chksum_sa8,
+                  test_5_chksum_fx16, test_5_chksum_sa8,
+                  test_6_chksum_fx16, test_6_chksum_sa8;
+
+#endif
+
+const quality_metrics thresholds_fx16_general { quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                /* SNR DB = */ 60.f, quality_metrics::kPassValueQuantErrPerc };
+
+const quality_metrics thresholds_sa8_general { quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                               /* SNR DB = */ 30.f, quality_metrics::kPassValueQuantErrPerc };
+
+static const layer_norm_test_operands tests_list[] = {
+    {"Test 1 FX16 LayerNorm 2D",  mli_krn_layer_norm_fx16,
+                                  input_1_fx16, gamma_1_fx16, beta_1_fx16, test_1_out_fx16,
+                                  thresholds_fx16_general, test_1_chksum_fx16, false},
+    {"Test 1 SA8  LayerNorm 2D",  mli_krn_layer_norm_sa8,
+                                  input_1_sa8, gamma_1_sa8, beta_1_sa8, test_1_out_sa8,
+                                  thresholds_sa8_general, test_1_chksum_sa8, false},
+    {"Test 2 FX16 LayerNorm 3D",  mli_krn_layer_norm_fx16,
+                                  input_2_fx16, gamma_2_fx16, beta_2_fx16, test_2_out_fx16,
+                                  thresholds_fx16_general, test_2_chksum_fx16, false},
+    {"Test 2 SA8  LayerNorm 3D",  mli_krn_layer_norm_sa8,
+                                  input_2_sa8, gamma_2_sa8, beta_2_sa8, test_2_out_sa8,
+                                  thresholds_sa8_general, test_2_chksum_sa8, false},
+    {"Test 3 FX16 RMSNorm 2D",    mli_krn_rms_norm_fx16_wrapper,
+                                  input_1_fx16, gamma_1_fx16, beta_1_fx16, test_3_out_fx16,
+                                  thresholds_fx16_general, test_3_chksum_fx16, false},
+    {"Test 3 SA8  RMSNorm 2D",    mli_krn_rms_norm_sa8_wrapper,
+                                  input_1_sa8, gamma_1_sa8, beta_1_sa8, test_3_out_sa8,
+                                  thresholds_sa8_general, test_3_chksum_sa8, false},
+    {"Test 4 FX16 RMSNorm 3D",    mli_krn_rms_norm_fx16_wrapper,
+                                  input_2_fx16, gamma_2_fx16, beta_2_fx16, test_4_out_fx16,
+                                  thresholds_fx16_general, test_4_chksum_fx16, false},
+    {"Test 4 SA8  RMSNorm 3D",    mli_krn_rms_norm_sa8_wrapper,
+                                  input_2_sa8, gamma_2_sa8, beta_2_sa8, test_4_out_sa8,
+                                  thresholds_sa8_general, test_4_chksum_sa8, false},
+    {"Test 5 FX16 LayerNorm IPC", mli_krn_layer_norm_fx16,
+                                  input_2_fx16, gamma_2_fx16, beta_2_fx16, test_2_out_fx16,
+                                  thresholds_fx16_general, test_5_chksum_fx16, true},
+    {"Test 5 SA8  LayerNorm IPC", mli_krn_layer_norm_sa8,
+                                  input_2_sa8, gamma_2_sa8, beta_2_sa8, test_2_out_sa8,
+                                  thresholds_sa8_general, test_5_chksum_sa8, true},
+    {"Test 6 FX16 LayerNorm Const", mli_krn_layer_norm_fx16,
+                                  input_3_fx16, gamma_2_fx16, beta_2_fx16, test_6_out_fx16,
+                                  thresholds_fx16_general, test_6_chksum_fx16, false},
+    {"Test 6 SA8  LayerNorm Const", mli_krn_layer_norm_sa8,
+                                  input_3_sa8, gamma_2_sa8, beta_2_sa8, test_6_out_sa8,
+                                  thresholds_sa8_general, test_6_chksum_sa8, false},
+};
+
+constexpr int kMemSize = 2048;
+static IO_DATA_ATTR int8_t scratch_mem_in[kMemSize]  = { 0 };
+static IO_DATA_ATTR int8_t scratch_mem_gamma[kMemSize]  = { 0 };
+static IO_DATA_ATTR int8_t scratch_mem_beta[kMemSize]  = { 0 };
+static IO_DATA_ATTR int8_t scratch_mem_out[kMemSize] = { 0 };
+static IO_DATA_ATTR int8_t scratch_mem_lut[kMemSize] = { 0 };
+
+constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
+
+int main() {
+    const reporter_full reporter;
+    bool final_status = true;
+
+    reporter.report_header("MLI|Kernels|Layer Normalization Functions Tests");
+    mli_lut lut;
+    bool lut_status = true;
+    int lut_size = mli_krn_layer_norm_get_lut_size();
+    lut_status = lut_status && (lut_size < sizeof(scratch_mem_lut));
+    lut.data.mem.pi16 = (int16_t*) scratch_mem_lut;
+    lut.data.capacity = sizeof(scratch_mem_lut);
+    lut_status = lut_status && (mli_krn_layer_norm_create_lut(&lut) == MLI_STATUS_OK);
+    for (int i = 0; i < kTestsNum; ++i) {
+        memory_manager mem_in_keeper((int8_t*)(scratch_mem_in), sizeof(scratch_mem_in));
+        memory_manager mem_gamma_keeper((int8_t*)(scratch_mem_gamma), sizeof(scratch_mem_gamma));
+        memory_manager mem_beta_keeper((int8_t*)(scratch_mem_beta), sizeof(scratch_mem_beta));
+        memory_manager mem_out_keeper((int8_t*)(scratch_mem_out), sizeof(scratch_mem_out));
+        bool is_test_passed = true;
+        const layer_norm_test_operands* cur_test = &tests_list[i];
+        quality_metrics test_metics;
+        if (!(lut_status)) {
+            reporter.report_message(cur_test->descr, "FAILED at init: LUT error");
+            is_test_passed = false;
+        }
+
+        if (!(cur_test->in.is_valid() && cur_test->gamma.is_valid() &&
+              cur_test->beta.is_valid() && cur_test->out.is_valid())) {
+            reporter.report_message(cur_test->descr, "FAILED at init: bad source data for one of tensors");
+            is_test_passed = false;
+        }
+
+        mli_tensor input = cur_test->in.get_quantized_tensor(mem_in_keeper.allocate_memory(cur_test->in));
+        mli_tensor gamma = cur_test->gamma.get_quantized_tensor(mem_gamma_keeper.allocate_memory(cur_test->gamma));
+        mli_tensor beta = cur_test->beta.get_quantized_tensor(mem_beta_keeper.allocate_memory(cur_test->beta));
+        mli_tensor out = cur_test->out.get_not_quantized_tensor(mem_out_keeper.allocate_memory(cur_test->out));
+        if (cur_test->in_place_comp) {
+            mli_element_params params = out.el_params;
+            /* Reuse Input Tensor */
+            out = input;
+            /* Output Params Provided by User */
+            out.el_params = params;
+        }
+
+        mli_tensor source_out_tensor = out;
+        if (is_test_passed &&
+                (tensor_quantizer::validate_tensor(input) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(gamma) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(beta) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(out) != tensor_quantizer::kOk)) {
+            reporter.report_message(cur_test->descr,
+                                    "FAILED at quantization step: more memory for one of tensors might be required");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                (mem_in_keeper.is_memory_corrupted() ||
+                 mem_gamma_keeper.is_memory_corrupted() ||
+                 mem_beta_keeper.is_memory_corrupted() ||
+                 mem_out_keeper.is_memory_corrupted())) {
+            reporter.report_message(cur_test->descr,
+                "FAILED at quantization step: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        // Run specific kernel for test
+        if (is_test_passed &&
+                cur_test->mli_krn_layer_norm(&input, &gamma, &beta, &lut, &out) != MLI_STATUS_OK) {
+            reporter.report_message(cur_test->descr, "FAILED at kernel run: kernel returned bad status");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                (mem_in_keeper.is_memory_corrupted() ||
+                 mem_gamma_keeper.is_memory_corrupted() ||
+                 mem_beta_keeper.is_memory_corrupted() ||
+                 mem_out_keeper.is_memory_corrupted())) {
+            reporter.report_message(cur_test->descr,
+                "FAILED after kernel run: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed && cur_test->in_place_comp &&
+                !mli_hlp_tensor_data_ptr_cmp(&input, &out)) {
+            reporter.report_message(cur_test->descr,
+                "FAILED after kernel run: memory corrupted for In Place Computation");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                test_metics.calculate_metrics(out, cur_test->out) == false) {
+            reporter.report_message(cur_test->descr, "FAILED at comparison output with reference");
+            is_test_passed = false;
+        }
+
+        // Check that kernel didn't modify quantization parameters provided by user.
+        if (is_test_passed) {
+            bool is_per_tensor_quant = true;
+
+            if (out.el_type == MLI_EL_FX_8 || out.el_type == MLI_EL_FX_16) {
+                is_test_passed &= out.el_params.fx.frac_bits == source_out_tensor.el_params.fx.frac_bits;
+            } else if (out.el_type == MLI_EL_SA_8 || out.el_type == MLI_EL_SA_32) {
+                if (out.el_params.sa.dim < 0 || source_out_tensor.el_params.sa.dim < 0) {
+                    is_test_passed &=
+                        (out.el_params.sa.scale.mem.i16 == source_out_tensor.el_params.sa.scale.mem.i16) &&
+                        (out.el_params.sa.zero_point.mem.i16 == source_out_tensor.el_params.sa.zero_point.mem.i16) &&
+                        (out.el_params.sa.scale_frac_bits.mem.i8 ==
+                            source_out_tensor.el_params.sa.scale_frac_bits.mem.i8);
+                } else {
+                    is_per_tensor_quant = false;
+                    is_test_passed = false;
+                }
+            }
+            if (!is_test_passed) {
+                reporter.report_message(cur_test->descr,
+                    is_per_tensor_quant ? "FAILED as element params of output tensor was modified"
+                                        : "FAILED as per-axis quantization of output tensor isn't supported");
+            }
+        }
+
+        if (is_test_passed) {
+            crc32_calc data_crc;
+            data_crc(input);
+            data_crc(out);
+            is_test_passed &= reporter.evaluate_and_report_case(cur_test->descr, test_metics, cur_test->threshold,
+                                                                data_crc, cur_test->check_sum);
+        }
+        final_status &= is_test_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_krn_layer_norm", final_status);
+
+    return (final_status) ? 0 : 1;
+}
@@ -364,7 +364,8 @@ int main() {
         /* .direction = */ cur_test->cfg.direction,
         /* .results = */ cur_test->cfg.results,
         /* .act = */ cur_test->cfg.act,
-        /* .scratch_data = */ mem_ir_keeper.allocate_memory(kMemIrSize)
+        /* .scratch_data = */ mem_ir_keeper.allocate_memory(
+                mli_krn_lstm_cell_get_scratch_size(&input, &weights_in, &cur_test->cfg))
         };
 
         if (is_test_passed &&
@@ -35,6 +35,20 @@ typedef mli_status (*prelu_func_ptr)(
     const mli_prelu_cfg* /*cfg*/,
     mli_tensor* /*out*/);
 
+// Number of channels along slope axis over all test vectors
+constexpr int kMaxSlopeChannels = 8;
+
+static mli_status mli_krn_prelu_sa8_planned(const mli_tensor* in, const mli_tensor* slope_coeff,
+                                            const mli_prelu_cfg* cfg, mli_tensor* out) {
+    mli_prelu_requant_params slope_params[kMaxSlopeChannels];
+    mli_prelu_plan plan;
+    plan.slope_params = slope_params;
+    plan.slope_params_capacity = kMaxSlopeChannels;
+    mli_status ret = mli_krn_prelu_sa8_prepare(in, slope_coeff, cfg, out, &plan);
+    if (ret != MLI_STATUS_OK) return ret;
+    return mli_krn_prelu_sa8_run(&plan, in, out);
+}
+
 struct prelu_test_operands {
     const char* descr;
     const prelu_func_ptr mli_krn_prelu;
@@ -121,6 +135,18 @@ static const prelu_test_operands tests_list[] = {
                                     input_2_sa8, alpha_7_sa8, test_7_cfg, test_7_out_sa8,
                                     thresholds_sa8_general, test_7_chksum_sa8, false},
 
+    {"Test 8 SA8 Plan Axis=0 MemStr",  mli_krn_prelu_sa8_planned,
+                                    input_1_sa8, alpha_1_sa8, test_1_cfg, test_1_out_sa8,
+                                    thresholds_sa8_general, test_1_chksum_sa8, false},
+    {"Test 9 SA8 Plan Axis=2 MemStr",  mli_krn_prelu_sa8_planned,
+                                    input_1_sa8, alpha_3_sa8, test_3_cfg, test_3_out_sa8,
+                                    thresholds_sa8_general, test_3_chksum_sa8, false},
+    {"Test 10 SA8 Plan Axis = 1",  mli_krn_prelu_sa8_planned,
+                                    input_2_sa8, alpha_5_sa8, test_5_cfg, test_5_out_sa8,
+                                    thresholds_sa8_general, test_5_chksum_sa8, false},
+    {"Test 11 SA8 Plan Axis = 3",  mli_krn_prelu_sa8_planned,
+                                    input_2_sa8, alpha_7_sa8, test_7_cfg, test_7_out_sa8,
+                                    thresholds_sa8_general, test_7_chksum_sa8, false},
 };
 
 constexpr int kMemSize = 2048;
@@ -0,0 +1,313 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_api.h"
+#include "mli_config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_crc32_calc.h"
+#include "test_memory_manager.h"
+#include "test_quality_metrics.h"
+#include "mli_types.h"
+#include "test_tensor_quantizer.h"
+#include "test_report.h"
+
+// Tiled execution must give bit exact results of the kernel itself,
+// so vectors and checksums of convolution and pooling tests are reused.
+namespace conv {
+#include "../mli_krn_conv2d/vectors_mli_krn_conv2d.inc"
+}
+// Descriptor macros are shared by names between vector files
+#undef INPUT_1_TSR_SHARED_DESCR
+#undef INPUT_1_MEMSTR_TSR_SHARED_DESCR
+#undef INPUT_2_TSR_SHARED_DESCR
+#undef TEST_1_OUT_TSR_SHARED_DESCR
+#undef TEST_2_OUT_TSR_SHARED_DESCR
+#undef TEST_3_OUT_TSR_SHARED_DESCR
+#undef TEST_4_OUT_TSR_SHARED_DESCR
+#undef TEST_5_OUT_TSR_SHARED_DESCR
+#undef TEST_6_OUT_TSR_SHARED_DESCR
+#undef TEST_7_OUT_TSR_SHARED_DESCR
+namespace pool {
+#include "../mli_krn_maxpool/vectors_mli_krn_maxpool.inc"
+}
+
+using mli::tst::tensor_quantizer;
+using mli::tst::quality_metrics;
+using mli::tst::crc32_calc;
+using mli::tst::reporter_full;
+using mli::tst::memory_manager;
+
+struct tiling_test_operands {
+    const char* descr;
+    const mli_tile_conv2d_fn conv2d;
+    const mli_tile_pool_fn pool;
+    tensor_quantizer in;
+    const tensor_quantizer* weights;
+    const tensor_quantizer* bias;
+    tensor_quantizer out;
+    const mli_conv2d_cfg* conv_cfg;
+    const mli_pool_cfg* pool_cfg;
+    const uint32_t fast_mem_size;
+    const quality_metrics threshold;
+    const crc32_calc check_sum;
+};
+
+// Checksums of test tensors for various mli calculations mode.
+// When developer finished implementation of kernel and consider it as ok, He need to populate
+// proper checksums for tests in order to highlight any change which affects results.
+#if defined(CRC_RM_CONVERGENT) || defined(CRC_RM_UP)
+// Shared CRC Results
+const crc32_calc test_1_chksum_conv_fx16{ 0x3669E8DA }, test_1_chksum_conv_sa8{ 0xA3FFD976 },
+                 test_2_chksum_conv_fx16{ 0x6075722F }, test_2_chksum_conv_sa8{ 0x5D288208 },
+                 test_3_chksum_conv_fx16{ 0xE2100158 }, test_3_chksum_conv_sa8{ 0x9740102D },
+                 test_4_chksum_conv_fx16{ 0x987AC0A8 }, test_4_chksum_conv_sa8{ 0x056EDB56 },
+                 test_5_chksum_conv_fx16{ 0x3B2662E7 }, test_5_chksum_conv_sa8{ 0x7D8D9C29 },
+                 test_6_chksum_pool_fx16{ 0xB3CA162A }, test_6_chksum_pool_sa8{ 0x8952D11E },
+                 test_7_chksum_pool_fx16{ 0xB088F2F7 }, test_7_chksum_pool_sa8{ 0xCBAF5F7F },
+                 test_8_chksum_pool_fx16{ 0xFF4A96B3 }, test_8_chksum_pool_sa8{ 0x5AD791C4 };
+#else // Not defined CRC_*
+const crc32_calc test_1_chksum_conv_fx16, test_1_chksum_conv_sa8,
+                 test_2_chksum_conv_fx16, test_2_chksum_conv_sa8,
+                 test_3_chksum_conv_fx16, test_3_chksum_conv_sa8,
+                 test_4_chksum_conv_fx16, test_4_chksum_conv_sa8,
+                 test_5_chksum_conv_fx16, test_5_chksum_conv_sa8,
+                 test_6_chksum_pool_fx16, test_6_chksum_pool_sa8,
+                 test_7_chksum_pool_fx16, test_7_chksum_pool_sa8,
+                 test_8_chksum_pool_fx16, test_8_chksum_pool_sa8;
+#endif
+
+const quality_metrics thresholds_conv_fx16_general { quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                     /* SNR_DB = */70.f, quality_metrics::kPassValueQuantErrPerc };
+
+const quality_metrics thresholds_conv_sa8_general{ quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                   /* SNR_DB = */35.f, /*Quant Error Perc = */40.f };
+
+const quality_metrics thresholds_pool_fx16_general { quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                     /* SNR_DB = */84.f, /*Quant Error Perc = */ 99.9f };
+
+const quality_metrics thresholds_pool_sa8_general{ quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                   /* SNR_DB = */40.f, /*Quant Error Perc = */ 99.9f };
+
+// Fast memory budgets are chosen to split each layer into several tiles.
+static const tiling_test_operands tests_list[] = {
+    // Conv2D kernel_size=(3, 4), strides=(1, 1), with krn_padding and w/o ReLU
+    {"Test 1 Conv FX16",    mli_krn_conv2d_hwcn_fx16, nullptr,
+                            conv::input_1_fx16, &conv::weights_1_fx16, &conv::bias_1_fx16, conv::test_1_out_fx16,
+                            &conv::test_1_cfg, nullptr, 448,
+                            thresholds_conv_fx16_general, test_1_chksum_conv_fx16},
+    {"Test 1 Conv SA8",     mli_krn_conv2d_hwcn_sa8_sa8_sa32, nullptr,
+                            conv::input_1_sa8, &conv::weights_1_sa8, &conv::bias_1_sa32, conv::test_1_out_sa8,
+                            &conv::test_1_cfg, nullptr, 224,
+                            thresholds_conv_sa8_general, test_1_chksum_conv_sa8},
+
+    // Conv2D with 7 kernels of (4, 3) size, strides = (2, 2), with krn_padding and with Gen_ReLU
+    {"Test 2 Conv FX16 Str",  mli_krn_conv2d_hwcn_fx16, nullptr,
+                              conv::input_1_fx16, &conv::weights_2_fx16, &conv::bias_1_fx16, conv::test_2_out_fx16,
+                              &conv::test_2_cfg, nullptr, 700,
+                              thresholds_conv_fx16_general, test_2_chksum_conv_fx16},
+    {"Test 2 Conv SA8 Str",   mli_krn_conv2d_hwcn_sa8_sa8_sa32, nullptr,
+                              conv::input_1_sa8, &conv::weights_2_sa8, &conv::bias_1_w2_per_tensor_sa32,
+                              conv::test_2_out_sa8, &conv::test_2_cfg, nullptr, 356,
+                              thresholds_conv_sa8_general, test_2_chksum_conv_sa8},
+
+    // Conv2D with dilation: kernel_size=(3, 4), strides=(1, 1), w/o padding and w/o ReLU
+    {"Test 3 Conv FX16 Dil",  mli_krn_conv2d_hwcn_fx16, nullptr,
+                              conv::input_1_fx16, &conv::weights_1_fx16, &conv::bias_1_fx16, conv::test_3_out_fx16,
+                              &conv::test_3_cfg, nullptr, 532,
+                              thresholds_conv_fx16_general, test_3_chksum_conv_fx16},
+    {"Test 3 Conv SA8 Dil",   mli_krn_conv2d_hwcn_sa8_sa8_sa32, nullptr,
+                              conv::input_1_sa8, &conv::weights_1_sa8, &conv::bias_1_sa32, conv::test_3_out_sa8,
+                              &conv::test_3_cfg, nullptr, 272,
+                              thresholds_conv_sa8_general, test_3_chksum_conv_sa8},
+
+    // Conv2D with input/output memstride : kernel_size = (4, 3), strides = (3, 3), w / o padding and with ReLU_1
+    {"Test 4 Conv FX16 Memstr",  mli_krn_conv2d_hwcn_fx16, nullptr,
+                                 conv::input_1_memstr_fx16, &conv::weights_1_fx16, &conv::bias_1_fx16,
+                                 conv::test_4_out_fx16, &conv::test_4_cfg, nullptr, 400,
+                                 thresholds_conv_fx16_general, test_4_chksum_conv_fx16},
+    {"Test 4 Conv SA8 Memstr",   mli_krn_conv2d_hwcn_sa8_sa8_sa32, nullptr,
+                                 conv::input_1_memstr_sa8, &conv::weights_1_sa8, &conv::bias_1_sa32,
+                                 conv::test_4_out_sa8, &conv::test_4_cfg, nullptr, 200,
+                                 thresholds_conv_sa8_general, test_4_chksum_conv_sa8},
+
+    // Conv2D with dilation and padding, kernel_size=(3, 3), strides=(1, 1), krn_padding, dilation = (2,2) and ReLU_Gen.
+    {"Test 5 Conv FX16 Dil+Pad",  mli_krn_conv2d_hwcn_fx16, nullptr,
+                                  conv::input_1_fx16, &conv::weights_4_memstr_fx16, &conv::bias_1_fx16,
+                                  conv::test_9_out_fx16, &conv::test_9_cfg, nullptr, 700,
+                                  thresholds_conv_fx16_general, test_5_chksum_conv_fx16},
+    {"Test 5 Conv SA8 Dil+Pad",   mli_krn_conv2d_hwcn_sa8_sa8_sa32, nullptr,
+                                  conv::input_1_sa8, &conv::weights_4_memstr_sa8, &conv::bias_1_w4_sa32,
+                                  conv::test_9_out_sa8, &conv::test_9_cfg, nullptr, 356,
+                                  thresholds_conv_sa8_general, test_5_chksum_conv_sa8},
+
+    // Maxpool kernel_size=(4, 3), strides=(1, 1), w/o padding
+    {"Test 6 Pool FX16",  nullptr, mli_krn_maxpool_hwc_fx16,
+                          pool::input_1_fx16, nullptr, nullptr, pool::test_1_out_fx16,
+                          nullptr, &pool::test_1_cfg, 504,
+                          thresholds_pool_fx16_general, test_6_chksum_pool_fx16},
+    {"Test 6 Pool SA8",   nullptr, mli_krn_maxpool_hwc_sa8,
+                          pool::input_1_sa8, nullptr, nullptr, pool::test_1_out_sa8,
+                          nullptr, &pool::test_1_cfg, 252,
+                          thresholds_pool_sa8_general, test_6_chksum_pool_sa8},
+
+    // Maxpool kernel_size=(3, 4), strides=(2, 2), with krn_padding
+    {"Test 7 Pool FX16 Str",  nullptr, mli_krn_maxpool_hwc_fx16,
+                              pool::input_1_fx16, nullptr, nullptr, pool::test_2_out_fx16,
+                              nullptr, &pool::test_2_cfg, 708,
+                              thresholds_pool_fx16_general, test_7_chksum_pool_fx16},
+    {"Test 7 Pool SA8 Str",   nullptr, mli_krn_maxpool_hwc_sa8,
+                              pool::input_1_sa8, nullptr, nullptr, pool::test_2_out_sa8,
+                              nullptr, &pool::test_2_cfg, 360,
+                              thresholds_pool_sa8_general, test_7_chksum_pool_sa8},
+
+    // Maxpool with memstride kernel_size=(3, 4), strides=(3, 3), with krn_padding
+    {"Test 8 Pool FX16 Memstr",  nullptr, mli_krn_maxpool_hwc_fx16,
+                                 pool::input_1_memstr_fx16, nullptr, nullptr, pool::test_3_out_fx16,
+                                 nullptr, &pool::test_3_cfg, 796,
+                                 thresholds_pool_fx16_general, test_8_chksum_pool_fx16},
+    {"Test 8 Pool SA8 Memstr",   nullptr, mli_krn_maxpool_hwc_sa8,
+                                 pool::input_1_memstr_sa8, nullptr, nullptr, pool::test_3_out_sa8,
+                                 nullptr, &pool::test_3_cfg, 404,
+                                 thresholds_pool_sa8_general, test_8_chksum_pool_sa8},
+};
+
+constexpr int kMemSize = 2247;
+constexpr int kFastMemSize = 1024;
+static int8_t scratch_mem_in[kMemSize] = { 0 };
+static int8_t scratch_mem_out[kMemSize] = { 0 };
+static W_DATA_ATTR int8_t scratch_mem_w[kMemSize] = { 0 };
+static W_DATA_ATTR int8_t scratch_mem_b[kMemSize] = { 0 };
+alignas(4) static IO_DATA_ATTR int8_t fast_mem[kFastMemSize] = { 0 };
+
+constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
+
+int main() {
+    const reporter_full reporter;
+    bool final_status = true;
+
+    reporter.report_header("MLI|Kernels|Tiled Layer Executor Tests");
+    mli_mov_set_num_dma_ch(0, 1);
+    // All cases are repeated with the only channel taken by the test,
+    // so that input tiles are loaded without background prefetch.
+    const char* pass_suffix[] = {"", " NoCh"};
+    constexpr int kPassesNum = sizeof(pass_suffix) / sizeof(pass_suffix[0]);
+    for (int test_idx = 0; test_idx < kPassesNum * kTestsNum; ++test_idx) {
+        const int i = test_idx % kTestsNum;
+        const int pass = test_idx / kTestsNum;
+        char descr[64];
+        memory_manager mem_in_keeper((int8_t*)(scratch_mem_in), sizeof(scratch_mem_in));
+        memory_manager mem_out_keeper((int8_t*)(scratch_mem_out), sizeof(scratch_mem_out));
+        memory_manager mem_w_keeper((int8_t*)(scratch_mem_w), sizeof(scratch_mem_w));
+        memory_manager mem_b_keeper((int8_t*)(scratch_mem_b), sizeof(scratch_mem_b));
+        bool is_test_passed = true;
+        const tiling_test_operands* cur_test = &tests_list[i];
+        const bool is_conv = cur_test->conv2d != nullptr;
+        quality_metrics test_metics;
+        snprintf(descr, sizeof(descr), "%s%s", cur_test->descr, pass_suffix[pass]);
+
+        if (!(cur_test->in.is_valid() && cur_test->out.is_valid() &&
+                (!is_conv || (cur_test->weights->is_valid() && cur_test->bias->is_valid())))) {
+            reporter.report_message(descr, "FAILED at init: Bad source data for one of tensors");
+            is_test_passed = false;
+        }
+
+        mli_tensor input = cur_test->in.get_quantized_tensor(mem_in_keeper.allocate_memory(cur_test->in));
+        mli_tensor out = cur_test->out.get_not_quantized_tensor(mem_out_keeper.allocate_memory(cur_test->out));
+        mli_tensor weights = { 0 };
+        mli_tensor bias = { 0 };
+        if (is_conv) {
+            weights = cur_test->weights->get_quantized_tensor(mem_w_keeper.allocate_memory(*cur_test->weights));
+            bias = cur_test->bias->get_quantized_tensor(mem_b_keeper.allocate_memory(*cur_test->bias));
+        }
+        if (is_test_passed &&
+                (tensor_quantizer::validate_tensor(input) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(out) != tensor_quantizer::kOk ||
+                 (is_conv && (tensor_quantizer::validate_tensor(weights) != tensor_quantizer::kOk ||
+                              tensor_quantizer::validate_tensor(bias) != tensor_quantizer::kOk)))) {
+            reporter.report_message(descr,
+                                    "FAILED at quantization step: more memory for one of tensors might be required");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                (mem_in_keeper.is_memory_corrupted() || mem_out_keeper.is_memory_corrupted() ||
+                mem_w_keeper.is_memory_corrupted() || mem_b_keeper.is_memory_corrupted())) {
+            reporter.report_message(descr,
+                "FAILED at quantization step: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        const mli_tile_layer layer = {cur_test->conv2d, cur_test->pool, &weights, &bias,
+                                      cur_test->conv_cfg, cur_test->pool_cfg};
+        mli_tile_plan plan = { 0 };
+        plan.fast_mem = fast_mem;
+        plan.fast_mem_size = cur_test->fast_mem_size;
+        if (is_test_passed &&
+                mli_tile_prepare(&layer, &input, &out, &plan) != MLI_STATUS_OK) {
+            reporter.report_message(descr, "FAILED at plan preparation: function returned bad status");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed && plan.num_tiles < 2) {
+            reporter.report_message(descr, "FAILED at plan preparation: layer isn't split into tiles");
+            is_test_passed = false;
+        }
+
+        mli_mov_handle_t busy_ch = { 0 };
+        if (is_test_passed && pass == 1 && mli_mov_acquire_handle(1, &busy_ch) != MLI_STATUS_OK) {
+            reporter.report_message(descr, "FAILED at init: dma channel isn't available");
+            is_test_passed = false;
+        }
+
+        // Run tiled layer for test
+        if (is_test_passed &&
+                mli_tile_run(&layer, &plan, &input, &out) != MLI_STATUS_OK) {
+            reporter.report_message(descr, "FAILED at kernel run: kernel returned bad status");
+            is_test_passed = false;
+        }
+        if (pass == 1) {
+            mli_mov_release_handle(&busy_ch);
+        }
+
+        if (is_test_passed &&
+                (mem_in_keeper.is_memory_corrupted() || mem_out_keeper.is_memory_corrupted() ||
+                mem_w_keeper.is_memory_corrupted() || mem_b_keeper.is_memory_corrupted())) {
+            reporter.report_message(descr,
+                "FAILED after kernel run: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                test_metics.calculate_metrics(out, cur_test->out) == false) {
+            reporter.report_message(descr, "FAILED at comparison output with reference");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed) {
+            crc32_calc data_crc;
+            data_crc(input);
+            if (is_conv) {
+                data_crc(weights);
+                data_crc(bias);
+            }
+            data_crc(out);
+            is_test_passed &= reporter.evaluate_and_report_case(descr, test_metics, cur_test->threshold,
+                                                                data_crc, cur_test->check_sum);
+        }
+        final_status &= is_test_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_krn_tiling", final_status);
+
+    return (final_status) ? 0 : 1;
+}
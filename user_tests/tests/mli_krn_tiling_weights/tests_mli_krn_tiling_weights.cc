@@ -0,0 +1,335 @@
+/*
+* Copyright 2021, Synopsys, Inc.
+* All rights reserved.
+*
+* This source code is licensed under the BSD-3-Clause license found in
+* the LICENSE file in the root directory of this source tree.
+*
+*/
+
+#include "mli_api.h"
+#include "mli_config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_crc32_calc.h"
+#include "test_memory_manager.h"
+#include "test_quality_metrics.h"
+#include "mli_types.h"
+#include "test_tensor_quantizer.h"
+#include "test_report.h"
+
+// Weight streaming must give bit exact results of the kernel itself,
+// so vectors and checksums of fully connected and convolution tests are reused.
+namespace fc {
+#include "../mli_krn_fully_connected/vectors_mli_krn_fully_connected.inc"
+}
+// Descriptor macros are shared by names between vector files
+#undef INPUT_1_TSR_SHARED_DESCR
+#undef INPUT_2_TSR_SHARED_DESCR
+#undef WEIGHTS_1_TSR_SHARED_DESCR
+#undef WEIGHTS_2_TSR_SHARED_DESCR
+#undef WEIGHTS_2_MEMSTR_TSR_SHARED_DESCR
+#undef BIAS_1_TSR_SHARED_DESCR
+#undef BIAS_2_TSR_SHARED_DESCR
+#undef TEST_1_OUT_TSR_SHARED_DESCR
+#undef TEST_2_OUT_TSR_SHARED_DESCR
+#undef TEST_3_OUT_TSR_SHARED_DESCR
+#undef TEST_4_OUT_TSR_SHARED_DESCR
+#undef TEST_5_OUT_TSR_SHARED_DESCR
+namespace conv {
+#include "../mli_krn_conv2d/vectors_mli_krn_conv2d.inc"
+}
+
+using mli::tst::tensor_quantizer;
+using mli::tst::quality_metrics;
+using mli::tst::crc32_calc;
+using mli::tst::reporter_full;
+using mli::tst::memory_manager;
+
+struct tiling_weights_test_operands {
+    const char* descr;
+    const mli_tile_fc_fn fully_connected;
+    const mli_tile_conv2d_fn conv2d;
+    tensor_quantizer in;
+    tensor_quantizer weights;
+    tensor_quantizer bias;
+    tensor_quantizer out;
+    const mli_fully_connected_cfg* fc_cfg;
+    const mli_conv2d_cfg* conv_cfg;
+    const uint32_t fast_mem_size;
+    const quality_metrics threshold;
+    const crc32_calc check_sum;
+};
+
+// Checksums of test tensors for various mli calculations mode.
+// When developer finished implementation of kernel and consider it as ok, He need to populate
+// proper checksums for tests in order to highlight any change which affects results.
+#if defined(CRC_RM_CONVERGENT) || defined(CRC_RM_UP)
+// Shared CRC Results
+const crc32_calc test_1_chksum_fc_fx16{ 0x933AC67B }, test_1_chksum_fc_fx16_fx8_fx8{ 0x73D433B0 }, test_1_chksum_fc_sa8{ 0x313DB9AC },
+                 test_2_chksum_fc_fx16{ 0xB5E17BAF }, test_2_chksum_fc_fx16_fx8_fx8{ 0xD1D009B6 }, test_2_chksum_fc_sa8{ 0xDA985432 },
+                 test_3_chksum_fc_fx16{ 0x4BCFDBF2 }, test_3_chksum_fc_fx16_fx8_fx8{ 0x923FDE15 }, test_3_chksum_fc_sa8{ 0x33950BC3 },
+                 test_4_chksum_fc_fx16{ 0x0231B226 }, test_4_chksum_fc_fx16_fx8_fx8{ 0x0EC859C8 }, test_4_chksum_fc_sa8{ 0xCBDD6577 },
+                 test_5_chksum_conv_fx16{ 0x3669E8DA }, test_5_chksum_conv_sa8{ 0xA3FFD976 },
+                 test_6_chksum_conv_fx16{ 0x987AC0A8 }, test_6_chksum_conv_sa8{ 0x056EDB56 },
+                 test_7_chksum_conv_fx16{ 0xD8CA1273 }, test_7_chksum_conv_sa8{ 0x01D390FA },
+                 test_8_chksum_conv_fx16{ 0x150A5D20 };
+// Platform Specific CRC Results
+#if defined(CRC_RM_UP)
+const crc32_calc test_8_chksum_conv_sa8{ 0x36699F43 };
+#else
+const crc32_calc test_8_chksum_conv_sa8{ 0x2BA3EA5D };
+#endif
+#else // Not defined CRC_*
+const crc32_calc test_1_chksum_fc_fx16, test_1_chksum_fc_fx16_fx8_fx8, test_1_chksum_fc_sa8,
+                 test_2_chksum_fc_fx16, test_2_chksum_fc_fx16_fx8_fx8, test_2_chksum_fc_sa8,
+                 test_3_chksum_fc_fx16, test_3_chksum_fc_fx16_fx8_fx8, test_3_chksum_fc_sa8,
+                 test_4_chksum_fc_fx16, test_4_chksum_fc_fx16_fx8_fx8, test_4_chksum_fc_sa8,
+                 test_5_chksum_conv_fx16, test_5_chksum_conv_sa8,
+                 test_6_chksum_conv_fx16, test_6_chksum_conv_sa8,
+                 test_7_chksum_conv_fx16, test_7_chksum_conv_sa8,
+                 test_8_chksum_conv_fx16, test_8_chksum_conv_sa8;
+#endif
+
+const quality_metrics thresholds_fx16_general { quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                /* SNR_DB = */70.f, quality_metrics::kPassValueQuantErrPerc };
+
+const quality_metrics thresholds_fx16_fx8_fx8_general{ quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                       /* SNR_DB = */30.f, quality_metrics::kPassValueQuantErrPerc };
+
+const quality_metrics thresholds_fc_sa8_general{ quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                 /* SNR_DB = */35.f, quality_metrics::kPassValueQuantErrPerc };
+
+const quality_metrics thresholds_conv_sa8_general{ quality_metrics::kPassValueMaxAbsErr, quality_metrics::kPassValueSnr,
+                                                   /* SNR_DB = */35.f, /*Quant Error Perc = */40.f };
+
+// Fast memory sizes are chosen to split weights into several chunks
+static const tiling_weights_test_operands tests_list[] = {
+    // Fully connected with per-axis quantized weights, 10 output channels in chunks of 4
+    {"Test 1 FC FX16",          mli_krn_fully_connected_fx16, nullptr,
+                                fc::input_1_fx16, fc::weights_1_fx16, fc::bias_1_fx16, fc::test_1_out_fx16,
+                                &fc::test_1_cfg, nullptr, 256,
+                                thresholds_fx16_general, test_1_chksum_fc_fx16},
+    {"Test 1 FC FX16_FX8_FX8",  mli_krn_fully_connected_fx16_fx8_fx8, nullptr,
+                                fc::input_1_fx16, fc::weights_1_fx8, fc::bias_1_fx8, fc::test_1_out_fx16,
+                                &fc::test_1_cfg, nullptr, 128,
+                                thresholds_fx16_fx8_fx8_general, test_1_chksum_fc_fx16_fx8_fx8},
+    {"Test 1 FC SA8_SA8_SA32",  mli_krn_fully_connected_sa8_sa8_sa32, nullptr,
+                                fc::input_1_sa8, fc::weights_1_sa8_per_axis, fc::bias_1_sa32_per_axis, fc::test_1_out_sa8,
+                                &fc::test_1_cfg, nullptr, 128,
+                                thresholds_fc_sa8_general, test_1_chksum_fc_sa8},
+
+    // Fully connected with weights memstride, 8 output channels in chunks of 3
+    {"Test 2 FC FX16 Mstr",         mli_krn_fully_connected_fx16, nullptr,
+                                    fc::input_1_fx16, fc::weights_2_memstr_fx16, fc::bias_2_fx16, fc::test_3_out_fx16,
+                                    &fc::test_3_cfg, nullptr, 192,
+                                    thresholds_fx16_general, test_2_chksum_fc_fx16},
+    {"Test 2 FC FX16_FX8_FX8 Mstr", mli_krn_fully_connected_fx16_fx8_fx8, nullptr,
+                                    fc::input_1_fx16, fc::weights_2_memstr_fx8, fc::bias_2_fx8, fc::test_3_out_fx16,
+                                    &fc::test_3_cfg, nullptr, 96,
+                                    thresholds_fx16_fx8_fx8_general, test_2_chksum_fc_fx16_fx8_fx8},
+    {"Test 2 FC SA8_SA8_SA32 Mstr", mli_krn_fully_connected_sa8_sa8_sa32, nullptr,
+                                    fc::input_1_sa8, fc::weights_2_memstr_sa8_per_axis, fc::bias_2_i1_w2_sa32_per_axis,
+                                    fc::test_3_out_sa8, &fc::test_3_cfg, nullptr, 96,
+                                    thresholds_fc_sa8_general, test_2_chksum_fc_sa8},
+
+    // Fully connected with multidimensional input, 8 output channels in chunks of 3
+    {"Test 3 FC FX16 Multidim",         mli_krn_fully_connected_fx16, nullptr,
+                                        fc::input_2_fx16, fc::weights_3_fx16, fc::bias_3_fx16, fc::test_4_out_fx16,
+                                        &fc::test_4_cfg, nullptr, 288,
+                                        thresholds_fx16_general, test_3_chksum_fc_fx16},
+    {"Test 3 FC FX16_FX8_FX8 Multidim", mli_krn_fully_connected_fx16_fx8_fx8, nullptr,
+                                        fc::input_2_fx16, fc::weights_3_fx8, fc::bias_3_fx8, fc::test_4_out_fx16,
+                                        &fc::test_4_cfg, nullptr, 144,
+                                        thresholds_fx16_fx8_fx8_general, test_3_chksum_fc_fx16_fx8_fx8},
+    {"Test 3 FC SA8_SA8_SA32 Multidim", mli_krn_fully_connected_sa8_sa8_sa32, nullptr,
+                                        fc::input_2_sa8, fc::weights_3_sa8_per_axis, fc::bias_3_i2_w3_sa32_per_axis,
+                                        fc::test_4_out_sa8, &fc::test_4_cfg, nullptr, 144,
+                                        thresholds_fc_sa8_general, test_3_chksum_fc_sa8},
+
+    // Fully connected with per-tensor quantized huge values, 7 output channels in chunks of 2
+    {"Test 4 FC FX16 Huge Vals",         mli_krn_fully_connected_fx16, nullptr,
+                                         fc::input_3_fx16, fc::weights_4_fx16, fc::bias_4_fx16, fc::test_5_out_fx16,
+                                         &fc::test_5_cfg, nullptr, 288,
+                                         thresholds_fx16_general, test_4_chksum_fc_fx16},
+    {"Test 4 FC FX16_FX8_FX8 Huge Vals", mli_krn_fully_connected_fx16_fx8_fx8, nullptr,
+                                         fc::input_3_fx16, fc::weights_4_fx8, fc::bias_4_fx8, fc::test_5_out_fx16,
+                                         &fc::test_5_cfg, nullptr, 144,
+                                         thresholds_fx16_fx8_fx8_general, test_4_chksum_fc_fx16_fx8_fx8},
+    {"Test 4 FC SA8_SA8_SA32 Huge Vals", mli_krn_fully_connected_sa8_sa8_sa32, nullptr,
+                                         fc::input_3_sa8, fc::weights_4_sa8, fc::bias_4_i3_w4_sa32, fc::test_5_out_sa8,
+                                         &fc::test_5_cfg, nullptr, 144,
+                                         thresholds_fc_sa8_general, test_4_chksum_fc_sa8},
+
+    // Conv2d with per-axis quantized weights, 7 output channels in chunks of 3
+    {"Test 5 Conv FX16",  nullptr, mli_krn_conv2d_hwcn_fx16,
+                          conv::input_1_fx16, conv::weights_1_fx16, conv::bias_1_fx16, conv::test_1_out_fx16,
+                          nullptr, &conv::test_1_cfg, 432,
+                          thresholds_fx16_general, test_5_chksum_conv_fx16},
+    {"Test 5 Conv SA8",   nullptr, mli_krn_conv2d_hwcn_sa8_sa8_sa32,
+                          conv::input_1_sa8, conv::weights_1_sa8, conv::bias_1_sa32, conv::test_1_out_sa8,
+                          nullptr, &conv::test_1_cfg, 216,
+                          thresholds_conv_sa8_general, test_5_chksum_conv_sa8},
+
+    // Conv2d with input/output memstride, 7 output channels in chunks of 3
+    {"Test 6 Conv FX16 IO_Memstr",  nullptr, mli_krn_conv2d_hwcn_fx16,
+                                    conv::input_1_memstr_fx16, conv::weights_1_fx16, conv::bias_1_fx16,
+                                    conv::test_4_out_fx16, nullptr, &conv::test_4_cfg, 432,
+                                    thresholds_fx16_general, test_6_chksum_conv_fx16},
+    {"Test 6 Conv SA8 IO_Memstr",   nullptr, mli_krn_conv2d_hwcn_sa8_sa8_sa32,
+                                    conv::input_1_memstr_sa8, conv::weights_1_sa8, conv::bias_1_sa32,
+                                    conv::test_4_out_sa8, nullptr, &conv::test_4_cfg, 216,
+                                    thresholds_conv_sa8_general, test_6_chksum_conv_sa8},
+
+    // Conv2d with weights memstride, 7 output channels in chunks of 3
+    {"Test 7 Conv FX16 W_Memstr",  nullptr, mli_krn_conv2d_hwcn_fx16,
+                                   conv::input_1_fx16, conv::weights_2_memstr_fx16, conv::bias_1_fx16,
+                                   conv::test_5_out_fx16, nullptr, &conv::test_5_cfg, 432,
+                                   thresholds_fx16_general, test_7_chksum_conv_fx16},
+    {"Test 7 Conv SA8 W_Memstr",   nullptr, mli_krn_conv2d_hwcn_sa8_sa8_sa32,
+                                   conv::input_1_sa8, conv::weights_2_memstr_sa8, conv::bias_1_w2_sa32,
+                                   conv::test_5_out_sa8, nullptr, &conv::test_5_cfg, 216,
+                                   thresholds_conv_sa8_general, test_7_chksum_conv_sa8},
+
+    // Pointwise conv2d (1x1 kernel) with weights memstride, 7 output channels in chunks of 3 and 4
+    {"Test 8 Conv FX16 k1x1",  nullptr, mli_krn_conv2d_hwcn_fx16_k1x1,
+                               conv::input_1_fx16, conv::weights_3_memstr_fx16, conv::bias_1_fx16,
+                               conv::test_6_out_fx16, nullptr, &conv::test_6_cfg, 40,
+                               thresholds_fx16_general, test_8_chksum_conv_fx16},
+    {"Test 8 Conv SA8 k1x1",   nullptr, mli_krn_conv2d_hwcn_sa8_sa8_sa32_k1x1,
+                               conv::input_1_sa8, conv::weights_3_memstr_sa8, conv::bias_1_w3_sa32,
+                               conv::test_6_out_sa8, nullptr, &conv::test_6_cfg, 24,
+                               thresholds_conv_sa8_general, test_8_chksum_conv_sa8},
+};
+
+constexpr int kMemSize = 2247;
+constexpr int kFastMemSize = 512;
+static int8_t scratch_mem_in[kMemSize] = { 0 };
+static int8_t scratch_mem_out[kMemSize] = { 0 };
+static int8_t scratch_mem_w[kMemSize] = { 0 };
+static W_DATA_ATTR int8_t scratch_mem_b[kMemSize] = { 0 };
+alignas(4) static W_DATA_ATTR int8_t fast_mem[kFastMemSize] = { 0 };
+
+constexpr int kTestsNum = sizeof(tests_list) / sizeof(tests_list[0]);
+
+int main() {
+    const reporter_full reporter;
+    bool final_status = true;
+
+    reporter.report_header("MLI|Kernels|Weight Streaming Tests");
+    mli_mov_set_num_dma_ch(0, 1);
+    // All cases are repeated with the only channel taken by the test,
+    // so that weights chunks are loaded without background prefetch.
+    const char* pass_suffix[] = {"", " NoCh"};
+    constexpr int kPassesNum = sizeof(pass_suffix) / sizeof(pass_suffix[0]);
+    for (int test_idx = 0; test_idx < kPassesNum * kTestsNum; ++test_idx) {
+        const int i = test_idx % kTestsNum;
+        const int pass = test_idx / kTestsNum;
+        char descr[64];
+        memory_manager mem_in_keeper((int8_t*)(scratch_mem_in), sizeof(scratch_mem_in));
+        memory_manager mem_out_keeper((int8_t*)(scratch_mem_out), sizeof(scratch_mem_out));
+        memory_manager mem_w_keeper((int8_t*)(scratch_mem_w), sizeof(scratch_mem_w));
+        memory_manager mem_b_keeper((int8_t*)(scratch_mem_b), sizeof(scratch_mem_b));
+        bool is_test_passed = true;
+        const tiling_weights_test_operands* cur_test = &tests_list[i];
+        quality_metrics test_metics;
+        snprintf(descr, sizeof(descr), "%s%s", cur_test->descr, pass_suffix[pass]);
+
+        if (!(cur_test->in.is_valid() && cur_test->weights.is_valid() &&
+                cur_test->bias.is_valid() && cur_test->out.is_valid())) {
+            reporter.report_message(descr, "FAILED at init: Bad source data for one of tensors");
+            is_test_passed = false;
+        }
+
+        mli_tensor input = cur_test->in.get_quantized_tensor(mem_in_keeper.allocate_memory(cur_test->in));
+        mli_tensor weights = cur_test->weights.get_quantized_tensor(mem_w_keeper.allocate_memory(cur_test->weights));
+        mli_tensor bias = cur_test->bias.get_quantized_tensor(mem_b_keeper.allocate_memory(cur_test->bias));
+        mli_tensor out = cur_test->out.get_not_quantized_tensor(mem_out_keeper.allocate_memory(cur_test->out));
+        if (is_test_passed &&
+                (tensor_quantizer::validate_tensor(input) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(weights) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(bias) != tensor_quantizer::kOk ||
+                 tensor_quantizer::validate_tensor(out) != tensor_quantizer::kOk)) {
+            reporter.report_message(descr,
+                                    "FAILED at quantization step: more memory for one of tensors might be required");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                (mem_in_keeper.is_memory_corrupted() || mem_out_keeper.is_memory_corrupted() ||
+                mem_w_keeper.is_memory_corrupted() || mem_b_keeper.is_memory_corrupted())) {
+            reporter.report_message(descr,
+                "FAILED at quantization step: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        mli_tile_layer layer = { 0 };
+        layer.conv2d = cur_test->conv2d;
+        layer.fully_connected = cur_test->fully_connected;
+        layer.weights = &weights;
+        layer.bias = &bias;
+        layer.conv_cfg = cur_test->conv_cfg;
+        layer.fc_cfg = cur_test->fc_cfg;
+        mli_tile_weights_plan plan = { 0 };
+        plan.fast_mem = fast_mem;
+        plan.fast_mem_size = cur_test->fast_mem_size;
+        if (is_test_passed &&
+                mli_tile_weights_prepare(&layer, &input, &out, &plan) != MLI_STATUS_OK) {
+            reporter.report_message(descr, "FAILED at plan preparation: function returned bad status");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed && plan.num_chunks < 2) {
+            reporter.report_message(descr, "FAILED at plan preparation: weights aren't split into chunks");
+            is_test_passed = false;
+        }
+
+        mli_mov_handle_t busy_ch = { 0 };
+        if (is_test_passed && pass == 1 && mli_mov_acquire_handle(1, &busy_ch) != MLI_STATUS_OK) {
+            reporter.report_message(descr, "FAILED at init: dma channel isn't available");
+            is_test_passed = false;
+        }
+
+        // Run layer with streamed weights for test
+        if (is_test_passed &&
+                mli_tile_weights_run(&layer, &plan, &input, &out) != MLI_STATUS_OK) {
+            reporter.report_message(descr, "FAILED at kernel run: kernel returned bad status");
+            is_test_passed = false;
+        }
+        if (pass == 1) {
+            mli_mov_release_handle(&busy_ch);
+        }
+
+        if (is_test_passed &&
+                (mem_in_keeper.is_memory_corrupted() || mem_out_keeper.is_memory_corrupted() ||
+                mem_w_keeper.is_memory_corrupted() || mem_b_keeper.is_memory_corrupted())) {
+            reporter.report_message(descr,
+                "FAILED after kernel run: memory beside one of operands is corrupted");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed &&
+                test_metics.calculate_metrics(out, cur_test->out) == false) {
+            reporter.report_message(descr, "FAILED at comparison output with reference");
+            is_test_passed = false;
+        }
+
+        if (is_test_passed) {
+            crc32_calc data_crc;
+            data_crc(input);
+            data_crc(weights);
+            data_crc(bias);
+            data_crc(out);
+            is_test_passed &= reporter.evaluate_and_report_case(descr, test_metics, cur_test->threshold,
+                                                                data_crc, cur_test->check_sum);
+        }
+        final_status &= is_test_passed;
+    }
+
+    reporter.report_outline("[AUTO] Group: mli_krn_tiling_weights", final_status);
+
+    return (final_status) ? 0 : 1;
+}
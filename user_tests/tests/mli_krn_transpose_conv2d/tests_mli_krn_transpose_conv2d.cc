@@ -19,6 +19,7 @@
 #include "test_quality_metrics.h"
 #include "mli_types.h"
 #include "test_tensor_quantizer.h"
+#include "test_tensor_utils.h"
 #include "test_report.h"
 
 #include "vectors_mli_krn_transpose_conv2d.inc"
@@ -29,6 +30,7 @@ using mli::tst::quality_metrics;
 using mli::tst::crc32_calc;
 using mli::tst::reporter_full;
 using mli::tst::memory_manager;
+using mli::tst::run_batch_of_two;
 
 typedef mli_status(*transpose_conv2d_func_ptr)(
     const mli_tensor* /*input*/,
@@ -37,6 +39,32 @@ typedef mli_status(*transpose_conv2d_func_ptr)(
     const mli_conv2d_cfg* /*cfg*/,
     mli_tensor* /*output*/);
 
+// Batched versions of kernels: input is replicated into rank-4 tensor of two items processed by one call.
+// Both output items must be bit exact with the rank-3 kernel, the first one is checked as output of the test.
+constexpr int kBatchMemSize = 2 * 3047;
+static IO_DATA_ATTR int8_t batch_mem_in[kBatchMemSize] = { 0 };
+static IO_DATA_ATTR int8_t batch_mem_out[kBatchMemSize] = { 0 };
+
+static mli_status transpose_conv2d_batch_of_two(transpose_conv2d_func_ptr func, const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    return run_batch_of_two([=](const mli_tensor* in_batch, mli_tensor* out_batch) {
+        return func(in_batch, weights, bias, cfg, out_batch);
+    }, in, out, batch_mem_in, batch_mem_out);
+}
+
+static mli_status mli_krn_transpose_conv2d_hwcn_fx16_batch_threads(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    mli_hlp_set_num_threads(3);
+    mli_status ret = transpose_conv2d_batch_of_two(mli_krn_transpose_conv2d_hwcn_fx16, in, weights, bias, cfg, out);
+    mli_hlp_set_num_threads(1);
+    return ret;
+}
+
+static mli_status mli_krn_transpose_conv2d_hwcn_sa8_sa8_sa32_k4x4_str2_batch(const mli_tensor* in, const mli_tensor* weights,
+        const mli_tensor* bias, const mli_conv2d_cfg* cfg, mli_tensor* out) {
+    return transpose_conv2d_batch_of_two(mli_krn_transpose_conv2d_hwcn_sa8_sa8_sa32_k4x4_str2, in, weights, bias, cfg, out);
+}
+
 struct transpose_conv2d_test_operands {
     const char* descr;
     const transpose_conv2d_func_ptr mli_krn_transpose_conv2d;
@@ -209,7 +237,17 @@ static const transpose_conv2d_test_operands tests_list[] = {
                                      test_8_cfg, thresholds_fx16_fx8_fx8_general, test_8_chksum_fx16_fx8_fx8, mem_fill_pattern_general},
     {"Test 8 SA8_SA8_SA32 k3x3 st2", mli_krn_transpose_conv2d_hwcn_sa8_sa8_sa32, 
                                      input_1_memstr_sa8, weights_5_memstr_sa8, bias_1_i1_w5_sa32, test_8_out_sa8, test_8_cfg,
-                                     thresholds_sa8_general, test_8_chksum_sa8, mem_fill_pattern_general}
+                                     thresholds_sa8_general, test_8_chksum_sa8, mem_fill_pattern_general},
+
+    // Batch of two items in rank-4 tensors (same operands and checksums as in tests 4 and 7)
+    {"Test 9 FX16 Batch Threads IO_Memstr", mli_krn_transpose_conv2d_hwcn_fx16_batch_threads,
+                                            input_1_memstr_fx16, weights_2_fx16, bias_1_fx16, test_4_out_fx16,
+                                            test_4_cfg, thresholds_fx16_general, test_4_chksum_fx16,
+                                            mem_fill_pattern_general},
+    {"Test 9 SA8_SA8_SA32 k4x4 st2 Batch",  mli_krn_transpose_conv2d_hwcn_sa8_sa8_sa32_k4x4_str2_batch,
+                                            input_2_memstr_sa8, weights_4_memstr_sa8, bias_2_i2_w4_sa32, test_7_out_sa8,
+                                            test_7_cfg, thresholds_sa8_test3_7, test_7_chksum_sa8,
+                                            mem_fill_pattern_general}
 };
 
 constexpr int kMemIOSize = 3047;
@@ -246,7 +284,8 @@ int main() {
             strstr(cur_test->descr, "Test 6 SA8_SA8_SA32 k2x2 st2") != nullptr ||
             strstr(cur_test->descr, "Test 7 SA8_SA8_SA32 k4x4 st2") != nullptr ||
             strstr(cur_test->descr, "Test 8 FX16 k3x3 str2") != nullptr ||
-            strstr(cur_test->descr, "Test 8 SA8_SA8_SA32 k3x3 st2") != nullptr) {
+            strstr(cur_test->descr, "Test 8 SA8_SA8_SA32 k3x3 st2") != nullptr ||
+            strstr(cur_test->descr, "Test 9 SA8_SA8_SA32 k4x4 st2 Batch") != nullptr) {
             // VPX fails bitwise comparison with reference .
             reporter.report_message(cur_test->descr, "SKIPPED due to a known issue");
             continue;